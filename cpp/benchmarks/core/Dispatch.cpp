@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace core {
+
+// Per-op latency on scalar and tiny tensors, where the time is spent in
+// shape handling, allocation and kernel dispatch instead of the arithmetic.
+
+void SizeVectorCopy(benchmark::State& state) {
+    SizeVector shape{2, 3, 4, 5};
+    for (auto _ : state) {
+        SizeVector copy = shape;
+        benchmark::DoNotOptimize(copy.data());
+    }
+}
+
+void TensorEmpty(benchmark::State& state, const Device& device) {
+    for (auto _ : state) {
+        Tensor t = Tensor::Empty({4, 4}, core::Float32, device);
+        benchmark::DoNotOptimize(t.GetDataPtr());
+    }
+}
+
+void TensorView(benchmark::State& state, const Device& device) {
+    Tensor src = Tensor::Ones({4, 4}, core::Float32, device);
+    for (auto _ : state) {
+        Tensor dst = src.Slice(0, 1, 3).Reshape({4, 2}).T();
+        benchmark::DoNotOptimize(dst.GetDataPtr());
+    }
+}
+
+void ScalarAdd(benchmark::State& state, const Device& device) {
+    Tensor lhs = Tensor::Init<float>(1, device);
+    Tensor rhs = Tensor::Init<float>(2, device);
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+        cuda::Synchronize(device);
+    }
+}
+
+void SmallAdd(benchmark::State& state, const Device& device) {
+    Tensor lhs = Tensor::Ones({4, 4}, core::Float32, device);
+    Tensor rhs = Tensor::Ones({4, 4}, core::Float32, device);
+    for (auto _ : state) {
+        Tensor dst = lhs + rhs;
+        cuda::Synchronize(device);
+    }
+}
+
+void SmallAddInplace(benchmark::State& state, const Device& device) {
+    Tensor lhs = Tensor::Ones({4, 4}, core::Float32, device);
+    Tensor rhs = Tensor::Ones({4, 4}, core::Float32, device);
+    for (auto _ : state) {
+        lhs += rhs;
+        cuda::Synchronize(device);
+    }
+}
+
+void SmallBroadcastMul(benchmark::State& state, const Device& device) {
+    Tensor lhs = Tensor::Ones({4, 4}, core::Float32, device);
+    Tensor rhs = Tensor::Ones({4}, core::Float32, device);
+    for (auto _ : state) {
+        Tensor dst = lhs * rhs;
+        cuda::Synchronize(device);
+    }
+}
+
+void SmallSqrt(benchmark::State& state, const Device& device) {
+    Tensor src = Tensor::Ones({4, 4}, core::Float32, device);
+    for (auto _ : state) {
+        Tensor dst = src.Sqrt();
+        cuda::Synchronize(device);
+    }
+}
+
+void SmallSum(benchmark::State& state, const Device& device) {
+    Tensor src = Tensor::Ones({4, 4}, core::Float32, device);
+    for (auto _ : state) {
+        Tensor dst = src.Sum({1});
+        cuda::Synchronize(device);
+    }
+}
+
+void SmallMatmul(benchmark::State& state, const Device& device) {
+    Tensor lhs = Tensor::Ones({4, 4}, core::Float32, device);
+    Tensor rhs = Tensor::Ones({4, 4}, core::Float32, device);
+    for (auto _ : state) {
+        Tensor dst = lhs.Matmul(rhs);
+        cuda::Synchronize(device);
+    }
+}
+
+void SmallContiguous(benchmark::State& state, const Device& device) {
+    Tensor src = Tensor::Ones({4, 4}, core::Float32, device).T();
+    for (auto _ : state) {
+        Tensor dst = src.Contiguous();
+        cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK(SizeVectorCopy);
+
+#ifdef BUILD_CUDA_MODULE
+#define ENUM_BM_DISPATCH(FN)                     \
+    BENCHMARK_CAPTURE(FN, CPU, Device("CPU:0")); \
+    BENCHMARK_CAPTURE(FN, CUDA, Device("CUDA:0"));
+#else
+#define ENUM_BM_DISPATCH(FN) BENCHMARK_CAPTURE(FN, CPU, Device("CPU:0"));
+#endif
+
+ENUM_BM_DISPATCH(TensorEmpty)
+ENUM_BM_DISPATCH(TensorView)
+ENUM_BM_DISPATCH(ScalarAdd)
+ENUM_BM_DISPATCH(SmallAdd)
+ENUM_BM_DISPATCH(SmallAddInplace)
+ENUM_BM_DISPATCH(SmallBroadcastMul)
+ENUM_BM_DISPATCH(SmallSqrt)
+ENUM_BM_DISPATCH(SmallSum)
+ENUM_BM_DISPATCH(SmallMatmul)
+ENUM_BM_DISPATCH(SmallContiguous)
+
+}  // namespace core
+}  // namespace open3d
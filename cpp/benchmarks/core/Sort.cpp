@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+
+namespace open3d {
+namespace core {
+
+static constexpr int64_t kNumElements = 1 << 24;
+
+static Tensor RandomKeys(const Dtype& dtype, const Device& device) {
+    std::mt19937 rng(0);
+    std::vector<int32_t> values(kNumElements);
+    for (auto& value : values) {
+        value = static_cast<int32_t>(rng());
+    }
+    Tensor keys(values, {kNumElements}, Int32, device);
+    if (dtype == Float32 || dtype == Float64) {
+        return keys.To(dtype) * 1e-3;
+    }
+    return keys.To(dtype);
+}
+
+void Sort(benchmark::State& state, const Dtype& dtype, const Device& device) {
+    Tensor keys = RandomKeys(dtype, device);
+    Tensor warm_up = keys.Sort();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor sorted = keys.Sort();
+        cuda::Synchronize(device);
+    }
+}
+
+void ArgSort(benchmark::State& state,
+             const Dtype& dtype,
+             const Device& device) {
+    Tensor keys = RandomKeys(dtype, device);
+    Tensor warm_up = keys.ArgSort();
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor indices = keys.ArgSort();
+        cuda::Synchronize(device);
+    }
+}
+
+// Unique voxel coordinates of a point cloud, as in voxel downsampling.
+void UniqueRows(benchmark::State& state, const Device& device) {
+    Tensor points =
+            Tensor::Arange(0, kNumElements * 3, 1, Int64, device)
+                    .Reshape({kNumElements, 3});
+    Tensor voxels = (points * int64_t(2654435761)).To(Int32) / (1 << 26);
+    auto warm_up = core::Unique(voxels, 0);
+    (void)warm_up;
+    for (auto _ : state) {
+        auto result = core::Unique(voxels, 0);
+        cuda::Synchronize(device);
+    }
+}
+
+void SegmentReduceMean(benchmark::State& state, const Device& device) {
+    const int64_t num_segments = kNumElements / 8;
+    Tensor values = Tensor::Ones({kNumElements, 3}, Float32, device);
+    Tensor segment_ids =
+            Tensor::Arange(0, kNumElements, 1, Int64, device) / 8;
+    Tensor warm_up = core::SegmentReduce(values, segment_ids, num_segments,
+                                         SegmentReduceOp::Mean);
+    (void)warm_up;
+    for (auto _ : state) {
+        Tensor result = core::SegmentReduce(values, segment_ids, num_segments,
+                                            SegmentReduceOp::Mean);
+        cuda::Synchronize(device);
+    }
+}
+
+#define ENUM_BM_DTYPE(FN, DEVICE_NAME, DEVICE)                           \
+    BENCHMARK_CAPTURE(FN, DEVICE_NAME##_Int32, Int32, DEVICE)            \
+            ->Unit(benchmark::kMillisecond);                             \
+    BENCHMARK_CAPTURE(FN, DEVICE_NAME##_Int64, Int64, DEVICE)            \
+            ->Unit(benchmark::kMillisecond);                             \
+    BENCHMARK_CAPTURE(FN, DEVICE_NAME##_Float32, Float32, DEVICE)        \
+            ->Unit(benchmark::kMillisecond);                             \
+    BENCHMARK_CAPTURE(FN, DEVICE_NAME##_Float64, Float64, DEVICE)        \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_DTYPE(Sort, CPU, Device("CPU:0"))
+ENUM_BM_DTYPE(ArgSort, CPU, Device("CPU:0"))
+BENCHMARK_CAPTURE(UniqueRows, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReduceMean, CPU, Device("CPU:0"))
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+ENUM_BM_DTYPE(Sort, CUDA, Device("CUDA:0"))
+ENUM_BM_DTYPE(ArgSort, CUDA, Device("CUDA:0"))
+BENCHMARK_CAPTURE(UniqueRows, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(SegmentReduceMean, CUDA, Device("CUDA:0"))
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,97 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Uniformly distributed points in the unit cube.
+static geometry::PointCloud CreateRandomPointCloud(int64_t num_points) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    for (Eigen::Vector3d& point : pcd.points_) {
+        point = Eigen::Vector3d(uniform(rng), uniform(rng), uniform(rng));
+    }
+    return pcd;
+}
+
+// Arguments: number of points, number of samples, bucket size.
+static void LegacyFarthestPointDownSample(benchmark::State& state) {
+    const geometry::PointCloud pcd = CreateRandomPointCloud(state.range(0));
+    for (auto _ : state) {
+        pcd.FarthestPointDownSample(state.range(1), 0, state.range(2));
+    }
+}
+
+static void FarthestPointDownSample(benchmark::State& state,
+                                    const core::Device& device) {
+    const t::geometry::PointCloud pcd =
+            t::geometry::PointCloud::FromLegacy(
+                    CreateRandomPointCloud(state.range(0)), core::Float32,
+                    device);
+
+    // Warm up.
+    pcd.FarthestPointDownSample(state.range(1), 0, state.range(2));
+    core::cuda::Synchronize(device);
+
+    for (auto _ : state) {
+        pcd.FarthestPointDownSample(state.range(1), 0, state.range(2));
+        core::cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK(LegacyFarthestPointDownSample)
+        ->Args({1 << 18, 1 << 10, 0})
+        ->Args({1 << 18, 1 << 10, 256})
+        ->Args({1 << 21, 1 << 14, 0})
+        ->Args({1 << 21, 1 << 14, 256})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(FarthestPointDownSample, CPU, core::Device("CPU:0"))
+        ->Args({1 << 18, 1 << 10, 0})
+        ->Args({1 << 18, 1 << 10, 256})
+        ->Args({1 << 21, 1 << 14, 0})
+        ->Args({1 << 21, 1 << 14, 256})
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(FarthestPointDownSample, CUDA, core::Device("CUDA:0"))
+        ->Args({1 << 18, 1 << 10, 0})
+        ->Args({1 << 21, 1 << 14, 0})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace benchmarks
+}  // namespace open3d
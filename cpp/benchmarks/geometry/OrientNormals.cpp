@@ -0,0 +1,101 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Points on the unit sphere with randomly flipped radial normals.
+static geometry::PointCloud CreateRandomSphere(int64_t num_points) {
+    std::mt19937 rng(0);
+    std::normal_distribution<double> normal(0, 1);
+    std::bernoulli_distribution flip(0.5);
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    pcd.normals_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d(normal(rng), normal(rng), normal(rng))
+                                 .normalized();
+        pcd.normals_[i] = flip(rng) ? -pcd.points_[i] : pcd.points_[i];
+    }
+    return pcd;
+}
+
+// Arguments: number of points, number of neighbors.
+static void LegacyOrientNormalsConsistentTangentPlane(
+        benchmark::State& state) {
+    const geometry::PointCloud pcd = CreateRandomSphere(state.range(0));
+    for (auto _ : state) {
+        geometry::PointCloud oriented = pcd;
+        oriented.OrientNormalsConsistentTangentPlane(state.range(1));
+    }
+}
+
+static void OrientNormalsConsistentTangentPlane(benchmark::State& state,
+                                                const core::Device& device) {
+    const t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            CreateRandomSphere(state.range(0)), core::Float32, device);
+
+    // Warm up.
+    pcd.Clone().OrientNormalsConsistentTangentPlane(state.range(1));
+    core::cuda::Synchronize(device);
+
+    for (auto _ : state) {
+        t::geometry::PointCloud oriented = pcd.Clone();
+        oriented.OrientNormalsConsistentTangentPlane(state.range(1));
+        core::cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK(LegacyOrientNormalsConsistentTangentPlane)
+        ->Args({1 << 16, 10})
+        ->Args({1 << 20, 10})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(OrientNormalsConsistentTangentPlane,
+                  CPU,
+                  core::Device("CPU:0"))
+        ->Args({1 << 16, 10})
+        ->Args({1 << 20, 10})
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(OrientNormalsConsistentTangentPlane,
+                  CUDA,
+                  core::Device("CUDA:0"))
+        ->Args({1 << 16, 10})
+        ->Args({1 << 20, 10})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -29,6 +29,8 @@
 #include "open3d/data/Dataset.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/io/TriangleMeshIO.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/geometry/TriangleMesh.h"
 
 namespace open3d {
 namespace benchmarks {
@@ -52,7 +54,26 @@ BENCHMARK_DEFINE_F(SamplePointsFixture, Poisson)(benchmark::State& state) {
     }
 }
 
-BENCHMARK_REGISTER_F(SamplePointsFixture, Poisson)->Args({123})->Args({1000});
+BENCHMARK_REGISTER_F(SamplePointsFixture, Poisson)
+        ->Args({123})
+        ->Args({1000})
+        ->Args({100000})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(SamplePointsFixture, TensorPoisson)
+(benchmark::State& state) {
+    const t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacy(*trimesh, core::Float64);
+    for (auto _ : state) {
+        mesh.SamplePointsPoissonDisk(state.range(0));
+    }
+}
+
+BENCHMARK_REGISTER_F(SamplePointsFixture, TensorPoisson)
+        ->Args({123})
+        ->Args({1000})
+        ->Args({100000})
+        ->Unit(benchmark::kMillisecond);
 
 BENCHMARK_DEFINE_F(SamplePointsFixture, Uniform)(benchmark::State& state) {
     for (auto _ : state) {
@@ -0,0 +1,117 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/t/geometry/PointCloud.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Points on three planes and uniform noise in the unit cube.
+static geometry::PointCloud CreatePlanarScene(int64_t num_points) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    geometry::PointCloud pcd;
+    pcd.points_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        const double u = uniform(rng), v = uniform(rng);
+        switch (i % 5) {
+            case 0:
+            case 1:
+                pcd.points_[i] = Eigen::Vector3d(u, v, 0);
+                break;
+            case 2:
+                pcd.points_[i] = Eigen::Vector3d(0, u, v);
+                break;
+            case 3:
+                pcd.points_[i] = Eigen::Vector3d(u, 0, v);
+                break;
+            default:
+                pcd.points_[i] = Eigen::Vector3d(u, v, uniform(rng));
+        }
+    }
+    return pcd;
+}
+
+// Arguments: number of points, RANSAC sample size.
+static void LegacySegmentPlane(benchmark::State& state) {
+    const geometry::PointCloud pcd = CreatePlanarScene(state.range(0));
+    for (auto _ : state) {
+        pcd.SegmentPlane(0.01, state.range(1), 1000, 0.99999999, 0);
+    }
+}
+
+// Arguments: number of points, maximum number of planes.
+static void LegacySegmentPlanes(benchmark::State& state) {
+    const geometry::PointCloud pcd = CreatePlanarScene(state.range(0));
+    for (auto _ : state) {
+        pcd.SegmentPlanes(0.01, 3, 1000, state.range(1), 0, 0.99999999, 0);
+    }
+}
+
+// Arguments: number of points, RANSAC sample size.
+static void SegmentPlane(benchmark::State& state, const core::Device& device) {
+    const t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            CreatePlanarScene(state.range(0)), core::Float32, device);
+
+    // Warm up.
+    pcd.SegmentPlane(0.01, state.range(1), 1000, 0.99999999, 0);
+    core::cuda::Synchronize(device);
+
+    for (auto _ : state) {
+        pcd.SegmentPlane(0.01, state.range(1), 1000, 0.99999999, 0);
+        core::cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK(LegacySegmentPlane)
+        ->Args({1 << 16, 3})
+        ->Args({1 << 20, 3})
+        ->Args({1 << 20, 10})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(LegacySegmentPlanes)
+        ->Args({1 << 20, 3})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(SegmentPlane, CPU, core::Device("CPU:0"))
+        ->Args({1 << 16, 3})
+        ->Args({1 << 20, 3})
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SegmentPlane, CUDA, core::Device("CUDA:0"))
+        ->Args({1 << 16, 3})
+        ->Args({1 << 20, 3})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace benchmarks
+}  // namespace open3d
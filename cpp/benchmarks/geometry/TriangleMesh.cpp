@@ -73,6 +73,33 @@ BENCHMARK_CAPTURE(BenchmarkCreateFromPointCloudBallPivoting,
 
 // TODO: Add BENCHMARK for case `With Non Finite Points`.
 
+// Arguments: number of points on a Fibonacci sphere, which is split into
+// partitions that are triangulated in parallel.
+static void BenchmarkCreateFromPointCloudBallPivotingSphere(
+        benchmark::State& state) {
+    const int64_t num_points = state.range(0);
+    const double golden_angle = M_PI * (3 - std::sqrt(5.0));
+    geometry::PointCloud pcd;
+    for (int64_t i = 0; i < num_points; ++i) {
+        const double z = 1 - 2 * (i + 0.5) / num_points;
+        const double r = std::sqrt(1 - z * z);
+        pcd.points_.emplace_back(r * std::cos(golden_angle * i),
+                                 r * std::sin(golden_angle * i), z);
+    }
+    pcd.normals_ = pcd.points_;
+    const double radius = 2 * std::sqrt(4 * M_PI / num_points);
+
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivoting(pcd,
+                                                                 {radius});
+    }
+}
+
+BENCHMARK(BenchmarkCreateFromPointCloudBallPivotingSphere)
+        ->Arg(1 << 18)
+        ->Arg(1 << 21)
+        ->Unit(benchmark::kMillisecond);
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace open3d
@@ -0,0 +1,102 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/TriangleMeshDeformation.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// A sphere with about 2 * resolution^2 vertices. The vertices around the south
+// pole are fixed and the ones around the north pole are moved sideways.
+static geometry::TriangleMesh CreateSphere(
+        int resolution,
+        std::vector<int>& constraint_vertex_indices,
+        std::vector<Eigen::Vector3d>& constraint_vertex_positions) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, resolution);
+    for (int idx = 0; idx < int(mesh->vertices_.size()); ++idx) {
+        const Eigen::Vector3d& v = mesh->vertices_[idx];
+        if (v(2) < -0.8) {
+            constraint_vertex_indices.push_back(idx);
+            constraint_vertex_positions.push_back(v);
+        } else if (v(2) > 0.8) {
+            constraint_vertex_indices.push_back(idx);
+            constraint_vertex_positions.push_back(v +
+                                                  Eigen::Vector3d(0.3, 0, 0.2));
+        }
+    }
+    return *mesh;
+}
+
+// Arguments: sphere resolution, number of iterations. Includes the setup of
+// the solver.
+static void DeformAsRigidAsPossible(benchmark::State& state) {
+    std::vector<int> constraint_vertex_indices;
+    std::vector<Eigen::Vector3d> constraint_vertex_positions;
+    const geometry::TriangleMesh mesh =
+            CreateSphere(state.range(0), constraint_vertex_indices,
+                         constraint_vertex_positions);
+    mesh.GetTopology();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                mesh.DeformAsRigidAsPossible(constraint_vertex_indices,
+                                             constraint_vertex_positions,
+                                             state.range(1))
+                        ->vertices_.data());
+    }
+}
+
+// Arguments: sphere resolution, number of iterations. Reuses the
+// factorization, as in interactive editing.
+static void DeformAsRigidAsPossibleSolver(benchmark::State& state) {
+    std::vector<int> constraint_vertex_indices;
+    std::vector<Eigen::Vector3d> constraint_vertex_positions;
+    const geometry::TriangleMesh mesh =
+            CreateSphere(state.range(0), constraint_vertex_indices,
+                         constraint_vertex_positions);
+    geometry::DeformAsRigidAsPossibleSolver solver(mesh,
+                                                   constraint_vertex_indices);
+    for (auto _ : state) {
+        solver.Reset();
+        benchmark::DoNotOptimize(
+                solver.Deform(constraint_vertex_positions, state.range(1))
+                        ->vertices_.data());
+    }
+}
+
+BENCHMARK(DeformAsRigidAsPossible)
+        ->Args({64, 10})
+        ->Args({256, 10})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(DeformAsRigidAsPossibleSolver)
+        ->Args({64, 10})
+        ->Args({256, 10})
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
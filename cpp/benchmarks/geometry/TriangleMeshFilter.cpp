@@ -0,0 +1,132 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// A sphere with about 2 * resolution^2 vertices, with vertex normals and
+// colors. Resolution 2240 gives about 10M vertices.
+static geometry::TriangleMesh CreateSphere(int resolution) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, resolution);
+    mesh->ComputeVertexNormals();
+    mesh->PaintUniformColor({0.5, 0.5, 0.5});
+    return *mesh;
+}
+
+// Arguments: sphere resolution, number of iterations.
+static void LegacyFilterSmoothTaubin(benchmark::State& state) {
+    const geometry::TriangleMesh mesh = CreateSphere(state.range(0));
+    mesh.GetTopology();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                mesh.FilterSmoothTaubin(state.range(1))->vertices_.data());
+    }
+}
+
+static void FilterSmoothTaubin(benchmark::State& state,
+                               const core::Device& device) {
+    const t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacy(CreateSphere(state.range(0)),
+                                                  core::Float32, core::Int64,
+                                                  device);
+
+    // Warm up.
+    mesh.FilterSmoothTaubin(1);
+    core::cuda::Synchronize(device);
+
+    for (auto _ : state) {
+        mesh.FilterSmoothTaubin(state.range(1));
+        core::cuda::Synchronize(device);
+    }
+}
+
+// Arguments: sphere resolution, number of iterations.
+static void LegacySubdivideLoop(benchmark::State& state) {
+    const geometry::TriangleMesh mesh = CreateSphere(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                mesh.SubdivideLoop(state.range(1))->vertices_.data());
+    }
+}
+
+static void SubdivideLoop(benchmark::State& state,
+                          const core::Device& device) {
+    const t::geometry::TriangleMesh mesh =
+            t::geometry::TriangleMesh::FromLegacy(CreateSphere(state.range(0)),
+                                                  core::Float32, core::Int64,
+                                                  device);
+
+    // Warm up.
+    mesh.SubdivideLoop(1);
+    core::cuda::Synchronize(device);
+
+    for (auto _ : state) {
+        mesh.SubdivideLoop(state.range(1));
+        core::cuda::Synchronize(device);
+    }
+}
+
+BENCHMARK(LegacyFilterSmoothTaubin)
+        ->Args({256, 10})
+        ->Args({2240, 10})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(FilterSmoothTaubin, CPU, core::Device("CPU:0"))
+        ->Args({256, 10})
+        ->Args({2240, 10})
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(FilterSmoothTaubin, CUDA, core::Device("CUDA:0"))
+        ->Args({256, 10})
+        ->Args({2240, 10})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+BENCHMARK(LegacySubdivideLoop)
+        ->Args({256, 1})
+        ->Args({1024, 1})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(SubdivideLoop, CPU, core::Device("CPU:0"))
+        ->Args({256, 1})
+        ->Args({1024, 1})
+        ->Unit(benchmark::kMillisecond);
+
+#ifdef BUILD_CUDA_MODULE
+BENCHMARK_CAPTURE(SubdivideLoop, CUDA, core::Device("CUDA:0"))
+        ->Args({256, 1})
+        ->Args({1024, 1})
+        ->Unit(benchmark::kMillisecond);
+#endif
+
+}  // namespace benchmarks
+}  // namespace open3d
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshTopology.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/geometry/HalfEdgeTriangleMesh.h"
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// A sphere with about 4 * resolution^2 triangles.
+static geometry::TriangleMesh CreateSphere(int resolution) {
+    return *geometry::TriangleMesh::CreateSphere(1.0, resolution);
+}
+
+// Builds the topology from scratch in every iteration.
+static void BuildTriangleMeshTopology(benchmark::State& state) {
+    const geometry::TriangleMesh mesh = CreateSphere(state.range(0));
+    for (auto _ : state) {
+        geometry::TriangleMeshTopology topology(mesh.triangles_,
+                                                mesh.vertices_.size());
+        benchmark::DoNotOptimize(topology.NumEdges());
+    }
+}
+
+// The functions below reuse the topology cached on the mesh, so every
+// iteration measures the comparison with the cached triangles and the
+// function itself.
+static void GetEdgeToTrianglesMap(benchmark::State& state) {
+    const geometry::TriangleMesh mesh = CreateSphere(state.range(0));
+    mesh.GetTopology();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mesh.GetEdgeToTrianglesMap().size());
+    }
+}
+
+static void IsEdgeAndVertexManifold(benchmark::State& state) {
+    const geometry::TriangleMesh mesh = CreateSphere(state.range(0));
+    mesh.GetTopology();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mesh.IsEdgeManifold(false) &&
+                                 mesh.IsVertexManifold());
+    }
+}
+
+static void ClusterConnectedTriangles(benchmark::State& state) {
+    const geometry::TriangleMesh mesh = CreateSphere(state.range(0));
+    mesh.GetTopology();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(mesh.ClusterConnectedTriangles());
+    }
+}
+
+static void RemoveDuplicatedVertices(benchmark::State& state) {
+    geometry::TriangleMesh mesh = CreateSphere(state.range(0));
+    // Every vertex is duplicated once.
+    const int num_vertices = int(mesh.vertices_.size());
+    mesh.vertices_.insert(mesh.vertices_.end(), mesh.vertices_.begin(),
+                          mesh.vertices_.end());
+    for (auto& triangle : mesh.triangles_) {
+        triangle(0) += num_vertices;
+    }
+    for (auto _ : state) {
+        geometry::TriangleMesh deduplicated = mesh;
+        deduplicated.RemoveDuplicatedVertices();
+    }
+}
+
+static void CreateHalfEdgeTriangleMesh(benchmark::State& state) {
+    const geometry::TriangleMesh mesh = CreateSphere(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+                geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(mesh));
+    }
+}
+
+BENCHMARK(BuildTriangleMeshTopology)
+        ->Arg(250)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(GetEdgeToTrianglesMap)
+        ->Arg(250)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(IsEdgeAndVertexManifold)
+        ->Arg(250)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(ClusterConnectedTriangles)
+        ->Arg(250)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(RemoveDuplicatedVertices)
+        ->Arg(250)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(CreateHalfEdgeTriangleMesh)
+        ->Arg(250)
+        ->Arg(1000)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace benchmarks
+}  // namespace open3d
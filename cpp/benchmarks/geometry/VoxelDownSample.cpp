@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <unordered_map>
+
+#include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/VoxelGrid.h"
+
+namespace open3d {
+namespace benchmarks {
+
+// Uniformly distributed points with colors in the unit cube. The clouds are
+// cached, as creating 100M points takes longer than down sampling them.
+static const geometry::PointCloud& GetRandomPointCloud(int64_t num_points) {
+    static std::unordered_map<int64_t, geometry::PointCloud> pcds;
+    auto it = pcds.find(num_points);
+    if (it != pcds.end()) {
+        return it->second;
+    }
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    geometry::PointCloud& pcd = pcds[num_points];
+    pcd.points_.resize(num_points);
+    pcd.colors_.resize(num_points);
+    for (int64_t i = 0; i < num_points; ++i) {
+        pcd.points_[i] = Eigen::Vector3d(uniform(rng), uniform(rng),
+                                         uniform(rng));
+        pcd.colors_[i] = Eigen::Vector3d(uniform(rng), uniform(rng),
+                                         uniform(rng));
+    }
+    return pcd;
+}
+
+// Arguments: number of points, inverse voxel size.
+static void LegacyVoxelDownSample(benchmark::State& state) {
+    const geometry::PointCloud& pcd = GetRandomPointCloud(state.range(0));
+    const double voxel_size = 1.0 / state.range(1);
+    for (auto _ : state) {
+        pcd.VoxelDownSample(voxel_size);
+    }
+}
+
+static void LegacyVoxelDownSampleAndTrace(benchmark::State& state) {
+    const geometry::PointCloud& pcd = GetRandomPointCloud(state.range(0));
+    const double voxel_size = 1.0 / state.range(1);
+    for (auto _ : state) {
+        pcd.VoxelDownSampleAndTrace(voxel_size, pcd.GetMinBound(),
+                                    pcd.GetMaxBound());
+    }
+}
+
+static void LegacyVoxelGridFromPointCloud(benchmark::State& state) {
+    const geometry::PointCloud& pcd = GetRandomPointCloud(state.range(0));
+    const double voxel_size = 1.0 / state.range(1);
+    for (auto _ : state) {
+        geometry::VoxelGrid::CreateFromPointCloud(pcd, voxel_size);
+    }
+}
+
+#define ENUM_BM_VOXEL_SIZES(FN)        \
+    BENCHMARK(FN)                      \
+            ->Args({10000000, 100})    \
+            ->Args({10000000, 400})    \
+            ->Args({100000000, 100})   \
+            ->Args({100000000, 400})   \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_VOXEL_SIZES(LegacyVoxelDownSample)
+ENUM_BM_VOXEL_SIZES(LegacyVoxelDownSampleAndTrace)
+ENUM_BM_VOXEL_SIZES(LegacyVoxelGridFromPointCloud)
+
+}  // namespace benchmarks
+}  // namespace open3d
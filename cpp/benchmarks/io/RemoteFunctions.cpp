@@ -0,0 +1,114 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/io/rpc/RemoteFunctions.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "open3d/io/rpc/AsyncConnection.h"
+#include "open3d/io/rpc/Connection.h"
+#include "open3d/io/rpc/DummyReceiver.h"
+#include "open3d/io/rpc/ZMQContext.h"
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+#ifdef _WIN32
+static const std::string kAddress = "tcp://127.0.0.1:51455";
+#else
+static const std::string kAddress = "ipc:///tmp/open3d_benchmark_ipc";
+#endif
+
+// Streams frames of a point cloud with positions and colors to a local
+// receiver. max_in_flight == 0 uses the synchronous Connection, which waits
+// for the reply of every frame.
+static void StreamMeshData(benchmark::State& state,
+                           int max_in_flight,
+                           bool use_compression) {
+    const int64_t num_points = state.range(0);
+    // Quantized positions and constant colors, similar to depth sensor data.
+    std::vector<float> values(num_points * 3);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = (i % 1024) * 0.01f;
+    }
+    core::Tensor positions(values, {num_points, 3}, core::Float32);
+    core::Tensor colors = core::Tensor::Full({num_points, 3}, 0.5f,
+                                             core::Float32);
+    {
+        DummyReceiver receiver(kAddress, 1000);
+        receiver.Start();
+
+        std::shared_ptr<ConnectionBase> connection;
+        std::shared_ptr<AsyncConnection> async_connection;
+        if (max_in_flight > 0) {
+            async_connection = std::make_shared<AsyncConnection>(
+                    kAddress, 1000, 10000, max_in_flight, use_compression);
+            connection = async_connection;
+        } else {
+            connection = std::make_shared<Connection>(kAddress, 1000, 10000);
+        }
+
+        int time = 0;
+        for (auto _ : state) {
+            SetMeshData("points", time++, "", positions, {{"colors", colors}},
+                        core::Tensor({0}, core::Int32), {},
+                        core::Tensor({0}, core::Int32), {}, "", {}, {}, {},
+                        "", connection);
+        }
+        if (async_connection) {
+            async_connection->Flush();
+        }
+        state.SetBytesProcessed(state.iterations() * num_points * 6 *
+                                sizeof(float));
+        receiver.Stop();
+    }
+    DestroyZMQContext();
+}
+
+BENCHMARK_CAPTURE(StreamMeshData, Sync, 0, false)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(StreamMeshData, Async2, 2, false)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(StreamMeshData, Async8, 8, false)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(StreamMeshData, AsyncCompressed8, 8, true)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
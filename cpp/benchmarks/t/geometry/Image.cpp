@@ -0,0 +1,201 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/Image.h"
+
+#include <benchmark/benchmark.h>
+
+#include "benchmarks/benchmark_utilities/Rand.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/Image.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// Native kernels are called directly. The IPP variants go through the Image
+// API, which selects IPP when Open3D is built with it. Both allocate their
+// output in every iteration, as the Image API does.
+enum class ImageBackend { Native, IPP };
+
+// VGA, the resolution of the RGBD odometry inputs.
+static Image RandImage(core::Dtype dtype, int64_t channels) {
+    return Image(benchmarks::Rand({480, 640, channels}, 0, {0, 255}, dtype));
+}
+
+static bool SkipIfUnavailable(benchmark::State& state, ImageBackend backend) {
+    if (backend == ImageBackend::IPP && !Image::HAVE_IPPICV) {
+        state.SkipWithError("Open3D is not built with IPP.");
+        return true;
+    }
+    return false;
+}
+
+void Filter(benchmark::State& state,
+            ImageBackend backend,
+            core::Dtype dtype,
+            int64_t channels) {
+    if (SkipIfUnavailable(state, backend)) return;
+    Image im = RandImage(dtype, channels);
+    core::Tensor kernel = core::Tensor::Full({5, 5}, 1.0f / 25, core::Float32);
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            core::Tensor dst = core::Tensor::EmptyLike(im.AsTensor());
+            kernel::image::Filter(im.AsTensor(), dst, kernel);
+        } else {
+            im.Filter(kernel);
+        }
+    }
+}
+
+void FilterGaussian(benchmark::State& state,
+                    ImageBackend backend,
+                    core::Dtype dtype,
+                    int64_t channels) {
+    if (SkipIfUnavailable(state, backend)) return;
+    Image im = RandImage(dtype, channels);
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            core::Tensor dst = core::Tensor::EmptyLike(im.AsTensor());
+            kernel::image::FilterGaussian(im.AsTensor(), dst, 5, 1.0f);
+        } else {
+            im.FilterGaussian(5, 1.0f);
+        }
+    }
+}
+
+void FilterBilateral(benchmark::State& state,
+                     ImageBackend backend,
+                     core::Dtype dtype,
+                     int64_t channels) {
+    if (SkipIfUnavailable(state, backend)) return;
+    Image im = RandImage(dtype, channels);
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            core::Tensor dst = core::Tensor::EmptyLike(im.AsTensor());
+            kernel::image::FilterBilateral(im.AsTensor(), dst, 5, 20.0f,
+                                           10.0f);
+        } else {
+            im.FilterBilateral(5, 20.0f, 10.0f);
+        }
+    }
+}
+
+void FilterSobel(benchmark::State& state,
+                 ImageBackend backend,
+                 core::Dtype dtype,
+                 int64_t channels) {
+    if (SkipIfUnavailable(state, backend)) return;
+    Image im = RandImage(dtype, channels);
+    const core::Dtype dst_dtype =
+            dtype == core::UInt8 ? core::Int16 : core::Float32;
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            core::Tensor dx =
+                    core::Tensor::Empty(im.AsTensor().GetShape(), dst_dtype);
+            core::Tensor dy =
+                    core::Tensor::Empty(im.AsTensor().GetShape(), dst_dtype);
+            kernel::image::FilterSobel(im.AsTensor(), dx, dy, 3);
+        } else {
+            im.FilterSobel(3);
+        }
+    }
+}
+
+void Dilate(benchmark::State& state,
+            ImageBackend backend,
+            core::Dtype dtype,
+            int64_t channels) {
+    if (SkipIfUnavailable(state, backend)) return;
+    Image im = RandImage(dtype, channels);
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            core::Tensor dst = core::Tensor::EmptyLike(im.AsTensor());
+            kernel::image::Dilate(im.AsTensor(), dst, 5);
+        } else {
+            im.Dilate(5);
+        }
+    }
+}
+
+void Resize(benchmark::State& state,
+            ImageBackend backend,
+            core::Dtype dtype,
+            int64_t channels,
+            Image::InterpType interp_type) {
+    if (SkipIfUnavailable(state, backend)) return;
+    Image im = RandImage(dtype, channels);
+    for (auto _ : state) {
+        if (backend == ImageBackend::Native) {
+            core::Tensor dst = core::Tensor::Empty(
+                    {im.GetRows() / 2, im.GetCols() / 2, channels}, dtype);
+            kernel::image::Resize(im.AsTensor(), dst, interp_type);
+        } else {
+            im.Resize(0.5f, interp_type);
+        }
+    }
+}
+
+void ResizeLinear(benchmark::State& state,
+                  ImageBackend backend,
+                  core::Dtype dtype,
+                  int64_t channels) {
+    Resize(state, backend, dtype, channels, Image::InterpType::Linear);
+}
+
+void ResizeSuper(benchmark::State& state,
+                 ImageBackend backend,
+                 core::Dtype dtype,
+                 int64_t channels) {
+    Resize(state, backend, dtype, channels, Image::InterpType::Super);
+}
+
+#define ENUM_IMAGE_BACKENDS(FN, DTYPE, CHANNELS)                              \
+    BENCHMARK_CAPTURE(FN, Native_##DTYPE##_C##CHANNELS, ImageBackend::Native, \
+                      core::DTYPE, CHANNELS)                                  \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FN, IPP_##DTYPE##_C##CHANNELS, ImageBackend::IPP,       \
+                      core::DTYPE, CHANNELS)                                  \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_IMAGE_BACKENDS(Filter, UInt8, 3)
+ENUM_IMAGE_BACKENDS(Filter, Float32, 1)
+ENUM_IMAGE_BACKENDS(FilterGaussian, UInt8, 3)
+ENUM_IMAGE_BACKENDS(FilterGaussian, Float32, 1)
+ENUM_IMAGE_BACKENDS(FilterBilateral, UInt8, 3)
+ENUM_IMAGE_BACKENDS(FilterBilateral, Float32, 1)
+ENUM_IMAGE_BACKENDS(FilterSobel, UInt8, 1)
+ENUM_IMAGE_BACKENDS(FilterSobel, Float32, 1)
+ENUM_IMAGE_BACKENDS(Dilate, UInt8, 3)
+ENUM_IMAGE_BACKENDS(Dilate, Float32, 1)
+ENUM_IMAGE_BACKENDS(ResizeLinear, UInt8, 3)
+ENUM_IMAGE_BACKENDS(ResizeLinear, Float32, 1)
+ENUM_IMAGE_BACKENDS(ResizeSuper, UInt8, 3)
+ENUM_IMAGE_BACKENDS(ResizeSuper, Float32, 1)
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
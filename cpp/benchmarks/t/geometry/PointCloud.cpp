@@ -75,6 +75,31 @@ void ToLegacyPointCloud(benchmark::State& state, const core::Device& device) {
     }
 }
 
+// Fans a point cloud out to workers that only read it, or that write one
+// attribute. On the CPU, Clone() defers copying until an attribute is written.
+void ClonePointCloud(benchmark::State& state,
+                     const core::Device& device,
+                     bool write) {
+    int64_t num_points = 1000000;  // 1M
+    PointCloud pcd(device);
+    pcd.SetPointPositions(core::Tensor::Ones({num_points, 3}, core::Float32,
+                                             device));
+    pcd.SetPointNormals(core::Tensor::Ones({num_points, 3}, core::Float32,
+                                           device));
+    pcd.SetPointColors(core::Tensor::Ones({num_points, 3}, core::Float32,
+                                          device));
+
+    for (auto _ : state) {
+        for (int worker = 0; worker < 8; ++worker) {
+            PointCloud pcd_worker = pcd.Clone();
+            if (write) {
+                pcd_worker.GetPointColors().Fill(0.5);
+            }
+            core::cuda::Synchronize(device);
+        }
+    }
+}
+
 data::PLYPointCloud pointcloud_ply;
 static const std::string path = pointcloud_ply.GetPath();
 
@@ -203,12 +228,22 @@ BENCHMARK_CAPTURE(FromLegacyPointCloud, CPU, core::Device("CPU:0"))
 BENCHMARK_CAPTURE(ToLegacyPointCloud, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 
+BENCHMARK_CAPTURE(ClonePointCloud, CPU_Read, core::Device("CPU:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClonePointCloud, CPU_Write, core::Device("CPU:0"), true)
+        ->Unit(benchmark::kMillisecond);
+
 #ifdef BUILD_CUDA_MODULE
 BENCHMARK_CAPTURE(FromLegacyPointCloud, CUDA, core::Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
 
 BENCHMARK_CAPTURE(ToLegacyPointCloud, CUDA, core::Device("CUDA:0"))
         ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(ClonePointCloud, CUDA_Read, core::Device("CUDA:0"), false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ClonePointCloud, CUDA_Write, core::Device("CUDA:0"), true)
+        ->Unit(benchmark::kMillisecond);
 #endif
 
 #define ENUM_VOXELSIZE(DEVICE, BACKEND)                                       \
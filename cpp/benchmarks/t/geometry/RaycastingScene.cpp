@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include <benchmark/benchmark.h>
+
+#include "open3d/data/Dataset.h"
+#include "open3d/t/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+static TriangleMesh LoadArmadilloMesh() {
+    data::ArmadilloMesh armadillo;
+    TriangleMesh mesh;
+    t::io::ReadTriangleMesh(armadillo.GetPath(), mesh);
+    return mesh;
+}
+
+static const std::string scene_file_name =
+        utility::filesystem::GetTempDirectoryPath() +
+        "/open3d_benchmark_raycasting_scene.bin";
+
+static core::Tensor CreateQueryRays() {
+    return RaycastingScene::CreateRaysPinhole(
+            60, core::Tensor::Init<float>({0, 0, 0}),
+            core::Tensor::Init<float>({0, 0, 300}),
+            core::Tensor::Init<float>({0, 1, 0}), 8, 8);
+}
+
+// Adds the mesh to a new scene and builds the acceleration structure.
+static void BuildRaycastingScene(benchmark::State& state) {
+    TriangleMesh mesh = LoadArmadilloMesh();
+    core::Tensor rays = CreateQueryRays();
+
+    for (auto _ : state) {
+        RaycastingScene scene;
+        scene.AddTriangles(mesh);
+        scene.Commit();
+        benchmark::DoNotOptimize(scene.CastRays(rays));
+    }
+}
+
+// Restores the scene from a file written by Save() and builds the
+// acceleration structure.
+static void LoadRaycastingScene(benchmark::State& state, bool use_mmap) {
+    {
+        RaycastingScene scene;
+        scene.AddTriangles(LoadArmadilloMesh());
+        scene.Save(scene_file_name);
+    }
+    core::Tensor rays = CreateQueryRays();
+
+    for (auto _ : state) {
+        auto scene = RaycastingScene::Load(scene_file_name, use_mmap);
+        scene->Commit();
+        benchmark::DoNotOptimize(scene->CastRays(rays));
+    }
+    utility::filesystem::RemoveFile(scene_file_name);
+}
+
+// Restores the scene without building the acceleration structure.
+static void LoadRaycastingSceneGeometry(benchmark::State& state,
+                                        bool use_mmap) {
+    {
+        RaycastingScene scene;
+        scene.AddTriangles(LoadArmadilloMesh());
+        scene.Save(scene_file_name);
+    }
+
+    for (auto _ : state) {
+        auto scene = RaycastingScene::Load(scene_file_name, use_mmap);
+        benchmark::DoNotOptimize(scene);
+    }
+    utility::filesystem::RemoveFile(scene_file_name);
+}
+
+static const core::SizeVector grid_resolution = {64, 64, 64};
+
+// Computes the signed distance for the grid points as independent queries.
+static void ComputeSignedDistancePoints(benchmark::State& state) {
+    RaycastingScene scene;
+    scene.AddTriangles(LoadArmadilloMesh());
+    core::Tensor query_points = core::Tensor::Empty(
+            {grid_resolution[0], grid_resolution[1], grid_resolution[2], 3},
+            core::Float32);
+    float* query_points_ptr = query_points.GetDataPtr<float>();
+    for (int64_t i = 0; i < grid_resolution[0]; ++i) {
+        for (int64_t j = 0; j < grid_resolution[1]; ++j) {
+            for (int64_t k = 0; k < grid_resolution[2]; ++k) {
+                *query_points_ptr++ =
+                        -100 + 200 * (i + 0.5f) / grid_resolution[0];
+                *query_points_ptr++ =
+                        -100 + 200 * (j + 0.5f) / grid_resolution[1];
+                *query_points_ptr++ =
+                        -100 + 200 * (k + 0.5f) / grid_resolution[2];
+            }
+        }
+    }
+    scene.Commit();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(scene.ComputeSignedDistance(query_points));
+    }
+}
+
+// Computes the signed distance for the same points with the grid query.
+static void ComputeSignedDistanceGrid(benchmark::State& state) {
+    RaycastingScene scene;
+    scene.AddTriangles(LoadArmadilloMesh());
+    core::Tensor min_bound = core::Tensor::Init<float>({-100, -100, -100});
+    core::Tensor max_bound = core::Tensor::Init<float>({100, 100, 100});
+    scene.Commit();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(scene.ComputeSignedDistanceGrid(
+                min_bound, max_bound, grid_resolution));
+    }
+}
+
+BENCHMARK(BuildRaycastingScene)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LoadRaycastingScene, Read, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LoadRaycastingScene, MMap, true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LoadRaycastingSceneGeometry, Read, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(LoadRaycastingSceneGeometry, MMap, true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(ComputeSignedDistancePoints)->Unit(benchmark::kMillisecond);
+BENCHMARK(ComputeSignedDistanceGrid)->Unit(benchmark::kMillisecond);
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <set>
+
+#include "open3d/io/PointCloudIO.h"
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/t/geometry/PointCloud.h"
+#include "open3d/t/io/PointCloudIO.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+
+// Reads the same mesh stored as ASCII, binary little endian and binary big
+// endian PLY. ASCII files go through rply, binary files through the bulk
+// reader. Every vertex carries four float properties that no reader uses, to
+// measure how cheaply unused columns are skipped.
+enum class PLYFormat { ASCII, BinaryLittleEndian, BinaryBigEndian };
+
+static constexpr int64_t kNumVertices = 1 << 20;
+static constexpr int64_t kNumFaces = 2 * kNumVertices;
+
+static const char* GetFormatName(PLYFormat format) {
+    switch (format) {
+        case PLYFormat::ASCII:
+            return "ascii";
+        case PLYFormat::BinaryLittleEndian:
+            return "binary_little_endian";
+        default:
+            return "binary_big_endian";
+    }
+}
+
+class PLYWriter {
+public:
+    PLYWriter(const std::string& filename, PLYFormat format)
+        : out_(filename, std::ios::binary), format_(format) {}
+
+    template <typename T>
+    void Write(T value, bool last = false) {
+        if (format_ == PLYFormat::ASCII) {
+            out_ << +value << (last ? '\n' : ' ');
+            return;
+        }
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        if (format_ == PLYFormat::BinaryBigEndian) {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        out_.write(bytes, sizeof(T));
+    }
+
+    std::ofstream out_;
+    PLYFormat format_;
+};
+
+static std::string GetPLYFile(PLYFormat format) {
+    static std::set<PLYFormat> written;
+    const std::string filename = utility::filesystem::GetTempDirectoryPath() +
+                                 "/benchmark_" + GetFormatName(format) + ".ply";
+    if (written.count(format)) {
+        return filename;
+    }
+
+    PLYWriter writer(filename, format);
+    writer.out_ << "ply\nformat " << GetFormatName(format) << " 1.0\n"
+                << "element vertex " << kNumVertices << "\n"
+                << "property float x\nproperty float y\nproperty float z\n"
+                << "property float nx\nproperty float ny\nproperty float nz\n"
+                << "property uchar red\nproperty uchar green\n"
+                << "property uchar blue\n";
+    for (int k = 0; k < 4; ++k) {
+        writer.out_ << "property float unused" << k << "\n";
+    }
+    writer.out_ << "element face " << kNumFaces << "\n"
+                << "property list uchar int vertex_indices\n"
+                << "end_header\n";
+    for (int64_t i = 0; i < kNumVertices; ++i) {
+        writer.Write(float(std::sin(i * .8969920581) * 1000.));
+        writer.Write(float(std::sin(i * .3898546778) * 1000.));
+        writer.Write(float(std::sin(i * .2509962463) * 1000.));
+        writer.Write(float(std::sin(i * .4472367685)));
+        writer.Write(float(std::sin(i * .9698787116)));
+        writer.Write(float(std::sin(i * .7072878517)));
+        writer.Write(uint8_t(i % 256));
+        writer.Write(uint8_t(i * 7 % 256));
+        writer.Write(uint8_t(i * 13 % 256));
+        for (int k = 0; k < 4; ++k) {
+            writer.Write(float(k), k == 3);
+        }
+    }
+    for (int64_t i = 0; i < kNumFaces; ++i) {
+        writer.Write(uint8_t(3));
+        writer.Write(int32_t(i / 2));
+        writer.Write(int32_t((i / 2 + 1) % kNumVertices));
+        writer.Write(int32_t((i / 2 + 2 + i % 2) % kNumVertices), true);
+    }
+    writer.out_.close();
+    written.insert(format);
+    return filename;
+}
+
+void ReadLegacyPointCloudPLY(benchmark::State& state, PLYFormat format) {
+    const std::string filename = GetPLYFile(format);
+    open3d::geometry::PointCloud pcd;
+    for (auto _ : state) {
+        open3d::io::ReadPointCloud(filename, pcd,
+                                   {"auto", false, false, false});
+    }
+}
+
+void ReadLegacyTriangleMeshPLY(benchmark::State& state, PLYFormat format) {
+    const std::string filename = GetPLYFile(format);
+    open3d::geometry::TriangleMesh mesh;
+    for (auto _ : state) {
+        open3d::io::ReadTriangleMesh(filename, mesh);
+    }
+}
+
+void ReadTensorPointCloudPLY(benchmark::State& state, PLYFormat format) {
+    const std::string filename = GetPLYFile(format);
+    t::geometry::PointCloud pcd;
+    for (auto _ : state) {
+        t::io::ReadPointCloud(filename, pcd, {"auto", false, false, false});
+    }
+}
+
+#define ENUM_BM_PLY_FORMAT(FN)                                                \
+    BENCHMARK_CAPTURE(FN, ASCII, PLYFormat::ASCII)                            \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FN, BinaryLittleEndian, PLYFormat::BinaryLittleEndian) \
+            ->Unit(benchmark::kMillisecond);                                  \
+    BENCHMARK_CAPTURE(FN, BinaryBigEndian, PLYFormat::BinaryBigEndian)       \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_PLY_FORMAT(ReadLegacyPointCloudPLY)
+ENUM_BM_PLY_FORMAT(ReadLegacyTriangleMeshPLY)
+ENUM_BM_PLY_FORMAT(ReadTensorPointCloudPLY)
+
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,105 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/io/NumpyIO.h"
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// A point cloud with 2^24 points stored as positions, normals and colors,
+// about 400MB in total.
+static constexpr int64_t kNumPoints = 1 << 24;
+
+static std::string GetNpzFile() {
+    static const std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/benchmark.npz";
+    static bool written = false;
+    if (!written) {
+        core::Tensor positions =
+                core::Tensor::Ones({kNumPoints, 3}, core::Float32);
+        core::Tensor normals =
+                core::Tensor::Ones({kNumPoints, 3}, core::Float32);
+        core::Tensor colors = core::Tensor::Ones({kNumPoints, 3}, core::UInt8);
+        WriteNpz(file_name, {{"positions", positions},
+                             {"normals", normals},
+                             {"colors", colors}});
+        written = true;
+    }
+    return file_name;
+}
+
+// Returns the resident set size of this process in MiB, or 0 if unknown.
+static double GetResidentMiB() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    int64_t num_pages = 0;
+    int64_t num_resident_pages = 0;
+    if (statm >> num_pages >> num_resident_pages) {
+        return num_resident_pages * 4096.0 / (1 << 20);
+    }
+#endif
+    return 0;
+}
+
+// Loads all arrays. With reduce, every element is read once, which is where a
+// memory mapped load pays for the deferred page faults.
+static void ReadNpzFile(benchmark::State& state, bool memory_map, bool reduce) {
+    const std::string file_name = GetNpzFile();
+    double resident_mib = 0;
+    for (auto _ : state) {
+        const double resident_mib_before = GetResidentMiB();
+        std::unordered_map<std::string, core::Tensor> tensor_map =
+                ReadNpz(file_name, memory_map);
+        if (reduce) {
+            for (const auto& it : tensor_map) {
+                benchmark::DoNotOptimize(it.second.Sum({0}).GetDataPtr());
+            }
+        }
+        resident_mib = GetResidentMiB() - resident_mib_before;
+    }
+    state.counters["RSS_MiB"] = resident_mib;
+}
+
+BENCHMARK_CAPTURE(ReadNpzFile, Copy, false, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReadNpzFile, MemoryMap, true, false)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReadNpzFile, CopyAndReduce, false, true)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ReadNpzFile, MemoryMapAndReduce, true, true)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
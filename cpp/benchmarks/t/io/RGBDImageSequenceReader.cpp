@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/sensor/RGBDImageSequenceReader.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <thread>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// A VGA sequence with JPG color and PNG depth, read by a consumer that spends
+// a fixed time on each frame, standing in for odometry or integration.
+static constexpr int64_t kNumFrames = 64;
+static constexpr int64_t kProcessingTimeUs = 5000;
+
+static std::string GetSequenceDirectory() {
+    static const std::string path =
+            utility::filesystem::GetTempDirectoryPath() +
+            "/benchmark_rgbd_sequence";
+    static bool written = false;
+    if (!written) {
+        utility::filesystem::MakeDirectoryHierarchy(path + "/color");
+        utility::filesystem::MakeDirectoryHierarchy(path + "/depth");
+        for (int64_t i = 0; i < kNumFrames; ++i) {
+            // Smooth gradients with some noise, so that images do not
+            // compress to nothing.
+            core::Tensor x = core::Tensor::Arange(0, 640, 1, core::Float32)
+                                     .Reshape({1, 640, 1});
+            core::Tensor y = core::Tensor::Arange(0, 480, 1, core::Float32)
+                                     .Reshape({480, 1, 1});
+            core::Tensor noise =
+                    (x * 0.7f + y * 1.3f + float(i)).Sin() * 8.0f;
+            core::Tensor depth =
+                    (x + y * 2.0f + noise * 4.0f + 500.0f).To(core::UInt16);
+            core::Tensor color =
+                    (x * 0.2f + y * 0.3f + noise + 20.0f)
+                            .Add(core::Tensor::Init<float>({0, 40, 80}))
+                            .To(core::UInt8);
+            WriteImage(fmt::format("{}/color/{:05d}.jpg", path, i),
+                       t::geometry::Image(color));
+            WriteImage(fmt::format("{}/depth/{:05d}.png", path, i),
+                       t::geometry::Image(depth));
+        }
+        written = true;
+    }
+    return path;
+}
+
+static void ProcessFrame(const t::geometry::RGBDImage& frame) {
+    benchmark::DoNotOptimize(frame.depth_.GetDataPtr());
+    std::this_thread::sleep_for(std::chrono::microseconds(kProcessingTimeUs));
+}
+
+// Decodes each frame in the consumer loop, as with t::io::ReadImage today.
+static void ReadSequenceSynchronously(benchmark::State& state) {
+    const std::string path = GetSequenceDirectory();
+    for (auto _ : state) {
+        for (int64_t i = 0; i < kNumFrames; ++i) {
+            t::geometry::RGBDImage frame;
+            ReadImage(fmt::format("{}/color/{:05d}.jpg", path, i),
+                      frame.color_);
+            ReadImage(fmt::format("{}/depth/{:05d}.png", path, i),
+                      frame.depth_);
+            ProcessFrame(frame);
+        }
+    }
+}
+
+static void ReadSequence(benchmark::State& state) {
+    const std::string path = GetSequenceDirectory();
+    const size_t num_workers = static_cast<size_t>(state.range(0));
+    RGBDVideoReaderStatistics statistics;
+    for (auto _ : state) {
+        RGBDImageSequenceReader reader(
+                RGBDImageSequenceReader::DEFAULT_BUFFER_SIZE, num_workers);
+        reader.Open(path);
+        for (t::geometry::RGBDImage frame = reader.NextFrame();
+             !frame.IsEmpty(); frame = reader.NextFrame()) {
+            ProcessFrame(frame);
+        }
+        statistics = reader.GetStatistics();
+    }
+    state.counters["DecodeFPS"] = statistics.GetDecodeThroughput();
+    state.counters["StallMs"] = statistics.stall_time_ * 1000.0;
+}
+
+BENCHMARK(ReadSequenceSynchronously)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReadSequence)
+        ->Arg(1)
+        ->Arg(2)
+        ->Arg(4)
+        ->Arg(8)
+        ->Unit(benchmark::kMillisecond);
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
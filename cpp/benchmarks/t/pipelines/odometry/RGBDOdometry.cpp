@@ -171,6 +171,73 @@ static void RGBDOdometryMultiScale(
     }
 }
 
+// Frame-to-frame tracking over a recorded sequence. With frames, the pyramid
+// of each image is computed once and reused when the target of one pair
+// becomes the source of the next pair.
+static void RGBDOdometrySequence(benchmark::State& state,
+                                 const core::Device& device,
+                                 const t::pipelines::odometry::Method& method,
+                                 bool use_frames) {
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::vector<t::geometry::RGBDImage> rgbds;
+    for (size_t i = 0; i < redwood_data.GetDepthPaths().size(); ++i) {
+        t::geometry::RGBDImage rgbd;
+        rgbd.depth_ =
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                        ->To(device);
+        rgbd.color_ =
+                t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                        ->To(device);
+        rgbds.push_back(rgbd);
+    }
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    t::pipelines::odometry::OdometryLossParams loss(depth_diff);
+    std::vector<t::pipelines::odometry::OdometryConvergenceCriteria> criteria{
+            10, 5, 3};
+    const core::Tensor identity =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+
+    auto track = [&]() {
+        if (use_frames) {
+            t::pipelines::odometry::RGBDOdometryFrame source(
+                    rgbds[0], intrinsic_t, depth_scale, depth_max, depth_diff);
+            for (size_t i = 1; i < rgbds.size(); ++i) {
+                t::pipelines::odometry::RGBDOdometryFrame target(
+                        rgbds[i], intrinsic_t, depth_scale, depth_max,
+                        depth_diff);
+                RGBDOdometryMultiScale(source, target, identity, criteria,
+                                       method, loss);
+                source = std::move(target);
+            }
+        } else {
+            for (size_t i = 1; i < rgbds.size(); ++i) {
+                RGBDOdometryMultiScale(rgbds[i - 1], rgbds[i], intrinsic_t,
+                                       identity, depth_scale, depth_max,
+                                       criteria, method, loss);
+            }
+        }
+    };
+
+    // Warm up.
+    track();
+
+    for (auto _ : state) {
+        track();
+        core::cuda::Synchronize(device);
+    }
+    state.SetItemsProcessed(state.iterations() * (rgbds.size() - 1));
+}
+
 BENCHMARK_CAPTURE(ComputeOdometryResultPointToPlane, CPU, core::Device("CPU:0"))
         ->Unit(benchmark::kMillisecond);
 #ifdef BUILD_CUDA_MODULE
@@ -196,7 +263,27 @@ BENCHMARK_CAPTURE(RGBDOdometryMultiScale,
                   t::pipelines::odometry::Method::PointToPlane)
         ->Unit(benchmark::kMillisecond);
 
+#define ENUM_BM_SEQUENCE(DEVICE_NAME, DEVICE)                                \
+    BENCHMARK_CAPTURE(RGBDOdometrySequence, Hybrid_Images_##DEVICE_NAME,     \
+                      DEVICE, t::pipelines::odometry::Method::Hybrid, false) \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(RGBDOdometrySequence, Hybrid_Frames_##DEVICE_NAME,     \
+                      DEVICE, t::pipelines::odometry::Method::Hybrid, true)  \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(RGBDOdometrySequence,                                  \
+                      PointToPlane_Images_##DEVICE_NAME, DEVICE,             \
+                      t::pipelines::odometry::Method::PointToPlane, false)   \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(RGBDOdometrySequence,                                  \
+                      PointToPlane_Frames_##DEVICE_NAME, DEVICE,             \
+                      t::pipelines::odometry::Method::PointToPlane, true)    \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_BM_SEQUENCE(CPU, core::Device("CPU:0"))
+
 #ifdef BUILD_CUDA_MODULE
+ENUM_BM_SEQUENCE(CUDA, core::Device("CUDA:0"))
+
 BENCHMARK_CAPTURE(RGBDOdometryMultiScale,
                   Hybrid_CUDA,
                   core::Device("CUDA:0"),
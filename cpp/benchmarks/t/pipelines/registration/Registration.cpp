@@ -167,6 +167,61 @@ ENUM_ICP_METHOD_DEVICE(ColoredICP,
                        "CUDA:0")
 #endif
 
+// Point-to-plane ICP with correspondences cached between iterations. A
+// negative tolerance disables the cache, a tolerance of 0 gives the same
+// result as a full search, larger tolerances trade accuracy for speed.
+static void BenchmarkICPCorrespondenceCache(benchmark::State& state,
+                                            const core::Device& device,
+                                            const core::Dtype& dtype,
+                                            const double tolerance) {
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Error);
+    data::DemoICPPointClouds demo_icp_pointclouds;
+    geometry::PointCloud source, target;
+    std::tie(source, target) = LoadTensorPointCloudFromFile(
+            demo_icp_pointclouds.GetPaths(0), demo_icp_pointclouds.GetPaths(1),
+            /*voxel_downsampling_factor =*/0.02, dtype, device);
+
+    core::Tensor init_trans =
+            core::Tensor(initial_transform_flat, {4, 4}, core::Float32, device)
+                    .To(dtype);
+    const ICPConvergenceCriteria criteria(relative_fitness, relative_rmse,
+                                          max_iterations);
+
+    // Warm up.
+    RegistrationResult reg_result =
+            ICP(source, target, max_correspondence_distance, init_trans,
+                TransformationEstimationPointToPlane(), criteria, -1.0,
+                nullptr, tolerance);
+
+    for (auto _ : state) {
+        reg_result = ICP(source, target, max_correspondence_distance,
+                         init_trans, TransformationEstimationPointToPlane(),
+                         criteria, -1.0, nullptr, tolerance);
+        core::cuda::Synchronize(device);
+    }
+    state.counters["fitness"] = reg_result.fitness_;
+    state.counters["inlier_rmse"] = reg_result.inlier_rmse_;
+}
+
+#define ENUM_ICP_CACHE_DEVICE(DEVICE)                                        \
+    BENCHMARK_CAPTURE(BenchmarkICPCorrespondenceCache, DEVICE NoCache,       \
+                      core::Device(DEVICE), core::Float32, -1.0)             \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(BenchmarkICPCorrespondenceCache, DEVICE Exact,         \
+                      core::Device(DEVICE), core::Float32, 0.0)              \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(BenchmarkICPCorrespondenceCache, DEVICE Tolerance_1mm, \
+                      core::Device(DEVICE), core::Float32, 0.001)            \
+            ->Unit(benchmark::kMillisecond);                                 \
+    BENCHMARK_CAPTURE(BenchmarkICPCorrespondenceCache, DEVICE Tolerance_5mm, \
+                      core::Device(DEVICE), core::Float32, 0.005)            \
+            ->Unit(benchmark::kMillisecond);
+
+ENUM_ICP_CACHE_DEVICE("CPU:0")
+#ifdef BUILD_CUDA_MODULE
+ENUM_ICP_CACHE_DEVICE("CUDA:0")
+#endif
+
 }  // namespace registration
 }  // namespace pipelines
 }  // namespace t
@@ -26,8 +26,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
 
 #include "open3d/core/Device.h"
@@ -49,8 +52,13 @@ namespace core {
 /// address. The only responsibility for Blob is to hold the beginning
 /// memory address and it's up to the user to access any addresses around it.
 ///
+/// A CPU Blob allocated by the Blob itself can share its memory copy-on-write
+/// with other Blobs, see ShareCopyOnWrite(). The memory is only duplicated
+/// when one of the sharing Blobs is written, which is signaled by calling the
+/// non-const GetDataPtr() or Detach().
+///
 /// In summary:
-/// - A Blob does not know about its memory size after construction.
+/// - A Blob only knows its memory size if it allocated the memory itself.
 /// - A Blob cannot be deep-copied. However, the Tensor which owns the blob can
 /// be copied.
 class Blob {
@@ -62,7 +70,8 @@ public:
     Blob(int64_t byte_size, const Device& device)
         : deleter_(nullptr),
           data_ptr_(MemoryManager::Malloc(byte_size, device)),
-          device_(device) {}
+          device_(device),
+          byte_size_(byte_size) {}
 
     /// Construct Blob with externally managed memory.
     ///
@@ -83,26 +92,136 @@ public:
             // The void(void*) signature is kept to be consistent with DLPack's
             // deleter.
             deleter_(nullptr);
-        } else {
-            MemoryManager::Free(data_ptr_, device_);
+        } else if (!shared_data_) {
+            // Shared memory is freed by the last owner of shared_data_.
+            MemoryManager::Free(data_ptr_.load(std::memory_order_relaxed),
+                                device_);
         }
     };
 
     Device GetDevice() const { return device_; }
 
-    void* GetDataPtr() { return data_ptr_; }
+    /// Returns the data pointer for writing. Memory shared copy-on-write is
+    /// detached first.
+    void* GetDataPtr() {
+        Detach();
+        return data_ptr_.load(std::memory_order_acquire);
+    }
+
+    /// Returns the data pointer for reading. May be called while another
+    /// thread detaches this Blob and returns either the shared or the
+    /// detached memory, which hold the same contents.
+    const void* GetDataPtr() const {
+        return data_ptr_.load(std::memory_order_acquire);
+    }
+
+    /// Returns the size of the blob in bytes, or -1 for externally managed
+    /// memory.
+    int64_t GetByteSize() const { return byte_size_; }
 
-    const void* GetDataPtr() const { return data_ptr_; }
+    /// Returns true if the memory may be shared copy-on-write with another
+    /// Blob.
+    bool IsShared() const { return is_shared_.load(std::memory_order_acquire); }
+
+    /// Returns a new Blob that shares the memory of this Blob until either of
+    /// them is written. Returns nullptr if the memory cannot be shared, i.e.
+    /// if it is not on the CPU, externally managed, or copy-on-write has been
+    /// disabled for this Blob.
+    std::shared_ptr<Blob> ShareCopyOnWrite() {
+        if (deleter_ || byte_size_ < 0 ||
+            device_.GetType() != Device::DeviceType::CPU) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!copy_on_write_) {
+            return nullptr;
+        }
+        if (!shared_data_) {
+            const Device device = device_;
+            shared_data_ = std::shared_ptr<void>(
+                    data_ptr_.load(std::memory_order_relaxed),
+                    [device](void* data_ptr) {
+                        MemoryManager::Free(data_ptr, device);
+                    });
+        }
+        is_shared_.store(true, std::memory_order_release);
+        return std::shared_ptr<Blob>(new Blob(device_, byte_size_,
+                                              shared_data_));
+    }
+
+    /// Gives this Blob its own copy of the memory if it is shared
+    /// copy-on-write with other Blobs. Must be called before the memory is
+    /// written through a pointer obtained from the const GetDataPtr().
+    void Detach() {
+        if (!is_shared_.load(std::memory_order_acquire)) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!is_shared_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (shared_data_.use_count() > 1) {
+            void* data_ptr = MemoryManager::Malloc(byte_size_, device_);
+            MemoryManager::Memcpy(data_ptr, device_,
+                                  data_ptr_.load(std::memory_order_relaxed),
+                                  device_, byte_size_);
+            // Publishes the copied contents to readers of the const
+            // GetDataPtr(). The shared memory stays valid for readers that
+            // loaded the old pointer since another Blob still owns it.
+            data_ptr_.store(data_ptr, std::memory_order_release);
+            shared_data_.reset();
+        }
+        is_shared_.store(false, std::memory_order_release);
+    }
+
+    /// Detaches the memory and never shares it again. Required if raw
+    /// pointers to the memory are kept for writing, e.g. by buffers that are
+    /// exported or filled incrementally.
+    void DisableCopyOnWrite() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            copy_on_write_ = false;
+        }
+        Detach();
+    }
 
 protected:
+    /// Blob sharing the memory owned by \p shared_data copy-on-write.
+    Blob(const Device& device,
+         int64_t byte_size,
+         const std::shared_ptr<void>& shared_data)
+        : deleter_(nullptr),
+          data_ptr_(shared_data.get()),
+          device_(device),
+          byte_size_(byte_size),
+          shared_data_(shared_data),
+          is_shared_(true) {}
+
     /// For externally managed memory, deleter != nullptr.
     std::function<void(void*)> deleter_ = nullptr;
 
-    /// Device data pointer.
-    void* data_ptr_ = nullptr;
+    /// Device data pointer. Atomic since Detach() may replace it while the
+    /// const GetDataPtr() reads it without holding mutex_.
+    std::atomic<void*> data_ptr_{nullptr};
 
     /// Device context for the blob.
     Device device_;
+
+    /// Size in bytes of memory allocated by the Blob, -1 otherwise.
+    int64_t byte_size_ = -1;
+
+    /// Owner of memory that is or was shared copy-on-write. The memory is
+    /// freed when the last sharing Blob is destructed or detached.
+    std::shared_ptr<void> shared_data_ = nullptr;
+
+    /// True if shared_data_ may be referenced by other Blobs.
+    std::atomic<bool> is_shared_{false};
+
+    /// False if the memory must never be shared.
+    bool copy_on_write_ = true;
+
+    /// Guards sharing and detaching.
+    std::mutex mutex_;
 };
 
 }  // namespace core
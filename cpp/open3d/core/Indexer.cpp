@@ -138,6 +138,8 @@ Indexer::Indexer(const std::vector<Tensor>& input_tensors,
     }
     for (int64_t i = 0; i < num_outputs_; ++i) {
         outputs_[i] = TensorRef(output_tensors[i]);
+        // Outputs are written, so memory shared copy-on-write is detached.
+        outputs_[i].data_ptr_ = output_tensors[i].GetWritableDataPtr();
     }
 
     // For simplicity, all outputs must have the same shape.
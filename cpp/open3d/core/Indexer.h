@@ -52,9 +52,6 @@ class Indexer;
 
 class IndexerIterator;
 
-// Maximum number of dimensions of TensorRef.
-static constexpr int64_t MAX_DIMS = 10;
-
 // Maximum number of inputs of an op.
 // MAX_INPUTS shall be >= MAX_DIMS to support advanced indexing.
 static constexpr int64_t MAX_INPUTS = 10;
@@ -35,6 +35,18 @@
 namespace open3d {
 namespace core {
 
+/// Owner of the allocations of the calling thread, see ScopedOwner.
+static thread_local std::string current_owner;
+
+MemoryManagerStatistic::ScopedOwner::ScopedOwner(const std::string& owner)
+    : previous_owner_(current_owner) {
+    current_owner = owner;
+}
+
+MemoryManagerStatistic::ScopedOwner::~ScopedOwner() {
+    current_owner = previous_owner_;
+}
+
 MemoryManagerStatistic& MemoryManagerStatistic::GetInstance() {
     // Ensure the static Logger instance is instantiated before the
     // MemoryManagerStatistic instance.
@@ -113,8 +125,15 @@ void MemoryManagerStatistic::Print() const {
                                 leaking_byte_size);
 
             for (const auto& leak : statistics.active_allocations_) {
-                utility::LogWarning("    {} @ {} bytes", fmt::ptr(leak.first),
-                                    leak.second);
+                auto owner = statistics.allocation_owners_.find(leak.first);
+                if (owner != statistics.allocation_owners_.end()) {
+                    utility::LogWarning("    {} @ {} bytes owned by {}",
+                                        fmt::ptr(leak.first), leak.second,
+                                        owner->second);
+                } else {
+                    utility::LogWarning("    {} @ {} bytes",
+                                        fmt::ptr(leak.first), leak.second);
+                }
             }
         } else {
             utility::LogInfo("{}: {} {}", device.ToString(),
@@ -147,6 +166,12 @@ void MemoryManagerStatistic::CountMalloc(void* ptr,
     auto it = statistics_[device].active_allocations_.emplace(ptr, byte_size);
     if (it.second) {
         statistics_[device].count_malloc_++;
+        if (!current_owner.empty()) {
+            statistics_[device].allocation_owners_.emplace(ptr, current_owner);
+            OwnerStatistics& owner = statistics_[device].owners_[current_owner];
+            owner.count_active_++;
+            owner.byte_size_ += byte_size;
+        }
         if (print_at_malloc_free_) {
             utility::LogInfo("[Malloc] {}: {} @ {} bytes",
                              fmt::sprintf("%6s", device.ToString()),
@@ -175,6 +200,18 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
                              fmt::ptr(ptr),
                              statistics_[device].active_allocations_.at(ptr));
         }
+        auto owner = statistics_[device].allocation_owners_.find(ptr);
+        if (owner != statistics_[device].allocation_owners_.end()) {
+            auto owner_statistics =
+                    statistics_[device].owners_.find(owner->second);
+            owner_statistics->second.count_active_--;
+            owner_statistics->second.byte_size_ -=
+                    statistics_[device].active_allocations_.at(ptr);
+            if (owner_statistics->second.count_active_ == 0) {
+                statistics_[device].owners_.erase(owner_statistics);
+            }
+            statistics_[device].allocation_owners_.erase(owner);
+        }
         statistics_[device].active_allocations_.erase(ptr);
         statistics_[device].count_free_++;
     } else if (num_to_erase == 0) {
@@ -188,6 +225,16 @@ void MemoryManagerStatistic::CountFree(void* ptr, const Device& device) {
     }
 }
 
+std::map<std::string, MemoryManagerStatistic::OwnerStatistics>
+MemoryManagerStatistic::GetOwnerStatistics(const Device& device) const {
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    auto it = statistics_.find(device);
+    if (it == statistics_.end()) {
+        return {};
+    }
+    return it->second.owners_;
+}
+
 void MemoryManagerStatistic::Reset() {
     std::lock_guard<std::mutex> lock(statistics_mutex_);
     statistics_.clear();
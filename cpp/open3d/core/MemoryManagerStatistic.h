@@ -29,6 +29,7 @@
 #include <cstddef>
 #include <map>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include "open3d/core/Device.h"
@@ -48,6 +49,45 @@ public:
         None = 2,
     };
 
+    /// Memory in use by one owner, see ScopedOwner.
+    struct OwnerStatistics {
+        /// Number of active allocations.
+        int64_t count_active_ = 0;
+        /// Total size of the active allocations in bytes.
+        int64_t byte_size_ = 0;
+    };
+
+    /// \class ScopedOwner
+    ///
+    /// \brief Attributes the allocations of the calling thread to an owner
+    /// while in scope.
+    ///
+    /// The owner is any name, e.g. of a geometry or of a request served by a
+    /// long-running process. Scopes can be nested, the innermost owner is
+    /// used. Allocations remain attributed to their owner until they are
+    /// freed, which makes it easy to find out who holds how much memory.
+    ///
+    /// ```cpp
+    /// {
+    ///     MemoryManagerStatistic::ScopedOwner owner("scene");
+    ///     points = Tensor::Zeros({100, 3}, core::Float32);
+    /// }
+    /// auto statistics = MemoryManagerStatistic::GetInstance()
+    ///                           .GetOwnerStatistics(Device("CPU:0"));
+    /// // statistics["scene"].byte_size_ == 1200
+    /// ```
+    class ScopedOwner {
+    public:
+        explicit ScopedOwner(const std::string& owner);
+        ~ScopedOwner();
+
+        ScopedOwner(const ScopedOwner&) = delete;
+        ScopedOwner& operator=(const ScopedOwner&) = delete;
+
+    private:
+        std::string previous_owner_;
+    };
+
     static MemoryManagerStatistic& GetInstance();
 
     MemoryManagerStatistic(const MemoryManagerStatistic&) = delete;
@@ -81,6 +121,11 @@ public:
     /// consistency.
     void CountFree(void* ptr, const Device& device);
 
+    /// Returns the memory in use per owner on the given device. Allocations
+    /// made outside of any ScopedOwner are not included.
+    std::map<std::string, OwnerStatistics> GetOwnerStatistics(
+            const Device& device) const;
+
     /// Resets the statistics.
     void Reset();
 
@@ -93,6 +138,9 @@ private:
         int64_t count_malloc_ = 0;
         int64_t count_free_ = 0;
         std::unordered_map<void*, size_t> active_allocations_;
+        /// Owners of the active allocations made within a ScopedOwner.
+        std::unordered_map<void*, std::string> allocation_owners_;
+        std::map<std::string, OwnerStatistics> owners_;
     };
 
     /// Only print unbalanced statistics by default.
@@ -105,7 +153,7 @@ private:
     /// Print at each malloc and free, disabled by default.
     bool print_at_malloc_free_ = false;
 
-    std::mutex statistics_mutex_;
+    mutable std::mutex statistics_mutex_;
     std::map<Device, MemoryStatistics> statistics_;
 };
 
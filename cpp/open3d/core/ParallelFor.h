@@ -202,6 +202,48 @@ void ParallelFor(const Device& device,
 #endif
 }
 
+#ifndef __CUDACC__
+
+/// Minimum number of workloads for which ParallelForCPU() runs in parallel.
+/// Below, the cost of waking up the OpenMP threads dominates cheap work items
+/// such as elementwise ops on small tensors.
+static constexpr int64_t OPEN3D_PARFOR_MIN_PARALLEL_WORKLOADS = 1 << 14;
+
+/// Run a function on the CPU, in parallel only if there are at least
+/// OPEN3D_PARFOR_MIN_PARALLEL_WORKLOADS workloads and on the calling thread
+/// otherwise.
+///
+/// \param n The number of workloads.
+/// \param func The function to be executed, see ParallelFor().
+template <typename func_t>
+void ParallelForCPU(int64_t n, const func_t& func) {
+    if (n < OPEN3D_PARFOR_MIN_PARALLEL_WORKLOADS) {
+        for (int64_t i = 0; i < n; ++i) {
+            func(i);
+        }
+    } else {
+        ParallelFor(Device("CPU:0"), n, func);
+    }
+}
+
+/// Run a potentially vectorized function on the CPU, in parallel only if
+/// there are at least OPEN3D_PARFOR_MIN_PARALLEL_WORKLOADS workloads. Small
+/// inputs call \p func on the calling thread.
+///
+/// \param n The number of workloads.
+/// \param func The function to be executed, see ParallelFor().
+/// \param vec_func The vectorized function, see ParallelFor().
+template <typename vec_func_t, typename func_t>
+void ParallelForCPU(int64_t n, const func_t& func, const vec_func_t& vec_func) {
+    if (n < OPEN3D_PARFOR_MIN_PARALLEL_WORKLOADS) {
+        ParallelForCPU(n, func);
+    } else {
+        ParallelFor(Device("CPU:0"), n, func, vec_func);
+    }
+}
+
+#endif
+
 #ifdef BUILD_ISPC_MODULE
 
 // Internal helper macro.
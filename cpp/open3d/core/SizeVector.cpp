@@ -104,26 +104,32 @@ bool DynamicSizeVector::IsDynamic() const {
 }
 
 SizeVector::SizeVector(const std::initializer_list<int64_t>& dim_sizes)
-    : std::vector<int64_t>(dim_sizes) {}
+    : SmallVector<int64_t, MAX_DIMS>(dim_sizes) {}
 
 SizeVector::SizeVector(const std::vector<int64_t>& dim_sizes)
-    : std::vector<int64_t>(dim_sizes) {}
+    : SmallVector<int64_t, MAX_DIMS>(dim_sizes.begin(), dim_sizes.end()) {}
 
-SizeVector::SizeVector(const SizeVector& other) : std::vector<int64_t>(other) {}
+SizeVector::SizeVector(const SizeVector& other)
+    : SmallVector<int64_t, MAX_DIMS>(other) {}
 
 SizeVector::SizeVector(int64_t n, int64_t initial_value)
-    : std::vector<int64_t>(n, initial_value) {}
+    : SmallVector<int64_t, MAX_DIMS>(n, initial_value) {}
 
 SizeVector& SizeVector::operator=(const SizeVector& v) {
-    static_cast<std::vector<int64_t>*>(this)->operator=(v);
+    static_cast<SmallVector<int64_t, MAX_DIMS>*>(this)->operator=(v);
     return *this;
 }
 
 SizeVector& SizeVector::operator=(SizeVector&& v) {
-    static_cast<std::vector<int64_t>*>(this)->operator=(v);
+    static_cast<SmallVector<int64_t, MAX_DIMS>*>(this)->operator=(
+            std::move(v));
     return *this;
 }
 
+SizeVector::operator std::vector<int64_t>() const {
+    return std::vector<int64_t>(begin(), end());
+}
+
 int64_t SizeVector::NumElements() const {
     if (this->size() == 0) {
         return 1;
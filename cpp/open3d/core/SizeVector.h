@@ -30,11 +30,16 @@
 #include <string>
 #include <vector>
 
+#include "open3d/core/SmallVector.h"
 #include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace core {
 
+/// Maximum number of dimensions of a Tensor. Shapes and strides with up to
+/// MAX_DIMS dimensions are stored inline in SizeVector.
+static constexpr int64_t MAX_DIMS = 10;
+
 class SizeVector;
 
 /// DynamicSizeVector is a vector of optional<int64_t>, it is used to represent
@@ -76,7 +81,10 @@ public:
 
 /// SizeVector is a vector of int64_t, typically used in Tensor shape and
 /// strides. A signed int64_t type is chosen to allow negative strides.
-class SizeVector : public std::vector<int64_t> {
+///
+/// Up to MAX_DIMS elements are stored inline, so creating and copying shapes
+/// does not allocate.
+class SizeVector : public SmallVector<int64_t, MAX_DIMS> {
 public:
     SizeVector() {}
 
@@ -90,12 +98,14 @@ public:
 
     template <class InputIterator>
     SizeVector(InputIterator first, InputIterator last)
-        : std::vector<int64_t>(first, last) {}
+        : SmallVector<int64_t, MAX_DIMS>(first, last) {}
 
     SizeVector& operator=(const SizeVector& v);
 
     SizeVector& operator=(SizeVector&& v);
 
+    operator std::vector<int64_t>() const;
+
     int64_t NumElements() const;
 
     int64_t GetLength() const;
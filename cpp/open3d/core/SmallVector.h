@@ -0,0 +1,362 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+namespace open3d {
+namespace core {
+
+/// \class SmallVector
+///
+/// \brief Vector with inline storage for the first \p N elements.
+///
+/// Behaves like std::vector<T> but does not allocate until more than \p N
+/// elements are stored, which makes copies of short vectors, e.g. tensor
+/// shapes and strides, as cheap as copying a fixed-size array. Only trivially
+/// copyable element types are supported, so elements are moved with memcpy.
+template <typename T, size_t N>
+class SmallVector {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SmallVector only supports trivially copyable types.");
+    static_assert(N > 0, "SmallVector requires inline storage.");
+
+public:
+    typedef T value_type;
+    typedef size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    SmallVector() {}
+
+    explicit SmallVector(size_type n, const T& value = T()) {
+        assign(n, value);
+    }
+
+    template <class InputIt,
+              typename = typename std::enable_if<
+                      !std::is_integral<InputIt>::value>::type>
+    SmallVector(InputIt first, InputIt last) {
+        assign(first, last);
+    }
+
+    SmallVector(std::initializer_list<T> values) {
+        assign(values.begin(), values.end());
+    }
+
+    SmallVector(const SmallVector& other) {
+        assign(other.begin(), other.end());
+    }
+
+    SmallVector(SmallVector&& other) noexcept { MoveFrom(other); }
+
+    ~SmallVector() { Deallocate(); }
+
+    SmallVector& operator=(const SmallVector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept {
+        if (this != &other) {
+            Deallocate();
+            data_ = inline_data_;
+            size_ = 0;
+            capacity_ = N;
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(std::initializer_list<T> values) {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    void assign(size_type n, const T& value) {
+        const T copy = value;
+        clear();
+        reserve(n);
+        std::fill_n(data_, n, copy);
+        size_ = n;
+    }
+
+    template <class InputIt,
+              typename = typename std::enable_if<
+                      !std::is_integral<InputIt>::value>::type>
+    void assign(InputIt first, InputIt last) {
+        typedef typename std::iterator_traits<InputIt>::iterator_category
+                category;
+        clear();
+        AppendRange(first, last, category());
+    }
+
+    void assign(std::initializer_list<T> values) {
+        assign(values.begin(), values.end());
+    }
+
+    reference operator[](size_type pos) { return data_[pos]; }
+    const_reference operator[](size_type pos) const { return data_[pos]; }
+
+    reference at(size_type pos) {
+        if (pos >= size_) {
+            throw std::out_of_range("SmallVector index out of range.");
+        }
+        return data_[pos];
+    }
+    const_reference at(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("SmallVector index out of range.");
+        }
+        return data_[pos];
+    }
+
+    reference front() { return data_[0]; }
+    const_reference front() const { return data_[0]; }
+    reference back() { return data_[size_ - 1]; }
+    const_reference back() const { return data_[size_ - 1]; }
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+
+    iterator begin() { return data_; }
+    const_iterator begin() const { return data_; }
+    const_iterator cbegin() const { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator end() const { return data_ + size_; }
+    const_iterator cend() const { return data_ + size_; }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type capacity() const { return capacity_; }
+    /// Returns true if the elements are stored inline, i.e. no heap memory
+    /// is owned by the vector.
+    bool IsInline() const { return data_ == inline_data_; }
+
+    void reserve(size_type new_capacity) {
+        if (new_capacity > capacity_) {
+            Grow(new_capacity);
+        }
+    }
+
+    void shrink_to_fit() {
+        if (!IsInline() && size_ <= N) {
+            T* heap_data = data_;
+            std::memcpy(inline_data_, heap_data, size_ * sizeof(T));
+            data_ = inline_data_;
+            capacity_ = N;
+            std::free(heap_data);
+        }
+    }
+
+    void clear() { size_ = 0; }
+
+    void resize(size_type n) { resize(n, T()); }
+
+    void resize(size_type n, const T& value) {
+        if (n > size_) {
+            const T copy = value;
+            reserve(n);
+            std::fill(data_ + size_, data_ + n, copy);
+        }
+        size_ = n;
+    }
+
+    void push_back(const T& value) {
+        if (size_ == capacity_) {
+            const T copy = value;
+            Grow(size_ + 1);
+            data_[size_++] = copy;
+        } else {
+            data_[size_++] = value;
+        }
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        push_back(T(std::forward<Args>(args)...));
+        return back();
+    }
+
+    void pop_back() { --size_; }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return insert(pos, 1, value);
+    }
+
+    iterator insert(const_iterator pos, size_type count, const T& value) {
+        const T copy = value;
+        const size_type idx = pos - data_;
+        MakeGap(idx, count);
+        std::fill_n(data_ + idx, count, copy);
+        return data_ + idx;
+    }
+
+    template <class InputIt,
+              typename = typename std::enable_if<
+                      !std::is_integral<InputIt>::value>::type>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        const size_type idx = pos - data_;
+        // The range may alias this vector, so it is copied out first.
+        SmallVector values(first, last);
+        MakeGap(idx, values.size());
+        std::copy(values.begin(), values.end(), data_ + idx);
+        return data_ + idx;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> values) {
+        return insert(pos, values.begin(), values.end());
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        const size_type idx = first - data_;
+        const size_type count = last - first;
+        std::memmove(data_ + idx, data_ + idx + count,
+                     (size_ - idx - count) * sizeof(T));
+        size_ -= count;
+        return data_ + idx;
+    }
+
+    void swap(SmallVector& other) {
+        SmallVector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    bool operator==(const SmallVector& other) const {
+        return size_ == other.size_ &&
+               std::equal(begin(), end(), other.begin());
+    }
+    bool operator!=(const SmallVector& other) const {
+        return !(*this == other);
+    }
+    bool operator<(const SmallVector& other) const {
+        return std::lexicographical_compare(begin(), end(), other.begin(),
+                                            other.end());
+    }
+    bool operator>(const SmallVector& other) const { return other < *this; }
+    bool operator<=(const SmallVector& other) const {
+        return !(other < *this);
+    }
+    bool operator>=(const SmallVector& other) const {
+        return !(*this < other);
+    }
+
+private:
+    void Grow(size_type min_capacity) {
+        const size_type new_capacity = std::max(min_capacity, 2 * capacity_);
+        T* new_data = static_cast<T*>(std::malloc(new_capacity * sizeof(T)));
+        if (new_data == nullptr) {
+            throw std::bad_alloc();
+        }
+        std::memcpy(new_data, data_, size_ * sizeof(T));
+        Deallocate();
+        data_ = new_data;
+        capacity_ = new_capacity;
+    }
+
+    void Deallocate() {
+        if (!IsInline()) {
+            std::free(data_);
+        }
+    }
+
+    /// Takes over the elements of \p other, which must not own any memory
+    /// that is still referenced by *this.
+    void MoveFrom(SmallVector& other) {
+        if (other.IsInline()) {
+            std::memcpy(inline_data_, other.inline_data_,
+                        other.size_ * sizeof(T));
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data_;
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    /// Shifts the elements from \p idx on by \p count places to the right.
+    void MakeGap(size_type idx, size_type count) {
+        reserve(size_ + count);
+        std::memmove(data_ + idx + count, data_ + idx,
+                     (size_ - idx) * sizeof(T));
+        size_ += count;
+    }
+
+    template <class InputIt>
+    void AppendRange(InputIt first, InputIt last, std::input_iterator_tag) {
+        for (; first != last; ++first) {
+            push_back(static_cast<T>(*first));
+        }
+    }
+
+    template <class ForwardIt>
+    void AppendRange(ForwardIt first,
+                     ForwardIt last,
+                     std::forward_iterator_tag) {
+        reserve(size_ + std::distance(first, last));
+        for (; first != last; ++first) {
+            data_[size_++] = static_cast<T>(*first);
+        }
+    }
+
+    T* data_ = inline_data_;
+    size_type size_ = 0;
+    size_type capacity_ = N;
+    T inline_data_[N];
+};
+
+}  // namespace core
+}  // namespace open3d
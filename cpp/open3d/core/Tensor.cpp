@@ -162,6 +162,11 @@ private:
         // dl_data_type prepared above.
         DLTensor dl_tensor;
         // Not Blob's data pointer.
+        // The consumer may write at any time, so the memory is never shared
+        // copy-on-write again.
+        if (o3d_tensor_.GetBlob()) {
+            o3d_tensor_.GetBlob()->DisableCopyOnWrite();
+        }
         dl_tensor.data = const_cast<void*>(o3d_tensor_.GetDataPtr());
         dl_tensor.ctx = dl_context;
         dl_tensor.ndim = static_cast<int>(o3d_tensor_.GetShape().size());
@@ -343,7 +348,7 @@ Tensor& Tensor::operator=(const Tensor& other) & {
     strides_ = other.strides_;
     dtype_ = other.dtype_;
     blob_ = other.blob_;
-    data_ptr_ = other.data_ptr_;
+    byte_offset_ = other.byte_offset_;
     return *this;
 }
 
@@ -355,7 +360,7 @@ Tensor& Tensor::operator=(Tensor&& other) & {
     strides_ = other.strides_;
     dtype_ = other.dtype_;
     blob_ = other.blob_;
-    data_ptr_ = other.data_ptr_;
+    byte_offset_ = other.byte_offset_;
     return *this;
 }
 
@@ -714,6 +719,9 @@ Tensor Tensor::To(Dtype dtype, bool copy /*= false*/) const {
     if (!copy && dtype_ == dtype) {
         return *this;
     }
+    if (dtype_ == dtype) {
+        return Clone();
+    }
     // We only support scalar type conversion.
     if (dtype_.IsObject() || dtype.IsObject()) {
         utility::LogError("Cannot cast type from {} to {}.", dtype_.ToString(),
@@ -728,6 +736,18 @@ Tensor Tensor::To(const Device& device, bool copy /*= false*/) const {
     if (!copy && GetDevice() == device) {
         return *this;
     }
+    if (GetDevice() == device && blob_ && byte_offset_ == 0 &&
+        IsContiguous() &&
+        NumElements() * dtype_.ByteSize() == blob_->GetByteSize()) {
+        // The Tensor covers its whole blob, the copy is deferred until either
+        // Tensor is written.
+        std::shared_ptr<Blob> shared_blob = blob_->ShareCopyOnWrite();
+        if (shared_blob) {
+            Tensor dst_tensor = *this;
+            dst_tensor.blob_ = shared_blob;
+            return dst_tensor;
+        }
+    }
     Tensor dst_tensor(shape_, dtype_, device);
     kernel::Copy(*this, dst_tensor);
     return dst_tensor;
@@ -741,6 +761,12 @@ Tensor Tensor::To(const Device& device,
     return dst_tensor;
 }
 
+Tensor Tensor::Clone() const {
+    Tensor dst_tensor(shape_, dtype_, GetDevice());
+    kernel::Copy(*this, dst_tensor);
+    return dst_tensor;
+}
+
 void Tensor::CopyFrom(const Tensor& other) { AsRvalue() = other; }
 
 Tensor Tensor::Contiguous() const {
@@ -763,9 +789,9 @@ std::string Tensor::ToString(bool with_suffix,
             rc << "0-element Tensor";
         } else if (shape_.size() == 0) {
             rc << indent;
-            rc << ScalarPtrToString(data_ptr_);
+            rc << ScalarPtrToString(GetDataPtr());
         } else if (shape_.size() == 1) {
-            const char* ptr = static_cast<const char*>(data_ptr_);
+            const char* ptr = static_cast<const char*>(GetDataPtr());
             rc << "[";
             std::string delim = "";
             int64_t element_byte_size = dtype_.ByteSize();
@@ -791,7 +817,8 @@ std::string Tensor::ToString(bool with_suffix,
     if (with_suffix) {
         rc << fmt::format("\nTensor[shape={}, stride={}, {}, {}, {}]",
                           shape_.ToString(), strides_.ToString(),
-                          dtype_.ToString(), GetDevice().ToString(), data_ptr_);
+                          dtype_.ToString(), GetDevice().ToString(),
+                          GetDataPtr());
     }
     return rc.str();
 }
@@ -823,9 +850,8 @@ Tensor Tensor::IndexExtract(int64_t dim, int64_t idx) const {
     new_shape.erase(new_shape.begin() + dim);
     SizeVector new_strides(strides_);
     new_strides.erase(new_strides.begin() + dim);
-    void* new_data_ptr = static_cast<char*>(data_ptr_) +
-                         strides_[dim] * dtype_.ByteSize() * idx;
-    return Tensor(new_shape, new_strides, new_data_ptr, dtype_, blob_);
+    return ViewAtOffset(new_shape, new_strides,
+                        strides_[dim] * dtype_.ByteSize() * idx);
 }
 
 Tensor Tensor::Slice(int64_t dim,
@@ -867,13 +893,12 @@ Tensor Tensor::Slice(int64_t dim,
         stop = shape_[dim];
     }
 
-    void* new_data_ptr = static_cast<char*>(data_ptr_) +
-                         start * strides_[dim] * dtype_.ByteSize();
     SizeVector new_shape = shape_;
     SizeVector new_strides = strides_;
     new_shape[dim] = (stop - start + step - 1) / step;
     new_strides[dim] = strides_[dim] * step;
-    return Tensor(new_shape, new_strides, new_data_ptr, dtype_, blob_);
+    return ViewAtOffset(new_shape, new_strides,
+                        start * strides_[dim] * dtype_.ByteSize());
 }
 
 Tensor Tensor::IndexGet(const std::vector<Tensor>& index_tensors) const {
@@ -997,9 +1022,7 @@ Tensor Tensor::Permute(const SizeVector& dims) const {
 
 Tensor Tensor::AsStrided(const SizeVector& new_shape,
                          const SizeVector& new_strides) const {
-    Tensor result(new_shape, new_strides, const_cast<void*>(data_ptr_), dtype_,
-                  blob_);
-    return result;
+    return ViewAtOffset(new_shape, new_strides, 0);
 }
 
 Tensor Tensor::Transpose(int64_t dim0, int64_t dim1) const {
@@ -1684,6 +1707,38 @@ std::vector<Tensor> Tensor::NonZeroNumpy() const {
 
 Tensor Tensor::NonZero() const { return kernel::NonZero(*this); }
 
+/// Sorts \p tensor along \p dim and returns the sorted values and indices.
+static std::pair<Tensor, Tensor> SortAlongDim(const Tensor& tensor,
+                                              int64_t dim,
+                                              bool descending) {
+    if (tensor.NumDims() == 0 || tensor.NumElements() == 0) {
+        return std::make_pair(
+                tensor.Clone(),
+                Tensor::Zeros(tensor.GetShape(), core::Int64,
+                              tensor.GetDevice()));
+    }
+    const int64_t last_dim = tensor.NumDims() - 1;
+    dim = shape_util::WrapDim(dim, tensor.NumDims());
+    Tensor src = tensor.Transpose(dim, last_dim).Contiguous();
+    const SizeVector shape = src.GetShape();
+    const int64_t length = shape[last_dim];
+    src = src.Reshape({src.NumElements() / length, length});
+
+    Tensor values, indices;
+    kernel::Sort(src, descending, values, indices);
+    return std::make_pair(
+            values.Reshape(shape).Transpose(dim, last_dim).Contiguous(),
+            indices.Reshape(shape).Transpose(dim, last_dim).Contiguous());
+}
+
+Tensor Tensor::Sort(int64_t dim, bool descending) const {
+    return SortAlongDim(*this, dim, descending).first;
+}
+
+Tensor Tensor::ArgSort(int64_t dim, bool descending) const {
+    return SortAlongDim(*this, dim, descending).second;
+}
+
 bool Tensor::IsNonZero() const {
     if (shape_.NumElements() != 1) {
         utility::LogError(
@@ -1763,8 +1818,8 @@ void Tensor::Save(const std::string& file_name) const {
     t::io::WriteNpy(file_name, *this);
 }
 
-Tensor Tensor::Load(const std::string& file_name) {
-    return t::io::ReadNpy(file_name);
+Tensor Tensor::Load(const std::string& file_name, bool memory_map) {
+    return t::io::ReadNpy(file_name, memory_map);
 }
 
 bool Tensor::AllEqual(const Tensor& other) const {
@@ -1797,7 +1852,7 @@ Tensor Tensor::IsClose(const Tensor& other, double rtol, double atol) const {
 bool Tensor::IsSame(const Tensor& other) const {
     AssertTensorDevice(other, GetDevice());
     return blob_ == other.blob_ && shape_ == other.shape_ &&
-           strides_ == other.strides_ && data_ptr_ == other.data_ptr_ &&
+           strides_ == other.strides_ && byte_offset_ == other.byte_offset_ &&
            dtype_ == other.dtype_;
 }
 
@@ -60,9 +60,7 @@ public:
           strides_(shape_util::DefaultStrides(shape)),
           dtype_(dtype),
           blob_(std::make_shared<Blob>(shape.NumElements() * dtype.ByteSize(),
-                                       device)) {
-        data_ptr_ = blob_->GetDataPtr();
-    }
+                                       device)) {}
 
     /// Constructor for creating a contiguous Tensor with initial values
     template <typename T>
@@ -115,11 +113,13 @@ public:
            void* data_ptr,
            Dtype dtype,
            const std::shared_ptr<Blob>& blob)
-        : shape_(shape),
-          strides_(strides),
-          data_ptr_(data_ptr),
-          dtype_(dtype),
-          blob_(blob) {}
+        : shape_(shape), strides_(strides), dtype_(dtype), blob_(blob) {
+        if (blob_) {
+            const void* blob_data_ptr = GetConstBlob().GetDataPtr();
+            byte_offset_ = static_cast<const char*>(data_ptr) -
+                           static_cast<const char*>(blob_data_ptr);
+        }
+    }
 
     /// \brief Take ownership of data in std::vector<T>
     ///
@@ -148,12 +148,12 @@ public:
         strides_ = shape_util::DefaultStrides(shape_);
         auto sp_vec = std::make_shared<std::vector<T>>();
         sp_vec->swap(vec);
-        data_ptr_ = static_cast<void*>(sp_vec->data());
 
         // Create blob that owns the shared pointer to vec. The deleter function
         // object just stores a shared pointer, ensuring that memory is freed
         // only when the Tensor is destructed.
-        blob_ = std::make_shared<Blob>(Device("CPU:0"), data_ptr_,
+        blob_ = std::make_shared<Blob>(Device("CPU:0"),
+                                       static_cast<void*>(sp_vec->data()),
                                        [sp_vec](void*) { (void)sp_vec; });
     }
 
@@ -182,12 +182,12 @@ public:
            const SizeVector& shape,
            const SizeVector& strides = {},
            const Device& device = Device("CPU:0"))
-        : shape_(shape), strides_(strides), data_ptr_(data_ptr), dtype_(dtype) {
+        : shape_(shape), strides_(strides), dtype_(dtype) {
         if (strides_.empty()) {
             strides_ = shape_util::DefaultStrides(shape);
         }
         // Blob with no-op deleter.
-        blob_ = std::make_shared<Blob>(device, (void*)data_ptr_, [](void*) {});
+        blob_ = std::make_shared<Blob>(device, data_ptr, [](void*) {});
     }
 
     /// Copy constructor performs a "shallow" copy of the Tensor.
@@ -510,8 +510,9 @@ public:
     /// - aten/src/ATen/TensorUtils.cpp
     Tensor View(const SizeVector& dst_shape) const;
 
-    /// Copy Tensor to the same device.
-    Tensor Clone() const { return To(GetDevice(), /*copy=*/true); }
+    /// Copy Tensor to the same device. The memory is always copied
+    /// immediately, use To(GetDevice(), true) to defer the copy.
+    Tensor Clone() const;
 
     /// Copy Tensor values to current tensor from the source tensor.
     void CopyFrom(const Tensor& other);
@@ -526,6 +527,12 @@ public:
     /// \param device The targeted device to convert to.
     /// \param copy If true, a new tensor is always created; if false, the copy
     /// is avoided when the original tensor is already on the targeted device.
+    ///
+    /// If \p copy is true and a contiguous CPU tensor that covers its whole
+    /// memory blob stays on the same device, the new tensor shares the memory
+    /// copy-on-write: the memory is only copied when either tensor is
+    /// written. Raw pointers obtained before must therefore not be used for
+    /// writing afterwards.
     Tensor To(const Device& device, bool copy = false) const;
 
     /// Returns a tensor with the specified \p device and \p dtype.
@@ -625,7 +632,8 @@ public:
         }
         AssertTemplateDtype<T>();
         T value;
-        MemoryManager::MemcpyToHost(&value, data_ptr_, GetDevice(), sizeof(T));
+        MemoryManager::MemcpyToHost(&value, GetDataPtr(), GetDevice(),
+                                    sizeof(T));
         return value;
     }
 
@@ -726,6 +734,22 @@ public:
     /// is into the flattened tensor.
     Tensor ArgMax(const SizeVector& dims) const;
 
+    /// Returns the tensor sorted along dimension \p dim. The sort is stable,
+    /// i.e. equal elements keep their order. NaNs are placed last in
+    /// ascending order. CPU tensors are sorted with a parallel radix sort.
+    ///
+    /// \param dim The dimension to sort along.
+    /// \param descending If true, sort in descending order.
+    Tensor Sort(int64_t dim = -1, bool descending = false) const;
+
+    /// Returns the int64 indices that sort the tensor along dimension \p dim,
+    /// such that the sorted tensor is the tensor indexed along \p dim with
+    /// the indices. See Sort().
+    ///
+    /// \param dim The dimension to sort along.
+    /// \param descending If true, sort in descending order.
+    Tensor ArgSort(int64_t dim = -1, bool descending = false) const;
+
     /// Element-wise square root of a tensor, returns a new tensor.
     Tensor Sqrt() const;
 
@@ -1031,7 +1055,7 @@ public:
     }
 
     /// Returns True if the underlying memory buffer is contiguous. A contiguous
-    /// Tensor's data_ptr_ does not need to point to the beginning of blob_.
+    /// Tensor's data does not need to start at the beginning of blob_.
     inline bool IsContiguous() const {
         return shape_util::DefaultStrides(shape_) == strides_;
     }
@@ -1139,26 +1163,44 @@ public:
         return strides_[shape_util::WrapDim(dim, NumDims())];
     }
 
+    /// Returns the data pointer for writing. If the memory is shared
+    /// copy-on-write with a Clone(), this Tensor gets its own copy first.
     template <typename T>
     inline T* GetDataPtr() {
-        return const_cast<T*>(const_cast<const Tensor*>(this)->GetDataPtr<T>());
+        CheckDtypeForDataPtr<T>();
+        return static_cast<T*>(GetDataPtr());
     }
 
     template <typename T>
     inline const T* GetDataPtr() const {
-        if (!dtype_.IsObject() && Dtype::FromType<T>() != dtype_) {
-            utility::LogError(
-                    "Requested values have type {} but Tensor has type {}. "
-                    "Please use non templated GetDataPtr() with manual "
-                    "casting.",
-                    Dtype::FromType<T>().ToString(), dtype_.ToString());
+        CheckDtypeForDataPtr<T>();
+        return static_cast<const T*>(GetDataPtr());
+    }
+
+    inline void* GetDataPtr() {
+        if (!blob_) {
+            return nullptr;
         }
-        return static_cast<T*>(data_ptr_);
+        return static_cast<char*>(blob_->GetDataPtr()) + byte_offset_;
     }
 
-    inline void* GetDataPtr() { return data_ptr_; }
+    inline const void* GetDataPtr() const {
+        if (!blob_) {
+            return nullptr;
+        }
+        return static_cast<const char*>(GetConstBlob().GetDataPtr()) +
+               byte_offset_;
+    }
 
-    inline const void* GetDataPtr() const { return data_ptr_; }
+    /// Returns the data pointer for writing through a const Tensor, e.g. for
+    /// kernels that take their outputs as const references. If the memory is
+    /// shared copy-on-write with a Clone(), it is detached first.
+    inline void* GetWritableDataPtr() const {
+        if (!blob_) {
+            return nullptr;
+        }
+        return static_cast<char*>(blob_->GetDataPtr()) + byte_offset_;
+    }
 
     inline Dtype GetDtype() const { return dtype_; }
 
@@ -1193,7 +1235,10 @@ public:
     void Save(const std::string& file_name) const;
 
     /// Load tensor from numpy's npy format.
-    static Tensor Load(const std::string& file_name);
+    ///
+    /// If \p memory_map is true, the tensor refers to a copy-on-write memory
+    /// mapping of the file instead of a copy of its data, see t::io::ReadNpy.
+    static Tensor Load(const std::string& file_name, bool memory_map = false);
 
     /// Iterator for Tensor.
     struct Iterator {
@@ -1297,6 +1342,35 @@ private:
     }
 
 protected:
+    /// Throws if \p T does not match the dtype of the Tensor.
+    template <typename T>
+    inline void CheckDtypeForDataPtr() const {
+        if (!dtype_.IsObject() && Dtype::FromType<T>() != dtype_) {
+            utility::LogError(
+                    "Requested values have type {} but Tensor has type {}. "
+                    "Please use non templated GetDataPtr() with manual "
+                    "casting.",
+                    Dtype::FromType<T>().ToString(), dtype_.ToString());
+        }
+    }
+
+    /// Reads blob_ without detaching memory shared copy-on-write.
+    inline const Blob& GetConstBlob() const { return *blob_; }
+
+    /// Returns a view of the same blob that starts \p byte_offset bytes after
+    /// the start of this Tensor. The offset is derived from byte_offset_
+    /// rather than from data pointers, which a concurrent copy-on-write
+    /// detach may move.
+    Tensor ViewAtOffset(const SizeVector& shape,
+                        const SizeVector& strides,
+                        int64_t byte_offset) const {
+        Tensor view(*this);
+        view.shape_ = shape;
+        view.strides_ = strides;
+        view.byte_offset_ = byte_offset_ + byte_offset;
+        return view;
+    }
+
     /// SizeVector of the Tensor. shape_[i] is the length of dimension i.
     SizeVector shape_ = {0};
 
@@ -1309,9 +1383,11 @@ protected:
     /// change the shape and stride.
     SizeVector strides_ = {1};
 
-    /// Data pointer pointing to the beginning element of the Tensor.
+    /// Byte offset of the beginning element of the Tensor from the beginning
+    /// of blob_. The data pointer is not stored, since the memory of blob_
+    /// moves when memory shared copy-on-write is detached.
     ///
-    /// Note that this is not necessarily the same as blob_.GetDataPtr().
+    /// Note that the offset is not necessarily 0.
     /// When this happens, it means that the beginning element of the Tensor
     /// is not located a the beginning of the underlying blob. This could
     /// happen, for instance, at slicing:
@@ -1322,7 +1398,7 @@ protected:
     /// // b.GetDataPtr() != b.GetBlob().GetDataPtr()
     /// b = a[1];
     /// ```
-    void* data_ptr_ = nullptr;
+    int64_t byte_offset_ = 0;
 
     /// Data type
     Dtype dtype_ = core::Undefined;
@@ -1383,7 +1459,7 @@ inline bool Tensor::Item() const {
     }
     AssertTemplateDtype<bool>();
     uint8_t value;
-    MemoryManager::MemcpyToHost(&value, data_ptr_, GetDevice(),
+    MemoryManager::MemcpyToHost(&value, GetDataPtr(), GetDevice(),
                                 sizeof(uint8_t));
     return static_cast<bool>(value);
 }
@@ -26,6 +26,8 @@
 
 #include "open3d/core/TensorFunction.h"
 
+#include "open3d/core/kernel/Sort.h"
+
 namespace open3d {
 namespace core {
 
@@ -138,5 +140,78 @@ Tensor Append(const Tensor& self,
     return Concatenate({self, other}, axis);
 }
 
+// Returns the number of elements of tensor[i].
+static int64_t NumSliceElements(const Tensor& tensor) {
+    int64_t num_elements = 1;
+    for (int64_t i = 1; i < tensor.NumDims(); ++i) {
+        num_elements *= tensor.GetShape(i);
+    }
+    return num_elements;
+}
+
+std::tuple<Tensor, Tensor, Tensor> Unique(
+        const Tensor& tensor, const utility::optional<int64_t>& dim) {
+    Tensor src;
+    int64_t dim_d = 0;
+    if (!dim.has_value()) {
+        src = tensor.Reshape({tensor.NumElements(), 1});
+    } else {
+        if (tensor.NumDims() == 0) {
+            utility::LogError("Unique along a dimension requires a tensor "
+                              "with at least one dimension.");
+        }
+        dim_d = shape_util::WrapDim(dim.value(), tensor.NumDims());
+        src = tensor.Transpose(0, dim_d).Contiguous();
+        src = src.Reshape({src.GetLength(), NumSliceElements(src)});
+    }
+    src = src.Contiguous();
+
+    Tensor unique, inverse, counts;
+    kernel::Unique(src, unique, inverse, counts);
+
+    if (!dim.has_value()) {
+        unique = unique.Reshape({unique.GetLength()});
+        inverse = inverse.Reshape(tensor.GetShape());
+    } else {
+        SizeVector unique_shape = tensor.Transpose(0, dim_d).GetShape();
+        unique_shape[0] = unique.GetLength();
+        unique = unique.Reshape(unique_shape).Transpose(0, dim_d).Contiguous();
+    }
+    return std::make_tuple(unique, inverse, counts);
+}
+
+Tensor SegmentReduce(const Tensor& values,
+                     const Tensor& segment_ids,
+                     int64_t num_segments,
+                     SegmentReduceOp op) {
+    if (values.NumDims() == 0) {
+        utility::LogError("SegmentReduce requires a tensor with at least one "
+                          "dimension.");
+    }
+    if (num_segments < 0) {
+        utility::LogError("num_segments must be non-negative, but got {}.",
+                          num_segments);
+    }
+    const int64_t n = values.GetLength();
+    core::AssertTensorDevice(segment_ids, values.GetDevice());
+    core::AssertTensorShape(segment_ids, {n});
+    if (segment_ids.GetDtype() != core::Int32 &&
+        segment_ids.GetDtype() != core::Int64) {
+        utility::LogError("segment_ids must be Int32 or Int64, but got {}.",
+                          segment_ids.GetDtype().ToString());
+    }
+    Tensor ids = segment_ids.To(core::Int64).Contiguous();
+    if (n > 0 && (ids.Min({0}).Item<int64_t>() < 0 ||
+                  ids.Max({0}).Item<int64_t>() >= num_segments)) {
+        utility::LogError("segment_ids must be in [0, {}).", num_segments);
+    }
+
+    SizeVector result_shape = values.GetShape();
+    result_shape[0] = num_segments;
+    Tensor src = values.Contiguous().Reshape({n, NumSliceElements(values)});
+    return kernel::SegmentReduce(src, ids, num_segments, op)
+            .Reshape(result_shape);
+}
+
 }  // namespace core
 }  // namespace open3d
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/utility/Optional.h"
 
@@ -110,6 +112,56 @@ Tensor Append(const Tensor& self,
               const Tensor& other,
               const utility::optional<int64_t>& axis = utility::nullopt);
 
+/// \brief Finds the unique elements of a tensor.
+///
+/// The elements are sorted with a radix sort, on CPU a parallel LSD radix
+/// sort and on CUDA the radix sort of thrust.
+///
+/// Example:
+/// \code{.cpp}
+/// Tensor a = Tensor::Init<int64_t>({3, 1, 3, 2, 1, 3});
+/// Tensor unique, inverse, counts;
+/// std::tie(unique, inverse, counts) = core::Unique(a);
+/// // unique:  [1 2 3]
+/// // inverse: [2 0 2 1 0 2]
+/// // counts:  [2 1 3]
+/// \endcode
+///
+/// \param tensor The input tensor.
+/// \param dim [optional] If given, the unique slices along \p dim are
+/// returned, e.g. the unique rows of a 2D tensor for dim 0. Otherwise the
+/// tensor is flattened.
+/// \return A tuple (unique, inverse, counts). unique holds the unique elements
+/// or slices in ascending (lexicographic) order. inverse is an Int64 tensor
+/// with the index into unique for every element or slice of \p tensor.
+/// counts is an Int64 tensor with the number of occurrences of every unique
+/// element or slice.
+std::tuple<Tensor, Tensor, Tensor> Unique(
+        const Tensor& tensor,
+        const utility::optional<int64_t>& dim = utility::nullopt);
+
+/// Reduction operations for SegmentReduce().
+enum class SegmentReduceOp { Sum, Mean, Min, Max };
+
+/// \brief Reduces the slices of a tensor that belong to the same segment.
+///
+/// Row i of \p values, i.e. values[i], belongs to segment segment_ids[i].
+/// The rows are grouped with a radix sort on the segment ids, so the ids do
+/// not need to be sorted. Combined with the inverse indices of Unique(), this
+/// implements group-by operations such as averaging points per voxel.
+///
+/// \param values Tensor with at least one dimension.
+/// \param segment_ids Int32 or Int64 tensor of shape {values.GetLength()}
+/// with values in [0, num_segments).
+/// \param num_segments The number of segments.
+/// \param op The reduction. Mean is accumulated in double precision.
+/// \return Tensor of shape {num_segments, ...} with the remaining dimensions of
+/// \p values. Empty segments are zero.
+Tensor SegmentReduce(const Tensor& values,
+                     const Tensor& segment_ids,
+                     int64_t num_segments,
+                     SegmentReduceOp op);
+
 void SYCLDemo();
 
 }  // namespace core
@@ -68,6 +68,14 @@ HashBackendBuffer::HashBackendBuffer(int64_t capacity,
         value_buffers_.push_back(value_buffer_i);
     }
 
+    // The backends write through raw pointers into the buffers, so the
+    // buffers must never be shared copy-on-write.
+    heap_.GetBlob()->DisableCopyOnWrite();
+    key_buffer_.GetBlob()->DisableCopyOnWrite();
+    for (Tensor& value_buffer : value_buffers_) {
+        value_buffer.GetBlob()->DisableCopyOnWrite();
+    }
+
     // Heap top is device specific
     if (device.GetType() == Device::DeviceType::CUDA) {
         heap_top_.cuda = Tensor({1}, Dtype::Int32, device);
@@ -45,12 +45,12 @@ namespace kernel {
 template <typename src_t, typename dst_t, typename element_func_t>
 static void LaunchBinaryEWKernel(const Indexer& indexer,
                                  const element_func_t& element_func) {
-    ParallelFor(Device("CPU:0"), indexer.NumWorkloads(),
-                [&indexer, &element_func](int64_t i) {
-                    element_func(indexer.GetInputPtr<src_t>(0, i),
-                                 indexer.GetInputPtr<src_t>(1, i),
-                                 indexer.GetOutputPtr<dst_t>(i));
-                });
+    ParallelForCPU(indexer.NumWorkloads(),
+                   [&indexer, &element_func](int64_t i) {
+                       element_func(indexer.GetInputPtr<src_t>(0, i),
+                                    indexer.GetInputPtr<src_t>(1, i),
+                                    indexer.GetOutputPtr<dst_t>(i));
+                   });
 }
 
 template <typename src_t,
@@ -60,14 +60,12 @@ template <typename src_t,
 static void LaunchBinaryEWKernel(const Indexer& indexer,
                                  const element_func_t& element_func,
                                  const vec_func_t& vec_func) {
-    ParallelFor(
-            Device("CPU:0"), indexer.NumWorkloads(),
-            [&indexer, &element_func](int64_t i) {
-                element_func(indexer.GetInputPtr<src_t>(0, i),
-                             indexer.GetInputPtr<src_t>(1, i),
-                             indexer.GetOutputPtr<dst_t>(i));
-            },
-            vec_func);
+    auto func = [&indexer, &element_func](int64_t i) {
+        element_func(indexer.GetInputPtr<src_t>(0, i),
+                     indexer.GetInputPtr<src_t>(1, i),
+                     indexer.GetOutputPtr<dst_t>(i));
+    };
+    ParallelForCPU(indexer.NumWorkloads(), func, vec_func);
 }
 
 template <typename scalar_t>
@@ -0,0 +1,149 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+/// Unsigned integer type with the same size as T.
+template <typename T>
+using RadixKeyType = typename std::conditional<
+        sizeof(T) == 1,
+        uint8_t,
+        typename std::conditional<
+                sizeof(T) == 2,
+                uint16_t,
+                typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::
+                        type>::type>::type;
+
+/// Maps a value to an unsigned integer key with the same order, so that
+/// values can be sorted by their bits with a radix sort. -0.0 and 0.0 map to
+/// the same key and NaNs map to the largest key.
+template <typename T>
+OPEN3D_HOST_DEVICE inline
+        typename std::enable_if<std::is_floating_point<T>::value,
+                                RadixKeyType<T>>::type
+        ToRadixKey(T value) {
+    using key_type = RadixKeyType<T>;
+    const key_type sign = key_type(1) << (sizeof(T) * 8 - 1);
+    if (value != value) {
+        return ~key_type(0);
+    }
+    if (value == T(0)) {
+        value = T(0);
+    }
+    key_type bits;
+    memcpy(&bits, &value, sizeof(T));
+    return (bits & sign) ? key_type(~bits) : key_type(bits | sign);
+}
+
+template <typename T>
+OPEN3D_HOST_DEVICE inline typename std::enable_if<
+        std::is_integral<T>::value && std::is_signed<T>::value,
+        RadixKeyType<T>>::type
+ToRadixKey(T value) {
+    using key_type = RadixKeyType<T>;
+    const key_type sign = key_type(1) << (sizeof(T) * 8 - 1);
+    return key_type(key_type(value) ^ sign);
+}
+
+template <typename T>
+OPEN3D_HOST_DEVICE inline typename std::enable_if<
+        std::is_integral<T>::value && !std::is_signed<T>::value,
+        RadixKeyType<T>>::type
+ToRadixKey(T value) {
+    return RadixKeyType<T>(value);
+}
+
+// The kernels below do not go through Indexer. Indexer maps every output
+// element to one input element, or to the elements reduced into it, while
+// here an output depends on the order of a whole row or of all rows. The
+// callers instead move the sorted dimension last and make the input a
+// contiguous 2D tensor, so that the kernels can address rows directly.
+
+/// Stably sorts every row of the contiguous 2D tensor \p src. \p values gets
+/// the sorted rows and \p indices the Int64 positions of the sorted elements
+/// within their row.
+void Sort(const Tensor& src, bool descending, Tensor& values, Tensor& indices);
+
+void SortCPU(const Tensor& src,
+             bool descending,
+             Tensor& values,
+             Tensor& indices);
+
+/// Finds the unique rows of the contiguous 2D tensor \p src in ascending
+/// lexicographic order. \p inverse maps every row of \p src to its unique row
+/// and \p counts holds the number of occurrences of each unique row.
+void Unique(const Tensor& src, Tensor& unique, Tensor& inverse, Tensor& counts);
+
+void UniqueCPU(const Tensor& src,
+               Tensor& unique,
+               Tensor& inverse,
+               Tensor& counts);
+
+/// Reduces the rows of the contiguous 2D tensor \p values by the Int64
+/// \p segment_ids, which must be in [0, num_segments). Returns a tensor of
+/// shape {num_segments, values.GetShape(1)}. Empty segments are zero.
+Tensor SegmentReduce(const Tensor& values,
+                     const Tensor& segment_ids,
+                     int64_t num_segments,
+                     SegmentReduceOp op);
+
+Tensor SegmentReduceCPU(const Tensor& values,
+                        const Tensor& segment_ids,
+                        int64_t num_segments,
+                        SegmentReduceOp op);
+
+#ifdef BUILD_CUDA_MODULE
+void SortCUDA(const Tensor& src,
+              bool descending,
+              Tensor& values,
+              Tensor& indices);
+
+void UniqueCUDA(const Tensor& src,
+                Tensor& unique,
+                Tensor& inverse,
+                Tensor& counts);
+
+Tensor SegmentReduceCUDA(const Tensor& values,
+                         const Tensor& segment_ids,
+                         int64_t num_segments,
+                         SegmentReduceOp op);
+#endif
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
@@ -0,0 +1,359 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/Sort.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+#include "open3d/utility/ParallelScan.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+/// Inputs smaller than this are sorted with std::stable_sort.
+const int64_t kRadixSortMinSize = 1024;
+
+/// Minimum number of elements handled by one thread in a radix sort pass.
+const int64_t kRadixSortMinChunkSize = 1 << 16;
+
+/// \brief Stably sorts \p keys and reorders \p values accordingly.
+///
+/// This is a least significant digit radix sort over 8-bit digits. Every
+/// pass builds per-thread digit histograms, which are scanned in digit-major
+/// order so that the scatter keeps the relative order of equal digits. Only
+/// the lowest \p num_bits bits of the keys are considered, and passes where
+/// all keys have the same digit are skipped.
+template <typename K>
+void RadixSortPairs(std::vector<K>& keys,
+                    std::vector<int64_t>& values,
+                    int num_bits,
+                    int max_threads) {
+    const int64_t n = static_cast<int64_t>(keys.size());
+    if (n < kRadixSortMinSize) {
+        std::vector<int64_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(
+                order.begin(), order.end(),
+                [&](int64_t a, int64_t b) { return keys[a] < keys[b]; });
+        std::vector<K> sorted_keys(n);
+        std::vector<int64_t> sorted_values(n);
+        for (int64_t i = 0; i < n; ++i) {
+            sorted_keys[i] = keys[order[i]];
+            sorted_values[i] = values[order[i]];
+        }
+        keys.swap(sorted_keys);
+        values.swap(sorted_values);
+        return;
+    }
+
+    const int num_threads = static_cast<int>(std::max<int64_t>(
+            1, std::min<int64_t>(max_threads, n / kRadixSortMinChunkSize)));
+    const int64_t chunk_size = (n + num_threads - 1) / num_threads;
+    std::vector<K> keys_tmp(n);
+    std::vector<int64_t> values_tmp(n);
+    std::vector<int64_t> offsets(num_threads * 256);
+
+    for (int shift = 0; shift < num_bits; shift += 8) {
+        std::fill(offsets.begin(), offsets.end(), 0);
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int t = 0; t < num_threads; ++t) {
+            int64_t* histogram = offsets.data() + t * 256;
+            const int64_t end = std::min(n, (t + 1) * chunk_size);
+            for (int64_t i = t * chunk_size; i < end; ++i) {
+                ++histogram[(keys[i] >> shift) & 0xff];
+            }
+        }
+
+        bool trivial = false;
+        int64_t offset = 0;
+        for (int digit = 0; digit < 256; ++digit) {
+            int64_t count = 0;
+            for (int t = 0; t < num_threads; ++t) {
+                const int64_t tmp = offsets[t * 256 + digit];
+                offsets[t * 256 + digit] = offset + count;
+                count += tmp;
+            }
+            trivial |= count == n;
+            offset += count;
+        }
+        if (trivial) {
+            continue;
+        }
+
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (int t = 0; t < num_threads; ++t) {
+            int64_t* positions = offsets.data() + t * 256;
+            const int64_t end = std::min(n, (t + 1) * chunk_size);
+            for (int64_t i = t * chunk_size; i < end; ++i) {
+                const int64_t pos = positions[(keys[i] >> shift) & 0xff]++;
+                keys_tmp[pos] = keys[i];
+                values_tmp[pos] = values[i];
+            }
+        }
+        keys.swap(keys_tmp);
+        values.swap(values_tmp);
+    }
+}
+
+/// Returns the number of bits needed to represent values in [0, n).
+int NumBits(int64_t n) {
+    int num_bits = 1;
+    while (num_bits < 64 && (n - 1) >> num_bits) {
+        ++num_bits;
+    }
+    return num_bits;
+}
+
+template <typename scalar_t>
+void SortRows(const Tensor& src,
+              bool descending,
+              Tensor& values,
+              Tensor& indices) {
+    using key_type = decltype(ToRadixKey(scalar_t()));
+    const int64_t num_rows = src.GetShape(0);
+    const int64_t length = src.GetShape(1);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+    int64_t* indices_ptr = indices.GetDataPtr<int64_t>();
+    const int max_threads = utility::EstimateMaxThreads();
+
+    auto sort_row = [&](int64_t row, int num_threads) {
+        const scalar_t* row_ptr = src_ptr + row * length;
+        std::vector<key_type> keys(length);
+        std::vector<int64_t> order(length);
+        for (int64_t i = 0; i < length; ++i) {
+            keys[i] = ToRadixKey(row_ptr[i]);
+            if (descending) {
+                keys[i] = key_type(~keys[i]);
+            }
+            order[i] = i;
+        }
+        RadixSortPairs(keys, order, sizeof(key_type) * 8, num_threads);
+        for (int64_t i = 0; i < length; ++i) {
+            values_ptr[row * length + i] = row_ptr[order[i]];
+            indices_ptr[row * length + i] = order[i];
+        }
+    };
+
+    // Many rows are distributed over the threads, few long rows are sorted
+    // one after another by all threads.
+    if (num_rows >= max_threads) {
+#pragma omp parallel for schedule(static) num_threads(max_threads)
+        for (int64_t row = 0; row < num_rows; ++row) {
+            sort_row(row, 1);
+        }
+    } else {
+        for (int64_t row = 0; row < num_rows; ++row) {
+            sort_row(row, max_threads);
+        }
+    }
+}
+
+template <typename scalar_t>
+void UniqueRows(const Tensor& src,
+                Tensor& unique,
+                Tensor& inverse,
+                Tensor& counts) {
+    using key_type = decltype(ToRadixKey(scalar_t()));
+    const int64_t n = src.GetShape(0);
+    const int64_t num_cols = src.GetShape(1);
+    const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+    const int max_threads = utility::EstimateMaxThreads();
+
+    // Sorting by the columns from last to first with a stable sort orders
+    // the rows lexicographically.
+    std::vector<int64_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<key_type> keys(n);
+    for (int64_t col = num_cols - 1; col >= 0; --col) {
+#pragma omp parallel for schedule(static) num_threads(max_threads)
+        for (int64_t i = 0; i < n; ++i) {
+            keys[i] = ToRadixKey(src_ptr[order[i] * num_cols + col]);
+        }
+        RadixSortPairs(keys, order, sizeof(key_type) * 8, max_threads);
+    }
+
+    auto rows_equal = [&](int64_t a, int64_t b) {
+        for (int64_t col = 0; col < num_cols; ++col) {
+            if (ToRadixKey(src_ptr[a * num_cols + col]) !=
+                ToRadixKey(src_ptr[b * num_cols + col])) {
+                return false;
+            }
+        }
+        return true;
+    };
+    std::vector<int64_t> is_first(n);
+#pragma omp parallel for schedule(static) num_threads(max_threads)
+    for (int64_t i = 0; i < n; ++i) {
+        is_first[i] = i == 0 || !rows_equal(order[i - 1], order[i]);
+    }
+    std::vector<int64_t> group_ids(n);
+    utility::InclusivePrefixSum(is_first.data(), is_first.data() + n,
+                                group_ids.data());
+    const int64_t num_unique = n > 0 ? group_ids[n - 1] : 0;
+
+    unique = Tensor({num_unique, num_cols}, src.GetDtype(), src.GetDevice());
+    inverse = Tensor({n}, core::Int64, src.GetDevice());
+    counts = Tensor({num_unique}, core::Int64, src.GetDevice());
+    scalar_t* unique_ptr = unique.GetDataPtr<scalar_t>();
+    int64_t* inverse_ptr = inverse.GetDataPtr<int64_t>();
+    int64_t* counts_ptr = counts.GetDataPtr<int64_t>();
+
+    std::vector<int64_t> starts(num_unique);
+#pragma omp parallel for schedule(static) num_threads(max_threads)
+    for (int64_t i = 0; i < n; ++i) {
+        const int64_t group = group_ids[i] - 1;
+        inverse_ptr[order[i]] = group;
+        if (is_first[i]) {
+            starts[group] = i;
+            std::copy(src_ptr + order[i] * num_cols,
+                      src_ptr + (order[i] + 1) * num_cols,
+                      unique_ptr + group * num_cols);
+        }
+    }
+#pragma omp parallel for schedule(static) num_threads(max_threads)
+    for (int64_t group = 0; group < num_unique; ++group) {
+        const int64_t end = group + 1 < num_unique ? starts[group + 1] : n;
+        counts_ptr[group] = end - starts[group];
+    }
+}
+
+template <typename scalar_t>
+void ReduceSegments(const Tensor& values,
+                    const std::vector<int64_t>& order,
+                    const std::vector<int64_t>& starts,
+                    const std::vector<int64_t>& ends,
+                    SegmentReduceOp op,
+                    Tensor& result) {
+    const int64_t num_segments = result.GetShape(0);
+    const int64_t num_cols = result.GetShape(1);
+    const scalar_t* values_ptr = values.GetDataPtr<scalar_t>();
+    scalar_t* result_ptr = result.GetDataPtr<scalar_t>();
+
+#pragma omp parallel for schedule(dynamic, 64) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t segment = 0; segment < num_segments; ++segment) {
+        const int64_t begin = starts[segment];
+        const int64_t end = ends[segment];
+        if (begin == end) {
+            continue;
+        }
+        for (int64_t col = 0; col < num_cols; ++col) {
+            scalar_t acc = values_ptr[order[begin] * num_cols + col];
+            double sum = static_cast<double>(acc);
+            for (int64_t i = begin + 1; i < end; ++i) {
+                const scalar_t value = values_ptr[order[i] * num_cols + col];
+                switch (op) {
+                    case SegmentReduceOp::Sum:
+                        acc += value;
+                        break;
+                    case SegmentReduceOp::Mean:
+                        sum += static_cast<double>(value);
+                        break;
+                    case SegmentReduceOp::Min:
+                        acc = std::min(acc, value);
+                        break;
+                    case SegmentReduceOp::Max:
+                        acc = std::max(acc, value);
+                        break;
+                }
+            }
+            if (op == SegmentReduceOp::Mean) {
+                acc = static_cast<scalar_t>(sum / (end - begin));
+            }
+            result_ptr[segment * num_cols + col] = acc;
+        }
+    }
+}
+
+}  // namespace
+
+void SortCPU(const Tensor& src,
+             bool descending,
+             Tensor& values,
+             Tensor& indices) {
+    values = Tensor(src.GetShape(), src.GetDtype(), src.GetDevice());
+    indices = Tensor(src.GetShape(), core::Int64, src.GetDevice());
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        SortRows<scalar_t>(src, descending, values, indices);
+    });
+}
+
+void UniqueCPU(const Tensor& src,
+               Tensor& unique,
+               Tensor& inverse,
+               Tensor& counts) {
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        UniqueRows<scalar_t>(src, unique, inverse, counts);
+    });
+}
+
+Tensor SegmentReduceCPU(const Tensor& values,
+                        const Tensor& segment_ids,
+                        int64_t num_segments,
+                        SegmentReduceOp op) {
+    const int64_t n = values.GetShape(0);
+    const int64_t num_cols = values.GetShape(1);
+    const int max_threads = utility::EstimateMaxThreads();
+
+    // Group the rows by segment. Only the bits needed for num_segments are
+    // sorted.
+    const int64_t* segment_ids_ptr = segment_ids.GetDataPtr<int64_t>();
+    std::vector<uint64_t> keys(segment_ids_ptr, segment_ids_ptr + n);
+    std::vector<int64_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    RadixSortPairs(keys, order, NumBits(num_segments), max_threads);
+
+    std::vector<int64_t> starts(num_segments, 0);
+    std::vector<int64_t> ends(num_segments, 0);
+#pragma omp parallel for schedule(static) num_threads(max_threads)
+    for (int64_t i = 0; i < n; ++i) {
+        if (i == 0 || keys[i - 1] != keys[i]) {
+            starts[keys[i]] = i;
+        }
+        if (i + 1 == n || keys[i + 1] != keys[i]) {
+            ends[keys[i]] = i + 1;
+        }
+    }
+
+    Tensor result = Tensor::Zeros({num_segments, num_cols}, values.GetDtype(),
+                                  values.GetDevice());
+    DISPATCH_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        ReduceSegments<scalar_t>(values, order, starts, ends, op, result);
+    });
+    return result;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
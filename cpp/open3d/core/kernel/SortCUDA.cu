@@ -0,0 +1,346 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/kernel/Sort.h"
+
+namespace open3d {
+namespace core {
+namespace kernel {
+
+namespace {
+
+// thrust sorts unsigned integer keys with its radix sort, so all dtypes are
+// sorted through their radix keys.
+template <typename scalar_t, typename key_type>
+struct ElementKeyFunctor {
+    const scalar_t* src_;
+    bool descending_;
+
+    __device__ key_type operator()(int64_t i) const {
+        const key_type key = ToRadixKey(src_[i]);
+        return descending_ ? key_type(~key) : key;
+    }
+};
+
+template <typename scalar_t, typename key_type>
+struct ColumnKeyFunctor {
+    const scalar_t* src_;
+    int64_t num_cols_;
+    int64_t col_;
+
+    __device__ key_type operator()(int64_t row) const {
+        return ToRadixKey(src_[row * num_cols_ + col_]);
+    }
+};
+
+struct DivideFunctor {
+    int64_t divisor_;
+
+    __device__ int64_t operator()(int64_t i) const { return i / divisor_; }
+};
+
+struct ModuloFunctor {
+    int64_t divisor_;
+
+    __device__ int64_t operator()(int64_t i) const { return i % divisor_; }
+};
+
+template <typename scalar_t>
+struct IsFirstFunctor {
+    const scalar_t* src_;
+    const int64_t* order_;
+    int64_t num_cols_;
+
+    __device__ int64_t operator()(int64_t i) const {
+        if (i == 0) {
+            return 1;
+        }
+        const scalar_t* a = src_ + order_[i - 1] * num_cols_;
+        const scalar_t* b = src_ + order_[i] * num_cols_;
+        for (int64_t col = 0; col < num_cols_; ++col) {
+            if (ToRadixKey(a[col]) != ToRadixKey(b[col])) {
+                return 1;
+            }
+        }
+        return 0;
+    }
+};
+
+template <typename scalar_t>
+struct UniqueScatterFunctor {
+    const scalar_t* src_;
+    const int64_t* order_;
+    const int64_t* is_first_;
+    const int64_t* group_ids_;
+    int64_t num_cols_;
+    scalar_t* unique_;
+    int64_t* inverse_;
+    int64_t* starts_;
+
+    __device__ void operator()(int64_t i) const {
+        const int64_t group = group_ids_[i] - 1;
+        inverse_[order_[i]] = group;
+        if (is_first_[i]) {
+            starts_[group] = i;
+            for (int64_t col = 0; col < num_cols_; ++col) {
+                unique_[group * num_cols_ + col] =
+                        src_[order_[i] * num_cols_ + col];
+            }
+        }
+    }
+};
+
+struct CountFunctor {
+    const int64_t* starts_;
+    int64_t num_unique_;
+    int64_t n_;
+    int64_t* counts_;
+
+    __device__ void operator()(int64_t group) const {
+        const int64_t end =
+                group + 1 < num_unique_ ? starts_[group + 1] : n_;
+        counts_[group] = end - starts_[group];
+    }
+};
+
+struct SegmentBoundaryFunctor {
+    const int64_t* keys_;
+    int64_t n_;
+    int64_t* starts_;
+    int64_t* ends_;
+
+    __device__ void operator()(int64_t i) const {
+        if (i == 0 || keys_[i - 1] != keys_[i]) {
+            starts_[keys_[i]] = i;
+        }
+        if (i + 1 == n_ || keys_[i + 1] != keys_[i]) {
+            ends_[keys_[i]] = i + 1;
+        }
+    }
+};
+
+template <typename scalar_t>
+struct SegmentReduceFunctor {
+    const scalar_t* values_;
+    const int64_t* order_;
+    const int64_t* starts_;
+    const int64_t* ends_;
+    int64_t num_cols_;
+    SegmentReduceOp op_;
+    scalar_t* result_;
+
+    __device__ void operator()(int64_t workload_idx) const {
+        const int64_t segment = workload_idx / num_cols_;
+        const int64_t col = workload_idx % num_cols_;
+        const int64_t begin = starts_[segment];
+        const int64_t end = ends_[segment];
+        if (begin == end) {
+            return;
+        }
+        scalar_t acc = values_[order_[begin] * num_cols_ + col];
+        double sum = static_cast<double>(acc);
+        for (int64_t i = begin + 1; i < end; ++i) {
+            const scalar_t value = values_[order_[i] * num_cols_ + col];
+            switch (op_) {
+                case SegmentReduceOp::Sum:
+                    acc += value;
+                    break;
+                case SegmentReduceOp::Mean:
+                    sum += static_cast<double>(value);
+                    break;
+                case SegmentReduceOp::Min:
+                    acc = value < acc ? value : acc;
+                    break;
+                case SegmentReduceOp::Max:
+                    acc = value > acc ? value : acc;
+                    break;
+            }
+        }
+        if (op_ == SegmentReduceOp::Mean) {
+            acc = static_cast<scalar_t>(sum / (end - begin));
+        }
+        result_[workload_idx] = acc;
+    }
+};
+
+}  // namespace
+
+void SortCUDA(const Tensor& src,
+              bool descending,
+              Tensor& values,
+              Tensor& indices) {
+    CUDAScopedDevice scoped_device(src.GetDevice());
+    const int64_t num_rows = src.GetShape(0);
+    const int64_t length = src.GetShape(1);
+    const int64_t n = num_rows * length;
+    values = Tensor(src.GetShape(), src.GetDtype(), src.GetDevice());
+    indices = Tensor(src.GetShape(), core::Int64, src.GetDevice());
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using key_type = decltype(ToRadixKey(scalar_t()));
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        thrust::counting_iterator<int64_t> first(0);
+
+        thrust::device_vector<key_type> keys(n);
+        thrust::transform(thrust::device, first, first + n, keys.begin(),
+                          ElementKeyFunctor<scalar_t, key_type>{src_ptr,
+                                                                descending});
+        thrust::device_ptr<int64_t> order(indices.GetDataPtr<int64_t>());
+        thrust::sequence(thrust::device, order, order + n);
+        thrust::stable_sort_by_key(thrust::device, keys.begin(), keys.end(),
+                                   order);
+        if (num_rows > 1) {
+            // A stable sort by row groups the rows again and keeps the order
+            // within each row.
+            thrust::device_vector<int64_t> rows(n);
+            thrust::transform(thrust::device, order, order + n, rows.begin(),
+                              DivideFunctor{length});
+            thrust::stable_sort_by_key(thrust::device, rows.begin(),
+                                       rows.end(), order);
+        }
+        thrust::gather(thrust::device, order, order + n,
+                       thrust::device_ptr<const scalar_t>(src_ptr),
+                       thrust::device_ptr<scalar_t>(
+                               values.GetDataPtr<scalar_t>()));
+        thrust::transform(thrust::device, order, order + n, order,
+                          ModuloFunctor{length});
+    });
+}
+
+void UniqueCUDA(const Tensor& src,
+                Tensor& unique,
+                Tensor& inverse,
+                Tensor& counts) {
+    CUDAScopedDevice scoped_device(src.GetDevice());
+    const int64_t n = src.GetShape(0);
+    const int64_t num_cols = src.GetShape(1);
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        using key_type = decltype(ToRadixKey(scalar_t()));
+        const scalar_t* src_ptr = src.GetDataPtr<scalar_t>();
+        thrust::counting_iterator<int64_t> first(0);
+
+        // Sorting by the columns from last to first with a stable sort
+        // orders the rows lexicographically.
+        thrust::device_vector<int64_t> order(n);
+        thrust::sequence(thrust::device, order.begin(), order.end());
+        thrust::device_vector<key_type> keys(n);
+        for (int64_t col = num_cols - 1; col >= 0; --col) {
+            thrust::transform(
+                    thrust::device, order.begin(), order.end(), keys.begin(),
+                    ColumnKeyFunctor<scalar_t, key_type>{src_ptr, num_cols,
+                                                         col});
+            thrust::stable_sort_by_key(thrust::device, keys.begin(),
+                                       keys.end(), order.begin());
+        }
+
+        const int64_t* order_ptr = thrust::raw_pointer_cast(order.data());
+        thrust::device_vector<int64_t> is_first(n);
+        thrust::transform(
+                thrust::device, first, first + n, is_first.begin(),
+                IsFirstFunctor<scalar_t>{src_ptr, order_ptr, num_cols});
+        thrust::device_vector<int64_t> group_ids(n);
+        thrust::inclusive_scan(thrust::device, is_first.begin(),
+                               is_first.end(), group_ids.begin());
+        const int64_t num_unique = n > 0 ? group_ids[n - 1] : 0;
+
+        unique = Tensor({num_unique, num_cols}, src.GetDtype(),
+                        src.GetDevice());
+        inverse = Tensor({n}, core::Int64, src.GetDevice());
+        counts = Tensor({num_unique}, core::Int64, src.GetDevice());
+        thrust::device_vector<int64_t> starts(num_unique);
+        thrust::for_each(
+                thrust::device, first, first + n,
+                UniqueScatterFunctor<scalar_t>{
+                        src_ptr, order_ptr,
+                        thrust::raw_pointer_cast(is_first.data()),
+                        thrust::raw_pointer_cast(group_ids.data()), num_cols,
+                        unique.GetDataPtr<scalar_t>(),
+                        inverse.GetDataPtr<int64_t>(),
+                        thrust::raw_pointer_cast(starts.data())});
+        thrust::for_each(thrust::device, first, first + num_unique,
+                         CountFunctor{thrust::raw_pointer_cast(starts.data()),
+                                      num_unique, n,
+                                      counts.GetDataPtr<int64_t>()});
+    });
+}
+
+Tensor SegmentReduceCUDA(const Tensor& values,
+                         const Tensor& segment_ids,
+                         int64_t num_segments,
+                         SegmentReduceOp op) {
+    CUDAScopedDevice scoped_device(values.GetDevice());
+    const int64_t n = values.GetShape(0);
+    const int64_t num_cols = values.GetShape(1);
+    thrust::counting_iterator<int64_t> first(0);
+
+    // Group the rows by segment.
+    thrust::device_ptr<const int64_t> segment_ids_ptr(
+            segment_ids.GetDataPtr<int64_t>());
+    thrust::device_vector<int64_t> keys(segment_ids_ptr, segment_ids_ptr + n);
+    thrust::device_vector<int64_t> order(n);
+    thrust::sequence(thrust::device, order.begin(), order.end());
+    thrust::stable_sort_by_key(thrust::device, keys.begin(), keys.end(),
+                               order.begin());
+
+    thrust::device_vector<int64_t> starts(num_segments, 0);
+    thrust::device_vector<int64_t> ends(num_segments, 0);
+    thrust::for_each(
+            thrust::device, first, first + n,
+            SegmentBoundaryFunctor{thrust::raw_pointer_cast(keys.data()), n,
+                                   thrust::raw_pointer_cast(starts.data()),
+                                   thrust::raw_pointer_cast(ends.data())});
+
+    Tensor result = Tensor::Zeros({num_segments, num_cols}, values.GetDtype(),
+                                  values.GetDevice());
+    DISPATCH_DTYPE_TO_TEMPLATE(values.GetDtype(), [&]() {
+        thrust::for_each(
+                thrust::device, first, first + num_segments * num_cols,
+                SegmentReduceFunctor<scalar_t>{
+                        values.GetDataPtr<scalar_t>(),
+                        thrust::raw_pointer_cast(order.data()),
+                        thrust::raw_pointer_cast(starts.data()),
+                        thrust::raw_pointer_cast(ends.data()), num_cols, op,
+                        result.GetDataPtr<scalar_t>()});
+    });
+    return result;
+}
+
+}  // namespace kernel
+}  // namespace core
+}  // namespace open3d
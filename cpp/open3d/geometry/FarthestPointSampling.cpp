@@ -0,0 +1,297 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/FarthestPointSampling.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Number of points per block when the points are not partitioned. Small
+/// enough for the distances of a block to stay in cache between the update
+/// and the argmax pass.
+constexpr int64_t kBlockSize = 4096;
+
+template <typename scalar_t>
+struct Bucket {
+    int64_t begin_;
+    int64_t end_;
+    std::array<scalar_t, 3> min_bound_;
+    std::array<scalar_t, 3> max_bound_;
+    /// Largest distance of a point in the bucket to the samples, and the
+    /// smallest index of a point at that distance.
+    scalar_t farthest_distance_;
+    int64_t farthest_index_;
+};
+
+template <typename scalar_t>
+class FarthestPointSampler {
+public:
+    FarthestPointSampler(const scalar_t *points,
+                         int64_t num_points,
+                         int64_t bucket_size)
+        : points_(points),
+          indices_(num_points),
+          x_(num_points),
+          y_(num_points),
+          z_(num_points),
+          distances_(num_points, std::numeric_limits<scalar_t>::infinity()),
+          use_bounds_(bucket_size > 0) {
+        std::iota(indices_.begin(), indices_.end(), int64_t(0));
+        if (use_bounds_) {
+            Partition(num_points, bucket_size);
+        } else {
+            for (int64_t begin = 0; begin < num_points; begin += kBlockSize) {
+                Bucket<scalar_t> bucket;
+                bucket.begin_ = begin;
+                bucket.end_ = std::min(begin + kBlockSize, num_points);
+                buckets_.push_back(bucket);
+            }
+        }
+        for (Bucket<scalar_t> &bucket : buckets_) {
+            bucket.farthest_distance_ =
+                    std::numeric_limits<scalar_t>::infinity();
+            bucket.farthest_index_ = indices_[bucket.begin_];
+        }
+
+        // Positions are stored as separate x, y and z arrays in bucket order,
+        // so that the distance update vectorizes.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_points; ++i) {
+            const scalar_t *point = points_ + 3 * indices_[i];
+            x_[i] = point[0];
+            y_[i] = point[1];
+            z_[i] = point[2];
+        }
+    }
+
+    void Sample(int64_t num_samples,
+                int64_t start_index,
+                int64_t *sample_indices) {
+        if (num_samples <= 0) {
+            return;
+        }
+        const int64_t num_buckets = static_cast<int64_t>(buckets_.size());
+        sample_indices[0] = start_index;
+        for (int64_t k = 1; k < num_samples; ++k) {
+            const scalar_t *sample = points_ + 3 * sample_indices[k - 1];
+#pragma omp parallel for schedule(dynamic, 1) if (num_buckets > 1) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t b = 0; b < num_buckets; ++b) {
+                UpdateBucket(buckets_[b], sample);
+            }
+
+            // Ties go to the smallest index, independently of the bucket
+            // order.
+            const Bucket<scalar_t> *farthest = &buckets_[0];
+            for (const Bucket<scalar_t> &bucket : buckets_) {
+                if (bucket.farthest_distance_ > farthest->farthest_distance_ ||
+                    (bucket.farthest_distance_ ==
+                             farthest->farthest_distance_ &&
+                     bucket.farthest_index_ < farthest->farthest_index_)) {
+                    farthest = &bucket;
+                }
+            }
+            sample_indices[k] = farthest->farthest_index_;
+        }
+    }
+
+private:
+    /// Splits the points at the median of the longest axis of their bounding
+    /// box until at most \p bucket_size points are left.
+    void Partition(int64_t num_points, int64_t bucket_size) {
+        std::vector<std::pair<int64_t, int64_t>> ranges{{0, num_points}};
+        while (!ranges.empty()) {
+            const int64_t begin = ranges.back().first;
+            const int64_t end = ranges.back().second;
+            ranges.pop_back();
+
+            Bucket<scalar_t> bucket;
+            bucket.begin_ = begin;
+            bucket.end_ = end;
+            ComputeBounds(bucket);
+            if (end - begin <= bucket_size) {
+                // Within a bucket points are kept in index order, so that the
+                // first point at the largest distance has the smallest index.
+                std::sort(indices_.begin() + begin, indices_.begin() + end);
+                buckets_.push_back(bucket);
+                continue;
+            }
+
+            int axis = 0;
+            for (int d = 1; d < 3; ++d) {
+                if (bucket.max_bound_[d] - bucket.min_bound_[d] >
+                    bucket.max_bound_[axis] - bucket.min_bound_[axis]) {
+                    axis = d;
+                }
+            }
+            const int64_t mid = begin + (end - begin) / 2;
+            const scalar_t *points = points_;
+            std::nth_element(indices_.begin() + begin, indices_.begin() + mid,
+                             indices_.begin() + end,
+                             [points, axis](int64_t lhs, int64_t rhs) {
+                                 return points[3 * lhs + axis] <
+                                        points[3 * rhs + axis];
+                             });
+            ranges.emplace_back(begin, mid);
+            ranges.emplace_back(mid, end);
+        }
+    }
+
+    void ComputeBounds(Bucket<scalar_t> &bucket) const {
+        const scalar_t *first = points_ + 3 * indices_[bucket.begin_];
+        for (int d = 0; d < 3; ++d) {
+            bucket.min_bound_[d] = first[d];
+            bucket.max_bound_[d] = first[d];
+        }
+        for (int64_t i = bucket.begin_ + 1; i < bucket.end_; ++i) {
+            const scalar_t *point = points_ + 3 * indices_[i];
+            for (int d = 0; d < 3; ++d) {
+                bucket.min_bound_[d] = std::min(bucket.min_bound_[d], point[d]);
+                bucket.max_bound_[d] = std::max(bucket.max_bound_[d], point[d]);
+            }
+        }
+    }
+
+    /// Lower bound of the squared distance between \p sample and any point in
+    /// \p bucket. The bounds are point coordinates, so the bound never exceeds
+    /// the distance computed for a point.
+    static scalar_t ComputeBoundDistance(const Bucket<scalar_t> &bucket,
+                                         const scalar_t *sample) {
+        scalar_t distance = 0;
+        for (int d = 0; d < 3; ++d) {
+            scalar_t delta = 0;
+            if (sample[d] < bucket.min_bound_[d]) {
+                delta = bucket.min_bound_[d] - sample[d];
+            } else if (sample[d] > bucket.max_bound_[d]) {
+                delta = sample[d] - bucket.max_bound_[d];
+            }
+            distance += delta * delta;
+        }
+        return distance;
+    }
+
+    void UpdateBucket(Bucket<scalar_t> &bucket, const scalar_t *sample) {
+        // No point of the bucket can get closer to the samples than it is.
+        if (use_bounds_ && ComputeBoundDistance(bucket, sample) >=
+                                   bucket.farthest_distance_) {
+            return;
+        }
+
+        const scalar_t sx = sample[0];
+        const scalar_t sy = sample[1];
+        const scalar_t sz = sample[2];
+        const scalar_t *x = x_.data();
+        const scalar_t *y = y_.data();
+        const scalar_t *z = z_.data();
+        scalar_t *distances = distances_.data();
+        scalar_t farthest_distance = 0;
+        // OpenMP 4.0 allows the max reduction to be reordered, so that the
+        // loop vectorizes.
+#if defined(_OPENMP) && _OPENMP >= 201307
+#pragma omp simd reduction(max : farthest_distance)
+#endif
+        for (int64_t i = bucket.begin_; i < bucket.end_; ++i) {
+            const scalar_t dx = x[i] - sx;
+            const scalar_t dy = y[i] - sy;
+            const scalar_t dz = z[i] - sz;
+            const scalar_t distance =
+                    std::min(distances[i], dx * dx + dy * dy + dz * dz);
+            distances[i] = distance;
+            farthest_distance = std::max(farthest_distance, distance);
+        }
+
+        int64_t i = bucket.begin_;
+        while (i + 1 < bucket.end_ && distances[i] != farthest_distance) {
+            ++i;
+        }
+        bucket.farthest_distance_ = farthest_distance;
+        bucket.farthest_index_ = indices_[i];
+    }
+
+    const scalar_t *points_;
+    /// Point indices in bucket order.
+    std::vector<int64_t> indices_;
+    std::vector<scalar_t> x_;
+    std::vector<scalar_t> y_;
+    std::vector<scalar_t> z_;
+    /// Squared distance of each point to the closest sample, in bucket order.
+    std::vector<scalar_t> distances_;
+    std::vector<Bucket<scalar_t>> buckets_;
+    bool use_bounds_;
+};
+
+}  // namespace
+
+template <typename scalar_t>
+void FarthestPointSampling(const scalar_t *points,
+                           int64_t num_points,
+                           int64_t num_samples,
+                           int64_t start_index,
+                           int64_t bucket_size,
+                           int64_t *sample_indices) {
+    if (num_samples > num_points) {
+        utility::LogError(
+                "Illegal number of samples: {}, must <= point size: {}",
+                num_samples, num_points);
+    }
+    if (num_samples <= 0) {
+        return;
+    }
+    if (start_index < 0 || start_index >= num_points) {
+        utility::LogError("Illegal start index: {}, must < point size: {}",
+                          start_index, num_points);
+    }
+    FarthestPointSampler<scalar_t> sampler(points, num_points, bucket_size);
+    sampler.Sample(num_samples, start_index, sample_indices);
+}
+
+template void FarthestPointSampling<float>(const float *points,
+                                           int64_t num_points,
+                                           int64_t num_samples,
+                                           int64_t start_index,
+                                           int64_t bucket_size,
+                                           int64_t *sample_indices);
+template void FarthestPointSampling<double>(const double *points,
+                                            int64_t num_points,
+                                            int64_t num_samples,
+                                            int64_t start_index,
+                                            int64_t bucket_size,
+                                            int64_t *sample_indices);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,64 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace open3d {
+namespace geometry {
+
+/// \brief Farthest point sampling on CPU, shared by the legacy and the tensor
+/// point clouds.
+///
+/// Starting from \p start_index, iteratively selects the point with the
+/// largest distance to all points selected so far. Ties go to the smallest
+/// point index, so the result does not depend on the number of threads.
+///
+/// The distance update and the argmax reduction run in parallel over blocks
+/// of points. If \p bucket_size is positive, the points are first partitioned
+/// into a kd-tree with leaf buckets of at most \p bucket_size points, and a
+/// bucket is only updated if its bounding box is closer to the new sample than
+/// its current farthest point. The selected samples are the same, but large
+/// clouds need far fewer distance updates.
+///
+/// \param points Point positions, num_points x 3, row major.
+/// \param num_points Number of points.
+/// \param num_samples Number of samples, at most \p num_points.
+/// \param start_index Index of the first sample.
+/// \param bucket_size Maximum number of points per bucket, or 0 to update all
+/// points for every sample.
+/// \param sample_indices [out] Indices of the num_samples selected points.
+template <typename scalar_t>
+void FarthestPointSampling(const scalar_t *points,
+                           int64_t num_points,
+                           int64_t num_samples,
+                           int64_t start_index,
+                           int64_t bucket_size,
+                           int64_t *sample_indices);
+
+}  // namespace geometry
+}  // namespace open3d
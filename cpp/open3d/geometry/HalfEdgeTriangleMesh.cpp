@@ -26,11 +26,14 @@
 
 #include "open3d/geometry/HalfEdgeTriangleMesh.h"
 
+#include <algorithm>
 #include <numeric>
 
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/TriangleMeshTopology.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -171,112 +174,62 @@ HalfEdgeTriangleMesh::CreateFromTriangleMesh(const TriangleMesh &mesh) {
     mesh_cpy->RemoveUnreferencedVertices();
     mesh_cpy->RemoveDegenerateTriangles();
 
-    // Collect half edges
-    // Check: for valid manifolds, there mustn't be duplicated half-edges
-    std::unordered_map<Eigen::Vector2i, size_t,
-                       utility::hash_eigen<Eigen::Vector2i>>
-            vertex_indices_to_half_edge_index;
-
-    for (size_t triangle_index = 0;
-         triangle_index < mesh_cpy->triangles_.size(); triangle_index++) {
-        const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
-        size_t num_half_edges = het_mesh->half_edges_.size();
-
-        size_t he_0_index = num_half_edges;
-        size_t he_1_index = num_half_edges + 1;
-        size_t he_2_index = num_half_edges + 2;
-        HalfEdge he_0(Eigen::Vector2i(triangle(0), triangle(1)),
-                      int(triangle_index), int(he_1_index), -1);
-        HalfEdge he_1(Eigen::Vector2i(triangle(1), triangle(2)),
-                      int(triangle_index), int(he_2_index), -1);
-        HalfEdge he_2(Eigen::Vector2i(triangle(2), triangle(0)),
-                      int(triangle_index), int(he_0_index), -1);
-
-        if (vertex_indices_to_half_edge_index.find(he_0.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_1.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end() ||
-            vertex_indices_to_half_edge_index.find(he_2.vertex_indices_) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            utility::LogError(
-                    "ComputeHalfEdges failed. Duplicated half-edges.");
-        }
-
-        het_mesh->half_edges_.push_back(he_0);
-        het_mesh->half_edges_.push_back(he_1);
-        het_mesh->half_edges_.push_back(he_2);
-        vertex_indices_to_half_edge_index[he_0.vertex_indices_] = he_0_index;
-        vertex_indices_to_half_edge_index[he_1.vertex_indices_] = he_1_index;
-        vertex_indices_to_half_edge_index[he_2.vertex_indices_] = he_2_index;
+    // The half-edges are read off the cached topology of the purged mesh,
+    // which is built in parallel from the sorted edges.
+    const auto topology = mesh_cpy->GetTopology();
+    const int num_half_edges = int(3 * mesh_cpy->triangles_.size());
+    const int num_vertices = int(mesh_cpy->vertices_.size());
+
+    // Check: for valid manifolds, there mustn't be duplicated half-edges,
+    // i.e., every edge has one triangle or two of opposite orientation.
+    bool has_duplicated_half_edges = false;
+#pragma omp parallel for reduction(|| : has_duplicated_half_edges) \
+        schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int he_index = 0; he_index < num_half_edges; ++he_index) {
+        has_duplicated_half_edges =
+                has_duplicated_half_edges ||
+                (topology->half_edge_twins_[he_index] == -1 &&
+                 topology->EdgeDegree(topology->triangle_edges_[he_index]) !=
+                         1);
     }
-
-    // Fill twin half-edge. In the previous step, it is already guaranteed that
-    // each half-edge can have at most one twin half-edge.
-    for (size_t this_he_index = 0; this_he_index < het_mesh->half_edges_.size();
-         this_he_index++) {
-        HalfEdge &this_he = het_mesh->half_edges_[this_he_index];
-        Eigen::Vector2i twin_end_points(this_he.vertex_indices_(1),
-                                        this_he.vertex_indices_(0));
-        if (this_he.twin_ == -1 &&
-            vertex_indices_to_half_edge_index.find(twin_end_points) !=
-                    vertex_indices_to_half_edge_index.end()) {
-            size_t twin_he_index =
-                    vertex_indices_to_half_edge_index[twin_end_points];
-            HalfEdge &twin_he = het_mesh->half_edges_[twin_he_index];
-            this_he.twin_ = int(twin_he_index);
-            twin_he.twin_ = int(this_he_index);
-        }
+    if (has_duplicated_half_edges) {
+        utility::LogError("ComputeHalfEdges failed. Duplicated half-edges.");
     }
 
-    // Get out-going half-edges from each vertex. This can be done during
-    // half-edge construction. Done here for readability.
-    std::vector<std::vector<int>> half_edges_from_vertex(
-            mesh_cpy->vertices_.size());
-    for (size_t half_edge_index = 0;
-         half_edge_index < het_mesh->half_edges_.size(); half_edge_index++) {
-        int src_vertex_index =
-                het_mesh->half_edges_[half_edge_index].vertex_indices_(0);
-        half_edges_from_vertex[src_vertex_index].push_back(
-                int(half_edge_index));
+    het_mesh->half_edges_.resize(num_half_edges);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int he_index = 0; he_index < num_half_edges; ++he_index) {
+        const int triangle_index = he_index / 3;
+        const Eigen::Vector3i &triangle = mesh_cpy->triangles_[triangle_index];
+        het_mesh->half_edges_[he_index] = HalfEdge(
+                Eigen::Vector2i(triangle(he_index % 3),
+                                triangle((he_index + 1) % 3)),
+                triangle_index, TriangleMeshTopology::NextHalfEdge(he_index),
+                topology->half_edge_twins_[he_index]);
     }
 
-    // Find ordered half-edges from each vertex by traversal. To be a valid
-    // manifold, there can be at most 1 boundary half-edge from each vertex.
-    het_mesh->ordered_half_edge_from_vertex_.resize(mesh_cpy->vertices_.size());
-    for (size_t vertex_index = 0; vertex_index < mesh_cpy->vertices_.size();
-         vertex_index++) {
-        size_t num_boundaries = 0;
-        int init_half_edge_index = 0;
-        for (const int &half_edge_index :
-             half_edges_from_vertex[vertex_index]) {
-            if (het_mesh->half_edges_[half_edge_index].IsBoundary()) {
-                num_boundaries++;
-                init_half_edge_index = half_edge_index;
-            }
-        }
-        if (num_boundaries > 1) {
-            utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
-        }
-        // If there is a boundary edge, start from that; otherwise start
-        // with any half-edge (default 0) started from this vertex.
-        if (num_boundaries == 0) {
-            init_half_edge_index = half_edges_from_vertex[vertex_index][0];
-        }
-
-        // Push edges to ordered_half_edge_from_vertex_.
-        int curr_he_index = init_half_edge_index;
-        het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                curr_he_index);
-        int next_next_twin_he_index =
-                het_mesh->NextHalfEdgeFromVertex(curr_he_index);
-        curr_he_index = next_next_twin_he_index;
-        while (curr_he_index != -1 && curr_he_index != init_half_edge_index) {
-            het_mesh->ordered_half_edge_from_vertex_[vertex_index].push_back(
-                    curr_he_index);
-            next_next_twin_he_index =
-                    het_mesh->NextHalfEdgeFromVertex(curr_he_index);
-            curr_he_index = next_next_twin_he_index;
-        }
+    // The outgoing half-edges of every vertex are ordered counter-clockwise,
+    // starting at the boundary half-edge. To be a valid manifold, there can be
+    // at most 1 boundary half-edge from each vertex.
+    bool has_invalid_vertex = false;
+    het_mesh->ordered_half_edge_from_vertex_.resize(num_vertices);
+#pragma omp parallel for reduction(|| : has_invalid_vertex) schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vertex_index = 0; vertex_index < num_vertices; ++vertex_index) {
+        auto begin = topology->vertex_half_edges_.begin() +
+                     topology->vertex_half_edge_offsets_[vertex_index];
+        auto end = topology->vertex_half_edges_.begin() +
+                   topology->vertex_half_edge_offsets_[vertex_index + 1];
+        const auto num_boundaries = std::count_if(begin, end, [&](int he) {
+            return het_mesh->half_edges_[he].IsBoundary();
+        });
+        has_invalid_vertex = has_invalid_vertex || num_boundaries > 1;
+        het_mesh->ordered_half_edge_from_vertex_[vertex_index].assign(begin,
+                                                                      end);
+    }
+    if (has_invalid_vertex) {
+        utility::LogError("ComputeHalfEdges failed. Invalid vertex.");
     }
 
     mesh_cpy->ComputeVertexNormals();
@@ -103,7 +103,9 @@ public:
     HalfEdgeTriangleMesh operator+(const HalfEdgeTriangleMesh &mesh) const;
 
     /// Convert HalfEdgeTriangleMesh from TriangleMesh. Throws exception if the
-    /// input mesh is not manifold.
+    /// input mesh is not manifold. The half-edges are built in parallel from
+    /// the TriangleMeshTopology of the input, where half-edge 3 * t + k starts
+    /// at vertex k of triangle t.
     static std::shared_ptr<HalfEdgeTriangleMesh> CreateFromTriangleMesh(
             const TriangleMesh &mesh);
 
@@ -0,0 +1,238 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/LoopSubdivision.h"
+
+#include <algorithm>
+
+#include "open3d/geometry/TriangleMeshTopology.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+LoopSubdivision::LoopSubdivision(const std::vector<Eigen::Vector3i> &triangles,
+                                 const TriangleMeshTopology &topology,
+                                 size_t num_vertices) {
+    const int64_t num_old_vertices = static_cast<int64_t>(num_vertices);
+    const int64_t num_triangles = static_cast<int64_t>(triangles.size());
+    const int64_t num_edges = static_cast<int64_t>(topology.NumEdges());
+    const int64_t num_new_vertices = num_old_vertices + num_edges;
+
+    // Number of distinct triangles of every edge. The triangles of an edge are
+    // sorted, so repeated ones are adjacent.
+    std::vector<int> edge_num_triangles(num_edges);
+    bool has_non_manifold_edge = false;
+#pragma omp parallel for reduction(|| : has_non_manifold_edge) \
+        schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t e = 0; e < num_edges; ++e) {
+        const int *edge_triangles = topology.edge_triangles_.data();
+        int count = 0;
+        for (int64_t i = topology.edge_offsets_[e];
+             i < topology.edge_offsets_[e + 1]; ++i) {
+            if (i == topology.edge_offsets_[e] ||
+                edge_triangles[i] != edge_triangles[i - 1]) {
+                ++count;
+            }
+        }
+        edge_num_triangles[e] = count;
+        has_non_manifold_edge = has_non_manifold_edge || count > 2;
+    }
+    if (has_non_manifold_edge) {
+        utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+    }
+
+    // Number the edge vertices in the order of the first corner of every edge.
+    // The first triangle of an edge is its smallest one, so a corner is first
+    // if it lies in that triangle and no earlier corner of the triangle has
+    // the same edge.
+    std::vector<int> edge_vertices(num_edges);
+    int next_vertex = int(num_old_vertices);
+    for (int64_t c = 0; c < 3 * num_triangles; ++c) {
+        const int64_t e = topology.triangle_edges_[c];
+        const int64_t t = c / 3;
+        if (topology.edge_triangles_[topology.edge_offsets_[e]] != t ||
+            (c % 3 > 0 && topology.triangle_edges_[3 * t] == e) ||
+            (c % 3 > 1 && topology.triangle_edges_[3 * t + 1] == e)) {
+            continue;
+        }
+        edge_vertices[e] = next_vertex++;
+    }
+
+    // Neighbors of vertex v across edges with a single triangle.
+    auto BoundaryNeighbors = [&](int64_t v, std::vector<int> &neighbors) {
+        neighbors.clear();
+        for (int64_t i = topology.vertex_half_edge_offsets_[v];
+             i < topology.vertex_half_edge_offsets_[v + 1]; ++i) {
+            const int h = topology.vertex_half_edges_[i];
+            const int prev = TriangleMeshTopology::PrevHalfEdge(h);
+            if (edge_num_triangles[topology.triangle_edges_[h]] == 1) {
+                neighbors.push_back(triangles[h / 3]((h + 1) % 3));
+            }
+            if (edge_num_triangles[topology.triangle_edges_[prev]] == 1) {
+                neighbors.push_back(triangles[prev / 3](prev % 3));
+            }
+        }
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                        neighbors.end());
+    };
+
+    // Count the stencil sizes, then fill the stencils.
+    stencil_offsets_.assign(num_new_vertices + 1, 0);
+    bool has_complex_boundary = false;
+#pragma omp parallel reduction(|| : has_complex_boundary) \
+        num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<int> boundary_neighbors;
+#pragma omp for schedule(static)
+        for (int64_t v = 0; v < num_old_vertices; ++v) {
+            const int64_t num_neighbors = topology.vertex_offsets_[v + 1] -
+                                          topology.vertex_offsets_[v];
+            BoundaryNeighbors(v, boundary_neighbors);
+            // In manifold meshes this should not happen.
+            has_complex_boundary =
+                    has_complex_boundary || boundary_neighbors.size() > 2;
+            stencil_offsets_[v + 1] =
+                    1 + (boundary_neighbors.size() >= 2
+                                 ? int64_t(boundary_neighbors.size())
+                                 : num_neighbors);
+        }
+#pragma omp for schedule(static)
+        for (int64_t e = 0; e < num_edges; ++e) {
+            stencil_offsets_[edge_vertices[e] + 1] =
+                    2 + (edge_num_triangles[e] >= 2 ? edge_num_triangles[e]
+                                                    : 0);
+        }
+    }
+    if (has_complex_boundary) {
+        utility::LogWarning(
+                "[SubdivideLoop] boundary edge with > 2 neighbours, maybe mesh "
+                "is not manifold.");
+    }
+    for (int64_t i = 0; i < num_new_vertices; ++i) {
+        stencil_offsets_[i + 1] += stencil_offsets_[i];
+    }
+    stencil_vertices_.resize(stencil_offsets_.back());
+    stencil_weights_.resize(stencil_offsets_.back());
+
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<int> boundary_neighbors;
+#pragma omp for schedule(static)
+        for (int64_t v = 0; v < num_old_vertices; ++v) {
+            BoundaryNeighbors(v, boundary_neighbors);
+            const int *neighbors =
+                    topology.vertex_neighbors_.data() +
+                    topology.vertex_offsets_[v];
+            size_t num_neighbors = size_t(topology.vertex_offsets_[v + 1] -
+                                          topology.vertex_offsets_[v]);
+            double beta = 0;
+            if (boundary_neighbors.size() >= 2) {
+                neighbors = boundary_neighbors.data();
+                num_neighbors = boundary_neighbors.size();
+                beta = 1. / 8.;
+            } else if (num_neighbors == 3) {
+                beta = 3. / 16.;
+            } else if (num_neighbors > 0) {
+                beta = 3. / (8. * num_neighbors);
+            }
+            int64_t j = stencil_offsets_[v];
+            stencil_vertices_[j] = int(v);
+            stencil_weights_[j] = 1. - num_neighbors * beta;
+            for (size_t i = 0; i < num_neighbors; ++i) {
+                stencil_vertices_[++j] = neighbors[i];
+                stencil_weights_[j] = beta;
+            }
+        }
+#pragma omp for schedule(static)
+        for (int64_t e = 0; e < num_edges; ++e) {
+            int64_t j = stencil_offsets_[edge_vertices[e]];
+            const double weight = edge_num_triangles[e] < 2 ? 0.5 : 3. / 8.;
+            for (int k = 0; k < 2; ++k, ++j) {
+                stencil_vertices_[j] = topology.edges_[e](k);
+                stencil_weights_[j] = weight;
+            }
+            if (edge_num_triangles[e] < 2) {
+                continue;
+            }
+            // The first vertex of every triangle that is not on the edge, which
+            // is the opposite vertex unless the triangle is degenerate.
+            const Eigen::Vector2i &edge = topology.edges_[e];
+            const double scale = 1. / (4. * edge_num_triangles[e]);
+            for (int64_t i = topology.edge_offsets_[e];
+                 i < topology.edge_offsets_[e + 1]; ++i) {
+                const int t = topology.edge_triangles_[i];
+                if (i > topology.edge_offsets_[e] &&
+                    t == topology.edge_triangles_[i - 1]) {
+                    continue;
+                }
+                int k = 0;
+                while (k < 2 && (triangles[t](k) == edge(0) ||
+                                 triangles[t](k) == edge(1))) {
+                    ++k;
+                }
+                stencil_vertices_[j] = triangles[t](k);
+                stencil_weights_[j++] = scale;
+            }
+        }
+    }
+
+    triangles_.resize(4 * num_triangles);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        const Eigen::Vector3i &triangle = triangles[t];
+        const int v01 = edge_vertices[topology.triangle_edges_[3 * t]];
+        const int v12 = edge_vertices[topology.triangle_edges_[3 * t + 1]];
+        const int v20 = edge_vertices[topology.triangle_edges_[3 * t + 2]];
+        triangles_[4 * t + 0] = Eigen::Vector3i(triangle(0), v01, v20);
+        triangles_[4 * t + 1] = Eigen::Vector3i(v01, triangle(1), v12);
+        triangles_[4 * t + 2] = Eigen::Vector3i(v12, triangle(2), v20);
+        triangles_[4 * t + 3] = Eigen::Vector3i(v01, v12, v20);
+    }
+}
+
+std::vector<Eigen::Vector3d> LoopSubdivision::Apply(
+        const std::vector<Eigen::Vector3d> &values) const {
+    const int64_t num_new_vertices = static_cast<int64_t>(NumVertices());
+    std::vector<Eigen::Vector3d> subdivided(num_new_vertices);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_new_vertices; ++i) {
+        Eigen::Vector3d value = Eigen::Vector3d::Zero();
+        for (int64_t j = stencil_offsets_[i]; j < stencil_offsets_[i + 1];
+             ++j) {
+            value += stencil_weights_[j] * values[stencil_vertices_[j]];
+        }
+        subdivided[i] = value;
+    }
+    return subdivided;
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+class TriangleMeshTopology;
+
+/// \class LoopSubdivision
+///
+/// \brief One iteration of Loop subdivision as a sparse linear map from the
+/// vertices of a triangle mesh to the vertices of the subdivided mesh.
+///
+/// Every vertex of the subdivided mesh is a weighted sum of input vertices,
+/// which is stored as a stencil in compressed sparse row format. The first
+/// num_vertices stencils move the input vertices, and the following ones
+/// create one vertex per edge, numbered in the order in which the edges first
+/// appear in the triangles. The stencils are built in parallel from the
+/// topology of the mesh and can be applied to any number of per-vertex
+/// attributes, on CPU with Apply() or on other devices by the tensor mesh.
+class LoopSubdivision {
+public:
+    /// \brief Builds the stencils of \p triangles on \p num_vertices vertices,
+    /// given the \p topology of the triangles.
+    LoopSubdivision(const std::vector<Eigen::Vector3i> &triangles,
+                    const TriangleMeshTopology &topology,
+                    size_t num_vertices);
+
+    /// Returns the number of vertices of the subdivided mesh.
+    size_t NumVertices() const { return stencil_offsets_.size() - 1; }
+
+    /// Computes the per-vertex \p values of the subdivided mesh from the
+    /// per-vertex \p values of the input mesh.
+    std::vector<Eigen::Vector3d> Apply(
+            const std::vector<Eigen::Vector3d> &values) const;
+
+public:
+    /// Vertex i of the subdivided mesh is the sum of
+    /// stencil_weights_[j] * stencil_vertices_[j] for j from
+    /// stencil_offsets_[i] to stencil_offsets_[i + 1] - 1.
+    std::vector<int64_t> stencil_offsets_;
+    std::vector<int> stencil_vertices_;
+    std::vector<double> stencil_weights_;
+    /// Triangles of the subdivided mesh. Triangle t of the input mesh becomes
+    /// the triangles 4 * t to 4 * t + 3.
+    std::vector<Eigen::Vector3i> triangles_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,378 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/NormalOrientation.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Edge of the neighbor graph with v0_ < v1_. Edges are ordered by weight and
+/// then by their vertices, so that all edge weights are distinct and the
+/// minimum spanning forest is unique.
+struct GraphEdge {
+    double weight_ = std::numeric_limits<double>::infinity();
+    int64_t v0_ = -1;
+    int64_t v1_ = -1;
+
+    bool IsValid() const { return v0_ >= 0; }
+    bool operator<(const GraphEdge &other) const {
+        return std::tie(weight_, v0_, v1_) <
+               std::tie(other.weight_, other.v0_, other.v1_);
+    }
+    bool operator==(const GraphEdge &other) const {
+        return v0_ == other.v0_ && v1_ == other.v1_;
+    }
+};
+
+/// Undirected graph in compressed sparse row format. The neighbors of vertex
+/// v are neighbors_[offsets_[v]] to neighbors_[offsets_[v + 1] - 1], sorted
+/// and without duplicates.
+struct Adjacency {
+    std::vector<int64_t> offsets_;
+    std::vector<int64_t> neighbors_;
+
+    int64_t Begin(int64_t v) const { return offsets_[v]; }
+    int64_t End(int64_t v) const { return offsets_[v + 1]; }
+};
+
+/// Builds the symmetric adjacency of \p num_edges edges, where GetEdge(e, v0,
+/// v1) returns false for edges to skip.
+template <typename GetEdgeFunc>
+Adjacency BuildAdjacency(int64_t num_vertices,
+                         int64_t num_edges,
+                         GetEdgeFunc GetEdge) {
+    std::vector<int64_t> degrees(num_vertices + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t e = 0; e < num_edges; ++e) {
+        int64_t v0, v1;
+        if (GetEdge(e, v0, v1)) {
+#pragma omp atomic
+            ++degrees[v0];
+#pragma omp atomic
+            ++degrees[v1];
+        }
+    }
+
+    std::vector<int64_t> offsets(num_vertices + 1, 0);
+    std::partial_sum(degrees.begin(), degrees.end() - 1, offsets.begin() + 1);
+    std::vector<int64_t> cursors(offsets.begin(), offsets.end() - 1);
+    std::vector<int64_t> neighbors(offsets.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t e = 0; e < num_edges; ++e) {
+        int64_t v0, v1;
+        if (GetEdge(e, v0, v1)) {
+            int64_t pos0, pos1;
+#pragma omp atomic capture
+            pos0 = cursors[v0]++;
+#pragma omp atomic capture
+            pos1 = cursors[v1]++;
+            neighbors[pos0] = v1;
+            neighbors[pos1] = v0;
+        }
+    }
+
+    // Sorting every row makes the layout independent of the insertion order.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < num_vertices; ++v) {
+        auto begin = neighbors.begin() + offsets[v];
+        auto end = neighbors.begin() + offsets[v + 1];
+        std::sort(begin, end);
+        degrees[v] = std::unique(begin, end) - begin;
+    }
+
+    Adjacency adjacency;
+    adjacency.offsets_.assign(num_vertices + 1, 0);
+    std::partial_sum(degrees.begin(), degrees.end() - 1,
+                     adjacency.offsets_.begin() + 1);
+    adjacency.neighbors_.resize(adjacency.offsets_.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < num_vertices; ++v) {
+        std::copy(neighbors.begin() + offsets[v],
+                  neighbors.begin() + offsets[v] + degrees[v],
+                  adjacency.neighbors_.begin() + adjacency.offsets_[v]);
+    }
+    return adjacency;
+}
+
+/// Computes the minimum spanning forest of \p graph with Boruvka's algorithm.
+/// In every round, each component selects its lightest outgoing edge and is
+/// hooked onto the component at the other end. Returns the forest edges, and
+/// in \p component a representative vertex of the tree of every vertex.
+template <typename GetWeightFunc>
+std::vector<GraphEdge> ComputeMinimumSpanningForest(
+        const Adjacency &graph,
+        int64_t num_vertices,
+        GetWeightFunc GetWeight,
+        std::vector<int64_t> &component) {
+    component.resize(num_vertices);
+    std::iota(component.begin(), component.end(), int64_t(0));
+    std::vector<int64_t> parent(num_vertices);
+    std::vector<int64_t> grandparent(num_vertices);
+    std::vector<GraphEdge> vertex_edges(num_vertices);
+    std::vector<GraphEdge> forest_edges(num_vertices);
+    // Vertex whose lightest edge is the lightest edge of the component.
+    std::unique_ptr<std::atomic<int64_t>[]> component_vertices(
+            new std::atomic<int64_t>[num_vertices]);
+
+    bool hooked = true;
+    while (hooked) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < num_vertices; ++v) {
+            GraphEdge lightest;
+            for (int64_t i = graph.Begin(v); i < graph.End(v); ++i) {
+                const int64_t u = graph.neighbors_[i];
+                if (component[u] != component[v]) {
+                    GraphEdge edge;
+                    edge.v0_ = std::min(u, v);
+                    edge.v1_ = std::max(u, v);
+                    edge.weight_ = GetWeight(edge.v0_, edge.v1_);
+                    if (edge < lightest) {
+                        lightest = edge;
+                    }
+                }
+            }
+            vertex_edges[v] = lightest;
+            component_vertices[v].store(-1, std::memory_order_relaxed);
+        }
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < num_vertices; ++v) {
+            if (!vertex_edges[v].IsValid()) {
+                continue;
+            }
+            std::atomic<int64_t> &lightest = component_vertices[component[v]];
+            int64_t current = lightest.load();
+            while ((current < 0 || vertex_edges[v] < vertex_edges[current]) &&
+                   !lightest.compare_exchange_weak(current, v)) {
+            }
+        }
+
+        // Since all weights are distinct, two components can only select each
+        // other, in which case the one with the larger index is hooked.
+        hooked = false;
+#pragma omp parallel for schedule(static) reduction(|| : hooked) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t v = 0; v < num_vertices; ++v) {
+            parent[v] = component[v];
+            const int64_t selected = component_vertices[v].load();
+            if (component[v] != v || selected < 0) {
+                continue;
+            }
+            const GraphEdge &edge = vertex_edges[selected];
+            const int64_t other = component[edge.v0_] == v
+                                          ? component[edge.v1_]
+                                          : component[edge.v0_];
+            const int64_t other_selected = component_vertices[other].load();
+            if (other_selected >= 0 && vertex_edges[other_selected] == edge &&
+                v < other) {
+                continue;
+            }
+            parent[v] = other;
+            forest_edges[v] = edge;
+            hooked = true;
+        }
+
+        // Pointer jumping until every vertex points to its root.
+        bool changed = true;
+        while (changed) {
+            changed = false;
+#pragma omp parallel for schedule(static) reduction(|| : changed) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t v = 0; v < num_vertices; ++v) {
+                grandparent[v] = parent[parent[v]];
+                changed = changed || grandparent[v] != parent[v];
+            }
+            parent.swap(grandparent);
+        }
+        component.swap(parent);
+    }
+
+    // Every component root is hooked at most once, so each vertex stores at
+    // most one forest edge.
+    std::vector<GraphEdge> forest;
+    for (const GraphEdge &edge : forest_edges) {
+        if (edge.IsValid()) {
+            forest.push_back(edge);
+        }
+    }
+    return forest;
+}
+
+}  // namespace
+
+template <typename scalar_t>
+void OrientNormalsAlongMinimumSpanningTree(const scalar_t *points,
+                                           scalar_t *normals,
+                                           int64_t num_points,
+                                           const int64_t *neighbor_indices,
+                                           int64_t num_neighbors) {
+    if (num_points <= 0) {
+        return;
+    }
+    if (num_neighbors < 0) {
+        utility::LogError("Illegal number of neighbors: {}", num_neighbors);
+    }
+
+    const Adjacency graph = BuildAdjacency(
+            num_points, num_points * num_neighbors,
+            [&](int64_t e, int64_t &v0, int64_t &v1) {
+                v0 = e / num_neighbors;
+                v1 = neighbor_indices[e];
+                return v1 >= 0 && v1 < num_points && v1 != v0;
+            });
+
+    auto GetWeight = [&](int64_t v0, int64_t v1) {
+        const scalar_t *n0 = normals + 3 * v0;
+        const scalar_t *n1 = normals + 3 * v1;
+        const double dot = double(n0[0]) * n1[0] + double(n0[1]) * n1[1] +
+                           double(n0[2]) * n1[2];
+        return 1.0 - std::abs(dot);
+    };
+    std::vector<int64_t> labels;
+    const std::vector<GraphEdge> forest_edges =
+            ComputeMinimumSpanningForest(graph, num_points, GetWeight, labels);
+    const Adjacency forest = BuildAdjacency(
+            num_points, static_cast<int64_t>(forest_edges.size()),
+            [&](int64_t e, int64_t &v0, int64_t &v1) {
+                v0 = forest_edges[e].v0_;
+                v1 = forest_edges[e].v1_;
+                return true;
+            });
+
+    // Find the point with the largest z in each tree, ties going to the
+    // smallest index.
+    std::unique_ptr<std::atomic<int64_t>[]> roots(
+            new std::atomic<int64_t>[num_points]);
+    for (int64_t v = 0; v < num_points; ++v) {
+        roots[v].store(v == labels[v] ? v : -1, std::memory_order_relaxed);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < num_points; ++v) {
+        std::atomic<int64_t> &root = roots[labels[v]];
+        int64_t current = root.load();
+        while ((points[3 * v + 2] > points[3 * current + 2] ||
+                (points[3 * v + 2] == points[3 * current + 2] &&
+                 v < current)) &&
+               !root.compare_exchange_weak(current, v)) {
+        }
+    }
+
+    // Level synchronous breadth first traversal from all roots. In a forest,
+    // every unvisited neighbor of the frontier is reached from exactly one
+    // frontier vertex, so the next frontier can be filled without conflicts.
+    std::vector<char> visited(num_points, 0);
+    std::vector<int64_t> frontier;
+    for (int64_t v = 0; v < num_points; ++v) {
+        const int64_t root = v == labels[v] ? roots[v].load() : -1;
+        if (root >= 0) {
+            frontier.push_back(root);
+            visited[root] = 1;
+            if (normals[3 * root + 2] < 0) {
+                normals[3 * root] *= -1;
+                normals[3 * root + 1] *= -1;
+                normals[3 * root + 2] *= -1;
+            }
+        }
+    }
+    std::vector<int64_t> next_offsets;
+    std::vector<int64_t> next_frontier;
+    while (!frontier.empty()) {
+        const int64_t frontier_size = static_cast<int64_t>(frontier.size());
+        next_offsets.assign(frontier_size + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < frontier_size; ++i) {
+            const int64_t v = frontier[i];
+            int64_t num_children = 0;
+            for (int64_t j = forest.Begin(v); j < forest.End(v); ++j) {
+                num_children += visited[forest.neighbors_[j]] ? 0 : 1;
+            }
+            next_offsets[i + 1] = num_children;
+        }
+        std::partial_sum(next_offsets.begin(), next_offsets.end(),
+                         next_offsets.begin());
+        next_frontier.resize(next_offsets.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < frontier_size; ++i) {
+            const int64_t v = frontier[i];
+            const scalar_t *n0 = normals + 3 * v;
+            int64_t pos = next_offsets[i];
+            for (int64_t j = forest.Begin(v); j < forest.End(v); ++j) {
+                const int64_t u = forest.neighbors_[j];
+                if (visited[u]) {
+                    continue;
+                }
+                visited[u] = 1;
+                next_frontier[pos++] = u;
+                scalar_t *n1 = normals + 3 * u;
+                if (n0[0] * n1[0] + n0[1] * n1[1] + n0[2] * n1[2] < 0) {
+                    n1[0] *= -1;
+                    n1[1] *= -1;
+                    n1[2] *= -1;
+                }
+            }
+        }
+        frontier.swap(next_frontier);
+    }
+}
+
+template void OrientNormalsAlongMinimumSpanningTree<float>(
+        const float *points,
+        float *normals,
+        int64_t num_points,
+        const int64_t *neighbor_indices,
+        int64_t num_neighbors);
+template void OrientNormalsAlongMinimumSpanningTree<double>(
+        const double *points,
+        double *normals,
+        int64_t num_points,
+        const int64_t *neighbor_indices,
+        int64_t num_neighbors);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,63 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+
+namespace open3d {
+namespace geometry {
+
+/// \brief Consistent normal orientation on CPU, shared by the legacy and the
+/// tensor point clouds.
+///
+/// Follows Hoppe et al., "Surface Reconstruction from Unorganized Points",
+/// 1992. The k nearest neighbor graph of the points is weighted with
+/// 1 - |n0 . n1|, its minimum spanning forest is computed with Boruvka's
+/// algorithm, and the orientation is propagated along the forest in breadth
+/// first order. Each connected component is started at its point with the
+/// largest z coordinate, whose normal is oriented towards +z.
+///
+/// All stages run in parallel. Equal edge weights are ordered by the vertex
+/// indices, so the result does not depend on the number of threads.
+///
+/// \param points Point positions, num_points x 3, row major.
+/// \param normals [in, out] Point normals, num_points x 3, row major. Normals
+/// are flipped in place.
+/// \param num_points Number of points.
+/// \param neighbor_indices Indices of the nearest neighbors of every point,
+/// num_points x num_neighbors, row major. The point itself and negative
+/// indices are ignored.
+/// \param num_neighbors Number of neighbors per point.
+template <typename scalar_t>
+void OrientNormalsAlongMinimumSpanningTree(const scalar_t *points,
+                                           scalar_t *normals,
+                                           int64_t num_points,
+                                           const int64_t *neighbor_indices,
+                                           int64_t num_neighbors);
+
+}  // namespace geometry
+}  // namespace open3d
@@ -32,9 +32,11 @@
 #include <random>
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/FarthestPointSampling.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/Qhull.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/VoxelPartition.h"
 #include "open3d/utility/Eigen.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
@@ -307,8 +309,10 @@ public:
     Eigen::Vector3d GetMaxClass() {
         int max_class = -1;
         int max_count = -1;
+        // Ties go to the smallest class, independently of the hash order.
         for (auto it = classes.begin(); it != classes.end(); it++) {
-            if (it->second > max_count) {
+            if (it->second > max_count ||
+                (it->second == max_count && it->first < max_class)) {
                 max_count = it->second;
                 max_class = it->first;
             }
@@ -316,7 +320,9 @@ public:
         return Eigen::Vector3d(max_class, max_class, max_class);
     }
 
-    std::vector<point_cubic_id> GetOriginalID() { return original_id; }
+    const std::vector<point_cubic_id> &GetOriginalID() const {
+        return original_id;
+    }
 
 private:
     // original point cloud id in higher resolution + its cubic id
@@ -339,32 +345,40 @@ std::shared_ptr<PointCloud> PointCloud::VoxelDownSample(
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPoint,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
-    for (int i = 0; i < (int)points_.size(); i++) {
-        ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i);
-    }
+    // Points are grouped by voxel in parallel and accumulated in increasing
+    // index order, so the averages do not depend on the number of threads.
+    const VoxelPartition partition(points_, voxel_min_bound, voxel_size);
+    const int64_t num_voxels = static_cast<int64_t>(partition.NumVoxels());
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
     bool has_covariances = HasCovariances();
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    if (has_covariances) {
+        output->covariances_.resize(num_voxels);
+    }
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < num_voxels; ++v) {
+        AccumulatedPoint accpoint;
+        for (const int *i = partition.PointsBegin(v);
+             i != partition.PointsEnd(v); ++i) {
+            accpoint.AddPoint(*this, *i);
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
-            output->colors_.push_back(accpoint.second.GetAverageColor());
+            output->colors_[v] = accpoint.GetAverageColor();
         }
         if (has_covariances) {
-            output->covariances_.emplace_back(
-                    accpoint.second.GetAverageCovariance());
+            output->covariances_[v] = accpoint.GetAverageCovariance();
         }
     }
     utility::LogDebug(
@@ -393,56 +407,60 @@ PointCloud::VoxelDownSampleAndTrace(double voxel_size,
         (voxel_max_bound - voxel_min_bound).maxCoeff()) {
         utility::LogError("voxel_size is too small.");
     }
-    std::unordered_map<Eigen::Vector3i, AccumulatedPointForTrace,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    int cid_temp[3] = {1, 2, 4};
-    for (size_t i = 0; i < points_.size(); i++) {
-        auto ref_coord = (points_[i] - voxel_min_bound) / voxel_size;
-        auto voxel_index = Eigen::Vector3i(int(floor(ref_coord(0))),
-                                           int(floor(ref_coord(1))),
-                                           int(floor(ref_coord(2))));
-        int cid = 0;
-        for (int c = 0; c < 3; c++) {
-            if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
-                cid += cid_temp[c];
-            }
-        }
-        voxelindex_to_accpoint[voxel_index].AddPoint(*this, i, cid,
-                                                     approximate_class);
-    }
+    const VoxelPartition partition(points_, voxel_min_bound, voxel_size);
+    const int64_t num_voxels = static_cast<int64_t>(partition.NumVoxels());
     bool has_normals = HasNormals();
     bool has_colors = HasColors();
     bool has_covariances = HasCovariances();
-    int cnt = 0;
-    cubic_id.resize(voxelindex_to_accpoint.size(), 8);
+    output->points_.resize(num_voxels);
+    if (has_normals) {
+        output->normals_.resize(num_voxels);
+    }
+    if (has_colors) {
+        output->colors_.resize(num_voxels);
+    }
+    if (has_covariances) {
+        output->covariances_.resize(num_voxels);
+    }
+    cubic_id.resize(num_voxels, 8);
     cubic_id.setConstant(-1);
-    std::vector<std::vector<int>> original_indices(
-            voxelindex_to_accpoint.size());
-    for (auto accpoint : voxelindex_to_accpoint) {
-        output->points_.push_back(accpoint.second.GetAveragePoint());
+    std::vector<std::vector<int>> original_indices(num_voxels);
+    int cid_temp[3] = {1, 2, 4};
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < num_voxels; ++v) {
+        const Eigen::Vector3i &voxel_index = partition.voxel_indices_[v];
+        AccumulatedPointForTrace accpoint;
+        for (const int *i = partition.PointsBegin(v);
+             i != partition.PointsEnd(v); ++i) {
+            const Eigen::Vector3d ref_coord =
+                    (points_[*i] - voxel_min_bound) / voxel_size;
+            int cid = 0;
+            for (int c = 0; c < 3; c++) {
+                if ((ref_coord(c) - voxel_index(c)) >= 0.5) {
+                    cid += cid_temp[c];
+                }
+            }
+            accpoint.AddPoint(*this, size_t(*i), cid, approximate_class);
+        }
+        output->points_[v] = accpoint.GetAveragePoint();
         if (has_normals) {
-            output->normals_.push_back(accpoint.second.GetAverageNormal());
+            output->normals_[v] = accpoint.GetAverageNormal();
         }
         if (has_colors) {
             if (approximate_class) {
-                output->colors_.push_back(accpoint.second.GetMaxClass());
+                output->colors_[v] = accpoint.GetMaxClass();
             } else {
-                output->colors_.push_back(accpoint.second.GetAverageColor());
+                output->colors_[v] = accpoint.GetAverageColor();
             }
         }
         if (has_covariances) {
-            output->covariances_.emplace_back(
-                    accpoint.second.GetAverageCovariance());
+            output->covariances_[v] = accpoint.GetAverageCovariance();
         }
-        auto original_id = accpoint.second.GetOriginalID();
-        for (int i = 0; i < (int)original_id.size(); i++) {
-            size_t pid = original_id[i].point_id;
-            int cid = original_id[i].cubic_id;
-            cubic_id(cnt, cid) = int(pid);
-            original_indices[cnt].push_back(int(pid));
+        for (const point_cubic_id &id : accpoint.GetOriginalID()) {
+            cubic_id(v, id.cubic_id) = int(id.point_id);
+            original_indices[v].push_back(int(id.point_id));
         }
-        cnt++;
     }
     utility::LogDebug(
             "Pointcloud down sampled from {:d} points to {:d} points.",
@@ -479,7 +497,7 @@ std::shared_ptr<PointCloud> PointCloud::RandomDownSample(
 }
 
 std::shared_ptr<PointCloud> PointCloud::FarthestPointDownSample(
-        size_t num_samples) const {
+        size_t num_samples, size_t start_index, size_t bucket_size) const {
     if (num_samples == 0) {
         return std::make_shared<PointCloud>();
     } else if (num_samples == points_.size()) {
@@ -488,29 +506,16 @@ std::shared_ptr<PointCloud> PointCloud::FarthestPointDownSample(
         utility::LogError(
                 "Illegal number of samples: {}, must <= point size: {}",
                 num_samples, points_.size());
-    }
-    // We can also keep track of the non-selected indices with unordered_set,
-    // but since typically num_samples << num_points, it may not be worth it.
-    std::vector<size_t> selected_indices;
-    selected_indices.reserve(num_samples);
-    const size_t num_points = points_.size();
-    std::vector<double> distances(num_points,
-                                  std::numeric_limits<double>::infinity());
-    size_t farthest_index = 0;
-    for (size_t i = 0; i < num_samples; i++) {
-        selected_indices.push_back(farthest_index);
-        const Eigen::Vector3d &selected = points_[farthest_index];
-        double max_dist = 0;
-        for (size_t j = 0; j < num_points; j++) {
-            double dist = (points_[j] - selected).squaredNorm();
-            distances[j] = std::min(distances[j], dist);
-            if (distances[j] > max_dist) {
-                max_dist = distances[j];
-                farthest_index = j;
-            }
-        }
-    }
-    return SelectByIndex(selected_indices);
+    } else if (start_index >= points_.size()) {
+        utility::LogError("Illegal start index: {}, must < point size: {}",
+                          start_index, points_.size());
+    }
+    std::vector<int64_t> sample_indices(num_samples);
+    FarthestPointSampling(points_[0].data(), int64_t(points_.size()),
+                          int64_t(num_samples), int64_t(start_index),
+                          int64_t(bucket_size), sample_indices.data());
+    return SelectByIndex(std::vector<size_t>(sample_indices.begin(),
+                                             sample_indices.end()));
 }
 
 std::shared_ptr<PointCloud> PointCloud::Crop(
@@ -140,7 +140,8 @@ public:
     /// \brief Function to downsample input pointcloud into output pointcloud
     /// with a voxel.
     ///
-    /// Normals and colors are averaged if they exist.
+    /// Normals and colors are averaged if they exist. The output points are
+    /// ordered by voxel index, independently of the number of threads.
     ///
     /// \param voxel_size Defines the resolution of the voxel grid,
     /// smaller value leads to denser output point cloud.
@@ -186,11 +187,19 @@ public:
     /// with a set of points has farthest distance.
     ///
     /// The sample is performed by selecting the farthest point from previous
-    /// selected points iteratively.
+    /// selected points iteratively. Ties go to the point with the smallest
+    /// index.
     ///
     /// \param num_samples Number of points to be sampled.
+    /// \param start_index Index of the first selected point.
+    /// \param bucket_size If positive, points are partitioned into a kd-tree
+    /// with buckets of at most this many points, and buckets that are farther
+    /// from a new sample than their own farthest point are not updated. The
+    /// result is the same, but large point clouds are sampled much faster.
     std::shared_ptr<PointCloud> FarthestPointDownSample(
-            size_t num_samples) const;
+            size_t num_samples,
+            size_t start_index = 0,
+            size_t bucket_size = 0) const;
 
     /// \brief Function to crop pointcloud into output pointcloud
     ///
@@ -262,6 +271,11 @@ public:
     /// consistent tangent planes as described in Hoppe et al., "Surface
     /// Reconstruction from Unorganized Points", 1992.
     ///
+    /// The orientation is propagated along the minimum spanning tree of the k
+    /// nearest neighbor graph. Each connected component of the graph is
+    /// oriented separately, starting from its point with the largest z
+    /// coordinate.
+    ///
     /// \param k k nearest neighbour for graph reconstruction for normal
     /// propagation.
     void OrientNormalsConsistentTangentPlane(size_t k);
@@ -367,6 +381,36 @@ public:
             const double probability = 0.99999999,
             utility::optional<int> seed = utility::nullopt) const;
 
+    /// \brief Segment up to \p max_num_planes planes with the RANSAC
+    /// algorithm.
+    ///
+    /// The planes are segmented one after another, and the inliers of each
+    /// plane are removed before the next plane is segmented. Segmentation stops
+    /// early if a plane has fewer than \p min_num_inliers inliers, which is
+    /// not returned, or if fewer than \p ransac_n points remain.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations per plane.
+    /// \param max_num_planes Maximum number of planes to segment.
+    /// \param min_num_inliers Minimum number of inliers of a plane.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param seed Sets the seed value used in the random
+    /// generator, set to nullopt to use a random seed value with each function
+    /// call.
+    /// \return Returns the plane models ax + by + cz + d = 0 and the indices
+    /// of the plane inliers, in the order the planes were segmented.
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+    SegmentPlanes(const double distance_threshold = 0.01,
+                  const int ransac_n = 3,
+                  const int num_iterations = 100,
+                  const int max_num_planes = 5,
+                  const size_t min_num_inliers = 0,
+                  const double probability = 0.99999999,
+                  utility::optional<int> seed = utility::nullopt) const;
+
     /// \brief Factory function to create a pointcloud from a depth image and a
     /// camera model.
     ///
@@ -26,59 +26,14 @@
 
 #include <Eigen/Dense>
 #include <algorithm>
-#include <iostream>
-#include <iterator>
-#include <mutex>
+#include <cmath>
 #include <numeric>
 #include <random>
-#include <unordered_set>
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
-
-namespace {
-
-/// \class RandomSampler
-///
-/// \brief Helper class for random sampling
-template <typename T>
-class RandomSampler {
-public:
-    explicit RandomSampler(const size_t size,
-                           open3d::utility::optional<int> seed)
-        : size_(size) {
-        if (!seed.has_value()) {
-            std::random_device rd;
-            seed = rd();
-        }
-        rng_ = std::mt19937(seed.value());
-    }
-
-    std::vector<T> operator()(size_t sample_size) {
-        std::lock_guard<std::mutex> guard(mutex_);
-
-        std::vector<T> sample;
-        sample.reserve(sample_size);
-
-        size_t valid_sample = 0;
-        while (valid_sample < sample_size) {
-            const size_t idx = rng_() % size_;
-            if (std::find(sample.begin(), sample.end(), idx) == sample.end()) {
-                sample.push_back(idx);
-                valid_sample++;
-            }
-        }
-
-        return sample;
-    }
-
-private:
-    size_t size_;
-    std::mt19937 rng_;
-    std::mutex mutex_;
-};
-}  // namespace
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -96,39 +51,6 @@ public:
     double inlier_rmse_;
 };
 
-// Calculates the number of inliers given a list of points and a plane model,
-// and the total distance between the inliers and the plane. These numbers are
-// then used to evaluate how well the plane model fits the given points.
-RANSACResult EvaluateRANSACBasedOnDistance(
-        const std::vector<Eigen::Vector3d> &points,
-        const Eigen::Vector4d plane_model,
-        std::vector<size_t> &inliers,
-        double distance_threshold,
-        double error) {
-    RANSACResult result;
-
-    for (size_t idx = 0; idx < points.size(); ++idx) {
-        Eigen::Vector4d point(points[idx](0), points[idx](1), points[idx](2),
-                              1);
-        double distance = std::abs(plane_model.dot(point));
-
-        if (distance < distance_threshold) {
-            error += distance;
-            inliers.emplace_back(idx);
-        }
-    }
-
-    size_t inlier_num = inliers.size();
-    if (inlier_num == 0) {
-        result.fitness_ = 0;
-        result.inlier_rmse_ = 0;
-    } else {
-        result.fitness_ = (double)inlier_num / (double)points.size();
-        result.inlier_rmse_ = error / std::sqrt((double)inlier_num);
-    }
-    return result;
-}
-
 // Find the plane such that the summed squared distance from the
 // plane to all points is minimized.
 //
@@ -177,76 +99,272 @@ Eigen::Vector4d GetPlaneFromPoints(const std::vector<Eigen::Vector3d> &points,
     return Eigen::Vector4d(abc(0), abc(1), abc(2), d);
 }
 
-std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
-        const double distance_threshold /* = 0.01 */,
-        const int ransac_n /* = 3 */,
-        const int num_iterations /* = 100 */,
-        const double probability /* = 0.99999999 */,
-        utility::optional<int> seed /* = utility::nullopt */) const {
-    if (probability <= 0 || probability > 1) {
-        utility::LogError("Probability must be > 0 or <= 1.0");
+namespace {
+
+/// Number of hypotheses that are scored together on each block of points.
+constexpr int kHypothesisBatchSize = 8;
+/// Number of batches that are scored in parallel with the same test.
+constexpr int kNumBatchesPerRound = 8;
+/// Number of points after which the test decides on a hypothesis.
+constexpr int kPointBlockSize = 64;
+/// Cost of sampling and fitting a hypothesis, in units of the cost of
+/// testing one point.
+constexpr double kHypothesisCost = 200;
+
+/// \class SequentialProbabilityRatioTest
+///
+/// \brief Test of Chum and Matas, "Optimal Randomized RANSAC", 2008, that
+/// rejects a hypothesis after a few points if it is likely to have fewer
+/// inliers than the best one.
+///
+/// The test compares the inlier ratio epsilon of the best hypothesis with the
+/// ratio delta of points that are consistent with a bad hypothesis. It is
+/// disabled until both are known.
+class SequentialProbabilityRatioTest {
+public:
+    void Update(double epsilon, double delta) {
+        enabled_ = delta > 0 && epsilon > delta && epsilon < 1;
+        if (!enabled_) {
+            return;
+        }
+        log_inlier_ = std::log(delta / epsilon);
+        log_outlier_ = std::log((1 - delta) / (1 - epsilon));
+        // The optimal threshold A solves A = cost * C + 1 + log(A).
+        const double C = (1 - delta) * log_outlier_ + delta * log_inlier_;
+        double A = kHypothesisCost * C + 1;
+        for (int itr = 0; itr < 10; ++itr) {
+            A = kHypothesisCost * C + 1 + std::log(A);
+        }
+        log_threshold_ = std::log(A);
     }
 
-    RANSACResult result;
+    /// Returns the log likelihood ratio of a block of points with
+    /// \p num_inliers inliers and \p num_outliers outliers.
+    double LogLikelihoodRatio(int64_t num_inliers, int64_t num_outliers) const {
+        return double(num_inliers) * log_inlier_ +
+               double(num_outliers) * log_outlier_;
+    }
 
-    // Initialize the best plane model.
-    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+public:
+    bool enabled_ = false;
+    double log_inlier_ = 0;
+    double log_outlier_ = 0;
+    double log_threshold_ = 0;
+};
 
-    size_t num_points = points_.size();
-    RandomSampler<size_t> sampler(num_points, seed);
+/// \class PlaneRANSAC
+///
+/// \brief RANSAC plane segmentation on the remaining points of a point cloud.
+///
+/// The points are stored in random order, so that the first points that a
+/// hypothesis is tested on are a random preliminary subset. Batches of
+/// hypotheses are scored with one matrix product per block of points, and
+/// the sequential probability ratio test stops scoring a hypothesis once it
+/// is likely worse than the best one. The hypotheses of a round are scored in
+/// parallel with the same test and merged in order, so the result does not
+/// depend on the number of threads. The inliers of segmented planes are
+/// removed in place.
+class PlaneRANSAC {
+public:
+    PlaneRANSAC(const std::vector<Eigen::Vector3d> &points,
+                utility::optional<int> seed)
+        : points_(points) {
+        if (!seed.has_value()) {
+            std::random_device rd;
+            seed = rd();
+        }
+        rng_ = std::mt19937(seed.value());
+        indices_.resize(points.size());
+        std::iota(indices_.begin(), indices_.end(), 0);
+        std::shuffle(indices_.begin(), indices_.end(), rng_);
+        remaining_points_.resize(3, points.size());
+        for (size_t pos = 0; pos < indices_.size(); ++pos) {
+            remaining_points_.col(pos) = points[indices_[pos]];
+        }
+    }
 
-    // Return if ransac_n is less than the required plane model parameters.
-    if (ransac_n < 3) {
-        utility::LogError(
-                "ransac_n should be set to higher than or equal to 3.");
-        return std::make_tuple(Eigen::Vector4d(0, 0, 0, 0),
-                               std::vector<size_t>{});
+    size_t NumPoints() const { return indices_.size(); }
+
+    /// Returns the plane with the most inliers among the remaining points
+    /// and the sorted indices of its inliers, and removes the inliers if
+    /// \p remove_inliers is true.
+    std::tuple<Eigen::Vector4d, std::vector<size_t>> Segment(
+            double distance_threshold,
+            int ransac_n,
+            int num_iterations,
+            double probability,
+            bool remove_inliers);
+
+private:
+    /// Accumulated score of a hypothesis.
+    struct Score {
+        int64_t num_inliers = 0;
+        int64_t num_tested = 0;
+        double error = 0;
+        bool rejected = false;
+    };
+
+    Eigen::Vector4d SampleHypothesis(int ransac_n);
+
+    void ScoreBatch(const std::vector<Eigen::Vector4d> &hypotheses,
+                    int begin,
+                    int end,
+                    double distance_threshold,
+                    const SequentialProbabilityRatioTest &test,
+                    std::vector<Score> &scores) const;
+
+    const std::vector<Eigen::Vector3d> &points_;
+    std::mt19937 rng_;
+    /// Indices of the remaining points in random order, and their positions.
+    std::vector<size_t> indices_;
+    Eigen::Matrix3Xd remaining_points_;
+};
+
+Eigen::Vector4d PlaneRANSAC::SampleHypothesis(int ransac_n) {
+    std::vector<size_t> sample;
+    sample.reserve(ransac_n);
+    while (sample.size() < size_t(ransac_n)) {
+        const size_t idx = indices_[rng_() % indices_.size()];
+        if (std::find(sample.begin(), sample.end(), idx) == sample.end()) {
+            sample.push_back(idx);
+        }
     }
-    if (num_points < size_t(ransac_n)) {
-        utility::LogError("There must be at least 'ransac_n' points.");
-        return std::make_tuple(Eigen::Vector4d(0, 0, 0, 0),
-                               std::vector<size_t>{});
+    if (ransac_n == 3) {
+        return TriangleMesh::ComputeTrianglePlane(
+                points_[sample[0]], points_[sample[1]], points_[sample[2]]);
     }
+    return GetPlaneFromPoints(points_, sample);
+}
+
+void PlaneRANSAC::ScoreBatch(const std::vector<Eigen::Vector4d> &hypotheses,
+                             int begin,
+                             int end,
+                             double distance_threshold,
+                             const SequentialProbabilityRatioTest &test,
+                             std::vector<Score> &scores) const {
+    std::vector<int> active;
+    for (int hidx = begin; hidx < end; ++hidx) {
+        if (!hypotheses[hidx].isZero(0)) {
+            active.push_back(hidx);
+        }
+    }
+    std::vector<double> log_ratios(active.size(), 0);
+    Eigen::Matrix<double, Eigen::Dynamic, 4> planes(active.size(), 4);
+    for (size_t aidx = 0; aidx < active.size(); ++aidx) {
+        planes.row(aidx) = hypotheses[active[aidx]].transpose();
+    }
+
+    const int64_t num_points = int64_t(NumPoints());
+    Eigen::MatrixXd distances;
+    for (int64_t start = 0; start < num_points && !active.empty();
+         start += kPointBlockSize) {
+        const int64_t size = std::min<int64_t>(kPointBlockSize,
+                                               num_points - start);
+        distances.noalias() = planes.leftCols<3>() *
+                              remaining_points_.middleCols(start, size);
+        distances.colwise() += planes.col(3);
+        distances = distances.cwiseAbs();
+
+        size_t next_free = 0;
+        for (size_t aidx = 0; aidx < active.size(); ++aidx) {
+            Score &score = scores[active[aidx]];
+            const auto is_inlier =
+                    distances.row(aidx).array() < distance_threshold;
+            const int64_t num_inliers = is_inlier.count();
+            score.num_inliers += num_inliers;
+            score.num_tested += size;
+            score.error += is_inlier.select(distances.row(aidx).array(), 0)
+                                   .sum();
+            if (test.enabled_) {
+                log_ratios[aidx] += test.LogLikelihoodRatio(
+                        num_inliers, size - num_inliers);
+                if (log_ratios[aidx] > test.log_threshold_) {
+                    score.rejected = true;
+                    continue;
+                }
+            }
+            active[next_free] = active[aidx];
+            log_ratios[next_free] = log_ratios[aidx];
+            planes.row(next_free) = planes.row(aidx);
+            ++next_free;
+        }
+        active.resize(next_free);
+        log_ratios.resize(next_free);
+        planes.conservativeResize(next_free, Eigen::NoChange);
+    }
+}
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PlaneRANSAC::Segment(
+        double distance_threshold,
+        int ransac_n,
+        int num_iterations,
+        double probability,
+        bool remove_inliers) {
+    RANSACResult result;
+    Eigen::Vector4d best_plane_model = Eigen::Vector4d(0, 0, 0, 0);
+    const double num_points = double(NumPoints());
 
     // Use size_t here to avoid large integer which acceed max of int.
     size_t break_iteration = std::numeric_limits<size_t>::max();
     int iteration_count = 0;
 
-#pragma omp parallel for schedule(static)
-    for (int itr = 0; itr < num_iterations; itr++) {
-        if ((size_t)iteration_count > break_iteration) {
-            continue;
+    // Inliers of the hypotheses that are not the best, to estimate delta.
+    double num_bad_inliers = 0;
+    double num_bad_tested = 0;
+    SequentialProbabilityRatioTest test;
+    std::vector<Eigen::Vector4d> hypotheses;
+    std::vector<Score> scores;
+    while (iteration_count < num_iterations &&
+           size_t(iteration_count) <= break_iteration) {
+        // The first round is scored completely to initialize the test.
+        const int num_batches = iteration_count == 0 ? 1 : kNumBatchesPerRound;
+        const int num_hypotheses =
+                std::min(num_batches * kHypothesisBatchSize,
+                         num_iterations - iteration_count);
+        hypotheses.resize(num_hypotheses);
+        for (Eigen::Vector4d &hypothesis : hypotheses) {
+            hypothesis = SampleHypothesis(ransac_n);
         }
-
-        const std::vector<size_t> sampled_indices = sampler(ransac_n);
-        std::vector<size_t> inliers = sampled_indices;
-
-        // Fit model to num_model_parameters randomly selected points among the
-        // inliers.
-        Eigen::Vector4d plane_model;
-        if (ransac_n == 3) {
-            plane_model = TriangleMesh::ComputeTrianglePlane(
-                    points_[inliers[0]], points_[inliers[1]],
-                    points_[inliers[2]]);
-        } else {
-            plane_model = GetPlaneFromPoints(points_, inliers);
+        scores.assign(num_hypotheses, Score());
+
+        const int num_round_batches =
+                (num_hypotheses + kHypothesisBatchSize - 1) /
+                kHypothesisBatchSize;
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int bidx = 0; bidx < num_round_batches; ++bidx) {
+            ScoreBatch(hypotheses, bidx * kHypothesisBatchSize,
+                       std::min((bidx + 1) * kHypothesisBatchSize,
+                                num_hypotheses),
+                       distance_threshold, test, scores);
         }
 
-        if (plane_model.isZero(0)) {
-            continue;
-        }
-
-        double error = 0;
-        inliers.clear();
-        auto this_result = EvaluateRANSACBasedOnDistance(
-                points_, plane_model, inliers, distance_threshold, error);
-#pragma omp critical
-        {
+        for (int hidx = 0; hidx < num_hypotheses; ++hidx) {
+            iteration_count++;
+            const Score &score = scores[hidx];
+            if (hypotheses[hidx].isZero(0)) {
+                continue;
+            }
+            if (score.rejected) {
+                num_bad_inliers += double(score.num_inliers);
+                num_bad_tested += double(score.num_tested);
+                continue;
+            }
+            RANSACResult this_result;
+            if (score.num_inliers > 0) {
+                this_result.fitness_ = double(score.num_inliers) / num_points;
+                this_result.inlier_rmse_ =
+                        score.error / std::sqrt(double(score.num_inliers));
+            }
             if (this_result.fitness_ > result.fitness_ ||
                 (this_result.fitness_ == result.fitness_ &&
                  this_result.inlier_rmse_ < result.inlier_rmse_)) {
+                if (!best_plane_model.isZero(0)) {
+                    num_bad_inliers += result.fitness_ * num_points;
+                    num_bad_tested += num_points;
+                }
                 result = this_result;
-                best_plane_model = plane_model;
+                best_plane_model = hypotheses[hidx];
                 if (result.fitness_ < 1.0) {
                     break_iteration = std::min(
                             log(1 - probability) /
@@ -256,27 +374,57 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
                     // Set break_iteration to 0 to force to break the loop.
                     break_iteration = 0;
                 }
+            } else {
+                num_bad_inliers += double(score.num_inliers);
+                num_bad_tested += num_points;
             }
-            iteration_count++;
+        }
+        if (num_bad_tested > 0) {
+            test.Update(result.fitness_, num_bad_inliers / num_bad_tested);
         }
     }
 
     // Find the final inliers using best_plane_model.
-    std::vector<size_t> final_inliers;
+    std::vector<size_t> inlier_positions;
     if (!best_plane_model.isZero(0)) {
-        for (size_t idx = 0; idx < points_.size(); ++idx) {
-            Eigen::Vector4d point(points_[idx](0), points_[idx](1),
-                                  points_[idx](2), 1);
-            double distance = std::abs(best_plane_model.dot(point));
-
-            if (distance < distance_threshold) {
-                final_inliers.emplace_back(idx);
+        const Eigen::VectorXd distances =
+                ((best_plane_model.head<3>().transpose() * remaining_points_)
+                         .array() +
+                 best_plane_model(3))
+                        .abs();
+        for (int64_t pos = 0; pos < distances.size(); ++pos) {
+            if (distances(pos) < distance_threshold) {
+                inlier_positions.push_back(size_t(pos));
             }
         }
     }
+    std::vector<size_t> final_inliers(inlier_positions.size());
+    for (size_t iidx = 0; iidx < inlier_positions.size(); ++iidx) {
+        final_inliers[iidx] = indices_[inlier_positions[iidx]];
+    }
+    std::sort(final_inliers.begin(), final_inliers.end());
 
     // Improve best_plane_model using the final inliers.
-    best_plane_model = GetPlaneFromPoints(points_, final_inliers);
+    if (!final_inliers.empty()) {
+        best_plane_model = GetPlaneFromPoints(points_, final_inliers);
+    }
+
+    if (remove_inliers && !inlier_positions.empty()) {
+        size_t next_free = 0;
+        size_t iidx = 0;
+        for (size_t pos = 0; pos < indices_.size(); ++pos) {
+            if (iidx < inlier_positions.size() &&
+                inlier_positions[iidx] == pos) {
+                ++iidx;
+                continue;
+            }
+            indices_[next_free] = indices_[pos];
+            remaining_points_.col(next_free) = remaining_points_.col(pos);
+            ++next_free;
+        }
+        indices_.resize(next_free);
+        remaining_points_.conservativeResize(Eigen::NoChange, next_free);
+    }
 
     utility::LogDebug(
             "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iteration: "
@@ -286,5 +434,60 @@ std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
     return std::make_tuple(best_plane_model, final_inliers);
 }
 
+/// Checks the arguments of PointCloud::SegmentPlane and SegmentPlanes.
+void CheckSegmentPlaneArguments(size_t num_points,
+                                int ransac_n,
+                                double probability) {
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("Probability must be > 0 or <= 1.0");
+    }
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    if (num_points < size_t(ransac_n)) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+}
+
+}  // namespace
+
+std::tuple<Eigen::Vector4d, std::vector<size_t>> PointCloud::SegmentPlane(
+        const double distance_threshold /* = 0.01 */,
+        const int ransac_n /* = 3 */,
+        const int num_iterations /* = 100 */,
+        const double probability /* = 0.99999999 */,
+        utility::optional<int> seed /* = utility::nullopt */) const {
+    CheckSegmentPlaneArguments(points_.size(), ransac_n, probability);
+    PlaneRANSAC ransac(points_, seed);
+    return ransac.Segment(distance_threshold, ransac_n, num_iterations,
+                          probability, /*remove_inliers=*/false);
+}
+
+std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>>
+PointCloud::SegmentPlanes(const double distance_threshold /* = 0.01 */,
+                          const int ransac_n /* = 3 */,
+                          const int num_iterations /* = 100 */,
+                          const int max_num_planes /* = 5 */,
+                          const size_t min_num_inliers /* = 0 */,
+                          const double probability /* = 0.99999999 */,
+                          utility::optional<int> seed /* = nullopt */) const {
+    CheckSegmentPlaneArguments(points_.size(), ransac_n, probability);
+    std::vector<std::tuple<Eigen::Vector4d, std::vector<size_t>>> planes;
+    PlaneRANSAC ransac(points_, seed);
+    while (int(planes.size()) < max_num_planes &&
+           ransac.NumPoints() >= size_t(ransac_n)) {
+        auto plane = ransac.Segment(distance_threshold, ransac_n,
+                                    num_iterations, probability,
+                                    /*remove_inliers=*/true);
+        const std::vector<size_t> &inliers = std::get<1>(plane);
+        if (inliers.empty() || inliers.size() < min_num_inliers) {
+            break;
+        }
+        planes.push_back(std::move(plane));
+    }
+    return planes;
+}
+
 }  // namespace geometry
 }  // namespace open3d
@@ -25,169 +25,277 @@
 // ----------------------------------------------------------------------------
 
 #include <Eigen/Dense>
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <deque>
+#include <numeric>
 
 #include "open3d/geometry/IntersectionTest.h"
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-class BallPivotingVertex;
-class BallPivotingEdge;
-class BallPivotingTriangle;
+namespace {
 
-typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+/// The points are split into partitions of at most this many points, whose
+/// fronts are expanded in parallel.
+constexpr size_t kMaxPartitionSize = 1 << 14;
 
-class BallPivotingVertex {
-public:
-    enum Type { Orphan = 0, Front = 1, Inner = 2 };
+/// Edges and triangles are referenced by the index of the arena that holds
+/// them in the upper 32 bits and their index in the arena in the lower 32
+/// bits.
+constexpr int64_t kInvalidId = -1;
 
-    BallPivotingVertex(int idx,
-                       const Eigen::Vector3d& point,
-                       const Eigen::Vector3d& normal)
-        : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
+int64_t MakeId(int arena, size_t index) {
+    return (int64_t(arena) << 32) | int64_t(index);
+}
 
-    void UpdateType();
+class BallPivotingVertex {
+public:
+    enum Type : uint8_t { Orphan = 0, Front = 1, Inner = 2 };
 
 public:
-    int idx_;
-    const Eigen::Vector3d& point_;
-    const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
-    Type type_;
+    Type type_ = Orphan;
+    /// Head of the list of edges of the vertex, which is threaded through the
+    /// edges.
+    int64_t first_edge_ = kInvalidId;
 };
 
 class BallPivotingEdge {
 public:
-    enum Type { Border = 0, Front = 1, Inner = 2 };
+    enum Type : uint8_t { Border = 0, Front = 1, Inner = 2 };
 
-    BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
+    BallPivotingEdge(int source, int target)
+        : source_(source), target_(target) {}
 
-    void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
-    BallPivotingVertexPtr GetOppositeVertex();
+    /// Returns the edge after this one in the edge list of vertex \p vidx.
+    int64_t NextEdge(int vidx) const {
+        return vidx == source_ ? next_source_ : next_target_;
+    }
 
 public:
-    BallPivotingVertexPtr source_;
-    BallPivotingVertexPtr target_;
-    BallPivotingTrianglePtr triangle0_;
-    BallPivotingTrianglePtr triangle1_;
-    Type type_;
+    int source_;
+    int target_;
+    /// Next edges in the edge lists of source_ and target_.
+    int64_t next_source_ = kInvalidId;
+    int64_t next_target_ = kInvalidId;
+    int64_t triangle0_ = kInvalidId;
+    int64_t triangle1_ = kInvalidId;
+    Type type_ = Type::Front;
 };
 
 class BallPivotingTriangle {
 public:
-    BallPivotingTriangle(BallPivotingVertexPtr vert0,
-                         BallPivotingVertexPtr vert1,
-                         BallPivotingVertexPtr vert2,
-                         Eigen::Vector3d ball_center)
+    BallPivotingTriangle(int vert0,
+                         int vert1,
+                         int vert2,
+                         const Eigen::Vector3d& ball_center)
         : vert0_(vert0),
           vert1_(vert1),
           vert2_(vert2),
           ball_center_(ball_center) {}
 
 public:
-    BallPivotingVertexPtr vert0_;
-    BallPivotingVertexPtr vert1_;
-    BallPivotingVertexPtr vert2_;
+    int vert0_;
+    int vert1_;
+    int vert2_;
     Eigen::Vector3d ball_center_;
 };
 
-void BallPivotingVertex::UpdateType() {
-    if (edges_.empty()) {
-        type_ = Type::Orphan;
-    } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
-            if (edge->type_ != BallPivotingEdge::Type::Inner) {
-                type_ = Type::Front;
-                return;
-            }
-        }
-        type_ = Type::Inner;
-    }
-}
-
-void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
-    if (triangle != triangle0_ && triangle != triangle1_) {
-        if (triangle0_ == nullptr) {
-            triangle0_ = triangle;
-            type_ = Type::Front;
-            // update orientation
-            if (BallPivotingVertexPtr opp = GetOppositeVertex()) {
-                Eigen::Vector3d tr_norm =
-                        (target_->point_ - source_->point_)
-                                .cross(opp->point_ - source_->point_);
-                tr_norm /= tr_norm.norm();
-                Eigen::Vector3d pt_norm =
-                        source_->normal_ + target_->normal_ + opp->normal_;
-                pt_norm /= pt_norm.norm();
-                if (pt_norm.dot(tr_norm) < 0) {
-                    std::swap(target_, source_);
-                }
-            } else {
-                utility::LogError("GetOppositeVertex() returns nullptr.");
-            }
-        } else if (triangle1_ == nullptr) {
-            triangle1_ = triangle;
-            type_ = Type::Inner;
-        } else {
-            utility::LogDebug("!!! This case should not happen");
-        }
-    }
-}
+/// \class BallPivotingArena
+///
+/// \brief Pool of the edges and triangles that one front creates.
+class BallPivotingArena {
+public:
+    std::vector<BallPivotingEdge> edges_;
+    std::vector<BallPivotingTriangle> triangles_;
+    /// Number of triangles that are already added to the mesh.
+    size_t num_mesh_triangles_ = 0;
+};
 
-BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
-    if (triangle0_ != nullptr) {
-        if (triangle0_->vert0_->idx_ != source_->idx_ &&
-            triangle0_->vert0_->idx_ != target_->idx_) {
-            return triangle0_->vert0_;
-        } else if (triangle0_->vert1_->idx_ != source_->idx_ &&
-                   triangle0_->vert1_->idx_ != target_->idx_) {
-            return triangle0_->vert1_;
-        } else {
-            return triangle0_->vert2_;
-        }
-    } else {
-        return nullptr;
-    }
-}
+/// \class BallPivotingFront
+///
+/// \brief Edge front of a partition, or of the stitching pass if partition_ is
+/// -1.
+class BallPivotingFront {
+public:
+    int partition_ = -1;
+    /// Arena of the edges and triangles that the front creates.
+    int arena_ = 0;
+    /// Vertices of the partition in increasing order.
+    std::vector<int> vertices_;
+    std::deque<int64_t> edges_;
+    std::vector<int64_t> border_edges_;
+    /// Front edges and seed vertices with neighbors in other partitions,
+    /// which are left to the stitching pass.
+    std::vector<int64_t> deferred_edges_;
+    std::vector<int> deferred_seeds_;
+};
 
+/// \class BallPivoting
+///
+/// \brief Ball pivoting on spatial partitions of the point cloud.
+///
+/// The points are split at the median of the longest axis until every
+/// partition has at most kMaxPartitionSize points. The fronts of the
+/// partitions are expanded in parallel. A pivot or seed whose search ball
+/// contains a point of another partition is deferred, so that every partition
+/// only creates triangles, edges and vertex states of its own points, in its
+/// own arena. The stitching pass then expands the deferred edges and seeds
+/// serially across partition boundaries. Triangles are added to the mesh in
+/// arena order after every radius, so the mesh does not depend on the number
+/// of threads. A point cloud with a single partition is triangulated exactly
+/// like the serial algorithm.
 class BallPivoting {
 public:
     BallPivoting(const PointCloud& pcd)
-        : has_normals_(pcd.HasNormals()), kdtree_(pcd) {
+        : has_normals_(pcd.HasNormals()),
+          points_(pcd.points_),
+          normals_(pcd.normals_),
+          kdtree_(pcd),
+          vertices_(pcd.points_.size()) {
         mesh_ = std::make_shared<TriangleMesh>();
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
         mesh_->vertex_colors_ = pcd.colors_;
-        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
+        PartitionPoints();
+    }
+
+    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
+        if (!has_normals_) {
+            utility::LogError("ReconstructBallPivoting requires normals");
+        }
+
+        mesh_->triangles_.clear();
+
+        const int num_partitions = int(fronts_.size()) - 1;
+        BallPivotingFront& stitching_front = fronts_.back();
+        for (double radius : radii) {
+            utility::LogDebug("[Run] change to radius {:.4f}", radius);
+            if (radius <= 0) {
+                utility::LogError(
+                        "got an invalid, negative radius as parameter");
+            }
+
+#pragma omp parallel for schedule(dynamic) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int pidx = 0; pidx < num_partitions; ++pidx) {
+                BallPivotingFront& front = fronts_[pidx];
+                ReactivateBorderEdges(front, radius);
+                if (front.edges_.empty()) {
+                    FindSeedTriangle(front, radius);
+                } else {
+                    ExpandTriangulation(front, radius);
+                }
+            }
+
+            // Stitch the partitions.
+            ReactivateBorderEdges(stitching_front, radius);
+            for (int pidx = 0; pidx < num_partitions; ++pidx) {
+                std::vector<int64_t>& deferred = fronts_[pidx].deferred_edges_;
+                stitching_front.edges_.insert(stitching_front.edges_.end(),
+                                              deferred.begin(), deferred.end());
+                deferred.clear();
+            }
+            ExpandTriangulation(stitching_front, radius);
+            for (int pidx = 0; pidx < num_partitions; ++pidx) {
+                for (int vidx : fronts_[pidx].deferred_seeds_) {
+                    if (vertices_[vidx].type_ ==
+                                BallPivotingVertex::Type::Orphan &&
+                        TrySeed(stitching_front, vidx, radius)) {
+                        ExpandTriangulation(stitching_front, radius);
+                    }
+                }
+                fronts_[pidx].deferred_seeds_.clear();
+            }
+
+            AddTrianglesToMesh();
+            utility::LogDebug("[Run] mesh_ has {:d} triangles",
+                              mesh_->triangles_.size());
+        }
+        return mesh_;
+    }
+
+private:
+    void PartitionPoints() {
+        std::vector<int> indices(points_.size());
+        std::iota(indices.begin(), indices.end(), 0);
+        partitions_.assign(points_.size(), 0);
+
+        // Split depth first, so that the partitions are numbered
+        // deterministically.
+        std::vector<std::pair<size_t, size_t>> ranges = {{0, indices.size()}};
+        while (!ranges.empty()) {
+            const size_t begin = ranges.back().first;
+            const size_t end = ranges.back().second;
+            ranges.pop_back();
+            if (end - begin <= kMaxPartitionSize) {
+                BallPivotingFront front;
+                front.partition_ = int(fronts_.size());
+                front.arena_ = front.partition_;
+                front.vertices_.assign(indices.begin() + begin,
+                                       indices.begin() + end);
+                std::sort(front.vertices_.begin(), front.vertices_.end());
+                for (int vidx : front.vertices_) {
+                    partitions_[vidx] = front.partition_;
+                }
+                fronts_.push_back(std::move(front));
+                continue;
+            }
+
+            Eigen::Vector3d min_bound = points_[indices[begin]];
+            Eigen::Vector3d max_bound = min_bound;
+            for (size_t pos = begin; pos < end; ++pos) {
+                min_bound = min_bound.cwiseMin(points_[indices[pos]]);
+                max_bound = max_bound.cwiseMax(points_[indices[pos]]);
+            }
+            int axis;
+            (max_bound - min_bound).maxCoeff(&axis);
+            const size_t mid = begin + (end - begin) / 2;
+            std::nth_element(indices.begin() + begin, indices.begin() + mid,
+                             indices.begin() + end, [&](int lhs, int rhs) {
+                                 return points_[lhs](axis) < points_[rhs](axis);
+                             });
+            ranges.emplace_back(mid, end);
+            ranges.emplace_back(begin, mid);
         }
+
+        BallPivotingFront stitching_front;
+        stitching_front.arena_ = int(fronts_.size());
+        fronts_.push_back(std::move(stitching_front));
+        arenas_.resize(fronts_.size());
     }
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
+    /// Returns true if \p front may use all points in \p indices.
+    bool OwnsPoints(const BallPivotingFront& front,
+                    const std::vector<int>& indices) const {
+        if (front.partition_ < 0) {
+            return true;
         }
+        return std::all_of(indices.begin(), indices.end(), [&](int idx) {
+            return partitions_[idx] == front.partition_;
+        });
+    }
+
+    BallPivotingEdge& Edge(int64_t id) {
+        return arenas_[id >> 32].edges_[id & 0xffffffff];
+    }
+    BallPivotingTriangle& Triangle(int64_t id) {
+        return arenas_[id >> 32].triangles_[id & 0xffffffff];
     }
 
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
                            int vidx3,
                            double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+                           Eigen::Vector3d& center) const {
+        const Eigen::Vector3d& v1 = points_[vidx1];
+        const Eigen::Vector3d& v2 = points_[vidx2];
+        const Eigen::Vector3d& v3 = points_[vidx3];
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -218,9 +326,8 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm =
+                    normals_[vidx1] + normals_[vidx2] + normals_[vidx3];
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -233,72 +340,119 @@ public:
         return false;
     }
 
-    BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
-                                       const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
-                }
+    int64_t GetLinkingEdge(int v0, int v1) {
+        for (int64_t id = vertices_[v0].first_edge_; id != kInvalidId;) {
+            const BallPivotingEdge& edge = Edge(id);
+            if ((edge.source_ == v0 && edge.target_ == v1) ||
+                (edge.source_ == v1 && edge.target_ == v0)) {
+                return id;
             }
+            id = edge.NextEdge(v0);
         }
-        return nullptr;
+        return kInvalidId;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
-                        const BallPivotingVertexPtr& v1,
-                        const BallPivotingVertexPtr& v2,
-                        const Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
-                v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
-        if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
-        }
-        e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
+    int64_t CreateEdge(int arena, int source, int target) {
+        std::vector<BallPivotingEdge>& edges = arenas_[arena].edges_;
+        const int64_t id = MakeId(arena, edges.size());
+        edges.emplace_back(source, target);
+        BallPivotingEdge& edge = edges.back();
+        edge.next_source_ = vertices_[source].first_edge_;
+        edge.next_target_ = vertices_[target].first_edge_;
+        vertices_[source].first_edge_ = id;
+        vertices_[target].first_edge_ = id;
+        return id;
+    }
 
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
+    int GetOppositeVertex(const BallPivotingEdge& edge) {
+        const BallPivotingTriangle& triangle = Triangle(edge.triangle0_);
+        if (triangle.vert0_ != edge.source_ &&
+            triangle.vert0_ != edge.target_) {
+            return triangle.vert0_;
+        } else if (triangle.vert1_ != edge.source_ &&
+                   triangle.vert1_ != edge.target_) {
+            return triangle.vert1_;
+        } else {
+            return triangle.vert2_;
         }
-        e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
+    }
 
-        BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
-        if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
+    void AddAdjacentTriangle(int64_t edge_id, int64_t triangle_id) {
+        BallPivotingEdge& edge = Edge(edge_id);
+        if (triangle_id == edge.triangle0_ || triangle_id == edge.triangle1_) {
+            return;
         }
-        e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
-
-        v0->UpdateType();
-        v1->UpdateType();
-        v2->UpdateType();
-
-        Eigen::Vector3d face_normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
+        if (edge.triangle0_ == kInvalidId) {
+            edge.triangle0_ = triangle_id;
+            edge.type_ = BallPivotingEdge::Type::Front;
+            // update orientation
+            const int opp = GetOppositeVertex(edge);
+            const Eigen::Vector3d& source = points_[edge.source_];
+            Eigen::Vector3d tr_norm = (points_[edge.target_] - source)
+                                              .cross(points_[opp] - source);
+            tr_norm /= tr_norm.norm();
+            Eigen::Vector3d pt_norm = normals_[edge.source_] +
+                                      normals_[edge.target_] + normals_[opp];
+            pt_norm /= pt_norm.norm();
+            if (pt_norm.dot(tr_norm) < 0) {
+                std::swap(edge.target_, edge.source_);
+                std::swap(edge.next_target_, edge.next_source_);
+            }
+        } else if (edge.triangle1_ == kInvalidId) {
+            edge.triangle1_ = triangle_id;
+            edge.type_ = BallPivotingEdge::Type::Inner;
         } else {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
+            utility::LogDebug("!!! This case should not happen");
         }
-        mesh_->triangle_normals_.push_back(face_normal);
+    }
+
+    void UpdateType(int vidx) {
+        BallPivotingVertex& vertex = vertices_[vidx];
+        if (vertex.first_edge_ == kInvalidId) {
+            vertex.type_ = BallPivotingVertex::Type::Orphan;
+            return;
+        }
+        for (int64_t id = vertex.first_edge_; id != kInvalidId;) {
+            const BallPivotingEdge& edge = Edge(id);
+            if (edge.type_ != BallPivotingEdge::Type::Inner) {
+                vertex.type_ = BallPivotingVertex::Type::Front;
+                return;
+            }
+            id = edge.NextEdge(vidx);
+        }
+        vertex.type_ = BallPivotingVertex::Type::Inner;
+    }
+
+    void CreateTriangle(BallPivotingFront& front,
+                        int v0,
+                        int v1,
+                        int v2,
+                        const Eigen::Vector3d& center) {
+        std::vector<BallPivotingTriangle>& triangles =
+                arenas_[front.arena_].triangles_;
+        const int64_t triangle_id = MakeId(front.arena_, triangles.size());
+        triangles.emplace_back(v0, v1, v2, center);
+
+        for (const auto& vertex_pair : {std::make_pair(v0, v1),
+                                        std::make_pair(v1, v2),
+                                        std::make_pair(v2, v0)}) {
+            int64_t edge_id =
+                    GetLinkingEdge(vertex_pair.first, vertex_pair.second);
+            if (edge_id == kInvalidId) {
+                edge_id = CreateEdge(front.arena_, vertex_pair.first,
+                                     vertex_pair.second);
+            }
+            AddAdjacentTriangle(edge_id, triangle_id);
+        }
+
+        UpdateType(v0);
+        UpdateType(v1);
+        UpdateType(v2);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
                                       const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
+                                      const Eigen::Vector3d& v2) const {
         Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
         double norm = normal.norm();
         if (norm > 0) {
@@ -307,125 +461,67 @@ public:
         return normal;
     }
 
-    bool IsCompatible(const BallPivotingVertexPtr& v0,
-                      const BallPivotingVertexPtr& v1,
-                      const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
+    bool IsCompatible(int v0, int v1, int v2) const {
         Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
+                ComputeFaceNormal(points_[v0], points_[v1], points_[v2]);
+        if (normal.dot(normals_[v0]) < -1e-16) {
             normal *= -1;
         }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
-        utility::LogDebug("[IsCompatible] returns = {}", ret);
-        return ret;
+        return normal.dot(normals_[v0]) > -1e-16 &&
+               normal.dot(normals_[v1]) > -1e-16 &&
+               normal.dot(normals_[v2]) > -1e-16;
     }
 
-    BallPivotingVertexPtr FindCandidateVertex(
-            const BallPivotingEdgePtr& edge,
-            double radius,
-            Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
-        BallPivotingVertexPtr src = edge->source_;
-        BallPivotingVertexPtr tgt = edge->target_;
-
-        const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
-        if (opp == nullptr) {
-            utility::LogError("edge->GetOppositeVertex() returns nullptr.");
-            assert(opp == nullptr);
-        }
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
-
-        Eigen::Vector3d v = tgt->point_ - src->point_;
+    /// Returns the vertex that the ball hits first when it pivots around
+    /// \p edge, or -1, with \p indices the points within twice the radius of
+    /// the edge midpoint.
+    int FindCandidateVertex(const BallPivotingEdge& edge,
+                            double radius,
+                            const std::vector<int>& indices,
+                            Eigen::Vector3d& candidate_center) {
+        const int src = edge.source_;
+        const int tgt = edge.target_;
+        const int opp = GetOppositeVertex(edge);
+
+        Eigen::Vector3d mp = 0.5 * (points_[src] + points_[tgt]);
+        const Eigen::Vector3d& center = Triangle(edge.triangle0_).ball_center_;
+
+        Eigen::Vector3d v = points_[tgt] - points_[src];
         v /= v.norm();
 
         Eigen::Vector3d a = center - mp;
         a /= a.norm();
 
-        std::vector<int> indices;
-        std::vector<double> dists2;
-        kdtree_.SearchRadius(mp, 2 * radius, indices, dists2);
-        utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
-                          indices.size());
-
-        BallPivotingVertexPtr min_candidate = nullptr;
+        int min_candidate = -1;
         double min_angle = 2 * M_PI;
-        for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
+        for (int candidate : indices) {
+            if (candidate == src || candidate == tgt || candidate == opp) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
 
             bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
+                    points_[src], points_[tgt], points_[opp],
+                    points_[candidate]);
             if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
+                                     mp, points_[candidate], points_[src],
+                                     points_[opp]) < 1e-12 ||
                              IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is intersecting "
-                        "the existing triangle",
-                        candidate->idx_);
+                                     mp, points_[candidate], points_[tgt],
+                                     points_[opp]) < 1e-12)) {
                 continue;
             }
 
             Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} can not compute "
-                        "ball",
-                        candidate->idx_);
+            if (!ComputeBallCenter(src, tgt, candidate, radius, new_center)) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
 
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
 
             double angle = std::acos(cosinus);
 
@@ -435,324 +531,269 @@ public:
             }
 
             if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
                 continue;
             }
 
             bool empty_ball = true;
-            for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
+            for (int nb : indices) {
+                if (nb == src || nb == tgt || nb == candidate) {
                     continue;
                 }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
-                            "[FindCandidateVertex] candidate {:d} not an empty "
-                            "ball",
-                            candidate->idx_);
+                if ((new_center - points_[nb]).norm() < radius - 1e-16) {
                     empty_ball = false;
                     break;
                 }
             }
 
             if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
                 min_angle = angle;
-                min_candidate = vertices[nbidx];
+                min_candidate = candidate;
                 candidate_center = new_center;
             }
         }
-
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
         return min_candidate;
     }
 
-    void ExpandTriangulation(double radius) {
-        utility::LogDebug("[ExpandTriangulation] radius={}", radius);
-        while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
-            edge_front_.pop_front();
-            if (edge->type_ != BallPivotingEdge::Front) {
+    void ExpandTriangulation(BallPivotingFront& front, double radius) {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+        while (!front.edges_.empty()) {
+            const int64_t edge_id = front.edges_.front();
+            front.edges_.pop_front();
+            const BallPivotingEdge& edge = Edge(edge_id);
+            if (edge.type_ != BallPivotingEdge::Front) {
+                continue;
+            }
+
+            const int src = edge.source_;
+            const int tgt = edge.target_;
+            kdtree_.SearchRadius(Eigen::Vector3d(0.5 * (points_[src] +
+                                                        points_[tgt])),
+                                 2 * radius, indices, dists2);
+            if (!OwnsPoints(front, indices)) {
+                front.deferred_edges_.push_back(edge_id);
                 continue;
             }
 
             Eigen::Vector3d center;
-            BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
-            if (candidate == nullptr ||
-                candidate->type_ == BallPivotingVertex::Type::Inner ||
-                !IsCompatible(candidate, edge->source_, edge->target_)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            const int candidate =
+                    FindCandidateVertex(edge, radius, indices, center);
+            if (candidate < 0 ||
+                vertices_[candidate].type_ ==
+                        BallPivotingVertex::Type::Inner ||
+                !IsCompatible(candidate, src, tgt)) {
+                Edge(edge_id).type_ = BallPivotingEdge::Type::Border;
+                front.border_edges_.push_back(edge_id);
                 continue;
             }
 
-            BallPivotingEdgePtr e0 = GetLinkingEdge(candidate, edge->source_);
-            BallPivotingEdgePtr e1 = GetLinkingEdge(candidate, edge->target_);
-            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
-                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int64_t e0 = GetLinkingEdge(candidate, src);
+            int64_t e1 = GetLinkingEdge(candidate, tgt);
+            if ((e0 != kInvalidId &&
+                 Edge(e0).type_ != BallPivotingEdge::Type::Front) ||
+                (e1 != kInvalidId &&
+                 Edge(e1).type_ != BallPivotingEdge::Type::Front)) {
+                Edge(edge_id).type_ = BallPivotingEdge::Type::Border;
+                front.border_edges_.push_back(edge_id);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(front, src, tgt, candidate, center);
 
-            e0 = GetLinkingEdge(candidate, edge->source_);
-            e1 = GetLinkingEdge(candidate, edge->target_);
-            if (e0->type_ == BallPivotingEdge::Type::Front) {
-                edge_front_.push_front(e0);
+            e0 = GetLinkingEdge(candidate, src);
+            e1 = GetLinkingEdge(candidate, tgt);
+            if (Edge(e0).type_ == BallPivotingEdge::Type::Front) {
+                front.edges_.push_front(e0);
             }
-            if (e1->type_ == BallPivotingEdge::Type::Front) {
-                edge_front_.push_front(e1);
+            if (Edge(e1).type_ == BallPivotingEdge::Type::Front) {
+                front.edges_.push_front(e1);
             }
         }
     }
 
-    bool TryTriangleSeed(const BallPivotingVertexPtr& v0,
-                         const BallPivotingVertexPtr& v1,
-                         const BallPivotingVertexPtr& v2,
+    bool TryTriangleSeed(int v0,
+                         int v1,
+                         int v2,
                          const std::vector<int>& nb_indices,
                          double radius,
                          Eigen::Vector3d& center) {
-        utility::LogDebug(
-                "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
-                "radius={}",
-                v0->idx_, v1->idx_, v2->idx_, radius);
-
         if (!IsCompatible(v0, v1, v2)) {
             return false;
         }
 
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e0 is inner edge",
-                    false);
+        const int64_t e0 = GetLinkingEdge(v0, v2);
+        const int64_t e1 = GetLinkingEdge(v1, v2);
+        if (e0 != kInvalidId &&
+            Edge(e0).type_ == BallPivotingEdge::Type::Inner) {
             return false;
         }
-        if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e1 is inner edge",
-                    false);
+        if (e1 != kInvalidId &&
+            Edge(e1).type_ == BallPivotingEdge::Type::Inner) {
             return false;
         }
 
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} could not compute ball "
-                    "center",
-                    false);
+        if (!ComputeBallCenter(v0, v1, v2, radius, center)) {
             return false;
         }
 
         // test if no other point is within the ball
-        for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
+        for (int nb : nb_indices) {
+            if (nb == v0 || nb == v1 || nb == v2) {
                 continue;
             }
-            if ((center - v->point_).norm() < radius - 1e-16) {
-                utility::LogDebug(
-                        "[TryTriangleSeed] returns {} computed ball is not "
-                        "empty",
-                        false);
+            if ((center - points_[nb]).norm() < radius - 1e-16) {
                 return false;
             }
         }
-
-        utility::LogDebug("[TryTriangleSeed] returns {}", true);
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
+    bool TrySeed(BallPivotingFront& front, int v, double radius) {
         std::vector<int> indices;
         std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
+        kdtree_.SearchRadius(points_[v], 2 * radius, indices, dists2);
         if (indices.size() < 3u) {
             return false;
         }
+        if (!OwnsPoints(front, indices)) {
+            front.deferred_seeds_.push_back(v);
+            return false;
+        }
 
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
-                continue;
-            }
-            if (nb0->idx_ == v->idx_) {
+            const int nb0 = indices[nbidx0];
+            if (vertices_[nb0].type_ != BallPivotingVertex::Type::Orphan ||
+                nb0 == v) {
                 continue;
             }
 
-            int candidate_vidx2 = -1;
+            int nb1 = -1;
             Eigen::Vector3d center;
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
+                const int candidate = indices[nbidx1];
+                if (vertices_[candidate].type_ !=
+                            BallPivotingVertex::Type::Orphan ||
+                    candidate == v) {
                     continue;
                 }
-                if (nb1->idx_ == v->idx_) {
-                    continue;
-                }
-                if (TryTriangleSeed(v, nb0, nb1, indices, radius, center)) {
-                    candidate_vidx2 = nb1->idx_;
+                if (TryTriangleSeed(v, nb0, candidate, indices, radius,
+                                    center)) {
+                    nb1 = candidate;
                     break;
                 }
             }
+            if (nb1 < 0) {
+                continue;
+            }
 
-            if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
-
-                BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
-                if (e0 != nullptr &&
-                    e0->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-                BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
-                if (e1 != nullptr &&
-                    e1->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-                BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
-                if (e2 != nullptr &&
-                    e2->type_ != BallPivotingEdge::Type::Front) {
-                    continue;
-                }
-
-                CreateTriangle(v, nb0, nb1, center);
+            const std::pair<int, int> seed_edges[] = {
+                    {v, nb1}, {nb0, nb1}, {v, nb0}};
+            bool has_non_front_edge = false;
+            for (const auto& vertex_pair : seed_edges) {
+                const int64_t edge_id =
+                        GetLinkingEdge(vertex_pair.first, vertex_pair.second);
+                has_non_front_edge |=
+                        edge_id != kInvalidId &&
+                        Edge(edge_id).type_ != BallPivotingEdge::Type::Front;
+            }
+            if (has_non_front_edge) {
+                continue;
+            }
 
-                e0 = GetLinkingEdge(v, nb1);
-                e1 = GetLinkingEdge(nb0, nb1);
-                e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e0);
-                }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e1);
-                }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e2);
-                }
+            CreateTriangle(front, v, nb0, nb1, center);
 
-                if (edge_front_.size() > 0) {
-                    utility::LogDebug(
-                            "[TrySeed] edge_front_.size() > 0 => return "
-                            "true");
-                    return true;
+            for (const auto& vertex_pair : seed_edges) {
+                const int64_t edge_id =
+                        GetLinkingEdge(vertex_pair.first, vertex_pair.second);
+                if (Edge(edge_id).type_ == BallPivotingEdge::Type::Front) {
+                    front.edges_.push_front(edge_id);
                 }
             }
+            if (!front.edges_.empty()) {
+                return true;
+            }
         }
-
-        utility::LogDebug("[TrySeed] return false");
         return false;
     }
 
-    void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
-                    ExpandTriangulation(radius);
-                }
+    void FindSeedTriangle(BallPivotingFront& front, double radius) {
+        for (int vidx : front.vertices_) {
+            if (vertices_[vidx].type_ == BallPivotingVertex::Type::Orphan &&
+                TrySeed(front, vidx, radius)) {
+                ExpandTriangulation(front, radius);
             }
         }
     }
 
-    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
-        if (!has_normals_) {
-            utility::LogError("ReconstructBallPivoting requires normals");
-        }
-
-        mesh_->triangles_.clear();
-
-        for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
-            utility::LogDebug("[Run] change to radius {:.4f}", radius);
-            if (radius <= 0) {
-                utility::LogError(
-                        "got an invalid, negative radius as parameter");
-            }
-
-            // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
-
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
+    /// Returns the border edges of \p front to the front if the ball with the
+    /// new radius on their triangle is empty.
+    void ReactivateBorderEdges(BallPivotingFront& front, double radius) {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+        size_t next_border_edge = 0;
+        for (int64_t edge_id : front.border_edges_) {
+            BallPivotingEdge& edge = Edge(edge_id);
+            const BallPivotingTriangle& triangle = Triangle(edge.triangle0_);
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle.vert0_, triangle.vert1_,
+                                  triangle.vert2_, radius, center)) {
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                const bool empty_ball = std::all_of(
+                        indices.begin(), indices.end(), [&](int idx) {
+                            return idx == triangle.vert0_ ||
+                                   idx == triangle.vert1_ ||
+                                   idx == triangle.vert2_;
+                        });
+                if (empty_ball) {
+                    edge.type_ = BallPivotingEdge::Type::Front;
+                    front.edges_.push_back(edge_id);
+                    continue;
                 }
-                ++it;
             }
+            front.border_edges_[next_border_edge++] = edge_id;
+        }
+        front.border_edges_.resize(next_border_edge);
+    }
 
-            // do the reconstruction
-            if (edge_front_.empty()) {
-                FindSeedTriangle(radius);
-            } else {
-                ExpandTriangulation(radius);
+    void AddTrianglesToMesh() {
+        for (BallPivotingArena& arena : arenas_) {
+            for (size_t tidx = arena.num_mesh_triangles_;
+                 tidx < arena.triangles_.size(); ++tidx) {
+                const BallPivotingTriangle& triangle = arena.triangles_[tidx];
+                const int v0 = triangle.vert0_;
+                const int v1 = triangle.vert1_;
+                const int v2 = triangle.vert2_;
+                Eigen::Vector3d face_normal = ComputeFaceNormal(
+                        points_[v0], points_[v1], points_[v2]);
+                if (face_normal.dot(normals_[v0]) > -1e-16) {
+                    mesh_->triangles_.emplace_back(v0, v1, v2);
+                } else {
+                    mesh_->triangles_.emplace_back(v0, v2, v1);
+                }
+                mesh_->triangle_normals_.push_back(face_normal);
             }
-
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
-            utility::LogDebug("[Run] ################################");
+            arena.num_mesh_triangles_ = arena.triangles_.size();
         }
-        return mesh_;
     }
 
 private:
     bool has_normals_;
+    const std::vector<Eigen::Vector3d>& points_;
+    const std::vector<Eigen::Vector3d>& normals_;
     KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
+    std::vector<BallPivotingVertex> vertices_;
+    /// Partition of every point.
+    std::vector<int> partitions_;
+    /// Fronts of the partitions, followed by the front of the stitching pass.
+    std::vector<BallPivotingFront> fronts_;
+    /// Arena of every front.
+    std::vector<BallPivotingArena> arenas_;
     std::shared_ptr<TriangleMesh> mesh_;
 };
 
+}  // namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
         const PointCloud& pcd, const std::vector<double>& radii) {
     BallPivoting bp(pcd);
@@ -31,8 +31,10 @@
 #include <cstdlib>
 #include <iostream>
 #include <list>
+#include <memory>
 
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/SurfaceReconstructionPoisson.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/utility/Logging.h"
 
@@ -102,33 +104,45 @@ public:
     Eigen::Vector3d color_;
 };
 
-template <typename Real>
+// Streams points from raw N x 3 arrays of type T in place.
+template <typename Real, typename T>
 class Open3DPointStream
     : public InputPointStreamWithData<Real, DIMENSION, Open3DData> {
 public:
-    Open3DPointStream(const open3d::geometry::PointCloud* pcd)
-        : pcd_(pcd), xform_(nullptr), current_(0) {}
+    Open3DPointStream(const T* points,
+                      const T* normals,
+                      const T* colors,
+                      size_t num_points)
+        : points_(points),
+          normals_(normals),
+          colors_(colors),
+          num_points_(num_points),
+          xform_(nullptr),
+          current_(0) {}
     void reset(void) { current_ = 0; }
     bool nextPoint(Point<Real, 3>& p, Open3DData& d) {
-        if (current_ >= pcd_->points_.size()) {
+        if (current_ >= num_points_) {
             return false;
         }
-        p.coords[0] = static_cast<Real>(pcd_->points_[current_](0));
-        p.coords[1] = static_cast<Real>(pcd_->points_[current_](1));
-        p.coords[2] = static_cast<Real>(pcd_->points_[current_](2));
+        const T* point = points_ + 3 * current_;
+        p.coords[0] = static_cast<Real>(point[0]);
+        p.coords[1] = static_cast<Real>(point[1]);
+        p.coords[2] = static_cast<Real>(point[2]);
 
         if (xform_ != nullptr) {
             p = (*xform_) * p;
         }
 
-        if (pcd_->HasNormals()) {
-            d.normal_ = pcd_->normals_[current_];
+        if (normals_ != nullptr) {
+            const T* normal = normals_ + 3 * current_;
+            d.normal_ = Eigen::Vector3d(normal[0], normal[1], normal[2]);
         } else {
             d.normal_ = Eigen::Vector3d(0, 0, 0);
         }
 
-        if (pcd_->HasColors()) {
-            d.color_ = pcd_->colors_[current_];
+        if (colors_ != nullptr) {
+            const T* color = colors_ + 3 * current_;
+            d.color_ = Eigen::Vector3d(color[0], color[1], color[2]);
         } else {
             d.color_ = Eigen::Vector3d(0, 0, 0);
         }
@@ -138,7 +152,10 @@ public:
     }
 
 public:
-    const open3d::geometry::PointCloud* pcd_;
+    const T* points_;
+    const T* normals_;
+    const T* colors_;
+    size_t num_points_;
     XForm<Real, 4>* xform_;
     size_t current_;
 };
@@ -189,8 +206,17 @@ template <unsigned int Dim, class Real>
 struct FEMTreeProfiler {
     FEMTree<Dim, Real>& tree;
     double t;
-
-    FEMTreeProfiler(FEMTree<Dim, Real>& tree) : tree(tree), t(0.0) {}
+    std::vector<std::pair<std::string, double>>* stage_times;
+    double max_memory_mb;
+
+    FEMTreeProfiler(FEMTree<Dim, Real>& tree,
+                    std::vector<std::pair<std::string, double>>* stage_times =
+                            nullptr,
+                    double max_memory_mb = 0.0)
+        : tree(tree),
+          t(0.0),
+          stage_times(stage_times),
+          max_memory_mb(max_memory_mb) {}
     void start(void) {
         t = Time(), FEMTree<Dim, Real>::ResetLocalMemoryUsage();
     }
@@ -209,6 +235,21 @@ struct FEMTreeProfiler {
                               MemoryInfo::PeakMemoryUsageMB());
         }
     }
+    // Ends a stage: logs it, records its time and enforces the memory limit.
+    void stop(const char* stage, const char* header) const {
+        dumpOutput(header);
+        if (stage_times) {
+            stage_times->emplace_back(stage, Time() - t);
+        }
+        double memory_mb = FEMTree<Dim, Real>::LocalMemoryUsage();
+        if (max_memory_mb > 0 && memory_mb > max_memory_mb) {
+            utility::LogError(
+                    "Poisson reconstruction uses {:.1f} MB after stage {}, "
+                    "exceeding the limit of {:.1f} MB. Consider reducing the "
+                    "depth.",
+                    memory_mb, stage, max_memory_mb);
+        }
+    }
 };
 
 template <class Real, unsigned int Dim>
@@ -340,8 +381,7 @@ void ExtractMesh(
                 density,
         const SetVertexFunction& SetVertex,
         XForm<Real, sizeof...(FEMSigs) + 1> iXForm,
-        std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
-        std::vector<double>& out_densities) {
+        MeshSink& sink) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
     static const unsigned int DataSig =
@@ -352,8 +392,8 @@ void ExtractMesh(
 
     FEMTreeProfiler<Dim, Real> profiler(tree);
 
-    CoredMeshData<Vertex, node_index_type>* mesh;
-    mesh = new CoredVectorMeshData<Vertex, node_index_type>();
+    std::unique_ptr<CoredMeshData<Vertex, node_index_type>> mesh(
+            new CoredVectorMeshData<Vertex, node_index_type>());
 
     bool non_manifold = true;
     bool polygon_mesh = false;
@@ -386,39 +426,42 @@ void ExtractMesh(
     }
 
     mesh->resetIterator();
-    out_densities.clear();
-    for (size_t vidx = 0; vidx < mesh->outOfCorePointCount(); ++vidx) {
+    size_t num_vertices = mesh->outOfCorePointCount();
+    size_t num_triangles = mesh->polygonCount();
+    sink.Resize(num_vertices, num_triangles);
+    for (size_t vidx = 0; vidx < num_vertices; ++vidx) {
         Vertex v;
         mesh->nextOutOfCorePoint(v);
         v.point = iXForm * v.point;
-        out_mesh->vertices_.push_back(
-                Eigen::Vector3d(v.point[0], v.point[1], v.point[2]));
-        out_mesh->vertex_normals_.push_back(v.normal_);
-        out_mesh->vertex_colors_.push_back(v.color_);
-        out_densities.push_back(v.w_);
+        const double position[3] = {v.point[0], v.point[1], v.point[2]};
+        sink.SetVertex(vidx, position, v.normal_.data(), v.color_.data(),
+                       v.w_);
     }
-    for (size_t tidx = 0; tidx < mesh->polygonCount(); ++tidx) {
+    for (size_t tidx = 0; tidx < num_triangles; ++tidx) {
         std::vector<CoredVertexIndex<node_index_type>> triangle;
         mesh->nextPolygon(triangle);
         if (triangle.size() != 3) {
             open3d::utility::LogError("got polygon");
         } else {
-            out_mesh->triangles_.push_back(Eigen::Vector3i(
-                    triangle[0].idx, triangle[1].idx, triangle[2].idx));
+            sink.SetTriangle(tidx, static_cast<int>(triangle[0].idx),
+                             static_cast<int>(triangle[1].idx),
+                             static_cast<int>(triangle[2].idx));
         }
     }
-
-    delete mesh;
 }
 
-template <class Real, typename... SampleData, unsigned int... FEMSigs>
-void Execute(const open3d::geometry::PointCloud& pcd,
-             std::shared_ptr<open3d::geometry::TriangleMesh>& out_mesh,
-             std::vector<double>& out_densities,
+template <class Real,
+          class PointStream,
+          typename... SampleData,
+          unsigned int... FEMSigs>
+void Execute(PointStream& pointStream,
+             MeshSink& sink,
+             std::vector<std::pair<std::string, double>>& stage_times,
              int depth,
              float width,
              float scale,
              bool linear_fit,
+             double max_memory_mb,
              UIntPack<FEMSigs...>) {
     static const int Dim = sizeof...(FEMSigs);
     typedef UIntPack<FEMSigs...> Sigs;
@@ -452,21 +495,20 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     Real isoValue = 0;
 
     FEMTree<Dim, Real> tree(MEMORY_ALLOCATOR_BLOCK_SIZE);
-    FEMTreeProfiler<Dim, Real> profiler(tree);
+    FEMTreeProfiler<Dim, Real> profiler(tree, &stage_times, max_memory_mb);
 
     size_t pointCount;
 
     Real pointWeightSum;
     std::vector<typename FEMTree<Dim, Real>::PointSample> samples;
     std::vector<Open3DData> sampleData;
-    DensityEstimator* density = NULL;
-    SparseNodeData<Point<Real, Dim>, NormalSigs>* normalInfo = NULL;
+    std::unique_ptr<DensityEstimator> density;
+    std::unique_ptr<SparseNodeData<Point<Real, Dim>, NormalSigs>> normalInfo;
     Real targetValue = (Real)0.5;
 
     // Read in the samples (and color data)
     {
-        Open3DPointStream<Real> pointStream(&pcd);
-
+        profiler.start();
         if (width > 0.0f) {
             xForm = GetPointXForm<Real, Dim>(pointStream, (Real)width,
                                              (Real)(scale > 0 ? scale : 1.),
@@ -512,6 +554,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
 
         utility::LogDebug("Input Points / Samples: {} / {}", pointCount,
                           samples.size());
+        profiler.stop("read_points", "#        Read points:");
     }
 
     int kernelDepth = depth - 2;
@@ -522,7 +565,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
     DenseNodeData<Real, Sigs> solution;
     {
         DenseNodeData<Real, Sigs> constraints;
-        InterpolationInfo* iInfo = NULL;
+        std::unique_ptr<InterpolationInfo> iInfo;
         int solveDepth = depth;
 
         tree.resetNodeIndices();
@@ -530,15 +573,16 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         // Get the kernel density estimator
         {
             profiler.start();
-            density = tree.template setDensityEstimator<WEIGHT_DEGREE>(
-                    samples, kernelDepth, samples_per_node, 1);
-            profiler.dumpOutput("#   Got kernel density:");
+            density.reset(tree.template setDensityEstimator<WEIGHT_DEGREE>(
+                    samples, kernelDepth, samples_per_node, 1));
+            profiler.stop("density_estimation", "#   Got kernel density:");
         }
 
         // Transform the Hermite samples into a vector field
         {
             profiler.start();
-            normalInfo = new SparseNodeData<Point<Real, Dim>, NormalSigs>();
+            normalInfo.reset(
+                    new SparseNodeData<Point<Real, Dim>, NormalSigs>());
             std::function<bool(Open3DData, Point<Real, Dim>&)>
                     ConversionFunction =
                             [](Open3DData in, Point<Real, Dim>& out) {
@@ -572,18 +616,18 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     };
             if (confidence_bias > 0) {
                 *normalInfo = tree.setDataField(
-                        NormalSigs(), samples, sampleData, density,
+                        NormalSigs(), samples, sampleData, density.get(),
                         pointWeightSum, ConversionAndBiasFunction);
             } else {
                 *normalInfo = tree.setDataField(
-                        NormalSigs(), samples, sampleData, density,
+                        NormalSigs(), samples, sampleData, density.get(),
                         pointWeightSum, ConversionFunction);
             }
             ThreadPool::Parallel_for(0, normalInfo->size(),
                                      [&](unsigned int, size_t i) {
                                          (*normalInfo)[i] *= (Real)-1.;
                                      });
-            profiler.dumpOutput("#     Got normal field:");
+            profiler.stop("normal_field", "#     Got normal field:");
             utility::LogDebug("Point weight / Estimated Area: {:e} / {:e}",
                               pointWeightSum, pointCount * pointWeightSum);
         }
@@ -598,8 +642,8 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                     full_depth,
                     typename FEMTree<Dim, Real>::template HasNormalDataFunctor<
                             NormalSigs>(*normalInfo),
-                    normalInfo, density);
-            profiler.dumpOutput("#       Finalized tree:");
+                    normalInfo.get(), density.get());
+            profiler.stop("finalize_tree", "#       Finalized tree:");
         }
 
         // Add the FEM constraints
@@ -624,17 +668,17 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                  derivatives2)] = 1;
             }
             tree.addFEMConstraints(F, *normalInfo, constraints, solveDepth);
-            profiler.dumpOutput("#  Set FEM constraints:");
+            profiler.stop("fem_constraints", "#  Set FEM constraints:");
         }
 
         // Free up the normal info
-        delete normalInfo, normalInfo = NULL;
+        normalInfo.reset();
 
         // Add the interpolation constraints
         if (point_weight > 0) {
             profiler.start();
             if (exact_interpolation) {
-                iInfo = FEMTree<Dim, Real>::
+                iInfo.reset(FEMTree<Dim, Real>::
                         template InitializeExactPointInterpolationInfo<Real, 0>(
                                 tree, samples,
                                 ConstraintDual<Dim, Real>(
@@ -642,9 +686,9 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                         (Real)point_weight * pointWeightSum),
                                 SystemDual<Dim, Real>((Real)point_weight *
                                                       pointWeightSum),
-                                true, false);
+                                true, false));
             } else {
-                iInfo = FEMTree<Dim, Real>::
+                iInfo.reset(FEMTree<Dim, Real>::
                         template InitializeApproximatePointInterpolationInfo<
                                 Real, 0>(
                                 tree, samples,
@@ -653,10 +697,10 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                         (Real)point_weight * pointWeightSum),
                                 SystemDual<Dim, Real>((Real)point_weight *
                                                       pointWeightSum),
-                                true, 1);
+                                true, 1));
             }
             tree.addInterpolationConstraints(constraints, solveDepth, *iInfo);
-            profiler.dumpOutput("#Set point constraints:");
+            profiler.stop("point_constraints", "#Set point constraints:");
         }
 
         utility::LogDebug(
@@ -682,9 +726,9 @@ void Execute(const open3d::geometry::PointCloud& pcd,
                                                     IsotropicUIntPack<Dim, 1>>
                     F({0., 1.});
             solution = tree.solveSystem(Sigs(), F, constraints, solveDepth,
-                                        sInfo, iInfo);
-            profiler.dumpOutput("# Linear system solved:");
-            if (iInfo) delete iInfo, iInfo = NULL;
+                                        sInfo, iInfo.get());
+            profiler.stop("solve", "# Linear system solved:");
+            iInfo.reset();
         }
     }
 
@@ -710,7 +754,7 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         for (size_t t = 0; t < valueSums.size(); t++)
             valueSum += valueSums[t], weightSum += weightSums[t];
         isoValue = (Real)(valueSum / weightSum);
-        profiler.dumpOutput("Got average:");
+        profiler.stop("iso_value", "Got average:");
         utility::LogDebug("Iso-Value: {:e} = {:e} / {:e}", isoValue, valueSum,
                           weightSum);
     }
@@ -722,35 +766,31 @@ void Execute(const open3d::geometry::PointCloud& pcd,
         v.color_ = d.color_;
         v.w_ = w;
     };
+    profiler.start();
     ExtractMesh<Open3DVertex<Real>, Real>(
             datax, linear_fit, UIntPack<FEMSigs...>(),
             std::tuple<SampleData...>(), tree, solution, isoValue, &samples,
-            &sampleData, density, SetVertex, iXForm, out_mesh, out_densities);
+            &sampleData, density.get(), SetVertex, iXForm, sink);
+    profiler.stop("extract_mesh", "#      Extracted mesh:");
 
-    if (density) delete density, density = NULL;
+    density.reset();
+    stage_times.emplace_back("total", Time() - startTime);
     utility::LogDebug("#          Total Solve: {:9.1f} (s), {:9.1f} (MB)",
                       Time() - startTime, FEMTree<Dim, Real>::MaxMemoryUsage());
 }
 
-}  // namespace poisson
-
-std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
-TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
-                                          size_t depth,
-                                          float width,
-                                          float scale,
-                                          bool linear_fit,
-                                          int n_threads) {
-    static const BoundaryType BType = poisson::DEFAULT_FEM_BOUNDARY;
+std::vector<std::pair<std::string, double>> Reconstruct(
+        const PointBuffer& pcd, const Parameters& params, MeshSink& sink) {
+    static const BoundaryType BType = DEFAULT_FEM_BOUNDARY;
     typedef IsotropicUIntPack<
-            poisson::DIMENSION,
-            FEMDegreeAndBType</* Degree */ 1, BType>::Signature>
+            DIMENSION, FEMDegreeAndBType</* Degree */ 1, BType>::Signature>
             FEMSigs;
 
-    if (!pcd.HasNormals()) {
+    if (pcd.points == nullptr || pcd.normals == nullptr) {
         utility::LogError("Point cloud has no normals");
     }
 
+    int n_threads = params.n_threads;
     if (n_threads <= 0) {
         n_threads = (int)std::thread::hardware_concurrency();
     }
@@ -763,12 +803,96 @@ TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
                      n_threads);
 #endif
 
-    auto mesh = std::make_shared<TriangleMesh>();
-    std::vector<double> densities;
-    poisson::Execute<float>(pcd, mesh, densities, static_cast<int>(depth),
-                            width, scale, linear_fit, FEMSigs());
+    std::vector<std::pair<std::string, double>> stage_times;
+    try {
+        if (pcd.is_double) {
+            Open3DPointStream<float, double> point_stream(
+                    static_cast<const double*>(pcd.points),
+                    static_cast<const double*>(pcd.normals),
+                    static_cast<const double*>(pcd.colors), pcd.num_points);
+            Execute<float>(point_stream, sink, stage_times, params.depth,
+                           params.width, params.scale, params.linear_fit,
+                           params.max_memory_mb, FEMSigs());
+        } else {
+            Open3DPointStream<float, float> point_stream(
+                    static_cast<const float*>(pcd.points),
+                    static_cast<const float*>(pcd.normals),
+                    static_cast<const float*>(pcd.colors), pcd.num_points);
+            Execute<float>(point_stream, sink, stage_times, params.depth,
+                           params.width, params.scale, params.linear_fit,
+                           params.max_memory_mb, FEMSigs());
+        }
+    } catch (...) {
+        ThreadPool::Terminate();
+        throw;
+    }
 
     ThreadPool::Terminate();
+    return stage_times;
+}
+
+}  // namespace poisson
+
+std::tuple<std::shared_ptr<TriangleMesh>, std::vector<double>>
+TriangleMesh::CreateFromPointCloudPoisson(const PointCloud& pcd,
+                                          size_t depth,
+                                          float width,
+                                          float scale,
+                                          bool linear_fit,
+                                          int n_threads) {
+    if (!pcd.HasNormals()) {
+        utility::LogError("Point cloud has no normals");
+    }
+
+    // Writes the reconstruction into the legacy mesh and density vectors.
+    class LegacyMeshSink : public poisson::MeshSink {
+    public:
+        LegacyMeshSink(TriangleMesh& mesh, std::vector<double>& densities)
+            : mesh_(mesh), densities_(densities) {}
+        void Resize(size_t num_vertices, size_t num_triangles) override {
+            mesh_.vertices_.resize(num_vertices);
+            mesh_.vertex_normals_.resize(num_vertices);
+            mesh_.vertex_colors_.resize(num_vertices);
+            densities_.resize(num_vertices);
+            mesh_.triangles_.resize(num_triangles);
+        }
+        void SetVertex(size_t index,
+                       const double* position,
+                       const double* normal,
+                       const double* color,
+                       double density) override {
+            mesh_.vertices_[index] = Eigen::Vector3d(position);
+            mesh_.vertex_normals_[index] = Eigen::Vector3d(normal);
+            mesh_.vertex_colors_[index] = Eigen::Vector3d(color);
+            densities_[index] = density;
+        }
+        void SetTriangle(size_t index, int v0, int v1, int v2) override {
+            mesh_.triangles_[index] = Eigen::Vector3i(v0, v1, v2);
+        }
+
+    private:
+        TriangleMesh& mesh_;
+        std::vector<double>& densities_;
+    };
+
+    poisson::PointBuffer buffer;
+    buffer.points = pcd.points_.data();
+    buffer.normals = pcd.normals_.data();
+    buffer.colors = pcd.HasColors() ? pcd.colors_.data() : nullptr;
+    buffer.num_points = pcd.points_.size();
+    buffer.is_double = true;
+
+    poisson::Parameters params;
+    params.depth = static_cast<int>(depth);
+    params.width = width;
+    params.scale = scale;
+    params.linear_fit = linear_fit;
+    params.n_threads = n_threads;
+
+    auto mesh = std::make_shared<TriangleMesh>();
+    std::vector<double> densities;
+    LegacyMeshSink sink(*mesh, densities);
+    poisson::Reconstruct(buffer, params, sink);
 
     return std::make_tuple(mesh, densities);
 }
@@ -0,0 +1,85 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+namespace poisson {
+
+/// Non-owning view of N oriented points, shared by the legacy and tensor
+/// front-ends so that the solver streams the caller's buffers in place.
+/// Every array holds N x 3 contiguous values of type float, or double if
+/// \p is_double is set. Colors are optional.
+struct PointBuffer {
+    const void* points = nullptr;
+    const void* normals = nullptr;
+    const void* colors = nullptr;
+    size_t num_points = 0;
+    bool is_double = true;
+};
+
+/// Receives the reconstructed mesh. Resize is called once, before the
+/// vertices and triangles are set.
+class MeshSink {
+public:
+    virtual ~MeshSink() = default;
+    virtual void Resize(size_t num_vertices, size_t num_triangles) = 0;
+    virtual void SetVertex(size_t index,
+                           const double* position,
+                           const double* normal,
+                           const double* color,
+                           double density) = 0;
+    virtual void SetTriangle(size_t index, int v0, int v1, int v2) = 0;
+};
+
+/// Solver parameters, see TriangleMesh::CreateFromPointCloudPoisson.
+struct Parameters {
+    int depth = 8;
+    float width = 0.0f;
+    float scale = 1.1f;
+    bool linear_fit = false;
+    /// Number of solver threads, all the hardware threads if <= 0.
+    int n_threads = -1;
+    /// Abort once the process memory sampled after a solver stage exceeds
+    /// this many MB. No limit if <= 0.
+    double max_memory_mb = 0.0;
+};
+
+/// \brief Screened Poisson surface reconstruction.
+///
+/// \return The wall time in seconds of every solver stage, in execution
+/// order, followed by the "total" time.
+std::vector<std::pair<std::string, double>> Reconstruct(
+        const PointBuffer& pcd, const Parameters& params, MeshSink& sink);
+
+}  // namespace poisson
+}  // namespace geometry
+}  // namespace open3d
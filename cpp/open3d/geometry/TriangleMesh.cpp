@@ -26,7 +26,11 @@
 
 #include "open3d/geometry/TriangleMesh.h"
 
+#include <tbb/parallel_sort.h>
+
 #include <Eigen/Dense>
+#include <atomic>
+#include <cmath>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -37,6 +41,7 @@
 #include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/Qhull.h"
+#include "open3d/geometry/TriangleMeshTopology.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 
@@ -52,6 +57,7 @@ TriangleMesh &TriangleMesh::Clear() {
     materials_.clear();
     triangle_material_ids_.clear();
     textures_.clear();
+    InvalidateTopology();
 
     return *this;
 }
@@ -93,6 +99,7 @@ TriangleMesh &TriangleMesh::operator+=(const TriangleMesh &mesh) {
     for (size_t i = 0; i < add_tri_num; i++) {
         triangles_[old_tri_num + i] = mesh.triangles_[i] + index_shift;
     }
+    InvalidateTopology();
     if (HasAdjacencyList()) {
         ComputeAdjacencyList();
     }
@@ -159,246 +166,214 @@ TriangleMesh &TriangleMesh::ComputeVertexNormals(bool normalized /* = true*/) {
 }
 
 TriangleMesh &TriangleMesh::ComputeAdjacencyList() {
+    const auto topology = GetTopology();
     adjacency_list_.clear();
     adjacency_list_.resize(vertices_.size());
-    for (const auto &triangle : triangles_) {
-        adjacency_list_[triangle(0)].insert(triangle(1));
-        adjacency_list_[triangle(0)].insert(triangle(2));
-        adjacency_list_[triangle(1)].insert(triangle(0));
-        adjacency_list_[triangle(1)].insert(triangle(2));
-        adjacency_list_[triangle(2)].insert(triangle(0));
-        adjacency_list_[triangle(2)].insert(triangle(1));
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
+        adjacency_list_[vidx].insert(
+                topology->vertex_neighbors_.begin() +
+                        topology->vertex_offsets_[vidx],
+                topology->vertex_neighbors_.begin() +
+                        topology->vertex_offsets_[vidx + 1]);
     }
     return *this;
 }
 
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
-        int number_of_iterations, double strength, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
+namespace {
+
+/// \brief Iterates a linear vertex filter over the attributes of a mesh.
+///
+/// The vertex adjacency is read in compressed sparse row format, converted
+/// from adjacency_list_ if the mesh has one and taken from the cached topology
+/// of the mesh otherwise. Every pass updates all vertices in parallel from the
+/// previous values and swaps the two buffers of each filtered attribute, so no
+/// memory is allocated per iteration.
+class VertexFilter {
+public:
+    /// Copies the vertices, vertex attributes, triangles and adjacency list of
+    /// \p input to \p output, which then receives the filtered attributes.
+    VertexFilter(const TriangleMesh &input,
+                 TriangleMesh &output,
+                 MeshBase::FilterScope scope) {
+        output.vertices_ = input.vertices_;
+        output.vertex_normals_ = input.vertex_normals_;
+        output.vertex_colors_ = input.vertex_colors_;
+        output.triangles_ = input.triangles_;
+        output.adjacency_list_ = input.adjacency_list_;
+
+        using FilterScope = MeshBase::FilterScope;
+        bool filter_vertex =
+                scope == FilterScope::All || scope == FilterScope::Vertex;
+        bool filter_normal =
+                (scope == FilterScope::All || scope == FilterScope::Normal) &&
+                input.HasVertexNormals();
+        bool filter_color =
+                (scope == FilterScope::All || scope == FilterScope::Color) &&
+                input.HasVertexColors();
+        Enable(0, filter_vertex, output.vertices_);
+        Enable(1, filter_normal, output.vertex_normals_);
+        Enable(2, filter_color, output.vertex_colors_);
+        positions_ = enabled_[0] ? &prev_[0] : &output.vertices_;
+
+        const int64_t num_vertices = int64_t(input.vertices_.size());
+        if (input.HasAdjacencyList()) {
+            adjacency_offsets_.resize(num_vertices + 1, 0);
+            for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+                adjacency_offsets_[vidx + 1] =
+                        adjacency_offsets_[vidx] +
+                        input.adjacency_list_[vidx].size();
+            }
+            adjacency_neighbors_.resize(adjacency_offsets_.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+            for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+                auto begin = adjacency_neighbors_.begin() +
+                             adjacency_offsets_[vidx];
+                std::copy(input.adjacency_list_[vidx].begin(),
+                          input.adjacency_list_[vidx].end(), begin);
+                std::sort(begin, adjacency_neighbors_.begin() +
+                                         adjacency_offsets_[vidx + 1]);
+            }
+            offsets_ = adjacency_offsets_.data();
+            neighbors_ = adjacency_neighbors_.data();
+        } else {
+            topology_ = input.GetTopology();
+            offsets_ = topology_->vertex_offsets_.data();
+            neighbors_ = topology_->vertex_neighbors_.data();
+        }
+    }
+
+    /// \brief Runs one pass of the filter.
+    ///
+    /// Sets every filtered value to Combine(value, weighted sum of the
+    /// neighbor values, sum of the weights, number of neighbors). The weights
+    /// are the inverse distances of the vertices if
+    /// \p inverse_distance_weights, and one otherwise. Vertices without
+    /// neighbors keep their values.
+    template <typename CombineFunc>
+    void Apply(bool inverse_distance_weights, CombineFunc Combine) {
+        const std::vector<Eigen::Vector3d> &positions = *positions_;
+        const int64_t num_vertices = int64_t(positions.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t vidx = 0; vidx < num_vertices; ++vidx) {
+            Eigen::Vector3d sums[3] = {Eigen::Vector3d::Zero(),
+                                       Eigen::Vector3d::Zero(),
+                                       Eigen::Vector3d::Zero()};
+            double total_weight = 0;
+            for (int64_t i = offsets_[vidx]; i < offsets_[vidx + 1]; ++i) {
+                const int nbidx = neighbors_[i];
+                double weight = 1;
+                if (inverse_distance_weights) {
+                    weight = 1. / ((positions[vidx] - positions[nbidx]).norm() +
+                                   1e-12);
                 }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
+                total_weight += weight;
+                for (int a = 0; a < 3; ++a) {
+                    if (enabled_[a]) {
+                        sums[a] += weight * prev_[a][nbidx];
+                    }
                 }
             }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        prev_vertices[vidx] +
-                        strength * (prev_vertices[vidx] * nb_size - vertex_sum);
+            const int64_t nb_size = offsets_[vidx + 1] - offsets_[vidx];
+            for (int a = 0; a < 3; ++a) {
+                if (!enabled_[a]) {
+                    continue;
+                }
+                if (nb_size == 0) {
+                    (*next_[a])[vidx] = prev_[a][vidx];
+                } else {
+                    (*next_[a])[vidx] = Combine(prev_[a][vidx], sums[a],
+                                                total_weight, nb_size);
+                }
             }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        prev_vertex_normals[vidx] +
-                        strength * (prev_vertex_normals[vidx] * nb_size -
-                                    normal_sum);
+        }
+        for (int a = 0; a < 3; ++a) {
+            if (enabled_[a]) {
+                std::swap(prev_[a], *next_[a]);
             }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        prev_vertex_colors[vidx] +
-                        strength * (prev_vertex_colors[vidx] * nb_size -
-                                    color_sum);
+        }
+    }
+
+    /// Moves the latest filtered values to the output mesh.
+    void Finish() {
+        for (int a = 0; a < 3; ++a) {
+            if (enabled_[a]) {
+                std::swap(prev_[a], *next_[a]);
             }
         }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
+    }
+
+private:
+    void Enable(int a, bool enabled, std::vector<Eigen::Vector3d> &values) {
+        enabled_[a] = enabled;
+        next_[a] = &values;
+        if (enabled) {
+            prev_[a] = values;
         }
     }
 
-    return mesh;
-}
+    bool enabled_[3];
+    /// Previous values and output buffer of the vertices, normals and colors.
+    std::vector<Eigen::Vector3d> prev_[3];
+    std::vector<Eigen::Vector3d> *next_[3];
+    const std::vector<Eigen::Vector3d> *positions_;
 
-std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
-        int number_of_iterations, FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
+    std::shared_ptr<const TriangleMeshTopology> topology_;
+    std::vector<int64_t> adjacency_offsets_;
+    std::vector<int> adjacency_neighbors_;
+    const int64_t *offsets_;
+    const int *neighbors_;
+};
 
-    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+}  // namespace
 
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSharpen(
+        int number_of_iterations, double strength, FilterScope scope) const {
+    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
+    VertexFilter filter(*this, *mesh, scope);
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-            Eigen::Vector3d vertex_sum(0, 0, 0);
-            Eigen::Vector3d normal_sum(0, 0, 0);
-            Eigen::Vector3d color_sum(0, 0, 0);
-            for (int nbidx : mesh->adjacency_list_[vidx]) {
-                if (filter_vertex) {
-                    vertex_sum += prev_vertices[nbidx];
-                }
-                if (filter_normal) {
-                    normal_sum += prev_vertex_normals[nbidx];
-                }
-                if (filter_color) {
-                    color_sum += prev_vertex_colors[nbidx];
-                }
-            }
-
-            size_t nb_size = mesh->adjacency_list_[vidx].size();
-            if (filter_vertex) {
-                mesh->vertices_[vidx] =
-                        (prev_vertices[vidx] + vertex_sum) / (1 + nb_size);
-            }
-            if (filter_normal) {
-                mesh->vertex_normals_[vidx] =
-                        (prev_vertex_normals[vidx] + normal_sum) /
-                        (1 + nb_size);
-            }
-            if (filter_color) {
-                mesh->vertex_colors_[vidx] =
-                        (prev_vertex_colors[vidx] + color_sum) / (1 + nb_size);
-            }
-        }
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
+        filter.Apply(false, [&](const Eigen::Vector3d &value,
+                                const Eigen::Vector3d &sum, double,
+                                int64_t nb_size) {
+            return value + strength * (value * double(nb_size) - sum);
+        });
     }
+    filter.Finish();
     return mesh;
 }
 
-void TriangleMesh::FilterSmoothLaplacianHelper(
-        std::shared_ptr<TriangleMesh> &mesh,
-        const std::vector<Eigen::Vector3d> &prev_vertices,
-        const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-        const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-        const std::vector<std::unordered_set<int>> &adjacency_list,
-        double lambda_filter,
-        bool filter_vertex,
-        bool filter_normal,
-        bool filter_color) const {
-    for (size_t vidx = 0; vidx < mesh->vertices_.size(); ++vidx) {
-        Eigen::Vector3d vertex_sum(0, 0, 0);
-        Eigen::Vector3d normal_sum(0, 0, 0);
-        Eigen::Vector3d color_sum(0, 0, 0);
-        double total_weight = 0;
-        for (int nbidx : mesh->adjacency_list_[vidx]) {
-            auto diff = prev_vertices[vidx] - prev_vertices[nbidx];
-            double dist = diff.norm();
-            double weight = 1. / (dist + 1e-12);
-            total_weight += weight;
-
-            if (filter_vertex) {
-                vertex_sum += weight * prev_vertices[nbidx];
-            }
-            if (filter_normal) {
-                normal_sum += weight * prev_vertex_normals[nbidx];
-            }
-            if (filter_color) {
-                color_sum += weight * prev_vertex_colors[nbidx];
-            }
-        }
-
-        if (filter_vertex) {
-            mesh->vertices_[vidx] = prev_vertices[vidx] +
-                                    lambda_filter * (vertex_sum / total_weight -
-                                                     prev_vertices[vidx]);
-        }
-        if (filter_normal) {
-            mesh->vertex_normals_[vidx] =
-                    prev_vertex_normals[vidx] +
-                    lambda_filter * (normal_sum / total_weight -
-                                     prev_vertex_normals[vidx]);
-        }
-        if (filter_color) {
-            mesh->vertex_colors_[vidx] =
-                    prev_vertex_colors[vidx] +
-                    lambda_filter * (color_sum / total_weight -
-                                     prev_vertex_colors[vidx]);
-        }
+std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothSimple(
+        int number_of_iterations, FilterScope scope) const {
+    std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
+    VertexFilter filter(*this, *mesh, scope);
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        filter.Apply(false, [](const Eigen::Vector3d &value,
+                               const Eigen::Vector3d &sum, double,
+                               int64_t nb_size) {
+            return (value + sum) / double(1 + nb_size);
+        });
     }
+    filter.Finish();
+    return mesh;
 }
 
 std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothLaplacian(
         int number_of_iterations,
         double lambda_filter,
         FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
-
+    VertexFilter filter(*this, *mesh, scope);
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda_filter, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        }
+        filter.Apply(true, [&](const Eigen::Vector3d &value,
+                               const Eigen::Vector3d &sum, double total_weight,
+                               int64_t) {
+            return value + lambda_filter * (sum / total_weight - value);
+        });
     }
+    filter.Finish();
     return mesh;
 }
 
@@ -407,46 +382,18 @@ std::shared_ptr<TriangleMesh> TriangleMesh::FilterSmoothTaubin(
         double lambda_filter,
         double mu,
         FilterScope scope) const {
-    bool filter_vertex =
-            scope == FilterScope::All || scope == FilterScope::Vertex;
-    bool filter_normal =
-            (scope == FilterScope::All || scope == FilterScope::Normal) &&
-            HasVertexNormals();
-    bool filter_color =
-            (scope == FilterScope::All || scope == FilterScope::Color) &&
-            HasVertexColors();
-
-    std::vector<Eigen::Vector3d> prev_vertices = vertices_;
-    std::vector<Eigen::Vector3d> prev_vertex_normals = vertex_normals_;
-    std::vector<Eigen::Vector3d> prev_vertex_colors = vertex_colors_;
-
     std::shared_ptr<TriangleMesh> mesh = std::make_shared<TriangleMesh>();
-    mesh->vertices_.resize(vertices_.size());
-    mesh->vertex_normals_.resize(vertex_normals_.size());
-    mesh->vertex_colors_.resize(vertex_colors_.size());
-    mesh->triangles_ = triangles_;
-    mesh->adjacency_list_ = adjacency_list_;
-    if (!mesh->HasAdjacencyList()) {
-        mesh->ComputeAdjacencyList();
-    }
+    VertexFilter filter(*this, *mesh, scope);
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    lambda_filter, filter_vertex, filter_normal,
-                                    filter_color);
-        std::swap(mesh->vertices_, prev_vertices);
-        std::swap(mesh->vertex_normals_, prev_vertex_normals);
-        std::swap(mesh->vertex_colors_, prev_vertex_colors);
-        FilterSmoothLaplacianHelper(mesh, prev_vertices, prev_vertex_normals,
-                                    prev_vertex_colors, mesh->adjacency_list_,
-                                    mu, filter_vertex, filter_normal,
-                                    filter_color);
-        if (iter < number_of_iterations - 1) {
-            std::swap(mesh->vertices_, prev_vertices);
-            std::swap(mesh->vertex_normals_, prev_vertex_normals);
-            std::swap(mesh->vertex_colors_, prev_vertex_colors);
+        for (double factor : {lambda_filter, mu}) {
+            filter.Apply(true, [&](const Eigen::Vector3d &value,
+                                   const Eigen::Vector3d &sum,
+                                   double total_weight, int64_t) {
+                return value + factor * (sum / total_weight - value);
+            });
         }
     }
+    filter.Finish();
     return mesh;
 }
 
@@ -542,6 +489,114 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformly(
                                      surface_area, use_triangle_normal, seed);
 }
 
+namespace {
+
+/// \brief Weighted sample elimination of Yuksel, "Sample Elimination for
+/// Generating Poisson Disk Sample Sets", 2015, in parallel rounds.
+///
+/// The serial elimination repeatedly removes the sample with the largest
+/// weight. Every round here removes all samples that have a larger weight
+/// than their remaining neighbors and are among the largest weights that are
+/// still to be removed. The serial elimination removes each of these samples
+/// before any of its neighbors, and they do not change each other's weights,
+/// so the result is the same as the serial elimination with ties broken by
+/// the sample index, for any number of threads.
+///
+/// Returns a flag per sample that is set if the sample is removed.
+std::vector<uint8_t> EliminateSamples(const PointCloud &pcl,
+                                      size_t number_of_points,
+                                      double r_max,
+                                      double r_min,
+                                      double alpha) {
+    const int num_points = int(pcl.points_.size());
+    std::vector<uint8_t> deleted(num_points, 0);
+    if (size_t(num_points) <= number_of_points) {
+        return deleted;
+    }
+
+    // The neighbors of every sample and the weights they contribute.
+    KDTreeFlann kdtree(pcl);
+    std::vector<std::vector<int>> neighbors(num_points);
+    std::vector<std::vector<double>> neighbor_weights(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int pidx0 = 0; pidx0 < num_points; ++pidx0) {
+        std::vector<int> nbs;
+        std::vector<double> dists2;
+        kdtree.SearchRadius(pcl.points_[pidx0], r_max, nbs, dists2);
+        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
+            if (nbs[nbidx] == pidx0) {
+                continue;
+            }
+            double d = std::sqrt(dists2[nbidx]);
+            if (d < r_min) {
+                d = r_min;
+            }
+            neighbors[pidx0].push_back(nbs[nbidx]);
+            neighbor_weights[pidx0].push_back(std::pow(1 - d / r_max, alpha));
+        }
+    }
+
+    std::vector<double> weights(num_points);
+    // Orders the samples by weight, then by index.
+    auto Greater = [&](int pidx0, int pidx1) {
+        return weights[pidx0] > weights[pidx1] ||
+               (weights[pidx0] == weights[pidx1] && pidx0 < pidx1);
+    };
+    std::vector<int> remaining(num_points);
+    std::iota(remaining.begin(), remaining.end(), 0);
+    std::vector<int> ranked;
+    std::vector<uint8_t> selected(num_points, 0);
+    size_t number_to_delete = num_points - number_of_points;
+    while (number_to_delete > 0) {
+        const int num_remaining = int(remaining.size());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int ridx = 0; ridx < num_remaining; ++ridx) {
+            const int pidx0 = remaining[ridx];
+            double weight = 0;
+            for (size_t nbidx = 0; nbidx < neighbors[pidx0].size(); ++nbidx) {
+                if (!deleted[neighbors[pidx0][nbidx]]) {
+                    weight += neighbor_weights[pidx0][nbidx];
+                }
+            }
+            weights[pidx0] = weight;
+        }
+
+        // Only the number_to_delete largest weights can be removed.
+        ranked = remaining;
+        std::nth_element(ranked.begin(), ranked.begin() + number_to_delete - 1,
+                         ranked.end(), Greater);
+        const int threshold = ranked[number_to_delete - 1];
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int ridx = 0; ridx < num_remaining; ++ridx) {
+            const int pidx0 = remaining[ridx];
+            bool is_max = !Greater(threshold, pidx0);
+            for (size_t nbidx = 0; is_max && nbidx < neighbors[pidx0].size();
+                 ++nbidx) {
+                const int pidx1 = neighbors[pidx0][nbidx];
+                is_max = deleted[pidx1] || !Greater(pidx1, pidx0);
+            }
+            selected[pidx0] = is_max;
+        }
+
+        size_t next_free = 0;
+        for (int pidx0 : remaining) {
+            if (selected[pidx0]) {
+                deleted[pidx0] = 1;
+                number_to_delete--;
+            } else {
+                remaining[next_free++] = pidx0;
+            }
+        }
+        remaining.resize(next_free);
+    }
+    return deleted;
+}
+
+}  // namespace
+
 std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         size_t number_of_points,
         double init_factor /* = 5 */,
@@ -591,74 +646,8 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
                                  (2 * std::sqrt(3.)));
     double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
 
-    std::vector<double> weights(pcl->points_.size());
-    std::vector<bool> deleted(pcl->points_.size(), false);
-    KDTreeFlann kdtree(*pcl);
-
-    auto WeightFcn = [&](double d2) {
-        double d = std::sqrt(d2);
-        if (d < r_min) {
-            d = r_min;
-        }
-        return std::pow(1 - d / r_max, alpha);
-    };
-
-    auto ComputePointWeight = [&](int pidx0) {
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
-        double weight = 0;
-        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
-            int pidx1 = nbs[nbidx];
-            // only count weights if not the same point if not deleted
-            if (pidx0 == pidx1 || deleted[pidx1]) {
-                continue;
-            }
-            weight += WeightFcn(dists2[nbidx]);
-        }
-
-        weights[pidx0] = weight;
-    };
-
-    // init weights and priority queue
-    typedef std::tuple<int, double> QueueEntry;
-    auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
-        return std::get<1>(a) < std::get<1>(b);
-    };
-    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
-                        decltype(WeightCmp)>
-            queue(WeightCmp);
-    for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
-        ComputePointWeight(int(pidx0));
-        queue.push(QueueEntry(int(pidx0), weights[pidx0]));
-    };
-
-    // sample elimination
-    size_t current_number_of_points = pcl->points_.size();
-    while (current_number_of_points > number_of_points) {
-        int pidx;
-        double weight;
-        std::tie(pidx, weight) = queue.top();
-        queue.pop();
-
-        // test if the entry is up to date (because of reinsert)
-        if (deleted[pidx] || weight != weights[pidx]) {
-            continue;
-        }
-
-        // delete current sample
-        deleted[pidx] = true;
-        current_number_of_points--;
-
-        // update weights
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
-        for (int nb : nbs) {
-            ComputePointWeight(nb);
-            queue.push(QueueEntry(nb, weights[nb]));
-        }
-    }
+    const std::vector<uint8_t> deleted =
+            EliminateSamples(*pcl, number_of_points, r_max, r_min, alpha);
 
     // update pcl
     bool has_vert_normal = pcl->HasNormals();
@@ -688,44 +677,105 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
 }
 
 TriangleMesh &TriangleMesh::RemoveDuplicatedVertices() {
-    typedef std::tuple<double, double, double> Coordinate3;
-    std::unordered_map<Coordinate3, size_t, utility::hash_tuple<Coordinate3>>
-            point_to_old_index;
-    std::vector<int> index_old_to_new(vertices_.size());
-    bool has_vert_normal = HasVertexNormals();
-    bool has_vert_color = HasVertexColors();
-    size_t old_vertex_num = vertices_.size();
-    size_t k = 0;                                  // new index
-    for (size_t i = 0; i < old_vertex_num; i++) {  // old index
-        Coordinate3 coord = std::make_tuple(vertices_[i](0), vertices_[i](1),
-                                            vertices_[i](2));
-        if (point_to_old_index.find(coord) == point_to_old_index.end()) {
-            point_to_old_index[coord] = i;
-            vertices_[k] = vertices_[i];
-            if (has_vert_normal) vertex_normals_[k] = vertex_normals_[i];
-            if (has_vert_color) vertex_colors_[k] = vertex_colors_[i];
-            index_old_to_new[i] = (int)k;
-            k++;
-        } else {
-            index_old_to_new[i] = index_old_to_new[point_to_old_index[coord]];
+    // Vertices are sorted by their coordinates and then by their index, so
+    // every run of equal coordinates starts with the vertex that is kept.
+    // Vertices with NaN coordinates never compare equal and are all kept.
+    struct SortedVertex {
+        Eigen::Vector3d coord_;
+        int index_;
+        bool is_nan_;
+
+        bool operator<(const SortedVertex &other) const {
+            if (is_nan_ != other.is_nan_) {
+                return other.is_nan_;
+            }
+            if (!is_nan_) {
+                for (int d = 0; d < 3; ++d) {
+                    if (coord_(d) < other.coord_(d)) return true;
+                    if (other.coord_(d) < coord_(d)) return false;
+                }
+            }
+            return index_ < other.index_;
+        }
+        bool HasSameCoordinates(const SortedVertex &other) const {
+            return !is_nan_ && !other.is_nan_ && coord_ == other.coord_;
+        }
+    };
+    const int old_vertex_num = int(vertices_.size());
+    std::vector<SortedVertex> sorted_vertices(old_vertex_num);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < old_vertex_num; ++i) {
+        sorted_vertices[i] = {vertices_[i], i, vertices_[i].hasNaN()};
+    }
+    tbb::parallel_sort(sorted_vertices.begin(), sorted_vertices.end());
+
+    // representative[i] is the first vertex with the coordinates of vertex i.
+    std::vector<int> representative(old_vertex_num);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int s = 0; s < old_vertex_num; ++s) {
+        if (s > 0 && sorted_vertices[s - 1].HasSameCoordinates(
+                             sorted_vertices[s])) {
+            continue;
+        }
+        const int first = sorted_vertices[s].index_;
+        for (int r = s; r < old_vertex_num &&
+                        (r == s || sorted_vertices[r].HasSameCoordinates(
+                                           sorted_vertices[s]));
+             ++r) {
+            representative[sorted_vertices[r].index_] = first;
+        }
+    }
+
+    std::vector<int> index_old_to_new(old_vertex_num);
+    int k = 0;
+    for (int i = 0; i < old_vertex_num; ++i) {
+        if (representative[i] == i) {
+            index_old_to_new[i] = k++;
         }
     }
-    vertices_.resize(k);
-    if (has_vert_normal) vertex_normals_.resize(k);
-    if (has_vert_color) vertex_colors_.resize(k);
     if (k < old_vertex_num) {
-        for (auto &triangle : triangles_) {
-            triangle(0) = index_old_to_new[triangle(0)];
-            triangle(1) = index_old_to_new[triangle(1)];
-            triangle(2) = index_old_to_new[triangle(2)];
+        bool has_vert_normal = HasVertexNormals();
+        bool has_vert_color = HasVertexColors();
+        std::vector<Eigen::Vector3d> vertices(k);
+        std::vector<Eigen::Vector3d> vertex_normals(has_vert_normal ? k : 0);
+        std::vector<Eigen::Vector3d> vertex_colors(has_vert_color ? k : 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int i = 0; i < old_vertex_num; ++i) {
+            if (representative[i] == i) {
+                vertices[index_old_to_new[i]] = vertices_[i];
+                if (has_vert_normal) {
+                    vertex_normals[index_old_to_new[i]] = vertex_normals_[i];
+                }
+                if (has_vert_color) {
+                    vertex_colors[index_old_to_new[i]] = vertex_colors_[i];
+                }
+            } else {
+                index_old_to_new[i] = -1;
+            }
+        }
+        vertices_ = std::move(vertices);
+        if (has_vert_normal) vertex_normals_ = std::move(vertex_normals);
+        if (has_vert_color) vertex_colors_ = std::move(vertex_colors);
+
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
+            Eigen::Vector3i &triangle = triangles_[tidx];
+            for (int j = 0; j < 3; ++j) {
+                triangle(j) = index_old_to_new[representative[triangle(j)]];
+            }
         }
+        InvalidateTopology();
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
     }
     utility::LogDebug(
             "[RemoveDuplicatedVertices] {:d} vertices have been removed.",
-            (int)(old_vertex_num - k));
+            old_vertex_num - k);
 
     return *this;
 }
@@ -772,6 +822,7 @@ TriangleMesh &TriangleMesh::RemoveDuplicatedTriangles() {
     }
     triangles_.resize(k);
     if (has_tri_normal) triangle_normals_.resize(k);
+    InvalidateTopology();
     if (k < old_triangle_num && HasAdjacencyList()) {
         ComputeAdjacencyList();
     }
@@ -814,6 +865,7 @@ TriangleMesh &TriangleMesh::RemoveUnreferencedVertices() {
             triangle(1) = index_old_to_new[triangle(1)];
             triangle(2) = index_old_to_new[triangle(2)];
         }
+        InvalidateTopology();
         if (HasAdjacencyList()) {
             ComputeAdjacencyList();
         }
@@ -845,6 +897,7 @@ TriangleMesh &TriangleMesh::RemoveDegenerateTriangles() {
     }
     triangles_.resize(k);
     if (has_tri_normal) triangle_normals_.resize(k);
+    InvalidateTopology();
     if (k < old_triangle_num && HasAdjacencyList()) {
         ComputeAdjacencyList();
     }
@@ -927,6 +980,7 @@ TriangleMesh &TriangleMesh::RemoveNonManifoldEdges() {
             }
         }
         triangles_.resize(to_tidx);
+        InvalidateTopology();
         triangle_areas.resize(to_tidx);
         if (has_tri_normal) {
             triangle_normals_.resize(to_tidx);
@@ -1006,6 +1060,7 @@ TriangleMesh &TriangleMesh::MergeCloseVertices(double eps) {
         triangle(1) = new_vert_mapping[triangle(1)];
         triangle(2) = new_vert_mapping[triangle(2)];
     }
+    InvalidateTopology();
 
     if (HasTriangleNormals()) {
         ComputeTriangleNormals();
@@ -1132,24 +1187,27 @@ bool TriangleMesh::OrientTriangles() {
     auto SwapTriangleOrder = [&](int tidx, int idx0, int idx1) {
         std::swap(triangles_[tidx](idx0), triangles_[tidx](idx1));
     };
-    return OrientTriangleHelper(triangles_, SwapTriangleOrder);
+    const bool success = OrientTriangleHelper(triangles_, SwapTriangleOrder);
+    InvalidateTopology();
+    return success;
 }
 
 std::unordered_map<Eigen::Vector2i,
                    std::vector<int>,
                    utility::hash_eigen<Eigen::Vector2i>>
 TriangleMesh::GetEdgeToTrianglesMap() const {
+    const auto topology = GetTopology();
     std::unordered_map<Eigen::Vector2i, std::vector<int>,
                        utility::hash_eigen<Eigen::Vector2i>>
             trias_per_edge;
-    auto AddEdge = [&](int vidx0, int vidx1, int tidx) {
-        trias_per_edge[GetOrderedEdge(vidx0, vidx1)].push_back(tidx);
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        AddEdge(triangle(0), triangle(1), int(tidx));
-        AddEdge(triangle(1), triangle(2), int(tidx));
-        AddEdge(triangle(2), triangle(0), int(tidx));
+    trias_per_edge.reserve(topology->NumEdges());
+    for (size_t e = 0; e < topology->NumEdges(); ++e) {
+        trias_per_edge.emplace(
+                topology->edges_[e],
+                std::vector<int>(topology->edge_triangles_.begin() +
+                                         topology->edge_offsets_[e],
+                                 topology->edge_triangles_.begin() +
+                                         topology->edge_offsets_[e + 1]));
     }
     return trias_per_edge;
 }
@@ -1158,21 +1216,38 @@ std::unordered_map<Eigen::Vector2i,
                    std::vector<int>,
                    utility::hash_eigen<Eigen::Vector2i>>
 TriangleMesh::GetEdgeToVerticesMap() const {
+    const auto topology = GetTopology();
     std::unordered_map<Eigen::Vector2i, std::vector<int>,
                        utility::hash_eigen<Eigen::Vector2i>>
             trias_per_edge;
-    auto AddEdge = [&](int vidx0, int vidx1, int vidx2) {
-        trias_per_edge[GetOrderedEdge(vidx0, vidx1)].push_back(vidx2);
-    };
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        AddEdge(triangle(0), triangle(1), triangle(2));
-        AddEdge(triangle(1), triangle(2), triangle(0));
-        AddEdge(triangle(2), triangle(0), triangle(1));
+    trias_per_edge.reserve(topology->NumEdges());
+    for (size_t e = 0; e < topology->NumEdges(); ++e) {
+        trias_per_edge.emplace(
+                topology->edges_[e],
+                std::vector<int>(topology->edge_opposite_vertices_.begin() +
+                                         topology->edge_offsets_[e],
+                                 topology->edge_opposite_vertices_.begin() +
+                                         topology->edge_offsets_[e + 1]));
     }
     return trias_per_edge;
 }
 
+void TriangleMesh::InvalidateTopology() {
+    std::atomic_store(&topology_,
+                      std::shared_ptr<const TriangleMeshTopology>());
+}
+
+std::shared_ptr<const TriangleMeshTopology> TriangleMesh::GetTopology() const {
+    std::shared_ptr<const TriangleMeshTopology> topology =
+            std::atomic_load(&topology_);
+    if (!topology || !topology->IsBuiltFrom(triangles_, vertices_.size())) {
+        topology = std::make_shared<const TriangleMeshTopology>(
+                triangles_, vertices_.size());
+        std::atomic_store(&topology_, topology);
+    }
+    return topology;
+}
+
 double TriangleMesh::ComputeTriangleArea(const Eigen::Vector3d &p0,
                                          const Eigen::Vector3d &p1,
                                          const Eigen::Vector3d &p2) {
@@ -1268,29 +1343,26 @@ Eigen::Vector4d TriangleMesh::GetTrianglePlane(size_t triangle_idx) const {
 }
 
 int TriangleMesh::EulerPoincareCharacteristic() const {
-    std::unordered_set<Eigen::Vector2i, utility::hash_eigen<Eigen::Vector2i>>
-            edges;
-    for (auto triangle : triangles_) {
-        edges.emplace(GetOrderedEdge(triangle(0), triangle(1)));
-        edges.emplace(GetOrderedEdge(triangle(0), triangle(2)));
-        edges.emplace(GetOrderedEdge(triangle(1), triangle(2)));
-    }
-
-    int E = int(edges.size());
+    int E = int(GetTopology()->NumEdges());
     int V = int(vertices_.size());
     int F = int(triangles_.size());
     return V + F - E;
 }
 
+static bool IsNonManifoldEdgeDegree(int64_t degree,
+                                    bool allow_boundary_edges) {
+    return (allow_boundary_edges && (degree < 1 || degree > 2)) ||
+           (!allow_boundary_edges && degree != 2);
+}
+
 std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
+    const auto topology = GetTopology();
     std::vector<Eigen::Vector2i> non_manifold_edges;
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            non_manifold_edges.push_back(kv.first);
+    for (size_t e = 0; e < topology->NumEdges(); ++e) {
+        if (IsNonManifoldEdgeDegree(topology->EdgeDegree(e),
+                                    allow_boundary_edges)) {
+            non_manifold_edges.push_back(topology->edges_[e]);
         }
     }
     return non_manifold_edges;
@@ -1298,70 +1370,84 @@ std::vector<Eigen::Vector2i> TriangleMesh::GetNonManifoldEdges(
 
 bool TriangleMesh::IsEdgeManifold(
         bool allow_boundary_edges /* = true */) const {
-    auto edges = GetEdgeToTrianglesMap();
-    for (auto &kv : edges) {
-        if ((allow_boundary_edges &&
-             (kv.second.size() < 1 || kv.second.size() > 2)) ||
-            (!allow_boundary_edges && kv.second.size() != 2)) {
-            return false;
-        }
+    const auto topology = GetTopology();
+    const int64_t num_edges = int64_t(topology->NumEdges());
+    bool is_manifold = true;
+#pragma omp parallel for reduction(&& : is_manifold) schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t e = 0; e < num_edges; ++e) {
+        is_manifold = is_manifold &&
+                      !IsNonManifoldEdgeDegree(topology->EdgeDegree(e),
+                                               allow_boundary_edges);
     }
-    return true;
+    return is_manifold;
 }
 
 std::vector<int> TriangleMesh::GetNonManifoldVertices() const {
-    std::vector<std::unordered_set<int>> vert_to_triangles(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto &tria = triangles_[tidx];
-        vert_to_triangles[tria(0)].emplace(int(tidx));
-        vert_to_triangles[tria(1)].emplace(int(tidx));
-        vert_to_triangles[tria(2)].emplace(int(tidx));
-    }
-
-    std::vector<int> non_manifold_verts;
+    const auto topology = GetTopology();
+    std::vector<char> is_non_manifold(vertices_.size(), 0);
+#pragma omp parallel for schedule(dynamic, 1024) \
+        num_threads(utility::EstimateMaxThreads())
     for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
-        const auto &triangles = vert_to_triangles[vidx];
-        if (triangles.size() == 0) {
-            continue;
-        }
-
-        // collect edges and vertices
-        std::unordered_map<int, std::unordered_set<int>> edges;
-        for (int tidx : triangles) {
-            const auto &triangle = triangles_[tidx];
+        // Collect the edges opposite to the vertex in its triangles, i.e.,
+        // the link of the vertex.
+        std::vector<Eigen::Vector2i> edges;
+        for (int64_t i = topology->vertex_triangle_offsets_[vidx];
+             i < topology->vertex_triangle_offsets_[vidx + 1]; ++i) {
+            const auto &triangle = triangles_[topology->vertex_triangles_[i]];
             if (triangle(0) != vidx && triangle(1) != vidx) {
-                edges[triangle(0)].emplace(triangle(1));
-                edges[triangle(1)].emplace(triangle(0));
+                edges.emplace_back(triangle(0), triangle(1));
             } else if (triangle(0) != vidx && triangle(2) != vidx) {
-                edges[triangle(0)].emplace(triangle(2));
-                edges[triangle(2)].emplace(triangle(0));
+                edges.emplace_back(triangle(0), triangle(2));
             } else if (triangle(1) != vidx && triangle(2) != vidx) {
-                edges[triangle(1)].emplace(triangle(2));
-                edges[triangle(2)].emplace(triangle(1));
+                edges.emplace_back(triangle(1), triangle(2));
             }
         }
+        if (edges.empty()) {
+            continue;
+        }
 
-        // test if vertices are connected
-        std::queue<int> next;
-        std::unordered_set<int> visited;
-        next.push(edges.begin()->first);
-        visited.emplace(edges.begin()->first);
-        while (!next.empty()) {
-            int vert = next.front();
-            next.pop();
-
-            for (auto nb : edges[vert]) {
-                if (visited.count(nb) == 0) {
-                    visited.emplace(nb);
-                    next.emplace(nb);
-                }
+        // Test if the link is connected with a union-find on its vertices.
+        std::vector<int> verts;
+        for (const auto &edge : edges) {
+            verts.push_back(edge(0));
+            verts.push_back(edge(1));
+        }
+        std::sort(verts.begin(), verts.end());
+        verts.erase(std::unique(verts.begin(), verts.end()), verts.end());
+        std::vector<int> parents(verts.size());
+        std::iota(parents.begin(), parents.end(), 0);
+        auto Find = [&](int x) {
+            while (parents[x] != x) {
+                parents[x] = parents[parents[x]];
+                x = parents[x];
+            }
+            return x;
+        };
+        auto LocalIndex = [&](int v) {
+            return int(std::lower_bound(verts.begin(), verts.end(), v) -
+                       verts.begin());
+        };
+        size_t num_components = verts.size();
+        for (const auto &edge : edges) {
+            const int root0 = Find(LocalIndex(edge(0)));
+            const int root1 = Find(LocalIndex(edge(1)));
+            if (root0 != root1) {
+                parents[root0] = root1;
+                --num_components;
             }
         }
-        if (visited.size() != edges.size()) {
-            non_manifold_verts.push_back(vidx);
+        if (num_components != 1) {
+            is_non_manifold[vidx] = 1;
         }
     }
 
+    std::vector<int> non_manifold_verts;
+    for (int vidx = 0; vidx < int(vertices_.size()); ++vidx) {
+        if (is_non_manifold[vidx]) {
+            non_manifold_verts.push_back(vidx);
+        }
+    }
     return non_manifold_verts;
 }
 
@@ -1447,63 +1533,84 @@ bool TriangleMesh::IsIntersecting(const TriangleMesh &other) const {
 
 std::tuple<std::vector<int>, std::vector<size_t>, std::vector<double>>
 TriangleMesh::ClusterConnectedTriangles() const {
-    std::vector<int> triangle_clusters(triangles_.size(), -1);
+    const int num_tria = int(triangles_.size());
+    std::vector<int> triangle_clusters(num_tria, -1);
     std::vector<size_t> num_triangles;
     std::vector<double> areas;
 
     utility::LogDebug("[ClusterConnectedTriangles] Compute triangle adjacency");
-    auto edges_to_triangles = GetEdgeToTrianglesMap();
-    std::vector<std::unordered_set<int>> adjacency_list(triangles_.size());
-#pragma omp parallel for schedule(static) \
-        num_threads(utility::EstimateMaxThreads())
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        const auto &triangle = triangles_[tidx];
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(1))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(0), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-        for (auto tnb :
-             edges_to_triangles[GetOrderedEdge(triangle(1), triangle(2))]) {
-            adjacency_list[tidx].insert(tnb);
-        }
-    }
+    const auto topology = GetTopology();
     utility::LogDebug(
             "[ClusterConnectedTriangles] Done computing triangle adjacency");
 
-    int cluster_idx = 0;
-    for (int tidx = 0; tidx < int(triangles_.size()); ++tidx) {
-        if (triangle_clusters[tidx] != -1) {
-            continue;
+    // Lock-free union-find over the triangles sharing an edge. The larger
+    // root is always linked below the smaller one, so every root is the
+    // smallest triangle index of its cluster.
+    std::vector<std::atomic<int>> parents(num_tria);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_tria; ++tidx) {
+        parents[tidx].store(tidx, std::memory_order_relaxed);
+    }
+    // Path halving only redirects triangles to smaller ancestors, so it is
+    // safe to run concurrently with the linking below.
+    auto Find = [&](int x) {
+        while (true) {
+            int parent = parents[x].load(std::memory_order_relaxed);
+            if (parent == x) {
+                return x;
+            }
+            const int grandparent =
+                    parents[parent].load(std::memory_order_relaxed);
+            if (grandparent != parent) {
+                parents[x].compare_exchange_weak(parent, grandparent,
+                                                 std::memory_order_relaxed);
+            }
+            x = grandparent;
         }
-
-        std::queue<int> triangle_queue;
-        int cluster_n_triangles = 0;
-        double cluster_area = 0;
-
-        triangle_queue.push(tidx);
-        triangle_clusters[tidx] = cluster_idx;
-        while (!triangle_queue.empty()) {
-            int cluster_tidx = triangle_queue.front();
-            triangle_queue.pop();
-
-            cluster_n_triangles++;
-            cluster_area += GetTriangleArea(cluster_tidx);
-
-            for (auto tnb : adjacency_list[cluster_tidx]) {
-                if (triangle_clusters[tnb] == -1) {
-                    triangle_queue.push(tnb);
-                    triangle_clusters[tnb] = cluster_idx;
+    };
+    const int64_t num_edges = int64_t(topology->NumEdges());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t e = 0; e < num_edges; ++e) {
+        const int t0 = topology->edge_triangles_[topology->edge_offsets_[e]];
+        for (int64_t i = topology->edge_offsets_[e] + 1;
+             i < topology->edge_offsets_[e + 1]; ++i) {
+            int root0 = Find(t0);
+            int root1 = Find(topology->edge_triangles_[i]);
+            while (root0 != root1) {
+                if (root0 < root1) {
+                    std::swap(root0, root1);
+                }
+                int expected = root0;
+                if (parents[root0].compare_exchange_weak(expected, root1)) {
+                    break;
                 }
+                root0 = Find(root0);
+                root1 = Find(root1);
             }
         }
+    }
 
-        num_triangles.push_back(cluster_n_triangles);
-        areas.push_back(cluster_area);
-        cluster_idx++;
+    // Clusters are numbered in the order of their smallest triangle index.
+    int cluster_idx = 0;
+    for (int tidx = 0; tidx < num_tria; ++tidx) {
+        if (Find(tidx) == tidx) {
+            triangle_clusters[tidx] = cluster_idx++;
+        }
+    }
+    std::vector<double> triangle_areas(num_tria);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int tidx = 0; tidx < num_tria; ++tidx) {
+        triangle_clusters[tidx] = triangle_clusters[Find(tidx)];
+        triangle_areas[tidx] = GetTriangleArea(tidx);
+    }
+    num_triangles.resize(cluster_idx, 0);
+    areas.resize(cluster_idx, 0);
+    for (int tidx = 0; tidx < num_tria; ++tidx) {
+        num_triangles[triangle_clusters[tidx]]++;
+        areas[triangle_clusters[tidx]] += triangle_areas[tidx];
     }
 
     utility::LogDebug(
@@ -1555,6 +1662,7 @@ void TriangleMesh::RemoveTrianglesByMask(
         }
     }
     triangles_.resize(to_tidx);
+    InvalidateTopology();
     if (has_tri_normal) {
         triangle_normals_.resize(to_tidx);
     }
@@ -1621,6 +1729,7 @@ void TriangleMesh::RemoveVerticesByMask(const std::vector<bool> &vertex_mask) {
             tria(2) = vertex_map[tria(2)];
         }
     }
+    InvalidateTopology();
     RemoveTrianglesByMask(triangle_mask);
 }
 
@@ -43,6 +43,7 @@ namespace geometry {
 
 class PointCloud;
 class TetraMesh;
+class TriangleMeshTopology;
 
 /// \class TriangleMesh
 ///
@@ -298,6 +299,19 @@ public:
                        utility::hash_eigen<Eigen::Vector2i>>
     GetEdgeToVerticesMap() const;
 
+    /// \brief Returns the edges and adjacencies of the triangles.
+    ///
+    /// The topology is built in parallel on first use and cached on the mesh.
+    /// The edge maps, the adjacency list, the manifold checks and the
+    /// triangle clustering share it. Every call compares triangles_ and the
+    /// number of vertices with the ones the topology was built from, and
+    /// rebuilds it if they differ, so triangles_ may be modified directly.
+    std::shared_ptr<const TriangleMeshTopology> GetTopology() const;
+
+    /// \brief Drops the topology cached by GetTopology(), e.g. to release its
+    /// memory. The member functions that modify the triangles call it.
+    void InvalidateTopology();
+
     /// Function that computes the area of a mesh triangle
     static double ComputeTriangleArea(const Eigen::Vector3d &p0,
                                       const Eigen::Vector3d &p1,
@@ -376,7 +390,9 @@ public:
 
     /// Function to sample points from the mesh with Possion disk, based on the
     /// method presented in Yuksel, "Sample Elimination for Generating Poisson
-    /// Disk Sample Sets", EUROGRAPHICS.
+    /// Disk Sample Sets", EUROGRAPHICS. The samples are eliminated in parallel
+    /// rounds, which give the same result as the serial elimination for any
+    /// number of threads.
     ///
     /// \param number_of_points Number of points that should be sampled.
     /// \param init_factor Factor for the initial uniformly sampled PointCloud.
@@ -503,6 +519,8 @@ public:
 
     /// \brief This function deforms the mesh using the method by
     /// Sorkine and Alexa, "As-Rigid-As-Possible Surface Modeling", 2007.
+    /// To deform the same mesh repeatedly with the same constraint vertices,
+    /// use DeformAsRigidAsPossibleSolver, which keeps the factorization.
     ///
     /// \param constraint_vertex_indices Indices of the triangle vertices that
     /// should be constrained by the vertex positions in
@@ -547,7 +565,9 @@ public:
     /// Parallel Ball Pivoting Algorithm", 2014. The surface reconstruction is
     /// done by rolling a ball with a given radius (cf. \p radii) over the
     /// point cloud, whenever the ball touches three points a triangle is
-    /// created.
+    /// created. Large point clouds are split into spatial partitions whose
+    /// fronts are expanded in parallel and then stitched at the partition
+    /// boundaries.
     /// \param pcd defines the PointCloud from which the TriangleMesh surface is
     /// reconstructed. Has to contain normals.
     /// \param radii defines the radii of
@@ -755,17 +775,6 @@ protected:
     // Forward child class type to avoid indirect nonvirtual base
     TriangleMesh(Geometry::GeometryType type) : MeshBase(type) {}
 
-    void FilterSmoothLaplacianHelper(
-            std::shared_ptr<TriangleMesh> &mesh,
-            const std::vector<Eigen::Vector3d> &prev_vertices,
-            const std::vector<Eigen::Vector3d> &prev_vertex_normals,
-            const std::vector<Eigen::Vector3d> &prev_vertex_colors,
-            const std::vector<std::unordered_set<int>> &adjacency_list,
-            double lambda_filter,
-            bool filter_vertex,
-            bool filter_normal,
-            bool filter_color) const;
-
     /// \brief Function that computes for each edge in the triangle mesh and
     /// passed as parameter edges_to_vertices the cot weight.
     ///
@@ -877,6 +886,11 @@ public:
     std::vector<int> triangle_material_ids_;
     /// Textures of the image.
     std::vector<Image> textures_;
+
+private:
+    /// Topology cached by GetTopology(). Accessed with std::atomic_load and
+    /// std::atomic_store, so const functions may be called concurrently.
+    mutable std::shared_ptr<const TriangleMeshTopology> topology_;
 };
 
 }  // namespace geometry
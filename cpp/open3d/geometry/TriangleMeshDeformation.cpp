@@ -24,184 +24,329 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/TriangleMeshDeformation.h"
+
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 #include <algorithm>
 
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/geometry/TriangleMeshTopology.h"
 #include "open3d/utility/Logging.h"
 #include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
 
-std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+DeformAsRigidAsPossibleSolver::DeformAsRigidAsPossibleSolver(
+        const TriangleMesh &mesh,
         const std::vector<int> &constraint_vertex_indices,
-        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
-        size_t max_iter,
-        DeformAsRigidAsPossibleEnergy energy_model,
-        double smoothed_alpha) const {
-    auto prime = std::make_shared<TriangleMesh>();
-    prime->vertices_ = this->vertices_;
-    prime->triangles_ = this->triangles_;
+        MeshBase::DeformAsRigidAsPossibleEnergy energy,
+        double smoothed_alpha)
+    : rest_vertices_(mesh.vertices_),
+      triangles_(mesh.triangles_),
+      constraint_vertex_indices_(constraint_vertex_indices),
+      energy_(energy),
+      smoothed_alpha_(smoothed_alpha) {
+    const int num_vertices = int(rest_vertices_.size());
+    for (int idx : constraint_vertex_indices_) {
+        if (idx < 0 || idx >= num_vertices) {
+            utility::LogError(
+                    "Constraint vertex index {} is out of range for a mesh "
+                    "with {} vertices.",
+                    idx, num_vertices);
+        }
+    }
+    if (energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+        surface_area_ = mesh.GetSurfaceArea();
+    }
 
     utility::LogDebug("[DeformAsRigidAsPossible] setting up S'");
-    prime->ComputeAdjacencyList();
-    auto edges_to_vertices = prime->GetEdgeToVerticesMap();
-    auto edge_weights =
-            prime->ComputeEdgeWeightsCot(edges_to_vertices, /*min_weight=*/0);
-    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
-
-    std::unordered_map<int, Eigen::Vector3d> constraints;
-    for (size_t idx = 0; idx < constraint_vertex_indices.size() &&
-                         idx < constraint_vertex_positions.size();
-         ++idx) {
-        constraints[constraint_vertex_indices[idx]] =
-                constraint_vertex_positions[idx];
+    const auto topology = mesh.GetTopology();
+    const int64_t num_edges = int64_t(topology->NumEdges());
+    std::vector<double> edge_weights(num_edges);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t e = 0; e < num_edges; ++e) {
+        // Mean cotangent of the angles opposite to the edge, clamped at zero.
+        const Eigen::Vector2i &edge = topology->edges_[e];
+        double weight_sum = 0;
+        for (int64_t k = topology->edge_offsets_[e];
+             k < topology->edge_offsets_[e + 1]; ++k) {
+            const Eigen::Vector3d &v2 =
+                    rest_vertices_[topology->edge_opposite_vertices_[k]];
+            const Eigen::Vector3d a = rest_vertices_[edge(0)] - v2;
+            const Eigen::Vector3d b = rest_vertices_[edge(1)] - v2;
+            weight_sum += a.dot(b) / a.cross(b).norm();
+        }
+        const double weight = weight_sum / double(topology->EdgeDegree(e));
+        edge_weights[e] = weight < 0 ? 0 : weight;
     }
 
-    double surface_area = -1;
-    // std::vector<Eigen::Matrix3d> Rs(vertices_.size(),
-    // Eigen::Matrix3d::Identity());
-    std::vector<Eigen::Matrix3d> Rs(vertices_.size());
-    std::vector<Eigen::Matrix3d> Rs_old;
-    if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-        surface_area = prime->GetSurfaceArea();
-        Rs_old.resize(vertices_.size());
+    // Self loops of degenerate triangles do not contribute to the energy.
+    offsets_.assign(num_vertices + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_vertices; ++i) {
+        int64_t count = 0;
+        for (int64_t k = topology->vertex_offsets_[i];
+             k < topology->vertex_offsets_[i + 1]; ++k) {
+            count += topology->vertex_neighbors_[k] != i;
+        }
+        offsets_[i + 1] = count;
     }
+    for (int i = 0; i < num_vertices; ++i) {
+        offsets_[i + 1] += offsets_[i];
+    }
+    neighbors_.resize(offsets_.back());
+    weights_.resize(offsets_.back());
+    rest_edges_x_.resize(offsets_.back());
+    rest_edges_y_.resize(offsets_.back());
+    rest_edges_z_.resize(offsets_.back());
+    std::vector<double> total_weights(num_vertices);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_vertices; ++i) {
+        int64_t k = offsets_[i];
+        double total_weight = 0;
+        for (int64_t n = topology->vertex_offsets_[i];
+             n < topology->vertex_offsets_[i + 1]; ++n) {
+            const int j = topology->vertex_neighbors_[n];
+            if (j == i) {
+                continue;
+            }
+            const Eigen::Vector3d edge = rest_vertices_[i] - rest_vertices_[j];
+            neighbors_[k] = j;
+            weights_[k] = edge_weights[topology->FindEdge(i, j)];
+            rest_edges_x_[k] = edge(0);
+            rest_edges_y_[k] = edge(1);
+            rest_edges_z_[k] = edge(2);
+            total_weight += weights_[k];
+            ++k;
+        }
+        total_weights[i] = total_weight;
+    }
+    utility::LogDebug("[DeformAsRigidAsPossible] done setting up S'");
 
-    // Build system matrix L and its solver
+    // The constrained vertices and the vertices without weighted edges are
+    // fixed, and the system only contains the rows of the free vertices.
     utility::LogDebug("[DeformAsRigidAsPossible] setting up system matrix L");
-    std::vector<Eigen::Triplet<double>> triplets;
-    for (int i = 0; i < int(vertices_.size()); ++i) {
-        if (constraints.count(i) > 0) {
-            triplets.push_back(Eigen::Triplet<double>(i, i, 1));
+    free_index_.assign(num_vertices, 0);
+    for (int idx : constraint_vertex_indices_) {
+        free_index_[idx] = -1;
+    }
+    for (int i = 0; i < num_vertices; ++i) {
+        if (free_index_[i] == 0 && total_weights[i] > 0) {
+            free_index_[i] = int(free_vertices_.size());
+            free_vertices_.push_back(i);
         } else {
-            double W = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                triplets.push_back(Eigen::Triplet<double>(i, j, -w));
-                W += w;
-            }
-            if (W > 0) {
-                triplets.push_back(Eigen::Triplet<double>(i, i, W));
+            free_index_[i] = -1;
+        }
+    }
+    const int num_free = int(free_vertices_.size());
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(num_free + offsets_.back());
+    for (int f = 0; f < num_free; ++f) {
+        const int i = free_vertices_[f];
+        triplets.push_back(Eigen::Triplet<double>(f, f, total_weights[i]));
+        for (int64_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            const int g = free_index_[neighbors_[k]];
+            if (g >= 0) {
+                triplets.push_back(Eigen::Triplet<double>(f, g, -weights_[k]));
             }
         }
     }
-    Eigen::SparseMatrix<double> L(vertices_.size(), vertices_.size());
+    Eigen::SparseMatrix<double> L(num_free, num_free);
     L.setFromTriplets(triplets.begin(), triplets.end());
     utility::LogDebug(
             "[DeformAsRigidAsPossible] done setting up system matrix L");
 
     utility::LogDebug("[DeformAsRigidAsPossible] setting up sparse solver");
-    Eigen::SparseLU<Eigen::SparseMatrix<double>> solver;
-    solver.analyzePattern(L);
-    solver.factorize(L);
-    if (solver.info() != Eigen::Success) {
-        utility::LogError("Failed to build solver (factorize)");
-    } else {
-        utility::LogDebug(
-                "[DeformAsRigidAsPossible] done setting up sparse solver");
-    }
-
-    std::vector<Eigen::VectorXd> b = {Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size()),
-                                      Eigen::VectorXd(vertices_.size())};
+    if (num_free > 0) {
+        solver_.compute(L);
+        if (solver_.info() != Eigen::Success ||
+            solver_.vectorD().minCoeff() <= 0) {
+            utility::LogError("Failed to build solver (factorize)");
+        }
+    }
+    utility::LogDebug(
+            "[DeformAsRigidAsPossible] done setting up sparse solver");
+
+    positions_ = rest_vertices_;
+    rotations_.resize(num_vertices, Eigen::Matrix3d::Identity());
+    if (energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+        prev_rotations_.resize(num_vertices, Eigen::Matrix3d::Identity());
+    }
+}
+
+std::shared_ptr<TriangleMesh> DeformAsRigidAsPossibleSolver::Deform(
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter) {
+    if (constraint_vertex_positions.size() !=
+        constraint_vertex_indices_.size()) {
+        utility::LogError(
+                "Expected {} constraint vertex positions, but got {}.",
+                constraint_vertex_indices_.size(),
+                constraint_vertex_positions.size());
+    }
+
     for (size_t iter = 0; iter < max_iter; ++iter) {
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            std::swap(Rs, Rs_old);
+        if (energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed) {
+            std::swap(rotations_, prev_rotations_);
+        }
+        UpdateRotations();
+        // The first rotations are fitted to the previous solution, and the
+        // handles move in the first global step.
+        if (iter == 0) {
+            for (size_t idx = 0; idx < constraint_vertex_indices_.size();
+                 ++idx) {
+                positions_[constraint_vertex_indices_[idx]] =
+                        constraint_vertex_positions[idx];
+            }
         }
+        UpdatePositions();
+        if (utility::GetVerbosityLevel() >= utility::VerbosityLevel::Debug) {
+            utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
+                              iter, ComputeEnergy());
+        }
+    }
 
-#pragma omp parallel for schedule(static) \
+    auto mesh = std::make_shared<TriangleMesh>();
+    mesh->vertices_ = positions_;
+    mesh->triangles_ = triangles_;
+    return mesh;
+}
+
+void DeformAsRigidAsPossibleSolver::Reset() {
+    positions_ = rest_vertices_;
+    has_rotations_ = false;
+}
+
+void DeformAsRigidAsPossibleSolver::UpdateRotations() {
+    const int num_vertices = int(positions_.size());
+    const bool smoothed =
+            energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed &&
+            has_rotations_;
+    bool all_rotations = true;
+#pragma omp parallel for reduction(&& : all_rotations) schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            // Update rotations
-            Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
+    for (int i = 0; i < num_vertices; ++i) {
+        Eigen::Matrix3d S = Eigen::Matrix3d::Zero();
+        const Eigen::Vector3d &pi = positions_[i];
+        for (int64_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            const Eigen::Vector3d e1 = pi - positions_[neighbors_[k]];
+            const double w = weights_[k];
+            S.row(0).noalias() += (w * rest_edges_x_[k]) * e1.transpose();
+            S.row(1).noalias() += (w * rest_edges_y_[k]) * e1.transpose();
+            S.row(2).noalias() += (w * rest_edges_z_[k]) * e1.transpose();
+        }
+        const int64_t num_neighbors = offsets_[i + 1] - offsets_[i];
+        if (smoothed && num_neighbors > 0) {
             Eigen::Matrix3d R = Eigen::Matrix3d::Zero();
-            int n_nbs = 0;
-            for (int j : prime->adjacency_list_[i]) {
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                S += w * (e0 * e1.transpose());
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    R += Rs_old[j];
-                }
-                n_nbs++;
-            }
-            if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed &&
-                iter > 0 && n_nbs > 0) {
-                S = 2 * S +
-                    (4 * smoothed_alpha * surface_area / n_nbs) * R.transpose();
-            }
-            Eigen::JacobiSVD<Eigen::Matrix3d> svd(
-                    S, Eigen::ComputeFullU | Eigen::ComputeFullV);
-            Eigen::Matrix3d U = svd.matrixU();
-            Eigen::Matrix3d V = svd.matrixV();
-            Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
-            // ensure rotation:
-            // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
-            Rs[i] = V * D.asDiagonal() * U.transpose();
-            if (Rs[i].determinant() <= 0) {
-                utility::LogError(
-                        "something went wrong with "
-                        "updating R");
+            for (int64_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+                R += prev_rotations_[neighbors_[k]];
             }
+            S = 2 * S + (4 * smoothed_alpha_ * surface_area_ /
+                         double(num_neighbors)) *
+                                R.transpose();
         }
+        Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+                S, Eigen::ComputeFullU | Eigen::ComputeFullV);
+        const Eigen::Matrix3d &U = svd.matrixU();
+        const Eigen::Matrix3d &V = svd.matrixV();
+        Eigen::Vector3d D(1, 1, (V * U.transpose()).determinant());
+        // ensure rotation:
+        // http://graphics.stanford.edu/~smr/ICP/comparison/eggert_comparison_mva97.pdf
+        rotations_[i] = V * D.asDiagonal() * U.transpose();
+        all_rotations = all_rotations && rotations_[i].determinant() > 0;
+    }
+    if (!all_rotations) {
+        utility::LogError("something went wrong with updating R");
+    }
+    has_rotations_ = true;
+}
 
+void DeformAsRigidAsPossibleSolver::UpdatePositions() {
+    const int num_free = int(free_vertices_.size());
+    if (num_free == 0) {
+        return;
+    }
+    // Fixed neighbors move to the right-hand side.
+    Eigen::MatrixXd b(num_free, 3);
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            // Update Positions
-            Eigen::Vector3d bi(0, 0, 0);
-            if (constraints.count(i) > 0) {
-                bi = constraints[i];
-            } else {
-                for (int j : prime->adjacency_list_[i]) {
-                    double w = edge_weights[GetOrderedEdge(i, j)];
-                    bi += w / 2 *
-                          ((Rs[i] + Rs[j]) * (vertices_[i] - vertices_[j]));
-                }
+    for (int f = 0; f < num_free; ++f) {
+        const int i = free_vertices_[f];
+        Eigen::Vector3d bi(0, 0, 0);
+        for (int64_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            const int j = neighbors_[k];
+            const double w = weights_[k];
+            const Eigen::Vector3d e0(rest_edges_x_[k], rest_edges_y_[k],
+                                     rest_edges_z_[k]);
+            bi += w / 2 * ((rotations_[i] + rotations_[j]) * e0);
+            if (free_index_[j] < 0) {
+                bi += w * positions_[j];
             }
-            b[0](i) = bi(0);
-            b[1](i) = bi(1);
-            b[2](i) = bi(2);
         }
+        b.row(f) = bi.transpose();
+    }
+    const Eigen::MatrixXd x = solver_.solve(b);
+    if (solver_.info() != Eigen::Success) {
+        utility::LogError("Cholesky solve failed");
+    }
 #pragma omp parallel for schedule(static) \
         num_threads(utility::EstimateMaxThreads())
-        for (int comp = 0; comp < 3; ++comp) {
-            Eigen::VectorXd p_prime = solver.solve(b[comp]);
-            if (solver.info() != Eigen::Success) {
-                utility::LogError("Cholesky solve failed");
-            }
-            for (int i = 0; i < int(vertices_.size()); ++i) {
-                prime->vertices_[i](comp) = p_prime(i);
-            }
-        }
+    for (int f = 0; f < num_free; ++f) {
+        positions_[free_vertices_[f]] = x.row(f).transpose();
+    }
+}
 
-        // Compute energy and log
-        double energy = 0;
-        double reg = 0;
-        for (int i = 0; i < int(vertices_.size()); ++i) {
-            for (int j : prime->adjacency_list_[i]) {
-                double w = edge_weights[GetOrderedEdge(i, j)];
-                Eigen::Vector3d e0 = vertices_[i] - vertices_[j];
-                Eigen::Vector3d e1 = prime->vertices_[i] - prime->vertices_[j];
-                Eigen::Vector3d diff = e1 - Rs[i] * e0;
-                energy += w * diff.squaredNorm();
-                if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-                    reg += (Rs[i] - Rs[j]).squaredNorm();
-                }
+double DeformAsRigidAsPossibleSolver::ComputeEnergy() const {
+    const int num_vertices = int(positions_.size());
+    const bool smoothed =
+            energy_ == MeshBase::DeformAsRigidAsPossibleEnergy::Smoothed;
+    double energy = 0;
+    double reg = 0;
+#pragma omp parallel for reduction(+ : energy, reg) schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int i = 0; i < num_vertices; ++i) {
+        for (int64_t k = offsets_[i]; k < offsets_[i + 1]; ++k) {
+            const int j = neighbors_[k];
+            const Eigen::Vector3d e0(rest_edges_x_[k], rest_edges_y_[k],
+                                     rest_edges_z_[k]);
+            const Eigen::Vector3d e1 = positions_[i] - positions_[j];
+            energy += weights_[k] * (e1 - rotations_[i] * e0).squaredNorm();
+            if (smoothed) {
+                reg += (rotations_[i] - rotations_[j]).squaredNorm();
             }
         }
-        if (energy_model == DeformAsRigidAsPossibleEnergy::Smoothed) {
-            energy = energy + smoothed_alpha * surface_area * reg;
-        }
-        utility::LogDebug("[DeformAsRigidAsPossible] iter={}, energy={:e}",
-                          iter, energy);
     }
+    if (smoothed) {
+        energy += smoothed_alpha_ * surface_area_ * reg;
+    }
+    return energy;
+}
 
-    return prime;
+std::shared_ptr<TriangleMesh> TriangleMesh::DeformAsRigidAsPossible(
+        const std::vector<int> &constraint_vertex_indices,
+        const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+        size_t max_iter,
+        DeformAsRigidAsPossibleEnergy energy_model,
+        double smoothed_alpha) const {
+    // Unpaired indices or positions are ignored.
+    const size_t num_constraints = std::min(constraint_vertex_indices.size(),
+                                            constraint_vertex_positions.size());
+    DeformAsRigidAsPossibleSolver solver(
+            *this,
+            std::vector<int>(constraint_vertex_indices.begin(),
+                             constraint_vertex_indices.begin() +
+                                     num_constraints),
+            energy_model, smoothed_alpha);
+    return solver.Deform(
+            std::vector<Eigen::Vector3d>(constraint_vertex_positions.begin(),
+                                         constraint_vertex_positions.begin() +
+                                                 num_constraints),
+            max_iter);
 }
 
 }  // namespace geometry
@@ -0,0 +1,135 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SparseCholesky>
+#include <memory>
+#include <vector>
+
+#include "open3d/geometry/TriangleMesh.h"
+
+namespace open3d {
+namespace geometry {
+
+/// \class DeformAsRigidAsPossibleSolver
+///
+/// \brief Reusable solver for the deformation of Sorkine and Alexa,
+/// "As-Rigid-As-Possible Surface Modeling", 2007.
+///
+/// The constructor computes the cotangent weights of the rest mesh, the
+/// Laplacian of the unconstrained vertices and its sparse Cholesky
+/// factorization. These only depend on the mesh and on which vertices are
+/// constrained, so the same handles can be moved to new positions with
+/// Deform() without refactoring. Every call of Deform() starts from the
+/// solution of the previous call.
+///
+/// The local step fits the rotations of all vertices in parallel. The
+/// adjacency, weights and rest edges are stored in compressed sparse row
+/// format with the edge coordinates in separate arrays, so the covariance of
+/// a vertex is accumulated from contiguous memory.
+///
+/// Unconstrained vertices without weighted edges, e.g. unreferenced vertices,
+/// keep their rest positions.
+class DeformAsRigidAsPossibleSolver {
+public:
+    /// \brief Prepares the deformation of \p mesh with the vertices
+    /// \p constraint_vertex_indices as handles.
+    ///
+    /// \param mesh The rest shape.
+    /// \param constraint_vertex_indices Indices of the vertices whose positions
+    /// are given to Deform().
+    /// \param energy Energy model that is minimized.
+    /// \param smoothed_alpha Alpha parameter of the smoothed energy model.
+    DeformAsRigidAsPossibleSolver(
+            const TriangleMesh &mesh,
+            const std::vector<int> &constraint_vertex_indices,
+            MeshBase::DeformAsRigidAsPossibleEnergy energy =
+                    MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+            double smoothed_alpha = 0.01);
+
+    /// \brief Deforms the mesh so that the constrained vertices are at
+    /// \p constraint_vertex_positions.
+    ///
+    /// Starts from the solution of the previous call, or from the rest shape
+    /// after construction and Reset(). The rotations of the first iteration
+    /// are fitted to that shape before the handles are moved.
+    ///
+    /// \param constraint_vertex_positions One position per constraint vertex
+    /// index.
+    /// \param max_iter Number of iterations to minimize the energy.
+    /// \return The deformed mesh.
+    std::shared_ptr<TriangleMesh> Deform(
+            const std::vector<Eigen::Vector3d> &constraint_vertex_positions,
+            size_t max_iter);
+
+    /// Makes the next Deform() start from the rest shape.
+    void Reset();
+
+    /// Returns the indices of the constrained vertices.
+    const std::vector<int> &GetConstraintVertexIndices() const {
+        return constraint_vertex_indices_;
+    }
+
+private:
+    /// Fits the rotation of every vertex to the current positions.
+    void UpdateRotations();
+    /// Solves the positions of the free vertices for the current rotations.
+    void UpdatePositions();
+    /// Returns the energy of the current positions and rotations.
+    double ComputeEnergy() const;
+
+    std::vector<Eigen::Vector3d> rest_vertices_;
+    std::vector<Eigen::Vector3i> triangles_;
+    std::vector<int> constraint_vertex_indices_;
+    MeshBase::DeformAsRigidAsPossibleEnergy energy_;
+    double smoothed_alpha_;
+    double surface_area_ = 0;
+
+    /// The neighbors j of vertex i are neighbors_[offsets_[i]] to
+    /// neighbors_[offsets_[i + 1] - 1], with the cotangent weights w_ij and
+    /// the rest edges v_i - v_j.
+    std::vector<int64_t> offsets_;
+    std::vector<int> neighbors_;
+    std::vector<double> weights_;
+    std::vector<double> rest_edges_x_;
+    std::vector<double> rest_edges_y_;
+    std::vector<double> rest_edges_z_;
+
+    /// Row of every vertex in the system, or -1 if the vertex is fixed.
+    std::vector<int> free_index_;
+    std::vector<int> free_vertices_;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> solver_;
+
+    std::vector<Eigen::Vector3d> positions_;
+    std::vector<Eigen::Matrix3d> rotations_;
+    std::vector<Eigen::Matrix3d> prev_rotations_;
+    bool has_rotations_ = false;
+};
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,326 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/TriangleMeshTopology.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+/// Edge key of a triangle corner, ordered by edge and then by corner.
+struct CornerEdge {
+    uint64_t key_;
+    int64_t corner_;
+
+    bool operator<(const CornerEdge &other) const {
+        return key_ < other.key_ ||
+               (key_ == other.key_ && corner_ < other.corner_);
+    }
+};
+
+/// Builds sorted rows without duplicates from the (row, value) entries that
+/// ForEachEntry(i, Add) passes to Add for the items i in [0, num_items).
+template <typename ForEachEntryFunc>
+void BuildSortedRows(int64_t num_rows,
+                     int64_t num_items,
+                     ForEachEntryFunc ForEachEntry,
+                     std::vector<int64_t> &offsets,
+                     std::vector<int> &values) {
+    std::vector<int64_t> counts(num_rows + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_items; ++i) {
+        ForEachEntry(i, [&](int64_t row, int) {
+#pragma omp atomic
+            ++counts[row + 1];
+        });
+    }
+    std::vector<int64_t> unsorted_offsets(num_rows + 1);
+    std::partial_sum(counts.begin(), counts.end(), unsorted_offsets.begin());
+    std::vector<int64_t> cursors(unsorted_offsets.begin(),
+                                 unsorted_offsets.end() - 1);
+    std::vector<int> unsorted_values(unsorted_offsets.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_items; ++i) {
+        ForEachEntry(i, [&](int64_t row, int value) {
+            int64_t pos;
+#pragma omp atomic capture
+            pos = cursors[row]++;
+            unsorted_values[pos] = value;
+        });
+    }
+
+    // Sorting every row makes the layout independent of the insertion order.
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t row = 0; row < num_rows; ++row) {
+        auto begin = unsorted_values.begin() + unsorted_offsets[row];
+        auto end = unsorted_values.begin() + unsorted_offsets[row + 1];
+        std::sort(begin, end);
+        counts[row + 1] = std::unique(begin, end) - begin;
+    }
+    offsets.resize(num_rows + 1);
+    std::partial_sum(counts.begin(), counts.end(), offsets.begin());
+    values.resize(offsets.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t row = 0; row < num_rows; ++row) {
+        std::copy(unsorted_values.begin() + unsorted_offsets[row],
+                  unsorted_values.begin() + unsorted_offsets[row] +
+                          (offsets[row + 1] - offsets[row]),
+                  values.begin() + offsets[row]);
+    }
+}
+
+}  // namespace
+
+TriangleMeshTopology::TriangleMeshTopology(
+        const std::vector<Eigen::Vector3i> &triangles, size_t num_vertices)
+    : num_triangles_(triangles.size()),
+      source_triangles_(triangles),
+      source_num_vertices_(num_vertices) {
+    const int64_t num_triangles = static_cast<int64_t>(triangles.size());
+    const int64_t num_corners = 3 * num_triangles;
+
+    // Vertex indices beyond num_vertices still get adjacency rows.
+    int min_index = 0;
+    int max_index = -1;
+#pragma omp parallel for reduction(min : min_index) reduction(max : max_index) \
+        schedule(static) num_threads(utility::EstimateMaxThreads())
+    for (int64_t t = 0; t < num_triangles; ++t) {
+        min_index = std::min(min_index, triangles[t].minCoeff());
+        max_index = std::max(max_index, triangles[t].maxCoeff());
+    }
+    if (min_index < 0) {
+        utility::LogError("Invalid vertex index {} in triangles.", min_index);
+    }
+    num_vertices_ = std::max(num_vertices, size_t(max_index + 1));
+
+    std::vector<CornerEdge> corner_edges(num_corners);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_corners; ++c) {
+        const Eigen::Vector3i &triangle = triangles[c / 3];
+        const int v0 = triangle(c % 3);
+        const int v1 = triangle((c + 1) % 3);
+        corner_edges[c].key_ = (uint64_t(std::min(v0, v1)) << 32) |
+                               uint64_t(std::max(v0, v1));
+        corner_edges[c].corner_ = c;
+    }
+    // Corners are unique, so the order is total and the unstable parallel
+    // sort is deterministic.
+    tbb::parallel_sort(corner_edges.begin(), corner_edges.end());
+
+    // Every thread numbers the edges starting in its range of corners.
+    auto IsFirst = [&](int64_t i) {
+        return i == 0 || corner_edges[i - 1].key_ != corner_edges[i].key_;
+    };
+    const int64_t num_chunks =
+            std::max(std::min(int64_t(utility::EstimateMaxThreads()),
+                              num_corners),
+                     int64_t(1));
+    auto ChunkBegin = [&](int64_t c) { return c * num_corners / num_chunks; };
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t num_edges = 0;
+        for (int64_t i = ChunkBegin(c); i < ChunkBegin(c + 1); ++i) {
+            num_edges += IsFirst(i) ? 1 : 0;
+        }
+        chunk_offsets[c + 1] = num_edges;
+    }
+    std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(),
+                     chunk_offsets.begin());
+
+    const int64_t num_edges = chunk_offsets.back();
+    edges_.resize(num_edges);
+    edge_offsets_.resize(num_edges + 1);
+    edge_offsets_[num_edges] = num_corners;
+    edge_triangles_.resize(num_corners);
+    edge_opposite_vertices_.resize(num_corners);
+    triangle_edges_.resize(num_corners);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        int64_t e = chunk_offsets[c] - 1;
+        for (int64_t i = ChunkBegin(c); i < ChunkBegin(c + 1); ++i) {
+            if (IsFirst(i)) {
+                ++e;
+                edges_[e] = Eigen::Vector2i(int(corner_edges[i].key_ >> 32),
+                                            int(corner_edges[i].key_));
+                edge_offsets_[e] = i;
+            }
+            const int64_t corner = corner_edges[i].corner_;
+            const Eigen::Vector3i &triangle = triangles[corner / 3];
+            edge_triangles_[i] = int(corner / 3);
+            edge_opposite_vertices_[i] = triangle((corner + 2) % 3);
+            triangle_edges_[corner] = e;
+        }
+    }
+
+    half_edge_twins_.assign(num_corners, -1);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t e = 0; e < num_edges; ++e) {
+        if (EdgeDegree(e) != 2) {
+            continue;
+        }
+        const int64_t c0 = corner_edges[edge_offsets_[e]].corner_;
+        const int64_t c1 = corner_edges[edge_offsets_[e] + 1].corner_;
+        if (triangles[c0 / 3](c0 % 3) != triangles[c1 / 3](c1 % 3)) {
+            half_edge_twins_[c0] = int(c1);
+            half_edge_twins_[c1] = int(c0);
+        }
+    }
+
+    // A degenerate edge (v, v) makes v adjacent to itself, as in
+    // TriangleMesh::ComputeAdjacencyList.
+    BuildSortedRows(
+            int64_t(num_vertices_), num_edges,
+            [&](int64_t e, auto Add) {
+                Add(edges_[e](0), edges_[e](1));
+                Add(edges_[e](1), edges_[e](0));
+            },
+            vertex_offsets_, vertex_neighbors_);
+    BuildSortedRows(
+            int64_t(num_vertices_), num_corners,
+            [&](int64_t c, auto Add) {
+                Add(triangles[c / 3](c % 3), int(c));
+            },
+            vertex_half_edge_offsets_, vertex_half_edges_);
+
+    // The sorted outgoing half-edges list the incident triangles in order,
+    // with repetitions for degenerate triangles.
+    vertex_triangle_offsets_.assign(num_vertices_ + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < int64_t(num_vertices_); ++v) {
+        int64_t num_triangles = 0;
+        for (int64_t i = vertex_half_edge_offsets_[v];
+             i < vertex_half_edge_offsets_[v + 1]; ++i) {
+            if (i == vertex_half_edge_offsets_[v] ||
+                vertex_half_edges_[i] / 3 != vertex_half_edges_[i - 1] / 3) {
+                ++num_triangles;
+            }
+        }
+        vertex_triangle_offsets_[v + 1] = num_triangles;
+    }
+    std::partial_sum(vertex_triangle_offsets_.begin(),
+                     vertex_triangle_offsets_.end(),
+                     vertex_triangle_offsets_.begin());
+    vertex_triangles_.resize(vertex_triangle_offsets_.back());
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < int64_t(num_vertices_); ++v) {
+        int64_t pos = vertex_triangle_offsets_[v];
+        for (int64_t i = vertex_half_edge_offsets_[v];
+             i < vertex_half_edge_offsets_[v + 1]; ++i) {
+            if (i == vertex_half_edge_offsets_[v] ||
+                vertex_half_edges_[i] / 3 != vertex_half_edges_[i - 1] / 3) {
+                vertex_triangles_[pos++] = vertex_half_edges_[i] / 3;
+            }
+        }
+    }
+
+    // Reorder the outgoing half-edges of every vertex fan by fan.
+#pragma omp parallel num_threads(utility::EstimateMaxThreads())
+    {
+        std::vector<int> ordered;
+        std::vector<char> visited;
+#pragma omp for schedule(static)
+        for (int64_t v = 0; v < int64_t(num_vertices_); ++v) {
+            int *row = vertex_half_edges_.data() + vertex_half_edge_offsets_[v];
+            const int64_t num_half_edges = vertex_half_edge_offsets_[v + 1] -
+                                           vertex_half_edge_offsets_[v];
+            ordered.clear();
+            visited.assign(num_half_edges, 0);
+            auto WalkFan = [&](int start) {
+                int h = start;
+                do {
+                    const int64_t i =
+                            std::lower_bound(row, row + num_half_edges, h) -
+                            row;
+                    if (visited[i]) {
+                        break;
+                    }
+                    visited[i] = 1;
+                    ordered.push_back(h);
+                    h = NextHalfEdgeAroundVertex(h);
+                } while (h != -1 && h != start);
+            };
+            for (int64_t i = 0; i < num_half_edges; ++i) {
+                if (half_edge_twins_[row[i]] == -1) {
+                    WalkFan(row[i]);
+                }
+            }
+            for (int64_t i = 0; i < num_half_edges; ++i) {
+                if (!visited[i]) {
+                    WalkFan(row[i]);
+                }
+            }
+            std::copy(ordered.begin(), ordered.end(), row);
+        }
+    }
+}
+
+int64_t TriangleMeshTopology::FindEdge(int v0, int v1) const {
+    const Eigen::Vector2i edge(std::min(v0, v1), std::max(v0, v1));
+    auto it = std::lower_bound(
+            edges_.begin(), edges_.end(), edge,
+            [](const Eigen::Vector2i &a, const Eigen::Vector2i &b) {
+                return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+            });
+    if (it == edges_.end() || *it != edge) {
+        return -1;
+    }
+    return it - edges_.begin();
+}
+
+bool TriangleMeshTopology::IsBuiltFrom(
+        const std::vector<Eigen::Vector3i> &triangles,
+        size_t num_vertices) const {
+    // Eigen::Vector3i has no padding, so the triangles compare bytewise.
+    return num_vertices == source_num_vertices_ &&
+           triangles.size() == source_triangles_.size() &&
+           (triangles.empty() ||
+            std::memcmp(triangles.data(), source_triangles_.data(),
+                        triangles.size() * sizeof(Eigen::Vector3i)) == 0);
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,134 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class TriangleMeshTopology
+///
+/// \brief Edges and adjacencies of a triangle mesh in compressed sparse row
+/// format.
+///
+/// Every ordered edge key (min(v0, v1), max(v0, v1)) of every triangle is
+/// sorted in parallel, and the runs of equal keys become the edges. Edges are
+/// stored in lexicographic order, the triangles of an edge in increasing
+/// index order, and all adjacency lists sorted, so the structure does not
+/// depend on the number of threads.
+///
+/// The structure doubles as a half-edge mesh with index-only arrays. Half-edge
+/// h = 3 * t + k runs from vertex k to vertex (k + 1) % 3 of triangle t, so
+/// next, previous and triangle of a half-edge are implicit, and only the twins
+/// and the ordered outgoing half-edges of the vertices are stored.
+///
+/// TriangleMesh::GetTopology() caches an instance on the mesh, which the edge
+/// maps, manifold checks, clustering functions of TriangleMesh and
+/// HalfEdgeTriangleMesh share.
+class TriangleMeshTopology {
+public:
+    /// \brief Builds the topology of \p triangles on \p num_vertices vertices.
+    TriangleMeshTopology(const std::vector<Eigen::Vector3i> &triangles,
+                         size_t num_vertices);
+
+    /// Returns the number of unique edges.
+    size_t NumEdges() const { return edges_.size(); }
+    /// Returns the number of triangles incident to edge \p e.
+    int64_t EdgeDegree(size_t e) const {
+        return edge_offsets_[e + 1] - edge_offsets_[e];
+    }
+    /// Returns the index of edge (\p v0, \p v1) in edges_, or -1 if the edge
+    /// does not exist.
+    int64_t FindEdge(int v0, int v1) const;
+
+    /// Returns the next half-edge in the triangle of half-edge \p h.
+    static int NextHalfEdge(int h) { return h - h % 3 + (h + 1) % 3; }
+    /// Returns the previous half-edge in the triangle of half-edge \p h.
+    static int PrevHalfEdge(int h) { return h - h % 3 + (h + 2) % 3; }
+    /// Returns the outgoing half-edge of the same vertex that follows half-edge
+    /// \p h in counter-clockwise order, or -1 at a boundary.
+    int NextHalfEdgeAroundVertex(int h) const {
+        return half_edge_twins_[PrevHalfEdge(h)];
+    }
+
+    /// Returns true if this topology was built from \p triangles on
+    /// \p num_vertices vertices. Compares \p triangles with a copy of the
+    /// source triangles, so triangles modified in place are detected.
+    bool IsBuiltFrom(const std::vector<Eigen::Vector3i> &triangles,
+                     size_t num_vertices) const;
+
+public:
+    /// Number of vertex rows, at least one past the largest vertex index.
+    size_t num_vertices_ = 0;
+    size_t num_triangles_ = 0;
+    /// Triangles and number of vertices the topology was built from, see
+    /// IsBuiltFrom().
+    std::vector<Eigen::Vector3i> source_triangles_;
+    size_t source_num_vertices_ = 0;
+
+    /// Unique edges (v0, v1) with v0 <= v1 in lexicographic order.
+    std::vector<Eigen::Vector2i> edges_;
+    /// The triangles of edge e are edge_triangles_[edge_offsets_[e]] to
+    /// edge_triangles_[edge_offsets_[e + 1] - 1].
+    std::vector<int64_t> edge_offsets_;
+    std::vector<int> edge_triangles_;
+    /// Vertex of the triangle in edge_triangles_ opposite to the edge.
+    std::vector<int> edge_opposite_vertices_;
+    /// triangle_edges_[3 * t + k] is the edge from vertex k to vertex
+    /// (k + 1) % 3 of triangle t.
+    std::vector<int64_t> triangle_edges_;
+
+    /// The vertices adjacent to vertex v are
+    /// vertex_neighbors_[vertex_offsets_[v]] to
+    /// vertex_neighbors_[vertex_offsets_[v + 1] - 1].
+    std::vector<int64_t> vertex_offsets_;
+    std::vector<int> vertex_neighbors_;
+    /// The triangles incident to vertex v are
+    /// vertex_triangles_[vertex_triangle_offsets_[v]] to
+    /// vertex_triangles_[vertex_triangle_offsets_[v + 1] - 1].
+    std::vector<int64_t> vertex_triangle_offsets_;
+    std::vector<int> vertex_triangles_;
+
+    /// Twin of every half-edge, or -1 if the half-edge is on the boundary.
+    /// Only edges with exactly two triangles of opposite orientation have
+    /// twins, so non-manifold edges are boundaries on all sides.
+    std::vector<int> half_edge_twins_;
+    /// The outgoing half-edges of vertex v are
+    /// vertex_half_edges_[vertex_half_edge_offsets_[v]] to
+    /// vertex_half_edges_[vertex_half_edge_offsets_[v + 1] - 1]. Every fan of
+    /// triangles around v is listed in counter-clockwise order, starting at
+    /// its boundary half-edge if it has one and at its smallest half-edge
+    /// otherwise. Fans with a boundary come first.
+    std::vector<int64_t> vertex_half_edge_offsets_;
+    std::vector<int> vertex_half_edges_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
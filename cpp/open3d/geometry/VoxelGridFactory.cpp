@@ -31,8 +31,10 @@
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
 #include "open3d/geometry/VoxelGrid.h"
+#include "open3d/geometry/VoxelPartition.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 
 namespace open3d {
 namespace geometry {
@@ -76,29 +78,30 @@ std::shared_ptr<VoxelGrid> VoxelGrid::CreateFromPointCloudWithinBounds(
     }
     output->voxel_size_ = voxel_size;
     output->origin_ = min_bound;
-    std::unordered_map<Eigen::Vector3i, AvgColorVoxel,
-                       utility::hash_eigen<Eigen::Vector3i>>
-            voxelindex_to_accpoint;
-    Eigen::Vector3d ref_coord;
-    Eigen::Vector3i voxel_index;
+    const VoxelPartition partition(input.points_, min_bound, voxel_size);
+    const int64_t num_voxels = static_cast<int64_t>(partition.NumVoxels());
     bool has_colors = input.HasColors();
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        ref_coord = (input.points_[i] - min_bound) / voxel_size;
-        voxel_index << int(floor(ref_coord(0))), int(floor(ref_coord(1))),
-                int(floor(ref_coord(2)));
-        if (has_colors) {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index,
-                                                    input.colors_[i]);
-        } else {
-            voxelindex_to_accpoint[voxel_index].Add(voxel_index);
+    std::vector<Voxel> voxels(num_voxels);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t v = 0; v < num_voxels; ++v) {
+        const Eigen::Vector3i &voxel_index = partition.voxel_indices_[v];
+        AvgColorVoxel accpoint;
+        for (const int *i = partition.PointsBegin(v);
+             i != partition.PointsEnd(v); ++i) {
+            if (has_colors) {
+                accpoint.Add(voxel_index, input.colors_[*i]);
+            } else {
+                accpoint.Add(voxel_index);
+            }
         }
+        const Eigen::Vector3d &color = has_colors ? accpoint.GetAverageColor()
+                                                  : Eigen::Vector3d(0, 0, 0);
+        voxels[v] = Voxel(voxel_index, color);
     }
-    for (auto accpoint : voxelindex_to_accpoint) {
-        const Eigen::Vector3i &grid_index = accpoint.second.GetVoxelIndex();
-        const Eigen::Vector3d &color =
-                has_colors ? accpoint.second.GetAverageColor()
-                           : Eigen::Vector3d(0, 0, 0);
-        output->AddVoxel(geometry::Voxel(grid_index, color));
+    output->voxels_.reserve(voxels.size());
+    for (const Voxel &voxel : voxels) {
+        output->AddVoxel(voxel);
     }
     utility::LogDebug(
             "Pointcloud is voxelized from {:d} points to {:d} voxels.",
@@ -0,0 +1,133 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/geometry/VoxelPartition.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace geometry {
+
+namespace {
+
+struct VoxelEntry {
+    Eigen::Vector3i voxel_index_;
+    int point_index_;
+};
+
+bool SameVoxel(const VoxelEntry &a, const VoxelEntry &b) {
+    return a.voxel_index_ == b.voxel_index_;
+}
+
+bool operator<(const VoxelEntry &a, const VoxelEntry &b) {
+    for (int d = 0; d < 3; ++d) {
+        if (a.voxel_index_(d) != b.voxel_index_(d)) {
+            return a.voxel_index_(d) < b.voxel_index_(d);
+        }
+    }
+    return a.point_index_ < b.point_index_;
+}
+
+}  // namespace
+
+VoxelPartition::VoxelPartition(const std::vector<Eigen::Vector3d> &points,
+                               const Eigen::Vector3d &origin,
+                               double voxel_size) {
+    if (points.size() > size_t(INT_MAX)) {
+        utility::LogError("Too many points: {}, must <= {}.", points.size(),
+                          INT_MAX);
+    }
+    const int64_t num_points = static_cast<int64_t>(points.size());
+    offsets_.assign(1, 0);
+    if (num_points == 0) {
+        return;
+    }
+
+    std::vector<VoxelEntry> entries(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_points; ++i) {
+        const Eigen::Vector3d ref_coord = (points[i] - origin) / voxel_size;
+        entries[i].voxel_index_ = Eigen::Vector3i(int(floor(ref_coord(0))),
+                                                  int(floor(ref_coord(1))),
+                                                  int(floor(ref_coord(2))));
+        entries[i].point_index_ = int(i);
+    }
+    // Point indices are unique, so the order is total and the unstable
+    // parallel sort is deterministic.
+    tbb::parallel_sort(entries.begin(), entries.end());
+
+    // Every thread collects the first entries of the voxels starting in its
+    // range of entries.
+    const int64_t num_chunks =
+            std::min(int64_t(utility::EstimateMaxThreads()), num_points);
+    auto ChunkBegin = [&](int64_t c) { return c * num_points / num_chunks; };
+    std::vector<size_t> chunk_offsets(num_chunks + 1, 0);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        size_t num_voxels = 0;
+        for (int64_t i = ChunkBegin(c); i < ChunkBegin(c + 1); ++i) {
+            if (i == 0 || !SameVoxel(entries[i - 1], entries[i])) {
+                ++num_voxels;
+            }
+        }
+        chunk_offsets[c + 1] = num_voxels;
+    }
+    std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(),
+                     chunk_offsets.begin());
+
+    const size_t num_voxels = chunk_offsets.back();
+    voxel_indices_.resize(num_voxels);
+    offsets_.resize(num_voxels + 1);
+    offsets_[num_voxels] = size_t(num_points);
+    point_indices_.resize(num_points);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t c = 0; c < num_chunks; ++c) {
+        size_t v = chunk_offsets[c];
+        for (int64_t i = ChunkBegin(c); i < ChunkBegin(c + 1); ++i) {
+            if (i == 0 || !SameVoxel(entries[i - 1], entries[i])) {
+                voxel_indices_[v] = entries[i].voxel_index_;
+                offsets_[v] = size_t(i);
+                ++v;
+            }
+            point_indices_[i] = entries[i].point_index_;
+        }
+    }
+}
+
+}  // namespace geometry
+}  // namespace open3d
@@ -0,0 +1,79 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <vector>
+
+namespace open3d {
+namespace geometry {
+
+/// \class VoxelPartition
+///
+/// \brief Points grouped by the voxel they fall into, shared by the legacy
+/// voxel down sampling and voxelization.
+///
+/// The voxel index of a point p is floor((p - origin) / voxel_size). Occupied
+/// voxels are stored in lexicographic order of their indices, and the points
+/// of every voxel in increasing order of their indices, so that the partition,
+/// and any accumulation over it, does not depend on the number of threads.
+class VoxelPartition {
+public:
+    /// \brief Partitions \p points in parallel by sorting them by voxel index.
+    ///
+    /// \param points Points to partition, with at most INT_MAX entries.
+    /// \param origin Origin of the voxel grid.
+    /// \param voxel_size Edge length of a voxel.
+    VoxelPartition(const std::vector<Eigen::Vector3d> &points,
+                   const Eigen::Vector3d &origin,
+                   double voxel_size);
+
+    /// Returns the number of occupied voxels.
+    size_t NumVoxels() const { return voxel_indices_.size(); }
+
+    /// Returns the begin of the point indices in voxel \p v.
+    const int *PointsBegin(size_t v) const {
+        return point_indices_.data() + offsets_[v];
+    }
+    /// Returns the end of the point indices in voxel \p v.
+    const int *PointsEnd(size_t v) const {
+        return point_indices_.data() + offsets_[v + 1];
+    }
+
+public:
+    /// Indices of the occupied voxels.
+    std::vector<Eigen::Vector3i> voxel_indices_;
+    /// The points in voxel v are point_indices_[offsets_[v]] to
+    /// point_indices_[offsets_[v + 1] - 1].
+    std::vector<size_t> offsets_;
+    /// Point indices ordered by voxel.
+    std::vector<int> point_indices_;
+};
+
+}  // namespace geometry
+}  // namespace open3d
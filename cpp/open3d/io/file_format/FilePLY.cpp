@@ -31,7 +31,9 @@
 #include "open3d/io/PointCloudIO.h"
 #include "open3d/io/TriangleMeshIO.h"
 #include "open3d/io/VoxelGridIO.h"
+#include "open3d/io/file_format/PLYBinaryReader.h"
 #include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
 #include "open3d/utility/ProgressBar.h"
 #include "open3d/utility/ProgressReporters.h"
 
@@ -358,6 +360,126 @@ int ReadColorCallback(p_ply_argument argument) {
 
 }  // namespace ply_voxelgrid_reader
 
+namespace ply_binary_reader {
+
+/// Returns how many of the scalar properties \p names exist in \p element.
+int CountScalarProperties(const ply::PLYElement &element,
+                          const std::vector<std::string> &names) {
+    int count = 0;
+    for (const std::string &name : names) {
+        const int idx = element.FindProperty(name);
+        if (idx >= 0 && !element.properties_[idx].IsList()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/// Returns true if the vertices of \p reader can be decoded in bulk. Files
+/// with partial attributes, e.g. only "nx" and "ny", are left to rply so
+/// they are read exactly as before.
+bool CanReadVertices(const ply::PLYBinaryReader &reader) {
+    const ply::PLYElement *vertex = reader.FindElement("vertex");
+    if (vertex == nullptr || vertex->size_ <= 0) {
+        return false;
+    }
+    const int num_normals = CountScalarProperties(*vertex, {"nx", "ny", "nz"});
+    const int num_colors =
+            CountScalarProperties(*vertex, {"red", "green", "blue"});
+    return CountScalarProperties(*vertex, {"x", "y", "z"}) == 3 &&
+           (num_normals == 0 || num_normals == 3) &&
+           (num_colors == 0 || num_colors == 3);
+}
+
+bool ReadVector3(ply::PLYBinaryReader &reader,
+                 const std::vector<std::string> &names,
+                 std::vector<Eigen::Vector3d> &dst,
+                 double scale = 1.0) {
+    const ply::PLYElement *vertex = reader.FindElement("vertex");
+    if (vertex->FindProperty(names[0]) < 0) {
+        return true;
+    }
+    dst.resize(vertex->size_);
+    for (int k = 0; k < 3; ++k) {
+        if (!reader.ReadProperty<double>("vertex", names[k],
+                                         dst.data()->data() + k, 3, scale)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Decodes positions, normals and colors. Colors are scaled by 1 / 255 as
+/// in the rply callbacks.
+bool ReadVertices(ply::PLYBinaryReader &reader,
+                  std::vector<Eigen::Vector3d> &points,
+                  std::vector<Eigen::Vector3d> &normals,
+                  std::vector<Eigen::Vector3d> &colors,
+                  utility::CountingProgressReporter &reporter) {
+    if (!ReadVector3(reader, {"x", "y", "z"}, points)) {
+        return false;
+    }
+    reporter.Update(points.size());
+    return ReadVector3(reader, {"nx", "ny", "nz"}, normals) &&
+           ReadVector3(reader, {"red", "green", "blue"}, colors, 1.0 / 255.0);
+}
+
+/// Returns the name of the face index list, "" if the file has no faces and
+/// nullptr if the faces cannot be decoded in bulk.
+const char *GetFaceListName(const ply::PLYBinaryReader &reader) {
+    const ply::PLYElement *face = reader.FindElement("face");
+    if (face == nullptr) {
+        return "";
+    }
+    for (const char *name : {"vertex_indices", "vertex_index"}) {
+        const int idx = face->FindProperty(name);
+        if (idx >= 0) {
+            return face->properties_[idx].IsList() ? name : nullptr;
+        }
+    }
+    return "";
+}
+
+bool ReadFaces(ply::PLYBinaryReader &reader,
+               const std::string &list_name,
+               geometry::TriangleMesh &mesh) {
+    std::vector<int64_t> offsets;
+    std::vector<int> indices;
+    if (!reader.ReadList<int>("face", list_name, offsets, indices)) {
+        return false;
+    }
+    const int64_t num_faces = static_cast<int64_t>(offsets.size()) - 1;
+    bool all_triangles = true;
+    for (int64_t i = 0; i < num_faces && all_triangles; ++i) {
+        all_triangles = offsets[i + 1] - offsets[i] == 3;
+    }
+    if (all_triangles) {
+        mesh.triangles_.resize(num_faces);
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_faces; ++i) {
+            mesh.triangles_[i] = Eigen::Vector3i(
+                    indices[3 * i], indices[3 * i + 1], indices[3 * i + 2]);
+        }
+        return true;
+    }
+
+    std::vector<unsigned int> face;
+    for (int64_t i = 0; i < num_faces; ++i) {
+        face.assign(indices.begin() + offsets[i],
+                    indices.begin() + offsets[i + 1]);
+        if (!AddTrianglesByEarClipping(mesh, face)) {
+            utility::LogWarning(
+                    "Read PLY failed: A polygon in the mesh could not be "
+                    "decomposed into triangles.");
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace ply_binary_reader
+
 }  // unnamed namespace
 /// @endcond
 
@@ -399,6 +521,24 @@ bool ReadPointCloudFromPLY(const std::string &filename,
                            const ReadPointCloudOption &params) {
     using namespace ply_pointcloud_reader;
 
+    // Binary files are decoded in bulk from a memory map, everything else
+    // goes through the rply callbacks.
+    ply::PLYBinaryReader reader;
+    if (reader.Open(filename) && ply_binary_reader::CanReadVertices(reader)) {
+        pointcloud.Clear();
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(reader.FindElement("vertex")->size_);
+        if (!ply_binary_reader::ReadVertices(reader, pointcloud.points_,
+                                             pointcloud.normals_,
+                                             pointcloud.colors_, reporter)) {
+            utility::LogWarning("Read PLY failed: unable to read file: {} ({})",
+                                filename, reader.GetError());
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -542,6 +682,34 @@ bool ReadTriangleMeshFromPLY(const std::string &filename,
                              const ReadTriangleMeshOptions &params /*={}*/) {
     using namespace ply_trianglemesh_reader;
 
+    ply::PLYBinaryReader reader;
+    const char *face_list = nullptr;
+    if (reader.Open(filename) && ply_binary_reader::CanReadVertices(reader) &&
+        (face_list = ply_binary_reader::GetFaceListName(reader)) != nullptr) {
+        const ply::PLYElement *face = reader.FindElement("face");
+        const int64_t num_vertices = reader.FindElement("vertex")->size_;
+        const int64_t num_faces =
+                std::string(face_list).empty() ? 0 : face->size_;
+        mesh.Clear();
+        utility::CountingProgressReporter reporter(params.update_progress);
+        reporter.SetTotal(num_vertices + num_faces);
+        if (!ply_binary_reader::ReadVertices(reader, mesh.vertices_,
+                                             mesh.vertex_normals_,
+                                             mesh.vertex_colors_, reporter)) {
+            utility::LogWarning("Read PLY failed: unable to read file: {} ({})",
+                                filename, reader.GetError());
+            return false;
+        }
+        if (num_faces > 0 &&
+            !ply_binary_reader::ReadFaces(reader, face_list, mesh)) {
+            utility::LogWarning("Read PLY failed: unable to read file: {} ({})",
+                                filename, reader.GetError());
+            return false;
+        }
+        reporter.Finish();
+        return true;
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}",
@@ -0,0 +1,619 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/file_format/PLYBinaryReader.h"
+
+#include <cstring>
+#include <sstream>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace io {
+namespace ply {
+
+/// @cond
+namespace {
+
+PLYType ParsePLYType(const std::string &name) {
+    if (name == "char" || name == "int8") return PLYType::Int8;
+    if (name == "uchar" || name == "uint8") return PLYType::UInt8;
+    if (name == "short" || name == "int16") return PLYType::Int16;
+    if (name == "ushort" || name == "uint16") return PLYType::UInt16;
+    if (name == "int" || name == "int32") return PLYType::Int32;
+    if (name == "uint" || name == "uint32") return PLYType::UInt32;
+    if (name == "float" || name == "float32") return PLYType::Float32;
+    if (name == "double" || name == "float64") return PLYType::Float64;
+    return PLYType::Unknown;
+}
+
+bool IsHostLittleEndian() {
+    const uint16_t one = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+/// Loads an unaligned scalar, reversing its bytes if \p swap is set.
+template <typename src_t, bool swap>
+inline src_t Load(const uint8_t *ptr) {
+    src_t value;
+    if (swap) {
+        uint8_t bytes[sizeof(src_t)];
+        for (size_t k = 0; k < sizeof(src_t); ++k) {
+            bytes[k] = ptr[sizeof(src_t) - 1 - k];
+        }
+        std::memcpy(&value, bytes, sizeof(src_t));
+    } else {
+        std::memcpy(&value, ptr, sizeof(src_t));
+    }
+    return value;
+}
+
+/// Calls f with a value of the C++ type corresponding to \p type.
+template <typename func_t>
+void DispatchPLYType(PLYType type, func_t f) {
+    switch (type) {
+        case PLYType::Int8:
+            f(int8_t());
+            break;
+        case PLYType::UInt8:
+            f(uint8_t());
+            break;
+        case PLYType::Int16:
+            f(int16_t());
+            break;
+        case PLYType::UInt16:
+            f(uint16_t());
+            break;
+        case PLYType::Int32:
+            f(int32_t());
+            break;
+        case PLYType::UInt32:
+            f(uint32_t());
+            break;
+        case PLYType::Float32:
+            f(float());
+            break;
+        case PLYType::Float64:
+            f(double());
+            break;
+        default:
+            utility::LogError("Unknown PLY type.");
+    }
+}
+
+int64_t LoadCount(const uint8_t *ptr, PLYType type, bool swap) {
+    int64_t count = 0;
+    DispatchPLYType(type, [&](auto tag) {
+        using src_t = decltype(tag);
+        count = swap ? static_cast<int64_t>(Load<src_t, true>(ptr))
+                     : static_cast<int64_t>(Load<src_t, false>(ptr));
+    });
+    return count;
+}
+
+template <typename src_t, typename dst_t, bool swap, typename row_ptr_t>
+void DecodeScalars(int64_t num_rows,
+                   row_ptr_t row_ptr,
+                   dst_t *dst,
+                   int64_t dst_stride,
+                   double scale) {
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+    for (int64_t i = 0; i < num_rows; ++i) {
+        const src_t value = Load<src_t, swap>(row_ptr(i));
+        dst[i * dst_stride] =
+                static_cast<dst_t>(static_cast<double>(value) * scale);
+    }
+}
+
+}  // unnamed namespace
+/// @endcond
+
+int64_t GetPLYTypeSize(PLYType type) {
+    switch (type) {
+        case PLYType::Int8:
+        case PLYType::UInt8:
+            return 1;
+        case PLYType::Int16:
+        case PLYType::UInt16:
+            return 2;
+        case PLYType::Int32:
+        case PLYType::UInt32:
+        case PLYType::Float32:
+            return 4;
+        case PLYType::Float64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+std::string GetPLYTypeName(PLYType type) {
+    switch (type) {
+        case PLYType::Int8:
+            return "int8";
+        case PLYType::UInt8:
+            return "uint8";
+        case PLYType::Int16:
+            return "int16";
+        case PLYType::UInt16:
+            return "uint16";
+        case PLYType::Int32:
+            return "int32";
+        case PLYType::UInt32:
+            return "uint32";
+        case PLYType::Float32:
+            return "float32";
+        case PLYType::Float64:
+            return "float64";
+        default:
+            return "unknown";
+    }
+}
+
+int PLYElement::FindProperty(const std::string &name) const {
+    for (size_t i = 0; i < properties_.size(); ++i) {
+        if (properties_[i].name_ == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+bool PLYBinaryReader::Open(const std::string &filename) {
+    file_.Close();
+    data_ = nullptr;
+    size_ = 0;
+    elements_.clear();
+    layouts_.clear();
+    error_.clear();
+
+    if (!file_.Open(filename)) {
+        error_ = file_.GetError();
+        return false;
+    }
+    data_ = static_cast<const uint8_t *>(file_.GetData());
+    size_ = static_cast<int64_t>(file_.GetSize());
+    if (!ParseHeader()) {
+        file_.Close();
+        return false;
+    }
+    layouts_.resize(elements_.size());
+    return true;
+}
+
+bool PLYBinaryReader::ParseHeader() {
+    const char *text = reinterpret_cast<const char *>(data_);
+    int64_t pos = 0;
+    bool has_format = false;
+    bool first_line = true;
+    while (pos < size_) {
+        const void *newline = std::memchr(text + pos, '\n', size_ - pos);
+        if (newline == nullptr) {
+            break;
+        }
+        const int64_t end = static_cast<const char *>(newline) - text;
+        std::string line(text + pos, end - pos);
+        pos = end + 1;
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+
+        std::istringstream iss(line);
+        std::string keyword;
+        iss >> keyword;
+        if (first_line) {
+            if (keyword != "ply") {
+                error_ = "not a PLY file";
+                return false;
+            }
+            first_line = false;
+        } else if (keyword == "format") {
+            std::string format;
+            iss >> format;
+            if (format == "binary_little_endian") {
+                swap_bytes_ = !IsHostLittleEndian();
+            } else if (format == "binary_big_endian") {
+                swap_bytes_ = IsHostLittleEndian();
+            } else {
+                error_ = "unsupported format " + format;
+                return false;
+            }
+            has_format = true;
+        } else if (keyword == "element") {
+            PLYElement element;
+            if (!(iss >> element.name_ >> element.size_) ||
+                element.size_ < 0) {
+                error_ = "malformed element: " + line;
+                return false;
+            }
+            elements_.push_back(element);
+        } else if (keyword == "property") {
+            if (elements_.empty()) {
+                error_ = "property before element: " + line;
+                return false;
+            }
+            PLYProperty property;
+            std::string type;
+            iss >> type;
+            if (type == "list") {
+                std::string count_type, item_type;
+                iss >> count_type >> item_type;
+                property.count_type_ = ParsePLYType(count_type);
+                property.type_ = ParsePLYType(item_type);
+                if (property.count_type_ == PLYType::Unknown) {
+                    error_ = "unknown type: " + line;
+                    return false;
+                }
+            } else {
+                property.type_ = ParsePLYType(type);
+            }
+            if (property.type_ == PLYType::Unknown ||
+                !(iss >> property.name_)) {
+                error_ = "malformed property: " + line;
+                return false;
+            }
+            elements_.back().properties_.push_back(property);
+        } else if (keyword == "end_header") {
+            if (!has_format) {
+                error_ = "missing format";
+                return false;
+            }
+            payload_begin_ = pos;
+            return true;
+        } else if (keyword != "comment" && keyword != "obj_info" &&
+                   !keyword.empty()) {
+            error_ = "unknown header keyword " + keyword;
+            return false;
+        }
+    }
+    error_ = "missing end_header";
+    return false;
+}
+
+const PLYElement *PLYBinaryReader::FindElement(const std::string &name) const {
+    for (const PLYElement &element : elements_) {
+        if (element.name_ == name) {
+            return &element;
+        }
+    }
+    return nullptr;
+}
+
+bool PLYBinaryReader::Locate(size_t element_idx) {
+    for (size_t i = 0; i <= element_idx; ++i) {
+        Layout &layout = layouts_[i];
+        if (layout.located_) {
+            continue;
+        }
+        layout.begin_ = i == 0 ? payload_begin_ : layouts_[i - 1].end_;
+        if (!ComputeLayout(elements_[i], layout)) {
+            return false;
+        }
+        layout.located_ = true;
+    }
+    return true;
+}
+
+bool PLYBinaryReader::ComputeLayout(const PLYElement &element,
+                                    Layout &layout) {
+    const int64_t num_rows = element.size_;
+    const size_t num_properties = element.properties_.size();
+    layout.property_offsets_.assign(num_properties, 0);
+    layout.list_counts_.assign(num_properties, 0);
+    if (num_rows == 0) {
+        layout.end_ = layout.begin_;
+        layout.uniform_ = true;
+        return true;
+    }
+
+    // The first row gives the row stride if every row has the same list
+    // lengths, which is the common case of e.g. triangle-only meshes.
+    bool has_list = false;
+    int64_t stride = 0;
+    for (size_t k = 0; k < num_properties; ++k) {
+        const PLYProperty &property = element.properties_[k];
+        layout.property_offsets_[k] = stride;
+        if (property.IsList()) {
+            has_list = true;
+            const int64_t count_size = GetPLYTypeSize(property.count_type_);
+            const int64_t item_size = GetPLYTypeSize(property.type_);
+            if (count_size > size_ - layout.begin_ - stride) {
+                error_ = "unexpected end of file";
+                return false;
+            }
+            const int64_t count = LoadCount(data_ + layout.begin_ + stride,
+                                            property.count_type_, swap_bytes_);
+            if (count < 0) {
+                error_ = "negative list length";
+                return false;
+            }
+            stride += count_size;
+            if (count > (size_ - layout.begin_ - stride) / item_size) {
+                error_ = "unexpected end of file";
+                return false;
+            }
+            layout.list_counts_[k] = count;
+            stride += count * item_size;
+        } else {
+            stride += GetPLYTypeSize(property.type_);
+        }
+    }
+
+    // Every row holds at least its scalars and list counts, which bounds the
+    // number of rows without computing a possibly overflowing end offset.
+    int64_t min_row_size = 0;
+    for (const PLYProperty &property : element.properties_) {
+        min_row_size += GetPLYTypeSize(property.IsList() ? property.count_type_
+                                                         : property.type_);
+    }
+    if (min_row_size > 0 &&
+        num_rows > (size_ - layout.begin_) / min_row_size) {
+        error_ = "unexpected end of file";
+        return false;
+    }
+    if (!has_list) {
+        layout.uniform_ = true;
+        layout.row_stride_ = stride;
+        layout.end_ = layout.begin_ + num_rows * stride;
+        return true;
+    }
+
+    // Walk the rows once, checking the list lengths of every row against
+    // the first one. Rows are only given an offset table after the first
+    // mismatch, as the rows before it are at multiples of the stride.
+    layout.uniform_ = true;
+    int64_t offset = layout.begin_;
+    for (int64_t i = 0; i < num_rows; ++i) {
+        if (!layout.uniform_) {
+            layout.row_offsets_[i] = offset;
+        }
+        for (size_t k = 0; k < num_properties; ++k) {
+            const PLYProperty &property = element.properties_[k];
+            if (!property.IsList()) {
+                offset += GetPLYTypeSize(property.type_);
+                continue;
+            }
+            const int64_t count_size = GetPLYTypeSize(property.count_type_);
+            const int64_t item_size = GetPLYTypeSize(property.type_);
+            if (count_size > size_ - offset) {
+                error_ = "unexpected end of file";
+                return false;
+            }
+            const int64_t count = LoadCount(data_ + offset,
+                                            property.count_type_, swap_bytes_);
+            if (count < 0) {
+                error_ = "negative list length";
+                return false;
+            }
+            offset += count_size;
+            if (count > (size_ - offset) / item_size) {
+                error_ = "unexpected end of file";
+                return false;
+            }
+            offset += count * item_size;
+            if (layout.uniform_ && count != layout.list_counts_[k]) {
+                layout.uniform_ = false;
+                layout.row_offsets_.resize(num_rows + 1);
+                for (int64_t j = 0; j <= i; ++j) {
+                    layout.row_offsets_[j] = layout.begin_ + j * stride;
+                }
+            }
+        }
+    }
+    if (offset > size_) {
+        error_ = "unexpected end of file";
+        return false;
+    }
+    if (layout.uniform_) {
+        layout.row_stride_ = stride;
+    } else {
+        layout.row_offsets_[num_rows] = offset;
+    }
+    layout.end_ = offset;
+    return true;
+}
+
+const uint8_t *PLYBinaryReader::GetRowPropertyPtr(size_t element_idx,
+                                                  int64_t row,
+                                                  int property_idx) const {
+    const Layout &layout = layouts_[element_idx];
+    if (layout.uniform_) {
+        return data_ + layout.begin_ + row * layout.row_stride_ +
+               layout.property_offsets_[property_idx];
+    }
+    const PLYElement &element = elements_[element_idx];
+    const uint8_t *ptr = data_ + layout.row_offsets_[row];
+    for (int k = 0; k < property_idx; ++k) {
+        const PLYProperty &property = element.properties_[k];
+        if (property.IsList()) {
+            const int64_t count =
+                    LoadCount(ptr, property.count_type_, swap_bytes_);
+            ptr += GetPLYTypeSize(property.count_type_) +
+                   count * GetPLYTypeSize(property.type_);
+        } else {
+            ptr += GetPLYTypeSize(property.type_);
+        }
+    }
+    return ptr;
+}
+
+bool PLYBinaryReader::LookUp(const std::string &element,
+                             const std::string &property,
+                             bool list,
+                             size_t &element_idx,
+                             int &property_idx) {
+    for (element_idx = 0; element_idx < elements_.size(); ++element_idx) {
+        if (elements_[element_idx].name_ == element) break;
+    }
+    if (element_idx == elements_.size()) {
+        error_ = "no element " + element;
+        return false;
+    }
+    property_idx = elements_[element_idx].FindProperty(property);
+    if (property_idx < 0) {
+        error_ = "no property " + property + " in element " + element;
+        return false;
+    }
+    if (elements_[element_idx].properties_[property_idx].IsList() != list) {
+        error_ = "property " + property + (list ? " is not" : " is") +
+                 " a list";
+        return false;
+    }
+    return Locate(element_idx);
+}
+
+template <typename T>
+bool PLYBinaryReader::ReadProperty(const std::string &element,
+                                   const std::string &property,
+                                   T *dst,
+                                   int64_t dst_stride,
+                                   double scale) {
+    size_t element_idx;
+    int property_idx;
+    if (!LookUp(element, property, false, element_idx, property_idx)) {
+        return false;
+    }
+    const Layout &layout = layouts_[element_idx];
+    const int64_t num_rows = elements_[element_idx].size_;
+    const PLYType type =
+            elements_[element_idx].properties_[property_idx].type_;
+    DispatchPLYType(type, [&](auto tag) {
+        using src_t = decltype(tag);
+        if (layout.uniform_) {
+            const uint8_t *base = data_ + layout.begin_ +
+                                  layout.property_offsets_[property_idx];
+            const int64_t stride = layout.row_stride_;
+            auto row_ptr = [base, stride](int64_t i) {
+                return base + i * stride;
+            };
+            if (swap_bytes_) {
+                DecodeScalars<src_t, T, true>(num_rows, row_ptr, dst,
+                                              dst_stride, scale);
+            } else {
+                DecodeScalars<src_t, T, false>(num_rows, row_ptr, dst,
+                                               dst_stride, scale);
+            }
+        } else {
+            auto row_ptr = [this, element_idx, property_idx](int64_t i) {
+                return GetRowPropertyPtr(element_idx, i, property_idx);
+            };
+            if (swap_bytes_) {
+                DecodeScalars<src_t, T, true>(num_rows, row_ptr, dst,
+                                              dst_stride, scale);
+            } else {
+                DecodeScalars<src_t, T, false>(num_rows, row_ptr, dst,
+                                               dst_stride, scale);
+            }
+        }
+    });
+    return true;
+}
+
+template <typename T>
+bool PLYBinaryReader::ReadList(const std::string &element,
+                               const std::string &property,
+                               std::vector<int64_t> &offsets,
+                               std::vector<T> &values) {
+    size_t element_idx;
+    int property_idx;
+    if (!LookUp(element, property, true, element_idx, property_idx)) {
+        return false;
+    }
+    const Layout &layout = layouts_[element_idx];
+    const int64_t num_rows = elements_[element_idx].size_;
+    const PLYProperty &list =
+            elements_[element_idx].properties_[property_idx];
+    const int64_t count_size = GetPLYTypeSize(list.count_type_);
+    const int64_t item_size = GetPLYTypeSize(list.type_);
+
+    offsets.resize(num_rows + 1);
+    if (layout.uniform_) {
+        const int64_t count = layout.list_counts_[property_idx];
+        for (int64_t i = 0; i <= num_rows; ++i) {
+            offsets[i] = i * count;
+        }
+    } else {
+        offsets[0] = 0;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_rows; ++i) {
+            offsets[i + 1] =
+                    LoadCount(GetRowPropertyPtr(element_idx, i, property_idx),
+                              list.count_type_, swap_bytes_);
+        }
+        for (int64_t i = 0; i < num_rows; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+    }
+    values.resize(offsets[num_rows]);
+
+    DispatchPLYType(list.type_, [&](auto tag) {
+        using src_t = decltype(tag);
+        const bool swap = swap_bytes_;
+#pragma omp parallel for schedule(static) \
+        num_threads(utility::EstimateMaxThreads())
+        for (int64_t i = 0; i < num_rows; ++i) {
+            const uint8_t *ptr =
+                    GetRowPropertyPtr(element_idx, i, property_idx) +
+                    count_size;
+            for (int64_t j = offsets[i]; j < offsets[i + 1]; ++j) {
+                const src_t value = swap ? Load<src_t, true>(ptr)
+                                         : Load<src_t, false>(ptr);
+                values[j] = static_cast<T>(value);
+                ptr += item_size;
+            }
+        }
+    });
+    return true;
+}
+
+#define INSTANTIATE_PLY_READ(T)                                              \
+    template bool PLYBinaryReader::ReadProperty<T>(                          \
+            const std::string &, const std::string &, T *, int64_t, double); \
+    template bool PLYBinaryReader::ReadList<T>(                              \
+            const std::string &, const std::string &, std::vector<int64_t> &, \
+            std::vector<T> &);
+
+INSTANTIATE_PLY_READ(int8_t)
+INSTANTIATE_PLY_READ(uint8_t)
+INSTANTIATE_PLY_READ(int16_t)
+INSTANTIATE_PLY_READ(uint16_t)
+INSTANTIATE_PLY_READ(int32_t)
+INSTANTIATE_PLY_READ(uint32_t)
+INSTANTIATE_PLY_READ(int64_t)
+INSTANTIATE_PLY_READ(uint64_t)
+INSTANTIATE_PLY_READ(float)
+INSTANTIATE_PLY_READ(double)
+
+#undef INSTANTIATE_PLY_READ
+
+}  // namespace ply
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,169 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "open3d/utility/FileSystem.h"
+
+namespace open3d {
+namespace io {
+namespace ply {
+
+/// Scalar types of the PLY format. Aliases such as "uchar" and "uint8" map
+/// to the same type.
+enum class PLYType {
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float32,
+    Float64,
+    Unknown,
+};
+
+/// Returns the size of \p type in bytes, or 0 for PLYType::Unknown.
+int64_t GetPLYTypeSize(PLYType type);
+
+/// Returns the canonical name of \p type, e.g. "float32".
+std::string GetPLYTypeName(PLYType type);
+
+struct PLYProperty {
+    std::string name_;
+    /// Type of the value, or of the list items for list properties.
+    PLYType type_ = PLYType::Unknown;
+    /// Type of the item count for list properties, Unknown otherwise.
+    PLYType count_type_ = PLYType::Unknown;
+
+    bool IsList() const { return count_type_ != PLYType::Unknown; }
+};
+
+struct PLYElement {
+    std::string name_;
+    int64_t size_ = 0;
+    std::vector<PLYProperty> properties_;
+
+    /// Returns the index of property \p name, or -1 if it does not exist.
+    int FindProperty(const std::string &name) const;
+};
+
+/// \class PLYBinaryReader
+///
+/// \brief Bulk reader for binary PLY files.
+///
+/// The header is parsed directly and the payload is memory mapped, so whole
+/// element blocks are decoded in parallel into caller-provided buffers
+/// instead of through one rply callback per scalar. Properties that are not
+/// requested are never touched. Only binary little and big endian files are
+/// handled; Open() fails for ASCII files so callers can fall back to rply.
+class PLYBinaryReader {
+public:
+    PLYBinaryReader() = default;
+    PLYBinaryReader(const PLYBinaryReader &) = delete;
+    PLYBinaryReader &operator=(const PLYBinaryReader &) = delete;
+
+    /// Maps \p filename and parses its header. Returns false if the file
+    /// cannot be mapped, the header is malformed or the payload is ASCII.
+    bool Open(const std::string &filename);
+
+    /// Returns a description of the last error.
+    std::string GetError() const { return error_; }
+
+    const std::vector<PLYElement> &GetElements() const { return elements_; }
+
+    /// Returns element \p name, or nullptr if it does not exist.
+    const PLYElement *FindElement(const std::string &name) const;
+
+    /// \brief Decodes scalar property \p property of element \p element.
+    ///
+    /// Row i is written to dst[i * dst_stride] after converting to T and
+    /// multiplying by \p scale. Returns false if the property does not exist,
+    /// is a list or the payload is truncated.
+    template <typename T>
+    bool ReadProperty(const std::string &element,
+                      const std::string &property,
+                      T *dst,
+                      int64_t dst_stride,
+                      double scale = 1.0);
+
+    /// \brief Decodes list property \p property of element \p element.
+    ///
+    /// The items of row i are stored in values[offsets[i]:offsets[i + 1]],
+    /// i.e. \p offsets has one entry more than the element has rows.
+    template <typename T>
+    bool ReadList(const std::string &element,
+                  const std::string &property,
+                  std::vector<int64_t> &offsets,
+                  std::vector<T> &values);
+
+private:
+    /// Byte layout of an element in the payload.
+    struct Layout {
+        bool located_ = false;
+        int64_t begin_ = 0;
+        int64_t end_ = 0;
+        /// True if all rows have the same size, i.e. the element has no
+        /// lists or every row has the same list lengths.
+        bool uniform_ = false;
+        int64_t row_stride_ = 0;
+        /// Offsets of the properties within a row, valid if uniform_.
+        std::vector<int64_t> property_offsets_;
+        /// List lengths of the first row, valid if uniform_.
+        std::vector<int64_t> list_counts_;
+        /// Start of every row relative to the payload, valid if !uniform_.
+        std::vector<int64_t> row_offsets_;
+    };
+
+    bool ParseHeader();
+    bool Locate(size_t element_idx);
+    bool ComputeLayout(const PLYElement &element, Layout &layout);
+    const uint8_t *GetRowPropertyPtr(size_t element_idx,
+                                     int64_t row,
+                                     int property_idx) const;
+    bool LookUp(const std::string &element,
+                const std::string &property,
+                bool list,
+                size_t &element_idx,
+                int &property_idx);
+
+    utility::filesystem::MappedFile file_;
+    const uint8_t *data_ = nullptr;
+    int64_t size_ = 0;
+    int64_t payload_begin_ = 0;
+    bool swap_bytes_ = false;
+    std::vector<PLYElement> elements_;
+    std::vector<Layout> layouts_;
+    std::string error_;
+};
+
+}  // namespace ply
+}  // namespace io
+}  // namespace open3d
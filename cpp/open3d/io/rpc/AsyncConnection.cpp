@@ -0,0 +1,199 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/AsyncConnection.h"
+
+#include <algorithm>
+#include <zmq.hpp>
+
+#include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
+#include "open3d/io/rpc/ZMQContext.h"
+#include "open3d/utility/Logging.h"
+
+using namespace open3d::utility;
+
+namespace {
+
+std::shared_ptr<zmq::message_t> CreateStatusMessage(
+        const open3d::io::rpc::messages::Status& status) {
+    msgpack::sbuffer sbuf;
+    open3d::io::rpc::messages::Reply reply{status.MsgId()};
+    msgpack::pack(sbuf, reply);
+    msgpack::pack(sbuf, status);
+    return std::make_shared<zmq::message_t>(sbuf.data(), sbuf.size());
+}
+
+}  // namespace
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+AsyncConnection::AsyncConnection(const std::string& address,
+                                 int connect_timeout,
+                                 int timeout,
+                                 int max_in_flight,
+                                 bool use_compression)
+    : context_(GetZMQContext()),
+      address_(address),
+      connect_timeout_(connect_timeout),
+      timeout_(timeout),
+      max_in_flight_(std::max(1, max_in_flight)),
+      use_compression_(use_compression) {
+    Connect();
+}
+
+AsyncConnection::~AsyncConnection() {
+    Flush();
+    socket_->close();
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(
+        zmq::message_t& send_msg) {
+    std::vector<zmq::message_t> parts(1);
+    parts[0].move(send_msg);
+    return SendMultipart(parts);
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::Send(const void* data,
+                                                      size_t size) {
+    zmq::message_t send_msg(data, size);
+    return Send(send_msg);
+}
+
+std::shared_ptr<zmq::message_t> AsyncConnection::SendMultipart(
+        std::vector<zmq::message_t>& parts) {
+    // Collect replies that already arrived, then make room in the window.
+    while (num_in_flight_ > 0 && ReceiveReply(false)) {
+    }
+    while (num_in_flight_ >= max_in_flight_) {
+        ReceiveReply(true);
+    }
+
+    // The empty delimiter frame makes the message look like it came from a
+    // REQ socket to the REP socket of the receiver.
+    zmq::message_t delimiter;
+    bool sent = bool(socket_->send(delimiter, zmq::send_flags::sndmore));
+    for (size_t i = 0; sent && i < parts.size(); ++i) {
+        sent = bool(socket_->send(parts[i], i + 1 < parts.size()
+                                                    ? zmq::send_flags::sndmore
+                                                    : zmq::send_flags::none));
+    }
+    if (!sent) {
+        LogInfo("AsyncConnection::SendMultipart() send failed");
+        // The socket may hold an incomplete multipart message, which would
+        // be completed by the parts of the next message.
+        Reset();
+        auto status = messages::Status::ErrorProcessingMessage();
+        status.str = "send failed";
+        return CreateStatusMessage(status);
+    }
+    ++num_in_flight_;
+
+    if (error_reply_) {
+        std::shared_ptr<zmq::message_t> reply;
+        std::swap(reply, error_reply_);
+        return reply;
+    }
+    return CreateStatusOKMsg();
+}
+
+bool AsyncConnection::Flush() {
+    while (num_in_flight_ > 0) {
+        ReceiveReply(true);
+    }
+    error_reply_.reset();
+    const bool ok = ok_;
+    ok_ = true;
+    return ok;
+}
+
+bool AsyncConnection::ReceiveReply(bool wait) {
+    // Replies consist of the empty delimiter frame and the reply.
+    auto reply = std::make_shared<zmq::message_t>();
+    if (!socket_->recv(*reply, wait ? zmq::recv_flags::none
+                                    : zmq::recv_flags::dontwait)) {
+        if (wait) {
+            // Replies are not matched to their messages, so a late reply
+            // could not be told apart from the reply of a later message.
+            // Give up on all messages in flight and start over instead.
+            LogInfo("AsyncConnection: no reply within {} ms", timeout_);
+            auto status = messages::Status::ErrorProcessingMessage();
+            status.str = "no reply within timeout";
+            SetError(CreateStatusMessage(status));
+            Reset();
+        }
+        return false;
+    }
+    while (reply->more()) {
+        if (!socket_->recv(*reply)) break;
+    }
+    --num_in_flight_;
+
+    // A reply may contain the status of several chained messages.
+    size_t offset = 0;
+    do {
+        if (!ReplyIsOKStatus(*reply, offset)) {
+            SetError(reply);
+            break;
+        }
+    } while (offset < reply->size());
+    return true;
+}
+
+void AsyncConnection::Connect() {
+    socket_.reset(new zmq::socket_t(*context_, ZMQ_DEALER));
+    socket_->set(zmq::sockopt::linger, timeout_);
+    socket_->set(zmq::sockopt::connect_timeout, connect_timeout_);
+    socket_->set(zmq::sockopt::rcvtimeo, timeout_);
+    socket_->set(zmq::sockopt::sndtimeo, timeout_);
+    socket_->connect(address_.c_str());
+}
+
+void AsyncConnection::Reset() {
+    if (num_in_flight_ > 0) {
+        LogInfo("AsyncConnection: reconnecting, {} messages lost",
+                num_in_flight_);
+        ok_ = false;
+    }
+    // Drop pending messages of the old socket instead of lingering.
+    socket_->set(zmq::sockopt::linger, 0);
+    socket_->close();
+    Connect();
+    num_in_flight_ = 0;
+}
+
+void AsyncConnection::SetError(std::shared_ptr<zmq::message_t> reply) {
+    ok_ = false;
+    if (!error_reply_) {
+        error_reply_ = reply;
+    }
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "open3d/io/rpc/ConnectionBase.h"
+
+namespace zmq {
+class context_t;
+}  // namespace zmq
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+/// Connection for streaming data without waiting for each reply.
+///
+/// Unlike Connection, which waits for the reply of every message, this class
+/// keeps up to \p max_in_flight messages in flight and only blocks when the
+/// window is full. Messages are sent as multipart messages, so payloads that
+/// reference tensor memory are not copied. The receiver must be a
+/// ZMQReceiver, which accepts multipart messages.
+///
+/// Since replies arrive later, Send() returns an OK status unless a reply
+/// that arrived in the meantime reported an error. Call Flush() to wait for
+/// all outstanding replies. If a reply does not arrive within the timeout or
+/// a send fails, the socket is reconnected and the messages in flight are
+/// reported as failed.
+class AsyncConnection : public ConnectionBase {
+public:
+    /// Creates an AsyncConnection object used for sending data.
+    /// \param address          The address of the receiving end.
+    ///
+    /// \param connect_timeout  The timeout for the connect operation of the
+    /// socket.
+    ///
+    /// \param timeout          The timeout for sending data and for waiting
+    /// for a reply.
+    ///
+    /// \param max_in_flight    The maximum number of messages that have been
+    /// sent but not yet acknowledged by the receiver.
+    ///
+    /// \param use_compression  If true, large arrays are compressed with LZF
+    /// before sending.
+    AsyncConnection(const std::string& address = "tcp://127.0.0.1:51454",
+                    int connect_timeout = 5000,
+                    int timeout = 10000,
+                    int max_in_flight = 8,
+                    bool use_compression = false);
+    ~AsyncConnection();
+
+    /// Function for sending data wrapped in a zmq message object.
+    std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) override;
+
+    /// Function for sending raw data. Meant for testing purposes
+    std::shared_ptr<zmq::message_t> Send(const void* data,
+                                         size_t size) override;
+
+    std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& parts) override;
+
+    bool UseCompression() const override { return use_compression_; }
+
+    /// Waits for the replies of all messages in flight. Returns false if a
+    /// reply received since the last call to Flush() was not OK or did not
+    /// arrive within the timeout.
+    bool Flush();
+
+    /// Returns the number of messages that have not been acknowledged yet.
+    int GetNumInFlight() const { return num_in_flight_; }
+
+private:
+    /// Receives one reply. If \p wait is false, returns false immediately if
+    /// no reply is available.
+    bool ReceiveReply(bool wait);
+    /// Creates the socket and connects it to the address.
+    void Connect();
+    /// Closes the socket, dropping all messages in flight, and reconnects.
+    void Reset();
+    void SetError(std::shared_ptr<zmq::message_t> reply);
+
+    std::shared_ptr<zmq::context_t> context_;
+    std::unique_ptr<zmq::socket_t> socket_;
+    const std::string address_;
+    const int connect_timeout_;
+    const int timeout_;
+    const int max_in_flight_;
+    const bool use_compression_;
+    int num_in_flight_ = 0;
+    /// True if all replies since the last Flush() were OK.
+    bool ok_ = true;
+    /// The first failed reply that has not been returned by Send() yet.
+    std::shared_ptr<zmq::message_t> error_reply_;
+};
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
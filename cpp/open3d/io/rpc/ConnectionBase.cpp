@@ -0,0 +1,56 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/io/rpc/ConnectionBase.h"
+
+#include <cstring>
+#include <zmq.hpp>
+
+namespace open3d {
+namespace io {
+namespace rpc {
+
+std::shared_ptr<zmq::message_t> ConnectionBase::SendMultipart(
+        std::vector<zmq::message_t>& parts) {
+    if (parts.size() == 1) {
+        return Send(parts[0]);
+    }
+    size_t size = 0;
+    for (const auto& part : parts) {
+        size += part.size();
+    }
+    zmq::message_t send_msg(size);
+    size_t offset = 0;
+    for (const auto& part : parts) {
+        memcpy((char*)send_msg.data() + offset, part.data(), part.size());
+        offset += part.size();
+    }
+    return Send(send_msg);
+}
+
+}  // namespace rpc
+}  // namespace io
+}  // namespace open3d
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 namespace zmq {
 class message_t;
@@ -47,6 +48,16 @@ public:
     virtual std::shared_ptr<zmq::message_t> Send(zmq::message_t& send_msg) = 0;
     virtual std::shared_ptr<zmq::message_t> Send(const void* data,
                                                  size_t size) = 0;
+
+    /// Function for sending a message that is split into several parts, e.g.
+    /// small headers and large payloads that reference memory of the caller.
+    /// The default implementation concatenates the parts and calls Send().
+    /// The parts must not be used after calling this function.
+    virtual std::shared_ptr<zmq::message_t> SendMultipart(
+            std::vector<zmq::message_t>& parts);
+
+    /// Returns true if large arrays should be compressed before sending.
+    virtual bool UseCompression() const { return false; }
 };
 }  // namespace rpc
 }  // namespace io
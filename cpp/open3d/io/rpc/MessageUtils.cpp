@@ -26,6 +26,9 @@
 
 #include "open3d/io/rpc/MessageUtils.h"
 
+#include <liblzf/lzf.h>
+
+#include <limits>
 #include <zmq.hpp>
 
 #include "open3d/io/rpc/Messages.h"
@@ -109,38 +112,165 @@ std::shared_ptr<zmq::message_t> CreateStatusOKMsg() {
             new zmq::message_t(sbuf.data(), sbuf.size()));
 }
 
+/// Returns the dtype of the type string \p ts, e.g. core::Float32 for "<f4",
+/// or core::Undefined if it is not a supported type.
+static core::Dtype TypeStrToDtype(const std::string& ts) {
+    if ("<f4" == ts) {
+        return core::Float32;
+    } else if ("<f8" == ts) {
+        return core::Float64;
+    } else if ("|i1" == ts) {
+        return core::Int8;
+    } else if ("<i2" == ts) {
+        return core::Int16;
+    } else if ("<i4" == ts) {
+        return core::Int32;
+    } else if ("<i8" == ts) {
+        return core::Int64;
+    } else if ("|u1" == ts) {
+        return core::UInt8;
+    } else if ("<u2" == ts) {
+        return core::UInt16;
+    } else if ("<u4" == ts) {
+        return core::UInt32;
+    } else if ("<u8" == ts) {
+        return core::UInt64;
+    }
+    return core::Undefined;
+}
+
+/// Returns the size of the decompressed data of \p array in bytes, or -1 if
+/// the array cannot be decompressed. The reason is appended to \p errstr.
+static int64_t GetDecompressedNumBytes(const messages::Array& array,
+                                       std::string& errstr) {
+    if (array.compression != "lzf") {
+        errstr += " unsupported compression " + array.compression;
+        return -1;
+    }
+    const core::Dtype dtype = TypeStrToDtype(array.type);
+    if (dtype == core::Undefined) {
+        errstr += " unsupported array type " + array.type;
+        return -1;
+    }
+    // lzf sizes are unsigned int, which also bounds the product below.
+    const int64_t max_num_bytes = std::numeric_limits<unsigned int>::max();
+    int64_t num_bytes = dtype.ByteSize();
+    for (int64_t n : array.shape) {
+        if (n < 0) {
+            errstr += " invalid array shape";
+            return -1;
+        }
+        if (n > 0 && num_bytes > max_num_bytes / n) {
+            errstr += " array too large for lzf decompression";
+            return -1;
+        }
+        num_bytes *= n;
+    }
+    return num_bytes;
+}
+
+/// Decompresses the data of \p array into \p dst, which must have space for
+/// \p num_bytes bytes as returned by GetDecompressedNumBytes().
+static bool DecompressArray(const messages::Array& array,
+                            void* dst,
+                            int64_t num_bytes,
+                            std::string& errstr) {
+    if (int64_t(lzf_decompress(array.data.ptr, array.data.size, dst,
+                               static_cast<unsigned int>(num_bytes))) !=
+        num_bytes) {
+        errstr += " decompressing array failed";
+        return false;
+    }
+    return true;
+}
+
+static void CompressArray(messages::Array& array, size_t min_size) {
+    if (!array.compression.empty() || array.data.size < min_size ||
+        array.data.size < 2) {
+        return;
+    }
+    // Only keep the result if it is smaller than the input.
+    auto buffer = std::make_shared<std::vector<char>>(array.data.size - 1);
+    const unsigned int size = lzf_compress(array.data.ptr, array.data.size,
+                                           buffer->data(), buffer->size());
+    if (size == 0) {
+        return;
+    }
+    buffer->resize(size);
+    array.buffer_ = buffer;
+    array.tensor_ = core::Tensor();
+    array.data.ptr = buffer->data();
+    array.data.size = size;
+    array.compression = "lzf";
+}
+
+static bool DecompressArray(messages::Array& array, std::string& errstr) {
+    if (array.compression.empty()) {
+        return true;
+    }
+    const int64_t num_bytes = GetDecompressedNumBytes(array, errstr);
+    if (num_bytes < 0) {
+        return false;
+    }
+    auto buffer = std::make_shared<std::vector<char>>(num_bytes);
+    if (!DecompressArray(array, buffer->data(), num_bytes, errstr)) {
+        return false;
+    }
+    array.buffer_ = buffer;
+    array.data.ptr = buffer->data();
+    array.data.size = uint32_t(buffer->size());
+    array.compression.clear();
+    return true;
+}
+
+/// Calls \p func for all arrays in \p mesh_data.
+template <class Func>
+static void ForEachArray(messages::MeshData& mesh_data, Func func) {
+    func(mesh_data.vertices);
+    func(mesh_data.faces);
+    func(mesh_data.lines);
+    for (auto* attributes :
+         {&mesh_data.vertex_attributes, &mesh_data.face_attributes,
+          &mesh_data.line_attributes, &mesh_data.texture_maps}) {
+        for (auto& item : *attributes) {
+            func(item.second);
+        }
+    }
+}
+
+void CompressArrays(messages::MeshData& mesh_data, size_t min_size) {
+    ForEachArray(mesh_data, [min_size](messages::Array& array) {
+        CompressArray(array, min_size);
+    });
+}
+
+bool DecompressArrays(messages::MeshData& mesh_data, std::string& errstr) {
+    bool ok = true;
+    ForEachArray(mesh_data, [&](messages::Array& array) {
+        ok = ok && DecompressArray(array, errstr);
+    });
+    return ok;
+}
+
 /// Creates a Tensor from an Array. This function also returns a contiguous CPU
 /// Tensor. Note that the msgpack object backing the memory for \p array must be
 /// alive for calling this function.
 static core::Tensor ArrayToTensor(const messages::Array& array) {
-    auto TypeStrToDtype = [](const std::string& ts) {
-        if ("<f4" == ts) {
-            return core::Float32;
-        } else if ("<f8" == ts) {
-            return core::Float64;
-        } else if ("|i1" == ts) {
-            return core::Int8;
-        } else if ("<i2" == ts) {
-            return core::Int16;
-        } else if ("<i4" == ts) {
-            return core::Int32;
-        } else if ("<i8" == ts) {
-            return core::Int64;
-        } else if ("|u1" == ts) {
-            return core::UInt8;
-        } else if ("<u2" == ts) {
-            return core::UInt16;
-        } else if ("<u4" == ts) {
-            return core::UInt32;
-        } else if ("<u8" == ts) {
-            return core::UInt64;
+    const core::Dtype dtype = TypeStrToDtype(array.type);
+    if (dtype == core::Undefined) {
+        LogError("Unsupported type {}. Cannot convert to Tensor.", array.type);
+    }
+    core::Tensor result(array.shape, dtype);
+    if (array.compression.empty()) {
+        memcpy(result.GetDataPtr(), array.data.ptr, array.data.size);
+    } else {
+        std::string errstr;
+        const int64_t num_bytes = GetDecompressedNumBytes(array, errstr);
+        if (num_bytes < 0 ||
+            !DecompressArray(array, result.GetDataPtr(), num_bytes, errstr)) {
+            LogError("ArrayToTensor:{}", errstr);
         }
-        LogError("Unsupported type {}. Cannot convert to Tensor.", ts);
-        return core::Undefined;
-    };
-
-    core::Tensor result(array.shape, TypeStrToDtype(array.type));
-    memcpy(result.GetDataPtr(), array.data.ptr, array.data.size);
+    }
 
     return result;
 }
@@ -382,6 +512,13 @@ DataBufferToMetaGeometry(std::string& data) {
             auto mesh_obj = oh.get();
             messages::SetMeshData msg;
             msg = mesh_obj.as<messages::SetMeshData>();
+            std::string errstr;
+            if (!DecompressArrays(msg.data, errstr)) {
+                LogWarning("DataBufferToMetaGeometry: {}", errstr);
+                return std::forward_as_tuple(
+                        std::string(), 0.,
+                        std::shared_ptr<t::geometry::Geometry>());
+            }
             auto result = MeshDataToGeometry(msg.data);
             double time = msg.time;
             return std::tie(msg.path, time, result);
@@ -83,6 +83,15 @@ std::tuple<int32_t, std::string> GetStatusCodeAndStr(
 
 std::shared_ptr<zmq::message_t> CreateStatusOKMsg();
 
+/// Compresses the data of all arrays in \p mesh_data with at least \p min_size
+/// bytes with LZF. Arrays that do not get smaller are left uncompressed. The
+/// compressed data is owned by the arrays.
+void CompressArrays(messages::MeshData& mesh_data, size_t min_size = 1 << 16);
+
+/// Decompresses all compressed arrays in \p mesh_data in place. Returns false
+/// and appends a description to \p errstr if an array cannot be decompressed.
+bool DecompressArrays(messages::MeshData& mesh_data, std::string& errstr);
+
 /// Converts MeshData to a geometry type. MeshData can store TriangleMesh,
 /// PointCloud, and LineSet. The function returns a pointer to the base class
 /// Geometry. The pointer is null if the conversion is not successful. Note that
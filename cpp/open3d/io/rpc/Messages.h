@@ -29,6 +29,7 @@
 #include <array>
 #include <cstring>
 #include <map>
+#include <memory>
 #include <msgpack.hpp>
 #include <string>
 #include <vector>
@@ -156,10 +157,16 @@ struct Array {
 
     // Object for keeping a reference to the tensor. not meant to be serialized.
     core::Tensor tensor_;
+    // Object for keeping a reference to a compressed or decompressed copy of
+    // the data. not meant to be serialized.
+    std::shared_ptr<std::vector<char>> buffer_;
 
     std::string type;
     std::vector<int64_t> shape;
     msgpack::type::raw_ref data;
+    /// The compression of data. This is either empty for uncompressed data
+    /// or "lzf". Use DecompressArrays() before accessing compressed data.
+    std::string compression;
 
     template <class T>
     const T* Ptr() const {
@@ -267,7 +274,7 @@ struct Array {
     }
 
     // macro for creating the serialization/deserialization code
-    MSGPACK_DEFINE_MAP(type, shape, data);
+    MSGPACK_DEFINE_MAP(type, shape, data, compression);
 };
 
 /// struct for storing MeshData, e.g., PointClouds, TriangleMesh, ..
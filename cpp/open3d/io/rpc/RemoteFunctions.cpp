@@ -27,6 +27,7 @@
 #include "open3d/io/rpc/RemoteFunctions.h"
 
 #include <Eigen/Geometry>
+#include <limits>
 #include <zmq.hpp>
 
 #include "open3d/core/Dispatch.h"
@@ -41,6 +42,66 @@ namespace open3d {
 namespace io {
 namespace rpc {
 
+namespace {
+
+/// Payloads of at least this size are referenced instead of copied when
+/// packing a message.
+const size_t kZeroCopyMinSize = 4096;
+
+/// Keeps a message and its serialization alive until ZeroMQ has released all
+/// parts that reference them. This may happen after the message was sent.
+struct PackedMessage {
+    explicit PackedMessage(size_t ref_size) : buffer(ref_size) {}
+
+    std::shared_ptr<void> msg;
+    msgpack::vrefbuffer buffer;
+};
+
+void ReleasePart(void* data, void* hint) {
+    delete static_cast<std::shared_ptr<PackedMessage>*>(hint);
+}
+
+template <class T>
+void CompressPayloads(T& msg) {}
+
+void CompressPayloads(messages::SetMeshData& msg) { CompressArrays(msg.data); }
+
+/// Packs the Request header and \p msg and sends them as a multipart message.
+/// Large payloads that reference tensors are not copied. Payloads that
+/// reference memory owned by the caller must be copied with
+/// \p copy_payloads, since the connection may send them after returning.
+template <class T>
+bool SendMessage(T msg,
+                 bool copy_payloads,
+                 std::shared_ptr<ConnectionBase> connection) {
+    if (!connection) {
+        connection = std::shared_ptr<Connection>(new Connection());
+    }
+    if (connection->UseCompression()) {
+        CompressPayloads(msg);
+    }
+
+    auto packed = std::make_shared<PackedMessage>(
+            copy_payloads ? std::numeric_limits<size_t>::max()
+                          : kZeroCopyMinSize);
+    auto msg_ptr = std::make_shared<T>(std::move(msg));
+    packed->msg = msg_ptr;
+    messages::Request request{msg_ptr->MsgId()};
+    msgpack::pack(packed->buffer, request);
+    msgpack::pack(packed->buffer, *msg_ptr);
+
+    const struct iovec* vec = packed->buffer.vector();
+    std::vector<zmq::message_t> parts;
+    for (size_t i = 0; i < packed->buffer.vector_size(); ++i) {
+        parts.emplace_back(vec[i].iov_base, vec[i].iov_len, ReleasePart,
+                           new std::shared_ptr<PackedMessage>(packed));
+    }
+    auto reply = connection->SendMultipart(parts);
+    return ReplyIsOKStatus(*reply);
+}
+
+}  // namespace
+
 bool SetPointCloud(const geometry::PointCloud& pcd,
                    const std::string& path,
                    int time,
@@ -69,17 +130,7 @@ bool SetPointCloud(const geometry::PointCloud& pcd,
                 (double*)pcd.colors_.data(), {int64_t(pcd.colors_.size()), 3});
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMessage(std::move(msg), true, connection);
 }
 
 bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
@@ -147,17 +198,7 @@ bool SetTriangleMesh(const geometry::TriangleMesh& mesh,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMessage(std::move(msg), true, connection);
 }
 
 bool SetMeshData(const std::string& path,
@@ -298,17 +339,7 @@ bool SetMeshData(const std::string& path,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMessage(std::move(msg), false, connection);
 }
 
 bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
@@ -355,34 +386,14 @@ bool SetLegacyCamera(const camera::PinholeCameraParameters& camera,
         }
     }
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMessage(std::move(msg), false, connection);
 }
 
 bool SetTime(int time, std::shared_ptr<ConnectionBase> connection) {
     messages::SetTime msg;
     msg.time = time;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMessage(std::move(msg), false, connection);
 }
 
 bool SetActiveCamera(const std::string& path,
@@ -390,17 +401,7 @@ bool SetActiveCamera(const std::string& path,
     messages::SetActiveCamera msg;
     msg.path = path;
 
-    msgpack::sbuffer sbuf;
-    messages::Request request{msg.MsgId()};
-    msgpack::pack(sbuf, request);
-    msgpack::pack(sbuf, msg);
-
-    zmq::message_t send_msg(sbuf.data(), sbuf.size());
-    if (!connection) {
-        connection = std::shared_ptr<Connection>(new Connection());
-    }
-    auto reply = connection->Send(send_msg);
-    return ReplyIsOKStatus(*reply);
+    return SendMessage(std::move(msg), false, connection);
 }
 
 }  // namespace rpc
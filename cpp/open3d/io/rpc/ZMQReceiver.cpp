@@ -29,6 +29,7 @@
 #include <zmq.hpp>
 
 #include "open3d/io/rpc/MessageProcessorBase.h"
+#include "open3d/io/rpc/MessageUtils.h"
 #include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 
@@ -46,6 +47,16 @@ std::shared_ptr<zmq::message_t> CreateStatusMessage(
 
     return msg;
 }
+
+template <class T>
+bool DecompressPayloads(T& msg, std::string& errstr) {
+    return true;
+}
+
+bool DecompressPayloads(open3d::io::rpc::messages::SetMeshData& msg,
+                        std::string& errstr) {
+    return open3d::io::rpc::DecompressArrays(msg.data, errstr);
+}
 }  // namespace
 
 namespace open3d {
@@ -148,6 +159,27 @@ void ZMQReceiver::Mainloop() {
             if (!socket_->recv(message)) {
                 continue;
             }
+            // Multipart messages are concatenated. Senders split messages to
+            // avoid copying large payloads on their side.
+            if (message.more()) {
+                std::vector<zmq::message_t> parts;
+                parts.push_back(std::move(message));
+                size_t size = parts[0].size();
+                while (parts.back().more()) {
+                    parts.emplace_back();
+                    if (!socket_->recv(parts.back())) {
+                        break;
+                    }
+                    size += parts.back().size();
+                }
+                message.rebuild(size);
+                size_t offset = 0;
+                for (const auto& part : parts) {
+                    memcpy((char*)message.data() + offset, part.data(),
+                           part.size());
+                    offset += part.size();
+                }
+            }
 
             const char* buffer = (char*)message.data();
             size_t buffer_size = message.size();
@@ -176,6 +208,13 @@ void ZMQReceiver::Mainloop() {
         auto obj = oh.get();                                            \
         MSGTYPE msg;                                                    \
         msg = obj.as<MSGTYPE>();                                        \
+        std::string errstr;                                             \
+        if (!DecompressPayloads(msg, errstr)) {                         \
+            auto status = messages::Status::ErrorUnpackingFailed();     \
+            status.str += std::string(" with ") + errstr;               \
+            replies.push_back(CreateStatusMessage(status));             \
+            continue;                                                   \
+        }                                                               \
         auto reply = processor_->ProcessMessage(req, msg, oh);          \
         if (reply) {                                                    \
             replies.push_back(reply);                                   \
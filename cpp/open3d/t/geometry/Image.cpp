@@ -190,6 +190,14 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
 
+    // Native kernels cover the union of the IPP and NPP lists, for builds
+    // without IPP and for device / dtype combinations NPP does not handle.
+    static const dtype_channels_pairs native_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+            {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
+    };
+
     Image dst_im;
     dst_im.data_ = core::Tensor::Empty(
             {static_cast<int64_t>(GetRows() * sampling_rate),
@@ -205,6 +213,9 @@ Image Image::Resize(float sampling_rate, InterpType interp_type) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Resize, data_, dst_im.data_, interp_type);
+    } else if (std::count(native_supported.begin(), native_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::Resize(data_, dst_im.data_, interp_type);
     } else {
         utility::LogError(
                 "Resize with data type {} on device {} is not "
@@ -232,6 +243,14 @@ Image Image::Dilate(int kernel_size) const {
             {core::Float32, 3}, {core::Bool, 4},  {core::UInt8, 4},
             {core::Float32, 4}};
 
+    static const dtype_channels_pairs native_supported{
+            {core::Bool, 1},    {core::UInt8, 1},   {core::UInt16, 1},
+            {core::Int32, 1},   {core::Float32, 1}, {core::Bool, 3},
+            {core::UInt8, 3},   {core::UInt16, 3},  {core::Int32, 3},
+            {core::Float32, 3}, {core::Bool, 4},    {core::UInt8, 4},
+            {core::UInt16, 4},  {core::Int32, 4},   {core::Float32, 4},
+    };
+
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
@@ -243,6 +262,9 @@ Image Image::Dilate(int kernel_size) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Dilate, data_, dst_im.data_, kernel_size);
+    } else if (std::count(native_supported.begin(), native_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::Dilate(data_, dst_im.data_, kernel_size);
     } else {
         utility::LogError(
                 "Dilate with data type {} on device {} is not implemented!",
@@ -269,6 +291,11 @@ Image Image::FilterBilateral(int kernel_size,
             {core::Float32, 3},
     };
 
+    static const dtype_channels_pairs native_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+    };
+
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
@@ -282,6 +309,10 @@ Image Image::FilterBilateral(int kernel_size,
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterBilateral, data_, dst_im.data_, kernel_size,
                  value_sigma, dist_sigma);
+    } else if (std::count(native_supported.begin(), native_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterBilateral(data_, dst_im.data_, kernel_size,
+                                        value_sigma, dist_sigma);
     } else {
         utility::LogError(
                 "FilterBilateral with data type {} on device {} is not "
@@ -303,6 +334,12 @@ Image Image::Filter(const core::Tensor &kernel) const {
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
 
+    static const dtype_channels_pairs native_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+            {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
+    };
+
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
@@ -314,6 +351,9 @@ Image Image::Filter(const core::Tensor &kernel) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::Filter, data_, dst_im.data_, kernel);
+    } else if (std::count(native_supported.begin(), native_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::Filter(data_, dst_im.data_, kernel);
     } else {
         utility::LogError(
                 "Filter with data type {} on device {} is not "
@@ -328,6 +368,9 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
         utility::LogError("Kernel size must be an odd number >= 3, but got {}.",
                           kernel_size);
     }
+    if (!(sigma > 0)) {
+        utility::LogError("sigma must be positive, but got {}.", sigma);
+    }
 
     static const dtype_channels_pairs npp_supported{
             {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
@@ -340,6 +383,12 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
             {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
     };
 
+    static const dtype_channels_pairs native_supported{
+            {core::UInt8, 1}, {core::UInt16, 1}, {core::Float32, 1},
+            {core::UInt8, 3}, {core::UInt16, 3}, {core::Float32, 3},
+            {core::UInt8, 4}, {core::UInt16, 4}, {core::Float32, 4},
+    };
+
     Image dst_im;
     dst_im.data_ = core::Tensor::EmptyLike(data_);
     if (data_.GetDevice().GetType() == core::Device::DeviceType::CUDA &&
@@ -351,6 +400,10 @@ Image Image::FilterGaussian(int kernel_size, float sigma) const {
                std::count(ipp_supported.begin(), ipp_supported.end(),
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterGaussian, data_, dst_im.data_, kernel_size, sigma);
+    } else if (std::count(native_supported.begin(), native_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterGaussian(data_, dst_im.data_, kernel_size,
+                                       sigma);
     } else {
         utility::LogError(
                 "FilterGaussian with data type {} on device {} is not "
@@ -378,6 +431,11 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
             {core::Float32, 1},
     };
 
+    static const dtype_channels_pairs native_supported{
+            {core::UInt8, 1},
+            {core::Float32, 1},
+    };
+
     // Routines: 8u16s, 32f
     Image dst_im_dx, dst_im_dy;
     core::Dtype dtype = GetDtype();
@@ -402,6 +460,10 @@ std::pair<Image, Image> Image::FilterSobel(int kernel_size) const {
                           std::make_pair(GetDtype(), GetChannels())) > 0) {
         IPP_CALL(ipp::FilterSobel, data_, dst_im_dx.data_, dst_im_dy.data_,
                  kernel_size);
+    } else if (std::count(native_supported.begin(), native_supported.end(),
+                          std::make_pair(GetDtype(), GetChannels())) > 0) {
+        kernel::image::FilterSobel(data_, dst_im_dx.data_, dst_im_dy.data_,
+                                    kernel_size);
     } else {
         utility::LogError(
                 "FilterSobel with data type {} on device {} is not "
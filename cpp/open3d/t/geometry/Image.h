@@ -199,15 +199,17 @@ public:
     /// type.
     ///
     /// Downsample if sampling rate is < 1. Upsample if sampling rate > 1.
-    /// Aspect ratio is always preserved.
+    /// Aspect ratio is always preserved. On the CPU, builds without IPP use
+    /// native kernels that replicate the borders; Super then falls back to
+    /// Linear when upsampling.
     Image Resize(float sampling_rate = 0.5f,
                  InterpType interp_type = InterpType::Nearest) const;
 
     /// \brief Return a new image after performing morphological dilation.
     ///
-    /// Supported datatypes are UInt8, UInt16 and Float32 with {1, 3, 4}
-    /// channels. An 8-connected neighborhood is used to create the dilation
-    /// mask.
+    /// Supported datatypes are Bool, UInt8, UInt16, Int32 and Float32 with
+    /// {1, 3, 4} channels. An 8-connected neighborhood is used to create the
+    /// dilation mask.
     ///
     /// \param kernel_size An odd number >= 3.
     Image Dilate(int kernel_size = 3) const;
@@ -220,8 +222,8 @@ public:
     /// \param value_sigma Standard deviation for the image content.
     /// \param distance_sigma Standard deviation for the image pixel positions.
     ///
-    /// Note: CPU (IPP) and CUDA (NPP) versions use different algorithms and
-    /// will give different results:\n
+    /// Note: CPU (IPP or native) and CUDA (NPP) versions use different
+    /// algorithms and will give different results:\n
     /// CPU uses a round kernel (radius = floor(kernel_size / 2)),\n
     /// while CUDA uses a square kernel (width = kernel_size).\n
     /// Make sure to tune parameters accordingly.
@@ -232,7 +234,8 @@ public:
     /// \brief Return a new image after Gaussian filtering.
     ///
     /// \param kernel_size Odd numbers >= 3 are supported.
-    /// \param sigma Standard deviation of the Gaussian distribution.
+    /// \param sigma Standard deviation of the Gaussian distribution, must be
+    /// positive.
     Image FilterGaussian(int kernel_size = 3, float sigma = 1.0f) const;
 
     /// \brief Return a pair of new gradient images (dx, dy) after Sobel
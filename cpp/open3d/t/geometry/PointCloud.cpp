@@ -35,6 +35,7 @@
 #include <Eigen/Core>
 #include <algorithm>
 #include <limits>
+#include <random>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -48,6 +49,7 @@
 #include "open3d/core/hashmap/HashSet.h"
 #include "open3d/core/linalg/Matmul.h"
 #include "open3d/core/nns/NearestNeighborSearch.h"
+#include "open3d/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/geometry/TriangleMesh.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
@@ -280,6 +282,22 @@ PointCloud PointCloud::VoxelDownSample(
     return pcd_down;
 }
 
+PointCloud PointCloud::FarthestPointDownSample(size_t num_samples,
+                                               size_t start_index,
+                                               size_t bucket_size) const {
+    core::Tensor sample_indices = core::Tensor::Empty(
+            {static_cast<int64_t>(num_samples)}, core::Int64, GetDevice());
+    kernel::pointcloud::FarthestPointSample(
+            GetPointPositions(), static_cast<int64_t>(start_index),
+            static_cast<int64_t>(bucket_size), sample_indices);
+
+    PointCloud pcd(GetDevice());
+    for (auto &kv : GetPointAttr()) {
+        pcd.SetPointAttr(kv.first, kv.second.IndexGet({sample_indices}));
+    }
+    return pcd;
+}
+
 std::tuple<PointCloud, core::Tensor> PointCloud::RemoveRadiusOutliers(
         size_t nb_points, double search_radius) const {
     if (nb_points < 1 || search_radius <= 0) {
@@ -386,6 +404,41 @@ void PointCloud::EstimateNormals(
     RemovePointAttr("covariances");
 }
 
+void PointCloud::OrientNormalsConsistentTangentPlane(size_t k) {
+    if (!HasPointNormals()) {
+        utility::LogError(
+                "No normals in the PointCloud. Call EstimateNormals() first.");
+    }
+    core::AssertTensorDtypes(GetPointPositions(),
+                             {core::Float32, core::Float64});
+    core::AssertTensorDtype(GetPointNormals(), GetPointPositions().GetDtype());
+
+    const int64_t num_points = GetPointPositions().GetLength();
+    if (num_points == 0) {
+        return;
+    }
+    const int64_t knn = std::min(static_cast<int64_t>(k), num_points);
+
+    const core::Device host("CPU:0");
+    const core::Tensor points = GetPointPositions().Contiguous();
+    core::Tensor neighbor_indices =
+            core::Tensor::Empty({num_points, 0}, core::Int64, host);
+    if (knn > 0) {
+        core::nns::NearestNeighborSearch nns(points, core::Int64);
+        if (!nns.KnnIndex()) {
+            utility::LogError("Index is not set.");
+        }
+        neighbor_indices = nns.KnnSearch(points, static_cast<int>(knn))
+                                   .first.To(host)
+                                   .Contiguous();
+    }
+
+    core::Tensor normals = GetPointNormals().To(host, /*copy=*/true);
+    kernel::pointcloud::OrientNormalsConsistentTangentPlaneCPU(
+            points.To(host), normals, neighbor_indices);
+    SetPointNormals(normals.To(GetDevice()));
+}
+
 void PointCloud::EstimateColorGradients(
         const int max_knn /* = 30*/,
         const utility::optional<double> radius /*= utility::nullopt*/) {
@@ -738,6 +791,202 @@ core::Tensor PointCloud::ClusterDBSCAN(double eps,
     return core::Tensor(std::move(labels));
 }
 
+/// Returns the plane that minimizes the summed squared distance to points with
+/// the given centroid and covariance, see geometry::PointCloud::SegmentPlane,
+/// or a zero plane if the points don't span a plane.
+static Eigen::Vector4d ComputePlaneFromCovariance(
+        const Eigen::Vector3d &centroid, const Eigen::Matrix3d &covariance) {
+    const double xx = covariance(0, 0), xy = covariance(0, 1),
+                 xz = covariance(0, 2), yy = covariance(1, 1),
+                 yz = covariance(1, 2), zz = covariance(2, 2);
+    const double det_x = yy * zz - yz * yz;
+    const double det_y = xx * zz - xz * xz;
+    const double det_z = xx * yy - xy * xy;
+
+    Eigen::Vector3d abc;
+    if (det_x > det_y && det_x > det_z) {
+        abc = Eigen::Vector3d(det_x, xz * yz - xy * zz, xy * yz - xz * yy);
+    } else if (det_y > det_z) {
+        abc = Eigen::Vector3d(xz * yz - xy * zz, det_y, xy * xz - yz * xx);
+    } else {
+        abc = Eigen::Vector3d(xy * yz - xz * yy, xy * xz - yz * xx, det_z);
+    }
+    const double norm = abc.norm();
+    if (norm == 0) {
+        return Eigen::Vector4d::Zero();
+    }
+    abc /= norm;
+    return Eigen::Vector4d(abc(0), abc(1), abc(2), -abc.dot(centroid));
+}
+
+/// Fits a plane hypothesis to the columns of \p samples.
+static Eigen::Vector4d ComputePlaneHypothesis(const Eigen::Matrix3Xd &samples) {
+    if (samples.cols() == 3) {
+        return open3d::geometry::TriangleMesh::ComputeTrianglePlane(
+                samples.col(0), samples.col(1), samples.col(2));
+    }
+    const Eigen::Vector3d centroid = samples.rowwise().mean();
+    const Eigen::Matrix3Xd centered = samples.colwise() - centroid;
+    return ComputePlaneFromCovariance(centroid,
+                                      centered * centered.transpose());
+}
+
+std::tuple<core::Tensor, core::Tensor> PointCloud::SegmentPlane(
+        const double distance_threshold,
+        const int ransac_n,
+        const int num_iterations,
+        const double probability,
+        utility::optional<int> seed) const {
+    if (probability <= 0 || probability > 1) {
+        utility::LogError("Probability must be > 0 or <= 1.0");
+    }
+    if (ransac_n < 3) {
+        utility::LogError(
+                "ransac_n should be set to higher than or equal to 3.");
+    }
+    const core::Tensor points = GetPointPositions().Contiguous();
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+    if (num_points < ransac_n) {
+        utility::LogError("There must be at least 'ransac_n' points.");
+    }
+    if (!seed.has_value()) {
+        std::random_device rd;
+        seed = rd();
+    }
+    std::mt19937 rng(seed.value());
+
+    // Number of hypotheses that are scored together on the device.
+    constexpr int kHypothesisChunkSize = 64;
+    Eigen::Vector4d best_plane_model = Eigen::Vector4d::Zero();
+    double best_fitness = 0;
+    double best_inlier_rmse = 0;
+
+    // Use size_t here to avoid large integer which acceed max of int.
+    size_t break_iteration = std::numeric_limits<size_t>::max();
+    int iteration_count = 0;
+    while (iteration_count < num_iterations &&
+           size_t(iteration_count) <= break_iteration) {
+        const int num_hypotheses = std::min(kHypothesisChunkSize,
+                                            num_iterations - iteration_count);
+
+        // Sample distinct points for every hypothesis and copy only those.
+        std::vector<int64_t> sample_indices;
+        sample_indices.reserve(num_hypotheses * ransac_n);
+        for (int hidx = 0; hidx < num_hypotheses; ++hidx) {
+            const size_t first = sample_indices.size();
+            while (sample_indices.size() - first < size_t(ransac_n)) {
+                const int64_t idx = int64_t(rng() % uint64_t(num_points));
+                if (std::find(sample_indices.begin() + first,
+                              sample_indices.end(),
+                              idx) == sample_indices.end()) {
+                    sample_indices.push_back(idx);
+                }
+            }
+        }
+        const core::Tensor samples =
+                points.IndexGet({core::Tensor(sample_indices,
+                                              {int64_t(sample_indices.size())},
+                                              core::Int64)
+                                         .To(device)})
+                        .To(core::Device("CPU:0"), core::Float64)
+                        .Contiguous();
+        const Eigen::Map<const Eigen::Matrix3Xd> samples_eigen(
+                samples.GetDataPtr<double>(), 3, samples.GetLength());
+
+        std::vector<double> planes(4 * num_hypotheses);
+        for (int hidx = 0; hidx < num_hypotheses; ++hidx) {
+            Eigen::Map<Eigen::Vector4d>(planes.data() + 4 * hidx) =
+                    ComputePlaneHypothesis(samples_eigen.middleCols(
+                            hidx * ransac_n, ransac_n));
+        }
+        core::Tensor inlier_counts, inlier_errors;
+        kernel::pointcloud::EvaluatePlanes(
+                points,
+                core::Tensor(planes, {num_hypotheses, 4}, core::Float64)
+                        .To(device),
+                distance_threshold, inlier_counts, inlier_errors);
+        const std::vector<int64_t> counts =
+                inlier_counts.To(core::Device("CPU:0")).ToFlatVector<int64_t>();
+        const std::vector<double> errors =
+                inlier_errors.To(core::Device("CPU:0")).ToFlatVector<double>();
+
+        // Merge in order, so the result does not depend on the chunk size.
+        for (int hidx = 0; hidx < num_hypotheses &&
+                           size_t(iteration_count) <= break_iteration;
+             ++hidx) {
+            iteration_count++;
+            const Eigen::Map<const Eigen::Vector4d> plane(planes.data() +
+                                                          4 * hidx);
+            if (plane.isZero(0) || counts[hidx] == 0) {
+                continue;
+            }
+            const double fitness = double(counts[hidx]) / double(num_points);
+            const double inlier_rmse =
+                    errors[hidx] / std::sqrt(double(counts[hidx]));
+            if (fitness > best_fitness ||
+                (fitness == best_fitness && inlier_rmse < best_inlier_rmse)) {
+                best_fitness = fitness;
+                best_inlier_rmse = inlier_rmse;
+                best_plane_model = plane;
+                if (best_fitness < 1.0) {
+                    break_iteration = std::min(
+                            log(1 - probability) /
+                                    log(1 - pow(best_fitness, ransac_n)),
+                            (double)num_iterations);
+                } else {
+                    // Set break_iteration to 0 to force to break the loop.
+                    break_iteration = 0;
+                }
+            }
+        }
+    }
+
+    // Find the final inliers using best_plane_model.
+    core::Tensor inliers = core::Tensor::Empty({0}, core::Int64, device);
+    if (!best_plane_model.isZero(0)) {
+        const core::Tensor normal = core::Tensor::Init<double>(
+                {{best_plane_model(0), best_plane_model(1),
+                  best_plane_model(2)}},
+                device);
+        const core::Tensor distances = points.To(core::Float64)
+                                               .Mul(normal)
+                                               .Sum({1})
+                                               .Add(best_plane_model(3))
+                                               .Abs();
+        inliers = distances.Lt(distance_threshold)
+                          .NonZero()
+                          .GetItem(core::TensorKey::Index(0));
+    }
+
+    // Improve best_plane_model using the final inliers.
+    const int64_t num_inliers = inliers.GetLength();
+    if (num_inliers > 0) {
+        const core::Tensor inlier_points =
+                points.IndexGet({inliers}).To(core::Float64);
+        const core::Tensor centroid = inlier_points.Mean({0});
+        const core::Tensor centered = inlier_points - centroid;
+        const core::Tensor covariance =
+                (centered.Reshape({num_inliers, 3, 1}) *
+                 centered.Reshape({num_inliers, 1, 3}))
+                        .Sum({0});
+        best_plane_model = ComputePlaneFromCovariance(
+                core::eigen_converter::TensorToEigenMatrixXd(
+                        centroid.Reshape({3, 1})),
+                core::eigen_converter::TensorToEigenMatrixXd(covariance));
+    }
+
+    utility::LogDebug(
+            "RANSAC | Inliers: {:d}, Fitness: {:e}, RMSE: {:e}, Iteration: "
+            "{:d}",
+            num_inliers, best_fitness, best_inlier_rmse, iteration_count);
+    return std::make_tuple(
+            core::eigen_converter::EigenMatrixToTensor(best_plane_model)
+                    .Reshape({4})
+                    .To(device),
+            inliers);
+}
+
 TriangleMesh PointCloud::ComputeConvexHull(bool joggle_inputs) const {
     // QHull needs double dtype on the CPU.
     static_assert(std::is_same<realT, double>::value,
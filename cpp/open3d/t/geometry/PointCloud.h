@@ -327,6 +327,22 @@ public:
                                const core::HashBackendType &backend =
                                        core::HashBackendType::Default) const;
 
+    /// \brief Downsamples a point cloud into the set of points that are
+    /// farthest from each other, by iteratively selecting the point farthest
+    /// from all points selected so far. Ties go to the point with the smallest
+    /// index. The points are returned in the order they are selected.
+    ///
+    /// \param num_samples Number of points to be sampled.
+    /// \param start_index Index of the first selected point.
+    /// \param bucket_size If positive, points are partitioned into a kd-tree
+    /// with buckets of at most this many points, and buckets that are farther
+    /// from a new sample than their own farthest point are not updated. The
+    /// result is the same, but large point clouds are sampled much faster.
+    /// Only used on CPU.
+    PointCloud FarthestPointDownSample(size_t num_samples,
+                                       size_t start_index = 0,
+                                       size_t bucket_size = 0) const;
+
     /// \brief Remove points that have less than \p nb_points neighbors in a
     /// sphere of a given radius.
     ///
@@ -356,6 +372,31 @@ public:
                                size_t min_points,
                                bool print_progress = false) const;
 
+    /// \brief Segment PointCloud plane using the RANSAC algorithm.
+    ///
+    /// Hypotheses are sampled on the CPU and scored in parallel on the device
+    /// of the point cloud, in chunks of hypotheses that are fully evaluated.
+    /// Unlike geometry::PointCloud::SegmentPlane, hypotheses are not rejected
+    /// early with the sequential probability ratio test.
+    ///
+    /// \param distance_threshold Max distance a point can be from the plane
+    /// model, and still be considered an inlier.
+    /// \param ransac_n Number of initial points to be considered inliers in
+    /// each iteration.
+    /// \param num_iterations Maximum number of iterations.
+    /// \param probability Expected probability of finding the optimal plane.
+    /// \param seed Sets the seed value used in the random generator, set to
+    /// nullopt to use a random seed value with each function call.
+    /// \return Tuple of the Float64 plane model ax + by + cz + d = 0 of shape
+    /// {4} and the Int64 indices of the plane inliers in increasing order, both
+    /// on the device of the point cloud.
+    std::tuple<core::Tensor, core::Tensor> SegmentPlane(
+            const double distance_threshold = 0.01,
+            const int ransac_n = 3,
+            const int num_iterations = 100,
+            const double probability = 0.99999999,
+            utility::optional<int> seed = utility::nullopt) const;
+
     /// Compute the convex hull of a point cloud using qhull.
     ///
     /// This runs on the CPU.
@@ -384,6 +425,19 @@ public:
             const int max_nn = 30,
             const utility::optional<double> radius = utility::nullopt);
 
+    /// \brief Function to consistently orient estimated normals based on
+    /// consistent tangent planes as described in Hoppe et al., "Surface
+    /// Reconstruction from Unorganized Points", 1992.
+    ///
+    /// The nearest neighbor search runs on the device of the point cloud, the
+    /// minimum spanning tree and the propagation of the orientation on CPU.
+    /// Each connected component of the neighbor graph is oriented separately,
+    /// starting from its point with the largest z coordinate.
+    ///
+    /// \param k k nearest neighbour for graph reconstruction for normal
+    /// propagation.
+    void OrientNormalsConsistentTangentPlane(size_t k);
+
     /// \brief Function to compute point color gradients. If radius is provided,
     /// then HybridSearch is used, otherwise KNN-Search is used.
     /// Reference: Park, Q.-Y. Zhou, and V. Koltun,
@@ -36,10 +36,12 @@
 #include <tutorials/common/math/closest_point.h>
 
 #include <Eigen/Core>
+#include <algorithm>
 #include <tuple>
 #include <vector>
 
 #include "open3d/core/TensorCheck.h"
+#include "open3d/utility/FileSystem.h"
 #include "open3d/utility/Helper.h"
 #include "open3d/utility/Logging.h"
 
@@ -74,6 +76,37 @@ void AssertTensorDtypeLastDimDeviceMinNDim(const open3d::core::Tensor& tensor,
                                     open3d::core::Dtype::FromType<DTYPE>());
 }
 
+// File layout written by RaycastingScene::Save(). The header is followed by
+// one record per geometry and the vertex and index buffers of all geometries.
+// Buffers start at SCENE_FILE_ALIGNMENT aligned offsets and are followed by
+// SCENE_FILE_PADDING bytes such that embree can use them in place.
+const char SCENE_FILE_MAGIC[8] = {'O', '3', 'D', 'R', 'C', 'S', 'T', '\0'};
+const uint32_t SCENE_FILE_VERSION = 1;
+const uint32_t SCENE_FILE_BYTE_ORDER_MARK = 0x01020304;
+const uint64_t SCENE_FILE_ALIGNMENT = 64;
+const uint64_t SCENE_FILE_PADDING = 16;
+
+struct SceneFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order_mark;
+    uint64_t num_geometries;
+};
+
+struct SceneFileGeometryRecord {
+    uint32_t geometry_id;
+    uint32_t geometry_type;
+    uint64_t num_vertices;
+    uint64_t num_triangles;
+    uint64_t vertex_offset;
+    uint64_t index_offset;
+};
+
+uint64_t AlignSceneFileOffset(uint64_t offset) {
+    return (offset + SCENE_FILE_ALIGNMENT - 1) / SCENE_FILE_ALIGNMENT *
+           SCENE_FILE_ALIGNMENT;
+}
+
 struct CountIntersectionsContext {
     RTCIntersectContext context;
     std::vector<std::tuple<uint32_t, uint32_t, float>>*
@@ -124,6 +157,60 @@ void CountIntersectionsFunc(const RTCFilterFunctionNArguments* args) {
     }
 }
 
+// Validates the arguments of the grid query functions and returns the position
+// of the first cell center and the size of the cells.
+std::pair<Eigen::Vector3f, Eigen::Vector3f> GetGridOriginAndCellSize(
+        const open3d::core::Tensor& min_bound,
+        const open3d::core::Tensor& max_bound,
+        const open3d::core::SizeVector& resolution) {
+    open3d::core::AssertTensorDevice(min_bound, open3d::core::Device());
+    open3d::core::AssertTensorShape(min_bound, {3});
+    open3d::core::AssertTensorDevice(max_bound, open3d::core::Device());
+    open3d::core::AssertTensorShape(max_bound, {3});
+    if (resolution.size() != 3 || resolution[0] <= 0 || resolution[1] <= 0 ||
+        resolution[2] <= 0) {
+        open3d::utility::LogError(
+                "resolution must have 3 positive entries but got {}.",
+                resolution.ToString());
+    }
+    auto min_bound_contig =
+            min_bound.To(open3d::core::Float32).Contiguous();
+    auto max_bound_contig =
+            max_bound.To(open3d::core::Float32).Contiguous();
+    Eigen::Map<const Eigen::Vector3f> min_bound_map(
+            min_bound_contig.GetDataPtr<float>());
+    Eigen::Map<const Eigen::Vector3f> max_bound_map(
+            max_bound_contig.GetDataPtr<float>());
+    if ((max_bound_map.array() <= min_bound_map.array()).any()) {
+        open3d::utility::LogError(
+                "max_bound must be larger than min_bound in all dimensions.");
+    }
+    Eigen::Vector3f cell_size = (max_bound_map - min_bound_map).cwiseQuotient(
+            Eigen::Vector3f(resolution[0], resolution[1], resolution[2]));
+    Eigen::Vector3f origin = min_bound_map + 0.5f * cell_size;
+    return std::make_pair(origin, cell_size);
+}
+
+// Returns the offsets of the cells of a cubic tile with 2^TILE_BITS cells per
+// side in Morton order.
+template <int TILE_BITS>
+const std::vector<Eigen::Vector3i>& GetMortonOrderedTileOffsets() {
+    static const std::vector<Eigen::Vector3i> offsets = []() {
+        std::vector<Eigen::Vector3i> result(1 << (3 * TILE_BITS));
+        for (int code = 0; code < int(result.size()); ++code) {
+            Eigen::Vector3i offset(0, 0, 0);
+            for (int bit = 0; bit < TILE_BITS; ++bit) {
+                for (int dim = 0; dim < 3; ++dim) {
+                    offset(dim) |= ((code >> (3 * bit + dim)) & 1) << bit;
+                }
+            }
+            result[code] = offset;
+        }
+        return result;
+    }();
+    return offsets;
+}
+
 struct ClosestPointResult {
     ClosestPointResult()
         : primID(RTC_INVALID_GEOMETRY_ID),
@@ -199,14 +286,27 @@ namespace geometry {
 struct RaycastingScene::Impl {
     // The maximum number of rays used in calls to embree.
     const size_t BATCH_SIZE = 1024;
+    // The grid queries process tiles with 2^GRID_TILE_BITS cells per side.
+    static const int GRID_TILE_BITS = 3;
     RTCDevice device_;
     RTCScene scene_;
     bool scene_committed_;  // true if the scene has been committed.
     // Vector for storing some information about the added geometry.
     std::vector<std::tuple<RTCGeometryType, const void*, const void*>>
             geometry_ptrs_;
+    // The number of vertices and triangles for each geometry ID.
+    std::vector<std::pair<size_t, size_t>> geometry_sizes_;
+    // Backing storage for scenes loaded with Load(..., use_mmap=true).
+    utility::filesystem::MappedFile mapped_file_;
     core::Device tensor_device_;  // cpu
 
+    void CommitScene() {
+        if (!scene_committed_) {
+            rtcCommitScene(scene_);
+            scene_committed_ = true;
+        }
+    }
+
     template <bool LINE_INTERSECTION>
     void CastRays(const float* const rays,
                   const size_t num_rays,
@@ -216,10 +316,7 @@ struct RaycastingScene::Impl {
                   float* primitive_uvs,
                   float* primitive_normals,
                   const int nthreads) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         struct RTCIntersectContext context;
         rtcInitIntersectContext(&context);
@@ -305,10 +402,7 @@ struct RaycastingScene::Impl {
                         const float tfar,
                         int8_t* occluded,
                         const int nthreads) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         struct RTCIntersectContext context;
         rtcInitIntersectContext(&context);
@@ -360,10 +454,7 @@ struct RaycastingScene::Impl {
                             const size_t num_rays,
                             int* intersections,
                             const int nthreads) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         memset(intersections, 0, sizeof(int) * num_rays);
 
@@ -424,10 +515,7 @@ struct RaycastingScene::Impl {
                               unsigned int* geometry_ids,
                               unsigned int* primitive_ids,
                               const int nthreads) {
-        if (!scene_committed_) {
-            rtcCommitScene(scene_);
-            scene_committed_ = true;
-        }
+        CommitScene();
 
         auto LoopFn = [&](const tbb::blocked_range<size_t>& range) {
             for (size_t i = range.begin(); i < range.end(); ++i) {
@@ -467,6 +555,217 @@ struct RaycastingScene::Impl {
                     LoopFn);
         }
     }
+
+    // Returns the distance to the closest surface point within the radius or
+    // infinity if there is no surface within the radius.
+    float ComputeClosestPointDistance(const Eigen::Vector3f& point,
+                                      const float radius) {
+        RTCPointQuery query;
+        query.x = point.x();
+        query.y = point.y();
+        query.z = point.z();
+        query.radius = radius;
+        query.time = 0.f;
+
+        ClosestPointResult result;
+        result.geometry_ptrs_ptr = &geometry_ptrs_;
+
+        RTCPointQueryContext instStack;
+        rtcInitPointQueryContext(&instStack);
+        rtcPointQuery(scene_, &query, &instStack, &ClosestPointFunc,
+                      (void*)&result);
+        if (result.geomID == RTC_INVALID_GEOMETRY_ID) {
+            return std::numeric_limits<float>::infinity();
+        }
+        return query.radius;
+    }
+
+    // Counts the intersections of rays with direction [1,1,1] starting at the
+    // points. This processes all rays in the calling thread.
+    void CountIntersectionsFromPoints(
+            const std::vector<Eigen::Vector3f>& points, int* intersections) {
+        const size_t num_rays = points.size();
+        memset(intersections, 0, sizeof(int) * num_rays);
+
+        std::vector<std::tuple<uint32_t, uint32_t, float>>
+                previous_geom_prim_ID_tfar(
+                        num_rays,
+                        std::make_tuple(uint32_t(RTC_INVALID_GEOMETRY_ID),
+                                        uint32_t(RTC_INVALID_GEOMETRY_ID),
+                                        0.f));
+
+        CountIntersectionsContext context;
+        rtcInitIntersectContext(&context.context);
+        context.context.filter = CountIntersectionsFunc;
+        context.previous_geom_prim_ID_tfar = &previous_geom_prim_ID_tfar;
+        context.intersections = intersections;
+
+        std::vector<RTCRayHit> rayhits(num_rays);
+        for (size_t i = 0; i < num_rays; ++i) {
+            RTCRayHit* rh = &rayhits[i];
+            rh->ray.org_x = points[i].x();
+            rh->ray.org_y = points[i].y();
+            rh->ray.org_z = points[i].z();
+            rh->ray.dir_x = 1.f;
+            rh->ray.dir_y = 1.f;
+            rh->ray.dir_z = 1.f;
+            rh->ray.tnear = 0;
+            rh->ray.tfar = std::numeric_limits<float>::infinity();
+            rh->ray.mask = 0;
+            rh->ray.flags = 0;
+            rh->ray.id = i;
+            rh->hit.geomID = RTC_INVALID_GEOMETRY_ID;
+            rh->hit.instID[0] = RTC_INVALID_GEOMETRY_ID;
+        }
+        if (num_rays) {
+            rtcIntersect1M(scene_, &context.context, &rayhits[0], num_rays,
+                           sizeof(RTCRayHit));
+        }
+    }
+
+    // Computes the signed distance or the occupancy for the cell centers of a
+    // regular grid with the given resolution. Only the slices [x_begin, x_end)
+    // along the first dimension are computed and written to values, which has
+    // the shape {x_end-x_begin, resolution[1], resolution[2]}.
+    //
+    // The cells are processed in cubic tiles. A single closest point query at
+    // the tile center bounds the distance for all cells in the tile. If the
+    // surface does not intersect the tile, the sign is computed once for the
+    // whole tile, otherwise the sign is computed per cell. The cells of a
+    // tile are visited in Morton order to improve the locality of the
+    // queries.
+    template <bool SIGNED_DISTANCE>
+    void ComputeGrid(const Eigen::Vector3f& origin,
+                     const Eigen::Vector3f& cell_size,
+                     const core::SizeVector& resolution,
+                     const int64_t x_begin,
+                     const int64_t x_end,
+                     float* values,
+                     const int nthreads) {
+        CommitScene();
+
+        const int64_t tile_size = int64_t(1) << GRID_TILE_BITS;
+        const auto& tile_offsets =
+                GetMortonOrderedTileOffsets<GRID_TILE_BITS>();
+        const Eigen::Matrix<int64_t, 3, 1> grid_begin(x_begin, 0, 0);
+        const Eigen::Matrix<int64_t, 3, 1> grid_end(x_end, resolution[1],
+                                                    resolution[2]);
+        const Eigen::Matrix<int64_t, 3, 1> num_tiles =
+                (grid_end - grid_begin).unaryExpr([&](int64_t n) {
+                    return (n + tile_size - 1) / tile_size;
+                });
+        const float inf = std::numeric_limits<float>::infinity();
+
+        auto CellCenter = [&](const Eigen::Matrix<int64_t, 3, 1>& cell) {
+            return Eigen::Vector3f(origin + cell.cast<float>().cwiseProduct(
+                                                    cell_size));
+        };
+        auto ValueIndex = [&](const Eigen::Matrix<int64_t, 3, 1>& cell) {
+            return ((cell.x() - x_begin) * resolution[1] + cell.y()) *
+                           resolution[2] +
+                   cell.z();
+        };
+
+        auto LoopFn = [&](const tbb::blocked_range<int64_t>& range) {
+            std::vector<Eigen::Vector3f> points;
+            std::vector<int64_t> indices;
+            std::vector<int> intersections;
+            for (int64_t tile_idx = range.begin(); tile_idx < range.end();
+                 ++tile_idx) {
+                const Eigen::Matrix<int64_t, 3, 1> tile(
+                        tile_idx / (num_tiles.y() * num_tiles.z()),
+                        (tile_idx / num_tiles.z()) % num_tiles.y(),
+                        tile_idx % num_tiles.z());
+                const Eigen::Matrix<int64_t, 3, 1> tile_begin =
+                        grid_begin + tile * tile_size;
+                const Eigen::Matrix<int64_t, 3, 1> tile_end =
+                        (tile_begin.array() + tile_size)
+                                .min(grid_end.array())
+                                .matrix();
+
+                // All cells of the tile are within half_diagonal of the
+                // center. If the closest surface point is farther away, the
+                // surface does not pass through the tile.
+                const Eigen::Vector3f first_center = CellCenter(tile_begin);
+                const Eigen::Vector3f last_center = CellCenter(
+                        tile_end - Eigen::Matrix<int64_t, 3, 1>::Ones());
+                const Eigen::Vector3f tile_center =
+                        0.5f * (first_center + last_center);
+                const float half_diagonal =
+                        0.5f * (last_center - first_center).norm();
+                const float center_distance =
+                        ComputeClosestPointDistance(tile_center, inf);
+                const bool uniform_sign = center_distance > half_diagonal;
+
+                int tile_sign = 1;
+                if (uniform_sign) {
+                    int count;
+                    CountIntersectionsFromPoints({tile_center}, &count);
+                    tile_sign = (count % 2) ? -1 : 1;
+                }
+
+                points.clear();
+                indices.clear();
+                for (const Eigen::Vector3i& offset : tile_offsets) {
+                    const Eigen::Matrix<int64_t, 3, 1> cell =
+                            tile_begin + offset.cast<int64_t>();
+                    if ((cell.array() >= tile_end.array()).any()) {
+                        continue;
+                    }
+                    const Eigen::Vector3f point = CellCenter(cell);
+                    const int64_t value_idx = ValueIndex(cell);
+                    if (SIGNED_DISTANCE) {
+                        // The distance is Lipschitz continuous. The distance
+                        // at the tile center bounds the search radius. The
+                        // radius is slightly enlarged to keep the closest
+                        // point if the bound is tight.
+                        const float bound = center_distance +
+                                            (point - tile_center).norm();
+                        float distance = ComputeClosestPointDistance(
+                                point, bound * (1.f + 1e-4f) + 1e-6f);
+                        if (std::isinf(distance)) {
+                            distance = ComputeClosestPointDistance(point, inf);
+                        }
+                        values[value_idx] = distance * tile_sign;
+                    } else {
+                        values[value_idx] = tile_sign < 0 ? 1.f : 0.f;
+                    }
+                    if (!uniform_sign) {
+                        points.push_back(point);
+                        indices.push_back(value_idx);
+                    }
+                }
+
+                if (!uniform_sign) {
+                    intersections.resize(points.size());
+                    CountIntersectionsFromPoints(points, intersections.data());
+                    for (size_t i = 0; i < points.size(); ++i) {
+                        const bool inside = intersections[i] % 2;
+                        if (SIGNED_DISTANCE) {
+                            values[indices[i]] = inside ? -values[indices[i]]
+                                                        : values[indices[i]];
+                        } else {
+                            values[indices[i]] = inside ? 1.f : 0.f;
+                        }
+                    }
+                }
+            }
+        };
+
+        const int64_t total_num_tiles = num_tiles.prod();
+        if (nthreads > 0) {
+            tbb::task_arena arena(nthreads);
+            arena.execute([&]() {
+                tbb::parallel_for(
+                        tbb::blocked_range<int64_t>(0, total_num_tiles, 1),
+                        LoopFn);
+            });
+        } else {
+            tbb::parallel_for(
+                    tbb::blocked_range<int64_t>(0, total_num_tiles, 1),
+                    LoopFn);
+        }
+    }
 };
 
 RaycastingScene::RaycastingScene() : impl_(new RaycastingScene::Impl()) {
@@ -531,6 +830,8 @@ uint32_t RaycastingScene::AddTriangles(const core::Tensor& vertex_positions,
     impl_->geometry_ptrs_.push_back(std::make_tuple(RTC_GEOMETRY_TYPE_TRIANGLE,
                                                     (const void*)vertex_buffer,
                                                     (const void*)index_buffer));
+    impl_->geometry_sizes_.push_back(
+            std::make_pair(num_vertices, num_triangles));
     return geom_id;
 }
 
@@ -545,6 +846,234 @@ uint32_t RaycastingScene::AddTriangles(const TriangleMesh& mesh) {
                         mesh.GetTriangleIndices().To(core::UInt32));
 }
 
+void RaycastingScene::Commit() { impl_->CommitScene(); }
+
+void RaycastingScene::Save(const std::string& file_name) const {
+    const size_t num_geometries = impl_->geometry_ptrs_.size();
+
+    SceneFileHeader header;
+    memcpy(header.magic, SCENE_FILE_MAGIC, sizeof(header.magic));
+    header.version = SCENE_FILE_VERSION;
+    header.byte_order_mark = SCENE_FILE_BYTE_ORDER_MARK;
+    header.num_geometries = num_geometries;
+
+    std::vector<SceneFileGeometryRecord> records(num_geometries);
+    uint64_t offset = AlignSceneFileOffset(
+            sizeof(SceneFileHeader) +
+            num_geometries * sizeof(SceneFileGeometryRecord));
+    for (size_t geom_id = 0; geom_id < num_geometries; ++geom_id) {
+        SceneFileGeometryRecord& record = records[geom_id];
+        record.geometry_id = uint32_t(geom_id);
+        record.geometry_type =
+                uint32_t(std::get<0>(impl_->geometry_ptrs_[geom_id]));
+        record.num_vertices = impl_->geometry_sizes_[geom_id].first;
+        record.num_triangles = impl_->geometry_sizes_[geom_id].second;
+        record.vertex_offset = offset;
+        offset = AlignSceneFileOffset(offset +
+                                      record.num_vertices * 3 * sizeof(float) +
+                                      SCENE_FILE_PADDING);
+        record.index_offset = offset;
+        offset = AlignSceneFileOffset(
+                offset + record.num_triangles * 3 * sizeof(uint32_t) +
+                SCENE_FILE_PADDING);
+    }
+
+    utility::filesystem::CFile cfile;
+    if (!cfile.Open(file_name, "wb")) {
+        utility::LogError("Failed to open file {}, error: {}.", file_name,
+                          cfile.GetError());
+    }
+    FILE* fp = cfile.GetFILE();
+
+    // Writes the buffer at the given offset and zero fills the gap before it.
+    // The gap includes the padding of the previous buffer.
+    auto WriteAt = [&](uint64_t dst_offset, const void* data, size_t size) {
+        static const char zeros[SCENE_FILE_ALIGNMENT + SCENE_FILE_PADDING] =
+                {};
+        int64_t gap = int64_t(dst_offset) - cfile.CurPos();
+        if (gap < 0 || gap > int64_t(sizeof(zeros))) {
+            utility::LogError("Invalid offset while writing {}.", file_name);
+        }
+        if (fwrite(zeros, 1, gap, fp) != size_t(gap) ||
+            fwrite(data, 1, size, fp) != size) {
+            utility::LogError("Failed to write {}.", file_name);
+        }
+    };
+
+    WriteAt(0, &header, sizeof(header));
+    WriteAt(sizeof(header), records.data(),
+            records.size() * sizeof(SceneFileGeometryRecord));
+    for (size_t geom_id = 0; geom_id < num_geometries; ++geom_id) {
+        const SceneFileGeometryRecord& record = records[geom_id];
+        WriteAt(record.vertex_offset,
+                std::get<1>(impl_->geometry_ptrs_[geom_id]),
+                record.num_vertices * 3 * sizeof(float));
+        WriteAt(record.index_offset,
+                std::get<2>(impl_->geometry_ptrs_[geom_id]),
+                record.num_triangles * 3 * sizeof(uint32_t));
+    }
+    // Pad the end of the file such that the last buffer is padded as well.
+    WriteAt(offset, nullptr, 0);
+}
+
+std::unique_ptr<RaycastingScene> RaycastingScene::Load(
+        const std::string& file_name, bool use_mmap) {
+    std::unique_ptr<RaycastingScene> scene(new RaycastingScene());
+    Impl* impl = scene->impl_.get();
+
+    // With mmap the buffers are used in place, otherwise they are read from
+    // the file directly into the embree buffers.
+    utility::filesystem::CFile cfile;
+    const char* data = nullptr;
+    size_t file_size = 0;
+    if (use_mmap) {
+        if (!impl->mapped_file_.Open(file_name)) {
+            utility::LogError("Failed to map file {}, error: {}.", file_name,
+                              impl->mapped_file_.GetError());
+        }
+        data = static_cast<const char*>(impl->mapped_file_.GetData());
+        file_size = impl->mapped_file_.GetSize();
+    } else {
+        if (!cfile.Open(file_name, "rb")) {
+            utility::LogError("Failed to open file {}, error: {}.", file_name,
+                              cfile.GetError());
+        }
+        file_size = cfile.GetFileSize();
+    }
+    auto ReadAt = [&](uint64_t src_offset, void* dst, size_t size) {
+        if (use_mmap) {
+            memcpy(dst, data + src_offset, size);
+        } else if (fseek(cfile.GetFILE(), src_offset, SEEK_SET) != 0 ||
+                   cfile.ReadData(static_cast<char*>(dst), size) != size) {
+            utility::LogError("Failed to read {}.", file_name);
+        }
+    };
+
+    SceneFileHeader header;
+    if (file_size < sizeof(header)) {
+        utility::LogError("{} is not a RaycastingScene file.", file_name);
+    }
+    ReadAt(0, &header, sizeof(header));
+    if (memcmp(header.magic, SCENE_FILE_MAGIC, sizeof(header.magic)) != 0) {
+        utility::LogError("{} is not a RaycastingScene file.", file_name);
+    }
+    if (header.version != SCENE_FILE_VERSION) {
+        utility::LogError(
+                "Unsupported RaycastingScene file version {} in {}, expected "
+                "version {}.",
+                header.version, file_name, SCENE_FILE_VERSION);
+    }
+    if (header.byte_order_mark != SCENE_FILE_BYTE_ORDER_MARK) {
+        utility::LogError(
+                "RaycastingScene file {} was written with a different byte "
+                "order.",
+                file_name);
+    }
+    if ((file_size - sizeof(header)) / sizeof(SceneFileGeometryRecord) <
+        header.num_geometries) {
+        utility::LogError("RaycastingScene file {} is truncated.", file_name);
+    }
+
+    const size_t num_geometries = header.num_geometries;
+    std::vector<SceneFileGeometryRecord> records(num_geometries);
+    ReadAt(sizeof(header), records.data(),
+           num_geometries * sizeof(SceneFileGeometryRecord));
+
+    // Returns true if the buffer at offset with the given number of elements
+    // and the padding after it lie within the file. Written so that corrupted
+    // values cannot overflow.
+    auto IsInFile = [&](uint64_t offset, uint64_t num_elements,
+                        uint64_t element_size) {
+        return offset <= file_size &&
+               SCENE_FILE_PADDING <= file_size - offset &&
+               num_elements <= (file_size - offset - SCENE_FILE_PADDING) /
+                                       element_size;
+    };
+
+    impl->geometry_ptrs_.resize(num_geometries);
+    impl->geometry_sizes_.resize(num_geometries);
+    std::vector<bool> has_geometry(num_geometries, false);
+    for (const SceneFileGeometryRecord& record : records) {
+        if (record.geometry_id >= num_geometries ||
+            has_geometry[record.geometry_id] ||
+            record.geometry_type != RTC_GEOMETRY_TYPE_TRIANGLE ||
+            record.vertex_offset % SCENE_FILE_ALIGNMENT != 0 ||
+            record.index_offset % SCENE_FILE_ALIGNMENT != 0 ||
+            !IsInFile(record.vertex_offset, record.num_vertices,
+                      3 * sizeof(float)) ||
+            !IsInFile(record.index_offset, record.num_triangles,
+                      3 * sizeof(uint32_t))) {
+            utility::LogError("RaycastingScene file {} is corrupted.",
+                              file_name);
+        }
+        has_geometry[record.geometry_id] = true;
+    }
+    // Every geometry id must be present, the closest point queries look up
+    // geometry_ptrs_ by id and would find an empty slot otherwise.
+    if (std::find(has_geometry.begin(), has_geometry.end(), false) !=
+        has_geometry.end()) {
+        utility::LogError("RaycastingScene file {} is corrupted.", file_name);
+    }
+
+    for (const SceneFileGeometryRecord& record : records) {
+        const size_t vertices_size = record.num_vertices * 3 * sizeof(float);
+        const size_t indices_size =
+                record.num_triangles * 3 * sizeof(uint32_t);
+
+        RTCGeometry geom =
+                rtcNewGeometry(impl->device_, RTC_GEOMETRY_TYPE_TRIANGLE);
+        const void* vertex_buffer;
+        const void* index_buffer;
+        if (use_mmap) {
+            // Embree only reads from shared buffers, the pages stay clean and
+            // are shared with other processes mapping the same file.
+            void* base = const_cast<char*>(data);
+            rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_VERTEX, 0,
+                                       RTC_FORMAT_FLOAT3, base,
+                                       record.vertex_offset, 3 * sizeof(float),
+                                       record.num_vertices);
+            rtcSetSharedGeometryBuffer(geom, RTC_BUFFER_TYPE_INDEX, 0,
+                                       RTC_FORMAT_UINT3, base,
+                                       record.index_offset,
+                                       3 * sizeof(uint32_t),
+                                       record.num_triangles);
+            vertex_buffer = data + record.vertex_offset;
+            index_buffer = data + record.index_offset;
+        } else {
+            void* vertex_dst = rtcSetNewGeometryBuffer(
+                    geom, RTC_BUFFER_TYPE_VERTEX, 0, RTC_FORMAT_FLOAT3,
+                    3 * sizeof(float), record.num_vertices);
+            void* index_dst = rtcSetNewGeometryBuffer(
+                    geom, RTC_BUFFER_TYPE_INDEX, 0, RTC_FORMAT_UINT3,
+                    3 * sizeof(uint32_t), record.num_triangles);
+            ReadAt(record.vertex_offset, vertex_dst, vertices_size);
+            ReadAt(record.index_offset, index_dst, indices_size);
+            vertex_buffer = vertex_dst;
+            index_buffer = index_dst;
+        }
+        // Embree does not check the indices, so a corrupted index would read
+        // outside of the vertex buffer, i.e. outside of the mapped file.
+        const uint32_t* indices = static_cast<const uint32_t*>(index_buffer);
+        for (uint64_t i = 0; i < 3 * record.num_triangles; ++i) {
+            if (indices[i] >= record.num_vertices) {
+                rtcReleaseGeometry(geom);
+                utility::LogError("RaycastingScene file {} is corrupted.",
+                                  file_name);
+            }
+        }
+        rtcCommitGeometry(geom);
+        rtcAttachGeometryByID(impl->scene_, geom, record.geometry_id);
+        rtcReleaseGeometry(geom);
+
+        impl->geometry_ptrs_[record.geometry_id] = std::make_tuple(
+                RTC_GEOMETRY_TYPE_TRIANGLE, vertex_buffer, index_buffer);
+        impl->geometry_sizes_[record.geometry_id] =
+                std::make_pair(record.num_vertices, record.num_triangles);
+    }
+    impl->scene_committed_ = false;
+    return scene;
+}
+
 std::unordered_map<std::string, core::Tensor> RaycastingScene::CastRays(
         const core::Tensor& rays, const int nthreads) {
     AssertTensorDtypeLastDimDeviceMinNDim<float>(rays, "rays", 6,
@@ -720,6 +1249,82 @@ core::Tensor RaycastingScene::ComputeOccupancy(const core::Tensor& query_points,
     return intersections.To(core::Float32).Reshape(shape);
 }
 
+core::Tensor RaycastingScene::ComputeSignedDistanceGrid(
+        const core::Tensor& min_bound,
+        const core::Tensor& max_bound,
+        const core::SizeVector& resolution,
+        const int nthreads) {
+    Eigen::Vector3f origin, cell_size;
+    std::tie(origin, cell_size) =
+            GetGridOriginAndCellSize(min_bound, max_bound, resolution);
+    core::Tensor result(resolution, core::Float32);
+    impl_->ComputeGrid<true>(origin, cell_size, resolution, 0, resolution[0],
+                             result.GetDataPtr<float>(), nthreads);
+    return result;
+}
+
+void RaycastingScene::ComputeSignedDistanceGrid(
+        const core::Tensor& min_bound,
+        const core::Tensor& max_bound,
+        const core::SizeVector& resolution,
+        const std::function<void(int64_t, const core::Tensor&)>& callback,
+        const int64_t chunk_size,
+        const int nthreads) {
+    Eigen::Vector3f origin, cell_size;
+    std::tie(origin, cell_size) =
+            GetGridOriginAndCellSize(min_bound, max_bound, resolution);
+    if (chunk_size <= 0) {
+        utility::LogError("chunk_size must be positive but got {}.",
+                          chunk_size);
+    }
+    for (int64_t x_begin = 0; x_begin < resolution[0]; x_begin += chunk_size) {
+        const int64_t x_end = std::min(x_begin + chunk_size, resolution[0]);
+        core::Tensor chunk({x_end - x_begin, resolution[1], resolution[2]},
+                           core::Float32);
+        impl_->ComputeGrid<true>(origin, cell_size, resolution, x_begin, x_end,
+                                 chunk.GetDataPtr<float>(), nthreads);
+        callback(x_begin, chunk);
+    }
+}
+
+core::Tensor RaycastingScene::ComputeOccupancyGrid(
+        const core::Tensor& min_bound,
+        const core::Tensor& max_bound,
+        const core::SizeVector& resolution,
+        const int nthreads) {
+    Eigen::Vector3f origin, cell_size;
+    std::tie(origin, cell_size) =
+            GetGridOriginAndCellSize(min_bound, max_bound, resolution);
+    core::Tensor result(resolution, core::Float32);
+    impl_->ComputeGrid<false>(origin, cell_size, resolution, 0, resolution[0],
+                              result.GetDataPtr<float>(), nthreads);
+    return result;
+}
+
+void RaycastingScene::ComputeOccupancyGrid(
+        const core::Tensor& min_bound,
+        const core::Tensor& max_bound,
+        const core::SizeVector& resolution,
+        const std::function<void(int64_t, const core::Tensor&)>& callback,
+        const int64_t chunk_size,
+        const int nthreads) {
+    Eigen::Vector3f origin, cell_size;
+    std::tie(origin, cell_size) =
+            GetGridOriginAndCellSize(min_bound, max_bound, resolution);
+    if (chunk_size <= 0) {
+        utility::LogError("chunk_size must be positive but got {}.",
+                          chunk_size);
+    }
+    for (int64_t x_begin = 0; x_begin < resolution[0]; x_begin += chunk_size) {
+        const int64_t x_end = std::min(x_begin + chunk_size, resolution[0]);
+        core::Tensor chunk({x_end - x_begin, resolution[1], resolution[2]},
+                           core::Float32);
+        impl_->ComputeGrid<false>(origin, cell_size, resolution, x_begin,
+                                  x_end, chunk.GetDataPtr<float>(), nthreads);
+        callback(x_begin, chunk);
+    }
+}
+
 core::Tensor RaycastingScene::CreateRaysPinhole(
         const core::Tensor& intrinsic_matrix,
         const core::Tensor& extrinsic_matrix,
@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "open3d/Macro.h"
@@ -65,6 +66,36 @@ public:
     /// \return The geometry ID of the added mesh.
     uint32_t AddTriangles(const TriangleMesh &mesh);
 
+    /// \brief Builds the acceleration structure of the scene.
+    ///
+    /// The acceleration structure is built lazily by the first query after
+    /// geometry has been added. Calling this function builds it eagerly, e.g.,
+    /// before forking worker processes that share the scene read-only.
+    void Commit();
+
+    /// \brief Saves the geometry of the scene to a binary file.
+    ///
+    /// The file starts with a versioned header followed by the geometry IDs,
+    /// vertex positions and triangle indices of all meshes in the scene. The
+    /// buffers are stored in the layout used by the acceleration structure
+    /// such that Load() can use them without conversion.
+    /// \param file_name The path of the file to write.
+    void Save(const std::string &file_name) const;
+
+    /// \brief Loads a scene previously written with Save().
+    ///
+    /// The loaded scene assigns the same geometry IDs to its meshes as the
+    /// saved scene. Note that the acceleration structure itself is not stored
+    /// and is built by the first query or by calling Commit().
+    /// \param file_name The path of the file to read.
+    /// \param use_mmap If true, the file is memory mapped and the vertex and
+    /// index buffers are used in place without copying. The read-only pages are
+    /// shared between all processes that map the same file. The file must not
+    /// be modified while the scene is alive.
+    /// \return The restored scene.
+    static std::unique_ptr<RaycastingScene> Load(const std::string &file_name,
+                                                 bool use_mmap = false);
+
     /// \brief Computes the first intersection of the rays with the scene.
     /// \param rays A tensor with >=2 dims, shape {.., 6}, and Dtype Float32
     /// describing the rays.
@@ -192,6 +223,88 @@ public:
     core::Tensor ComputeOccupancy(const core::Tensor &query_points,
                                   const int nthreads = 0);
 
+    /// \brief Computes the signed distance on a regular grid.
+    ///
+    /// This function computes the same values as ComputeSignedDistance() for
+    /// the cell centers of a regular grid but exploits the coherence of the
+    /// query points. The cells are processed in tiles, a single closest point
+    /// query per tile bounds the search radius for all cells in the tile and
+    /// the sign is computed once for tiles that do not intersect the surface.
+    ///
+    /// \param min_bound The minimum bound of the grid with shape {3}.
+    /// \param max_bound The maximum bound of the grid with shape {3}.
+    /// \param resolution The number of cells along each axis {nx, ny, nz}.
+    /// The query point of the cell with index (i,j,k) is
+    /// min_bound + ((i,j,k) + 0.5) * (max_bound - min_bound) / resolution.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \return A tensor with the signed distances with shape {nx, ny, nz}.
+    core::Tensor ComputeSignedDistanceGrid(const core::Tensor &min_bound,
+                                           const core::Tensor &max_bound,
+                                           const core::SizeVector &resolution,
+                                           const int nthreads = 0);
+
+    /// \brief Computes the signed distance on a regular grid in chunks.
+    ///
+    /// Same as above but the result is passed chunk by chunk to the callback
+    /// such that only a single chunk is kept in memory.
+    ///
+    /// \param min_bound The minimum bound of the grid with shape {3}.
+    /// \param max_bound The maximum bound of the grid with shape {3}.
+    /// \param resolution The number of cells along each axis {nx, ny, nz}.
+    /// \param callback The function called for each chunk with the index of
+    /// the first slice along the x axis and the signed distances of the chunk
+    /// with shape {chunk_size, ny, nz}. The last chunk may be smaller.
+    /// \param chunk_size The number of slices along the x axis per chunk.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    void ComputeSignedDistanceGrid(
+            const core::Tensor &min_bound,
+            const core::Tensor &max_bound,
+            const core::SizeVector &resolution,
+            const std::function<void(int64_t, const core::Tensor &)>
+                    &callback,
+            const int64_t chunk_size = 64,
+            const int nthreads = 0);
+
+    /// \brief Computes the occupancy on a regular grid.
+    ///
+    /// This function computes the same values as ComputeOccupancy() for the
+    /// cell centers of a regular grid. Tiles of cells that do not intersect
+    /// the surface are classified with a single query.
+    ///
+    /// \param min_bound The minimum bound of the grid with shape {3}.
+    /// \param max_bound The maximum bound of the grid with shape {3}.
+    /// \param resolution The number of cells along each axis {nx, ny, nz}.
+    /// The query point of the cell with index (i,j,k) is
+    /// min_bound + ((i,j,k) + 0.5) * (max_bound - min_bound) / resolution.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    /// \return A tensor with the occupancy values with shape {nx, ny, nz}.
+    core::Tensor ComputeOccupancyGrid(const core::Tensor &min_bound,
+                                      const core::Tensor &max_bound,
+                                      const core::SizeVector &resolution,
+                                      const int nthreads = 0);
+
+    /// \brief Computes the occupancy on a regular grid in chunks.
+    ///
+    /// Same as above but the result is passed chunk by chunk to the callback
+    /// such that only a single chunk is kept in memory.
+    ///
+    /// \param min_bound The minimum bound of the grid with shape {3}.
+    /// \param max_bound The maximum bound of the grid with shape {3}.
+    /// \param resolution The number of cells along each axis {nx, ny, nz}.
+    /// \param callback The function called for each chunk with the index of
+    /// the first slice along the x axis and the occupancy values of the chunk
+    /// with shape {chunk_size, ny, nz}. The last chunk may be smaller.
+    /// \param chunk_size The number of slices along the x axis per chunk.
+    /// \param nthreads The number of threads to use. Set to 0 for automatic.
+    void ComputeOccupancyGrid(
+            const core::Tensor &min_bound,
+            const core::Tensor &max_bound,
+            const core::SizeVector &resolution,
+            const std::function<void(int64_t, const core::Tensor &)>
+                    &callback,
+            const int64_t chunk_size = 64,
+            const int nthreads = 0);
+
     /// \brief Creates rays for the given camera parameters.
     ///
     /// \param intrinsic_matrix The upper triangular intrinsic matrix with
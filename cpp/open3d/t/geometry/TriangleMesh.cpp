@@ -31,16 +31,23 @@
 #include <vtkPlane.h>
 
 #include <Eigen/Core>
+#include <memory>
 #include <string>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "open3d/core/Dispatch.h"
 #include "open3d/core/EigenConverter.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/geometry/LoopSubdivision.h"
+#include "open3d/geometry/SurfaceReconstructionPoisson.h"
+#include "open3d/geometry/TriangleMeshTopology.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/kernel/PointCloud.h"
 #include "open3d/t/geometry/kernel/Transform.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
 #include "open3d/t/geometry/kernel/VtkUtils.h"
 
 namespace open3d {
@@ -283,6 +290,133 @@ TriangleMesh TriangleMesh::ComputeConvexHull(bool joggle_inputs) const {
     return pcd.ComputeConvexHull();
 }
 
+namespace {
+
+/// Writes the Poisson reconstruction into CPU tensors of dtype scalar_t.
+template <typename scalar_t>
+class TensorMeshSink : public open3d::geometry::poisson::MeshSink {
+public:
+    TensorMeshSink(core::Dtype dtype, bool has_colors)
+        : dtype_(dtype), has_colors_(has_colors) {}
+
+    void Resize(size_t num_vertices, size_t num_triangles) override {
+        const int64_t nv = static_cast<int64_t>(num_vertices);
+        const int64_t nt = static_cast<int64_t>(num_triangles);
+        positions_ = core::Tensor::Empty({nv, 3}, dtype_);
+        normals_ = core::Tensor::Empty({nv, 3}, dtype_);
+        if (has_colors_) {
+            colors_ = core::Tensor::Empty({nv, 3}, dtype_);
+        }
+        densities_ = core::Tensor::Empty({nv}, dtype_);
+        triangles_ = core::Tensor::Empty({nt, 3}, core::Int64);
+        positions_ptr_ = positions_.GetDataPtr<scalar_t>();
+        normals_ptr_ = normals_.GetDataPtr<scalar_t>();
+        colors_ptr_ = has_colors_ ? colors_.GetDataPtr<scalar_t>() : nullptr;
+        densities_ptr_ = densities_.GetDataPtr<scalar_t>();
+        triangles_ptr_ = triangles_.GetDataPtr<int64_t>();
+    }
+
+    void SetVertex(size_t index,
+                   const double *position,
+                   const double *normal,
+                   const double *color,
+                   double density) override {
+        for (size_t i = 0; i < 3; ++i) {
+            positions_ptr_[3 * index + i] = static_cast<scalar_t>(position[i]);
+            normals_ptr_[3 * index + i] = static_cast<scalar_t>(normal[i]);
+            if (colors_ptr_ != nullptr) {
+                colors_ptr_[3 * index + i] = static_cast<scalar_t>(color[i]);
+            }
+        }
+        densities_ptr_[index] = static_cast<scalar_t>(density);
+    }
+
+    void SetTriangle(size_t index, int v0, int v1, int v2) override {
+        triangles_ptr_[3 * index + 0] = v0;
+        triangles_ptr_[3 * index + 1] = v1;
+        triangles_ptr_[3 * index + 2] = v2;
+    }
+
+    core::Dtype dtype_;
+    bool has_colors_;
+    core::Tensor positions_;
+    core::Tensor normals_;
+    core::Tensor colors_;
+    core::Tensor densities_;
+    core::Tensor triangles_;
+
+private:
+    scalar_t *positions_ptr_ = nullptr;
+    scalar_t *normals_ptr_ = nullptr;
+    scalar_t *colors_ptr_ = nullptr;
+    scalar_t *densities_ptr_ = nullptr;
+    int64_t *triangles_ptr_ = nullptr;
+};
+
+}  // namespace
+
+std::tuple<TriangleMesh, std::vector<std::pair<std::string, double>>>
+TriangleMesh::CreateFromPointCloudPoisson(const PointCloud &pcd,
+                                          size_t depth,
+                                          float width,
+                                          float scale,
+                                          bool linear_fit,
+                                          int n_threads,
+                                          double max_memory_mb) {
+    namespace poisson = open3d::geometry::poisson;
+    if (!pcd.HasPointNormals()) {
+        utility::LogError("PointCloud has no normals.");
+    }
+    const core::Tensor &pcd_positions = pcd.GetPointPositions();
+    core::AssertTensorDtypes(pcd_positions, {core::Float32, core::Float64});
+
+    // These are no-ops, i.e. the solver streams the caller's memory, if the
+    // attributes already are contiguous CPU tensors of the positions dtype.
+    const core::Device host("CPU:0");
+    const core::Dtype dtype = pcd_positions.GetDtype();
+    const bool has_colors = pcd.HasPointColors();
+    const core::Tensor positions = pcd_positions.To(host).Contiguous();
+    const core::Tensor normals =
+            pcd.GetPointNormals().To(host, dtype).Contiguous();
+    const core::Tensor colors =
+            has_colors ? pcd.GetPointColors().To(host, dtype).Contiguous()
+                       : core::Tensor();
+
+    poisson::PointBuffer buffer;
+    buffer.points = positions.GetDataPtr();
+    buffer.normals = normals.GetDataPtr();
+    buffer.colors = has_colors ? colors.GetDataPtr() : nullptr;
+    buffer.num_points = static_cast<size_t>(positions.GetLength());
+    buffer.is_double = dtype == core::Float64;
+
+    poisson::Parameters params;
+    params.depth = static_cast<int>(depth);
+    params.width = width;
+    params.scale = scale;
+    params.linear_fit = linear_fit;
+    params.n_threads = n_threads;
+    params.max_memory_mb = max_memory_mb;
+
+    TriangleMesh mesh(pcd.GetDevice());
+    std::vector<std::pair<std::string, double>> stage_times;
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(dtype, [&]() {
+        TensorMeshSink<scalar_t> sink(dtype, has_colors);
+        stage_times = poisson::Reconstruct(buffer, params, sink);
+
+        const core::Device &device = pcd.GetDevice();
+        mesh.SetVertexPositions(sink.positions_.To(device));
+        mesh.SetVertexNormals(sink.normals_.To(device));
+        if (has_colors) {
+            mesh.SetVertexColors(sink.colors_.To(
+                    device, pcd.GetPointColors().GetDtype()));
+        }
+        mesh.SetVertexAttr("densities", sink.densities_.To(device));
+        mesh.SetTriangleIndices(sink.triangles_.To(device));
+    });
+
+    return std::make_tuple(mesh, stage_times);
+}
+
 TriangleMesh TriangleMesh::ClipPlane(const core::Tensor &point,
                                      const core::Tensor &normal) const {
     using namespace kernel::vtkutils;
@@ -312,6 +446,223 @@ TriangleMesh TriangleMesh::ClipPlane(const core::Tensor &point,
     return CreateTriangleMeshFromVtkPolyData(clipped_polydata);
 }
 
+namespace {
+
+/// Vertex attributes that vertex filters and subdivision update: the
+/// positions, and the normals and colors with the shape and dtype of the
+/// positions.
+std::vector<std::string> GetFilteredVertexAttrKeys(const TriangleMesh &mesh) {
+    const core::Tensor &positions = mesh.GetVertexPositions();
+    std::vector<std::string> keys = {"positions"};
+    for (const std::string key : {"normals", "colors"}) {
+        if (mesh.HasVertexAttr(key) &&
+            mesh.GetVertexAttr(key).GetDtype() == positions.GetDtype() &&
+            mesh.GetVertexAttr(key).GetShape() == positions.GetShape()) {
+            keys.push_back(key);
+        }
+    }
+    return keys;
+}
+
+/// Builds the topology of the triangles on the CPU and checks that they only
+/// reference existing vertices.
+std::shared_ptr<open3d::geometry::TriangleMeshTopology> ComputeTopology(
+        const std::vector<Eigen::Vector3i> &triangles, int64_t num_vertices) {
+    auto topology = std::make_shared<open3d::geometry::TriangleMeshTopology>(
+            triangles, size_t(num_vertices));
+    if (int64_t(topology->num_vertices_) > num_vertices) {
+        utility::LogError(
+                "Triangle index {} is out of range for {} vertices.",
+                topology->num_vertices_ - 1, num_vertices);
+    }
+    return topology;
+}
+
+/// Runs number_of_iterations iterations of a vertex filter with one pass per
+/// strength in \p strengths.
+TriangleMesh FilterVertices(const TriangleMesh &mesh,
+                            int number_of_iterations,
+                            kernel::trianglemesh::VertexFilterType type,
+                            const std::vector<double> &strengths) {
+    TriangleMesh filtered = mesh.Clone();
+    if (!mesh.HasVertexPositions() || number_of_iterations <= 0) {
+        return filtered;
+    }
+    const core::Tensor &positions = mesh.GetVertexPositions();
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    const core::Device device = mesh.GetDevice();
+    const int64_t num_vertices = positions.GetLength();
+
+    std::vector<Eigen::Vector3i> triangles;
+    if (mesh.HasTriangleIndices()) {
+        triangles = core::eigen_converter::TensorToEigenVector3iVector(
+                mesh.GetTriangleIndices());
+    }
+    const auto topology = ComputeTopology(triangles, num_vertices);
+    const core::Tensor adjacency_offsets(
+            topology->vertex_offsets_,
+            {int64_t(topology->vertex_offsets_.size())}, core::Int64, device);
+    const core::Tensor adjacency_neighbors(
+            topology->vertex_neighbors_,
+            {int64_t(topology->vertex_neighbors_.size())}, core::Int32,
+            device);
+
+    // Every pass reads values and writes buffers, then the two are swapped.
+    // The positions are only swapped after all attributes read them.
+    const std::vector<std::string> keys = GetFilteredVertexAttrKeys(mesh);
+    std::vector<core::Tensor> values, buffers;
+    for (const std::string &key : keys) {
+        values.push_back(filtered.GetVertexAttr(key).Contiguous());
+        buffers.push_back(core::Tensor::Empty(values.back().GetShape(),
+                                              values.back().GetDtype(),
+                                              device));
+    }
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        for (double strength : strengths) {
+            for (size_t k = 0; k < keys.size(); ++k) {
+                kernel::trianglemesh::FilterVertexAttr(
+                        adjacency_offsets, adjacency_neighbors, values[0],
+                        values[k], buffers[k], type, strength);
+            }
+            std::swap(values, buffers);
+        }
+    }
+    for (size_t k = 0; k < keys.size(); ++k) {
+        filtered.SetVertexAttr(keys[k], values[k]);
+    }
+    return filtered;
+}
+
+}  // namespace
+
+TriangleMesh TriangleMesh::FilterSharpen(int number_of_iterations,
+                                         double strength) const {
+    return FilterVertices(*this, number_of_iterations,
+                          kernel::trianglemesh::VertexFilterType::Sharpen,
+                          {strength});
+}
+
+TriangleMesh TriangleMesh::FilterSmoothSimple(int number_of_iterations) const {
+    return FilterVertices(*this, number_of_iterations,
+                          kernel::trianglemesh::VertexFilterType::SmoothSimple,
+                          {0});
+}
+
+TriangleMesh TriangleMesh::FilterSmoothLaplacian(int number_of_iterations,
+                                                 double lambda_filter) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            kernel::trianglemesh::VertexFilterType::SmoothLaplacian,
+            {lambda_filter});
+}
+
+TriangleMesh TriangleMesh::FilterSmoothTaubin(int number_of_iterations,
+                                              double lambda_filter,
+                                              double mu) const {
+    return FilterVertices(
+            *this, number_of_iterations,
+            kernel::trianglemesh::VertexFilterType::SmoothLaplacian,
+            {lambda_filter, mu});
+}
+
+TriangleMesh TriangleMesh::SubdivideLoop(int number_of_iterations) const {
+    if (!HasVertexPositions() || number_of_iterations <= 0) {
+        return Clone();
+    }
+    const core::Tensor &positions = GetVertexPositions();
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    const core::Dtype float_dtype = positions.GetDtype();
+
+    const std::vector<std::string> keys = GetFilteredVertexAttrKeys(*this);
+    if (keys.size() < vertex_attr_.size() ||
+        triangle_attr_.size() > size_t(HasTriangleIndices() ? 1 : 0)) {
+        utility::LogWarning(
+                "[SubdivideLoop] Only vertex positions, normals and colors "
+                "are subdivided. Other attributes are dropped.");
+    }
+    std::vector<core::Tensor> values;
+    for (const std::string &key : keys) {
+        values.push_back(GetVertexAttr(key).Contiguous());
+    }
+
+    std::vector<Eigen::Vector3i> triangles;
+    core::Dtype int_dtype = core::Int64;
+    if (HasTriangleIndices()) {
+        triangles = core::eigen_converter::TensorToEigenVector3iVector(
+                GetTriangleIndices());
+        int_dtype = GetTriangleIndices().GetDtype();
+    }
+
+    // The stencils are built on the CPU and applied on the device.
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        const int64_t num_vertices = values[0].GetLength();
+        const auto topology = ComputeTopology(triangles, num_vertices);
+        open3d::geometry::LoopSubdivision subdivision(triangles, *topology,
+                                                      size_t(num_vertices));
+        const int64_t num_stencil_entries =
+                int64_t(subdivision.stencil_vertices_.size());
+        const core::Tensor stencil_offsets(
+                subdivision.stencil_offsets_,
+                {int64_t(subdivision.stencil_offsets_.size())}, core::Int64,
+                device_);
+        const core::Tensor stencil_vertices(subdivision.stencil_vertices_,
+                                            {num_stencil_entries}, core::Int32,
+                                            device_);
+        const core::Tensor stencil_weights =
+                core::Tensor(subdivision.stencil_weights_,
+                             {num_stencil_entries}, core::Float64, device_)
+                        .To(float_dtype);
+        for (core::Tensor &value : values) {
+            core::Tensor subdivided = core::Tensor::Empty(
+                    {int64_t(subdivision.NumVertices()), 3}, float_dtype,
+                    device_);
+            kernel::trianglemesh::ApplyVertexStencils(
+                    stencil_offsets, stencil_vertices, stencil_weights, value,
+                    subdivided);
+            value = subdivided;
+        }
+        triangles = std::move(subdivision.triangles_);
+    }
+
+    TriangleMesh mesh(device_);
+    for (size_t k = 0; k < keys.size(); ++k) {
+        mesh.SetVertexAttr(keys[k], values[k]);
+    }
+    mesh.SetTriangleIndices(core::eigen_converter::EigenVector3iVectorToTensor(
+            triangles, int_dtype, device_));
+    return mesh;
+}
+
+PointCloud TriangleMesh::SamplePointsPoissonDisk(size_t number_of_points,
+                                                 double init_factor,
+                                                 bool use_triangle_normal,
+                                                 int seed) const {
+    const core::Tensor &positions = GetVertexPositions();
+    core::AssertTensorDtypes(positions, {core::Float32, core::Float64});
+    if (!HasTriangleIndices()) {
+        utility::LogError("Input mesh has no triangles.");
+    }
+
+    // Only convert the attributes that are sampled.
+    TriangleMesh mesh(positions, GetTriangleIndices());
+    if (HasVertexNormals()) {
+        mesh.SetVertexNormals(GetVertexNormals());
+    }
+    if (HasVertexColors()) {
+        mesh.SetVertexColors(GetVertexColors());
+    }
+    if (HasTriangleNormals()) {
+        mesh.SetTriangleNormals(GetTriangleNormals());
+    }
+    open3d::geometry::TriangleMesh mesh_legacy = mesh.ToLegacy();
+    std::shared_ptr<open3d::geometry::PointCloud> pcd_legacy =
+            mesh_legacy.SamplePointsPoissonDisk(number_of_points, init_factor,
+                                                nullptr, use_triangle_normal,
+                                                seed);
+    return PointCloud::FromLegacy(*pcd_legacy, positions.GetDtype(),
+                                  GetDevice());
+}
+
 }  // namespace geometry
 }  // namespace t
 }  // namespace open3d
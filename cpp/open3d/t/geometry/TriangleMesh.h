@@ -26,6 +26,11 @@
 
 #pragma once
 
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/geometry/TriangleMesh.h"
@@ -37,6 +42,8 @@ namespace open3d {
 namespace t {
 namespace geometry {
 
+class PointCloud;
+
 /// \class TriangleMesh
 /// \brief A triangle mesh contains vertices and triangles.
 ///
@@ -440,6 +447,90 @@ public:
     TriangleMesh ClipPlane(const core::Tensor &point,
                            const core::Tensor &normal) const;
 
+    /// \brief Sharpens the mesh with
+    /// \f$v_o = v_i + strength (v_i * |N| - \sum_{n \in N} v_n)\f$, where
+    /// \f$N\f$ is the set of adjacent vertices.
+    ///
+    /// The vertex positions are filtered, and so are the vertex normals and
+    /// colors that have the dtype of the positions. The vertex adjacency is
+    /// built once on the CPU, and every iteration runs in parallel on the
+    /// device of the mesh.
+    ///
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param strength Strength of the filter.
+    /// \return The filtered mesh.
+    TriangleMesh FilterSharpen(int number_of_iterations = 1,
+                               double strength = 1.0) const;
+
+    /// \brief Smooths the mesh with the neighbour average
+    /// \f$v_o = \frac{v_i + \sum_{n \in N} v_n}{|N| + 1}\f$.
+    ///
+    /// Filters the same attributes as FilterSharpen.
+    ///
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \return The filtered mesh.
+    TriangleMesh FilterSmoothSimple(int number_of_iterations = 1) const;
+
+    /// \brief Smooths the mesh with the Laplacian
+    /// \f$v_o = v_i + \lambda (\sum_{n \in N} w_n v_n - v_i)\f$, where the
+    /// weights \f$w_n\f$ are the normalized inverse distances to the
+    /// neighbours.
+    ///
+    /// Filters the same attributes as FilterSharpen.
+    ///
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param lambda_filter Smoothing parameter.
+    /// \return The filtered mesh.
+    TriangleMesh FilterSmoothLaplacian(int number_of_iterations = 1,
+                                       double lambda_filter = 0.5) const;
+
+    /// \brief Smooths the mesh with the method of Taubin, "Curve and Surface
+    /// Smoothing Without Shrinkage", 1995. Every iteration applies
+    /// FilterSmoothLaplacian with \p lambda_filter and then with \p mu.
+    ///
+    /// \param number_of_iterations Number of repetitions of the filter.
+    /// \param lambda_filter First smoothing parameter.
+    /// \param mu Second smoothing parameter.
+    /// \return The filtered mesh.
+    TriangleMesh FilterSmoothTaubin(int number_of_iterations = 1,
+                                    double lambda_filter = 0.5,
+                                    double mu = -0.53) const;
+
+    /// \brief Subdivides the mesh with Loop's algorithm, "Smooth subdivision
+    /// surfaces based on triangles", 1987.
+    ///
+    /// Every iteration splits each triangle into four. The vertex positions,
+    /// and the vertex normals and colors that have the dtype of the
+    /// positions, are subdivided. Other attributes are dropped. The linear
+    /// subdivision stencils are built on the CPU and applied on the device of
+    /// the mesh.
+    ///
+    /// \param number_of_iterations Number of subdivision iterations.
+    /// \return The subdivided mesh.
+    TriangleMesh SubdivideLoop(int number_of_iterations = 1) const;
+
+    /// \brief Samples points from the mesh with Poisson disk sampling, using
+    /// the sample elimination of Yuksel, "Sample Elimination for Generating
+    /// Poisson Disk Sample Sets", 2015.
+    ///
+    /// This runs on the CPU with the legacy implementation. The points get
+    /// the interpolated vertex normals and colors, and the point cloud is on
+    /// the device of the mesh with the dtype of the vertex positions.
+    ///
+    /// \param number_of_points Number of points that should be sampled.
+    /// \param init_factor Factor for the number of uniformly sampled points
+    /// that the elimination starts from.
+    /// \param use_triangle_normal If true, assigns the triangle normals
+    /// instead of the interpolated vertex normals to the points. The triangle
+    /// normals are computed if the mesh does not have them.
+    /// \param seed Seed of the random generator, or -1 to use a random seed
+    /// with each call.
+    /// \return The sampled point cloud.
+    PointCloud SamplePointsPoissonDisk(size_t number_of_points,
+                                       double init_factor = 5,
+                                       bool use_triangle_normal = false,
+                                       int seed = -1) const;
+
     core::Device GetDevice() const { return device_; }
 
     /// Create a TriangleMesh from a legacy Open3D TriangleMesh.
@@ -474,6 +565,41 @@ public:
     /// corresponding vertex in the original mesh.
     TriangleMesh ComputeConvexHull(bool joggle_inputs = false) const;
 
+    /// \brief Function that computes a triangle mesh from an oriented
+    /// PointCloud \p pcd. This implements the Screened Poisson Reconstruction
+    /// proposed in Kazhdan and Hoppe, "Screened Poisson Surface
+    /// Reconstruction", 2013. This runs on the CPU. Positions, normals and
+    /// colors that are contiguous Float32 or Float64 CPU tensors are read in
+    /// place without copying.
+    ///
+    /// \param pcd PointCloud with normals and optionally colors.
+    /// \param depth Maximum depth of the tree that will be used for surface
+    /// reconstruction.
+    /// \param width Specifies the target width of the finest level octree
+    /// cells. This parameter is ignored if depth is specified.
+    /// \param scale Specifies the ratio between the diameter of the cube used
+    /// for reconstruction and the diameter of the samples' bounding cube.
+    /// \param linear_fit If true, the reconstructor will use linear
+    /// interpolation to estimate the positions of iso-vertices.
+    /// \param n_threads Number of threads used for reconstruction. Set to -1
+    /// to automatically determine it.
+    /// \param max_memory_mb Abort the reconstruction once the process memory
+    /// sampled after a solver stage exceeds this many MB. No limit if <= 0.
+    /// \return The mesh, on the device of \p pcd, and the wall time in
+    /// seconds of every solver stage, in execution order and ending with the
+    /// "total" run. The mesh has
+    /// the vertex attribute "densities" with the sampling density at each
+    /// vertex, which can be used to trim the mesh.
+    static std::tuple<TriangleMesh,
+                      std::vector<std::pair<std::string, double>>>
+    CreateFromPointCloudPoisson(const PointCloud &pcd,
+                                size_t depth = 8,
+                                float width = 0.0f,
+                                float scale = 1.1f,
+                                bool linear_fit = false,
+                                int n_threads = -1,
+                                double max_memory_mb = 0.0);
+
 protected:
     core::Device device_ = core::Device("CPU:0");
     TensorMap vertex_attr_;
@@ -27,6 +27,8 @@
 #include "open3d/t/geometry/VoxelBlockGrid.h"
 
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorFunction.h"
+#include "open3d/core/hashmap/HashSet.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/PointCloud.h"
 #include "open3d/t/geometry/Utility.h"
@@ -81,6 +83,18 @@ static TensorMap ConstructTensorMap(
     return tensor_map;
 }
 
+// Remove duplicates from buffer indices, output in ascending order.
+static core::Tensor UniqueBufferIndices(const core::Tensor &buf_indices,
+                                        int64_t capacity) {
+    core::Device device = buf_indices.GetDevice();
+    core::Tensor buf_masks =
+            core::Tensor::Zeros({capacity}, core::Bool, device);
+    buf_masks.IndexSet(
+            {buf_indices.To(core::Int64)},
+            core::Tensor::Ones({buf_indices.GetLength()}, core::Bool, device));
+    return buf_masks.NonZero()[0].To(core::Int32);
+}
+
 VoxelBlockGrid::VoxelBlockGrid(
         const std::vector<std::string> &attr_names,
         const std::vector<core::Dtype> &attr_dtypes,
@@ -285,6 +299,43 @@ core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
     return block_coords;
 }
 
+core::Tensor VoxelBlockGrid::GetUniqueBlockCoordinates(
+        const std::vector<Image> &depths,
+        const core::Tensor &intrinsic,
+        const std::vector<core::Tensor> &extrinsics,
+        float depth_scale,
+        float depth_max,
+        float trunc_voxel_multiplier) {
+    AssertInitialized();
+    if (depths.empty()) {
+        utility::LogError("Input depth images are empty.");
+    }
+    if (depths.size() != extrinsics.size()) {
+        utility::LogError(
+                "Number of depth images ({}) and extrinsics ({}) mismatch.",
+                depths.size(), extrinsics.size());
+    }
+
+    std::vector<core::Tensor> block_coords_list;
+    block_coords_list.reserve(depths.size());
+    for (size_t i = 0; i < depths.size(); ++i) {
+        block_coords_list.push_back(GetUniqueBlockCoordinates(
+                depths[i], intrinsic, extrinsics[i], depth_scale, depth_max,
+                trunc_voxel_multiplier));
+    }
+    if (block_coords_list.size() == 1) {
+        return block_coords_list[0];
+    }
+
+    // Remove duplicates across frames.
+    core::Tensor block_coords = core::Concatenate(block_coords_list, 0);
+    core::HashSet unique_set(block_coords.GetLength(), core::Int32,
+                             core::SizeVector{3}, block_coords.GetDevice());
+    core::Tensor buf_indices, masks;
+    unique_set.Insert(block_coords, buf_indices, masks);
+    return block_coords.IndexGet({masks});
+}
+
 void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
                                const Image &depth,
                                const core::Tensor &intrinsic,
@@ -332,6 +383,7 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
     core::Tensor buf_indices, masks;
     block_hashmap_->Activate(block_coords, buf_indices, masks);
     block_hashmap_->Find(block_coords, buf_indices, masks);
+    MarkBlocksDirty(block_coords);
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
@@ -344,6 +396,80 @@ void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
             voxel_size_ * trunc_voxel_multiplier, depth_scale, depth_max);
 }
 
+void VoxelBlockGrid::Integrate(const core::Tensor &block_coords,
+                               const std::vector<Image> &depths,
+                               const std::vector<Image> &colors,
+                               const core::Tensor &depth_intrinsic,
+                               const core::Tensor &color_intrinsic,
+                               const std::vector<core::Tensor> &extrinsics,
+                               float depth_scale,
+                               float depth_max,
+                               float trunc_voxel_multiplier) {
+    AssertInitialized();
+    if (depths.empty()) {
+        utility::LogError("Input depth images are empty.");
+    }
+    if (depths.size() != extrinsics.size()) {
+        utility::LogError(
+                "Number of depth images ({}) and extrinsics ({}) mismatch.",
+                depths.size(), extrinsics.size());
+    }
+    bool integrate_color = !colors.empty();
+    if (integrate_color && colors.size() != depths.size()) {
+        utility::LogError(
+                "Number of depth images ({}) and color images ({}) mismatch.",
+                depths.size(), colors.size());
+    }
+
+    CheckBlockCoorinates(block_coords);
+    CheckIntrinsicTensor(depth_intrinsic);
+    CheckIntrinsicTensor(color_intrinsic);
+
+    // Stack the frames into {F, H, W, C} tensors and {F, 4, 4} extrinsics.
+    const core::SizeVector depth_shape = depths[0].AsTensor().GetShape();
+    const core::SizeVector color_shape =
+            integrate_color ? colors[0].AsTensor().GetShape()
+                            : core::SizeVector{};
+    std::vector<core::Tensor> depth_list, color_list, extrinsic_list;
+    for (size_t i = 0; i < depths.size(); ++i) {
+        const core::Tensor depth = depths[i].AsTensor();
+        CheckDepthTensor(depth);
+        core::AssertTensorShape(depth, depth_shape);
+        depth_list.push_back(depth.Reshape({1, depth_shape[0], depth_shape[1],
+                                            depth_shape[2]}));
+        if (integrate_color) {
+            const core::Tensor color = colors[i].AsTensor();
+            CheckColorTensor(color);
+            core::AssertTensorShape(color, color_shape);
+            color_list.push_back(color.Reshape(
+                    {1, color_shape[0], color_shape[1], color_shape[2]}));
+        }
+        CheckExtrinsicTensor(extrinsics[i]);
+        extrinsic_list.push_back(
+                extrinsics[i].To(core::Float64).Reshape({1, 4, 4}));
+    }
+    core::Tensor depth_stack = core::Concatenate(depth_list, 0);
+    core::Tensor color_stack =
+            integrate_color ? core::Concatenate(color_list, 0) : core::Tensor();
+    core::Tensor extrinsic_stack = core::Concatenate(extrinsic_list, 0);
+
+    // Activate and look up the union of the blocks once for all the frames.
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Activate(block_coords, buf_indices, masks);
+    block_hashmap_->Find(block_coords, buf_indices, masks);
+    MarkBlocksDirty(block_coords);
+
+    core::Tensor block_keys = block_hashmap_->GetKeyTensor();
+    TensorMap block_value_map =
+            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+
+    kernel::voxel_grid::IntegrateFrames(
+            depth_stack, color_stack, buf_indices, block_keys, block_value_map,
+            depth_intrinsic, color_intrinsic, extrinsic_stack,
+            block_resolution_, voxel_size_,
+            voxel_size_ * trunc_voxel_multiplier, depth_scale, depth_max);
+}
+
 TensorMap VoxelBlockGrid::RayCast(const core::Tensor &block_coords,
                                   const core::Tensor &intrinsic,
                                   const core::Tensor &extrinsic,
@@ -425,6 +551,30 @@ PointCloud VoxelBlockGrid::ExtractPointCloud(float weight_threshold,
     AssertInitialized();
     core::Tensor active_buf_indices;
     block_hashmap_->GetActiveIndices(active_buf_indices);
+    return ExtractPointCloudFromBuffer(active_buf_indices, weight_threshold,
+                                       estimated_point_number);
+}
+
+PointCloud VoxelBlockGrid::ExtractPointCloud(const core::Tensor &block_coords,
+                                             float weight_threshold,
+                                             int estimated_point_number) {
+    AssertInitialized();
+    CheckBlockCoorinates(block_coords);
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Find(block_coords, buf_indices, masks);
+    buf_indices = UniqueBufferIndices(buf_indices.IndexGet({masks}),
+                                      block_hashmap_->GetCapacity());
+    return ExtractPointCloudFromBuffer(buf_indices, weight_threshold,
+                                       estimated_point_number);
+}
+
+PointCloud VoxelBlockGrid::ExtractPointCloudFromBuffer(
+        const core::Tensor &active_buf_indices,
+        float weight_threshold,
+        int estimated_point_number) {
+    if (active_buf_indices.GetLength() == 0) {
+        return PointCloud(block_hashmap_->GetDevice());
+    }
 
     core::Tensor active_nb_buf_indices, active_nb_masks;
     std::tie(active_nb_buf_indices, active_nb_masks) =
@@ -471,6 +621,7 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
                                iota_map);
 
     core::Tensor vertices, triangles, vertex_normals, vertex_colors;
+    core::Tensor triangle_block_indices;
 
     core::Tensor block_keys = block_hashmap_->GetKeyTensor();
     TensorMap block_value_map =
@@ -479,17 +630,180 @@ TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(float weight_threshold,
             active_buf_indices_i32, inverse_index_map, active_nb_buf_indices,
             active_nb_masks, block_keys, block_value_map, vertices, triangles,
             vertex_normals, vertex_colors, block_resolution_, voxel_size_,
-            weight_threshold, estimated_vertex_number);
+            weight_threshold, estimated_vertex_number,
+            /*num_surface_blocks=*/-1, triangle_block_indices);
+
+    TriangleMesh mesh(vertices, triangles);
+    mesh.SetVertexNormals(vertex_normals);
+    if (vertex_colors.GetLength() == vertices.GetLength()) {
+        mesh.SetVertexColors(vertex_colors);
+    }
+
+    return mesh;
+}
+
+TriangleMesh VoxelBlockGrid::ExtractTriangleMesh(
+        const core::Tensor &block_coords,
+        float weight_threshold,
+        int estimated_vertex_number) {
+    AssertInitialized();
+    CheckBlockCoorinates(block_coords);
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Find(block_coords, buf_indices, masks);
+    buf_indices = UniqueBufferIndices(buf_indices.IndexGet({masks}),
+                                      block_hashmap_->GetCapacity());
+    return ExtractTriangleMeshFromBuffer(buf_indices, weight_threshold,
+                                         estimated_vertex_number);
+}
+
+TriangleMesh VoxelBlockGrid::ExtractTriangleMeshFromBuffer(
+        const core::Tensor &surface_buf_indices,
+        float weight_threshold,
+        int estimated_vertex_number) {
+    core::Device device = block_hashmap_->GetDevice();
+    int64_t num_surface_blocks = surface_buf_indices.GetLength();
+    if (num_surface_blocks == 0) {
+        TriangleMesh mesh(core::Tensor({0, 3}, core::Float32, device),
+                          core::Tensor({0, 3}, core::Int32, device));
+        mesh.SetTriangleAttr("block_coords",
+                             core::Tensor({0, 3}, core::Int32, device));
+        return mesh;
+    }
+
+    // Vertices on the (+x, +y, +z) faces of a cube are stored in the
+    // neighbor blocks, so they join the workload without being triangulated.
+    int64_t capacity = block_hashmap_->GetCapacity();
+    core::Tensor surface_nb_buf_indices, surface_nb_masks;
+    std::tie(surface_nb_buf_indices, surface_nb_masks) =
+            BufferRadiusNeighbors(block_hashmap_, surface_buf_indices);
+    core::Tensor forward_nbs = core::Tensor::Init<int64_t>(
+            {13, 14, 16, 17, 22, 23, 25, 26}, device);
+    core::Tensor forward_nb_buf_indices =
+            surface_nb_buf_indices.IndexGet({forward_nbs});
+    core::Tensor forward_nb_masks = surface_nb_masks.IndexGet({forward_nbs});
+
+    core::Tensor boundary_masks =
+            core::Tensor::Zeros({capacity}, core::Bool, device);
+    core::Tensor forward_buf_indices =
+            forward_nb_buf_indices.IndexGet({forward_nb_masks})
+                    .To(core::Int64);
+    boundary_masks.IndexSet(
+            {forward_buf_indices},
+            core::Tensor::Ones({forward_buf_indices.GetLength()}, core::Bool,
+                               device));
+    boundary_masks.IndexSet(
+            {surface_buf_indices.To(core::Int64)},
+            core::Tensor::Zeros({num_surface_blocks}, core::Bool, device));
+    core::Tensor boundary_buf_indices =
+            boundary_masks.NonZero()[0].To(core::Int32);
+
+    core::Tensor buf_indices = core::Concatenate(
+            {surface_buf_indices, boundary_buf_indices}, 0);
+    int64_t num_blocks = buf_indices.GetLength();
+
+    core::Tensor nb_buf_indices, nb_masks;
+    std::tie(nb_buf_indices, nb_masks) =
+            BufferRadiusNeighbors(block_hashmap_, buf_indices);
+
+    core::Tensor inverse_index_map({capacity}, core::Int32, device);
+    core::Tensor iota_map =
+            core::Tensor::Arange(0, num_blocks, 1, core::Int32, device);
+    inverse_index_map.IndexSet({buf_indices.To(core::Int64)}, iota_map);
+
+    core::Tensor vertices, triangles, vertex_normals, vertex_colors;
+    core::Tensor triangle_block_indices;
+
+    core::Tensor block_keys = block_hashmap_->GetKeyTensor();
+    TensorMap block_value_map =
+            ConstructTensorMap(*block_hashmap_, name_attr_map_);
+    kernel::voxel_grid::ExtractTriangleMesh(
+            buf_indices, inverse_index_map, nb_buf_indices, nb_masks,
+            block_keys, block_value_map, vertices, triangles, vertex_normals,
+            vertex_colors, block_resolution_, voxel_size_, weight_threshold,
+            estimated_vertex_number, num_surface_blocks,
+            triangle_block_indices);
 
     TriangleMesh mesh(vertices, triangles);
     mesh.SetVertexNormals(vertex_normals);
     if (vertex_colors.GetLength() == vertices.GetLength()) {
         mesh.SetVertexColors(vertex_colors);
     }
+    mesh.SetTriangleAttr(
+            "block_coords",
+            block_keys.IndexGet({triangle_block_indices.To(core::Int64)}));
 
     return mesh;
 }
 
+std::pair<TriangleMesh, core::Tensor> VoxelBlockGrid::ExtractTriangleMeshUpdate(
+        float weight_threshold, int estimated_vertex_number) {
+    AssertInitialized();
+    core::Tensor buf_indices =
+            GetDirtyBufferIndices(/*include_neighbors=*/true);
+    core::Tensor block_coords = block_hashmap_->GetKeyTensor().IndexGet(
+            {buf_indices.To(core::Int64)});
+
+    TriangleMesh mesh = ExtractTriangleMeshFromBuffer(
+            buf_indices, weight_threshold, estimated_vertex_number);
+    ClearDirtyBlocks();
+    return std::make_pair(mesh, block_coords);
+}
+
+void VoxelBlockGrid::MarkBlocksDirty(const core::Tensor &block_coords) {
+    AssertInitialized();
+    CheckBlockCoorinates(block_coords);
+    if (block_coords.GetLength() == 0) {
+        return;
+    }
+    if (dirty_block_set_ == nullptr) {
+        dirty_block_set_ = std::make_shared<core::HashSet>(
+                block_coords.GetLength(), core::Int32, core::SizeVector{3},
+                block_hashmap_->GetDevice());
+    }
+    core::Tensor buf_indices, masks;
+    dirty_block_set_->Insert(block_coords, buf_indices, masks);
+}
+
+core::Tensor VoxelBlockGrid::GetDirtyBlockCoordinates(
+        bool include_neighbors) const {
+    AssertInitialized();
+    core::Tensor buf_indices = GetDirtyBufferIndices(include_neighbors);
+    return block_hashmap_->GetKeyTensor().IndexGet(
+            {buf_indices.To(core::Int64)});
+}
+
+void VoxelBlockGrid::ClearDirtyBlocks() {
+    AssertInitialized();
+    if (dirty_block_set_ != nullptr) {
+        dirty_block_set_->Clear();
+    }
+}
+
+core::Tensor VoxelBlockGrid::GetDirtyBufferIndices(
+        bool include_neighbors) const {
+    core::Device device = block_hashmap_->GetDevice();
+    if (dirty_block_set_ == nullptr || dirty_block_set_->Size() == 0) {
+        return core::Tensor({0}, core::Int32, device);
+    }
+
+    // Dirty coordinates are kept in a separate set, so that they survive
+    // rehashing of the block hash map.
+    core::Tensor dirty_coords = dirty_block_set_->GetKeyTensor().IndexGet(
+            {dirty_block_set_->GetActiveIndices().To(core::Int64)});
+    core::Tensor buf_indices, masks;
+    block_hashmap_->Find(dirty_coords, buf_indices, masks);
+    buf_indices = buf_indices.IndexGet({masks});
+
+    if (include_neighbors) {
+        std::shared_ptr<core::HashMap> block_hashmap = block_hashmap_;
+        core::Tensor nb_buf_indices, nb_masks;
+        std::tie(nb_buf_indices, nb_masks) =
+                BufferRadiusNeighbors(block_hashmap, buf_indices);
+        buf_indices = nb_buf_indices.IndexGet({nb_masks});
+    }
+    return UniqueBufferIndices(buf_indices, block_hashmap_->GetCapacity());
+}
+
 void VoxelBlockGrid::Save(const std::string &file_name) const {
     AssertInitialized();
     // TODO(wei): provide 'GetActiveKeyValues' functionality.
@@ -606,6 +920,7 @@ VoxelBlockGrid VoxelBlockGrid::Load(const std::string &file_name) {
                        block_resolution, keys.GetLength(), device);
     auto block_hashmap = vbg.GetHashMap();
     block_hashmap.Insert(keys, soa_value_tensor);
+    vbg.MarkBlocksDirty(keys);
     return vbg;
 }
 
@@ -28,6 +28,7 @@
 
 #include "open3d/core/Tensor.h"
 #include "open3d/core/hashmap/HashMap.h"
+#include "open3d/core/hashmap/HashSet.h"
 #include "open3d/t/geometry/Geometry.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/PointCloud.h"
@@ -139,6 +140,17 @@ public:
     core::Tensor GetUniqueBlockCoordinates(const PointCloud &pcd,
                                            float trunc_voxel_multiplier = 8.0);
 
+    /// Obtain the union of active block coordinates touched by a batch of
+    /// depth images, each with its own extrinsic. Duplicates across frames are
+    /// removed, so every block appears once.
+    core::Tensor GetUniqueBlockCoordinates(
+            const std::vector<Image> &depths,
+            const core::Tensor &intrinsic,
+            const std::vector<core::Tensor> &extrinsics,
+            float depth_scale = 1000.0f,
+            float depth_max = 3.0f,
+            float trunc_voxel_multiplier = 8.0);
+
     /// Specific operation for TSDF volumes.
     /// Integrate an RGB-D frame in the selected block coordinates using pinhole
     /// camera model.
@@ -184,6 +196,25 @@ public:
                    float depth_max = 3.0f,
                    float trunc_voxel_multiplier = 8.0f);
 
+    /// Specific operation for TSDF volumes.
+    /// Integrate a batch of RGB-D frames in the selected block coordinates.
+    /// Blocks are activated once for the whole batch, and each voxel is loaded
+    /// and stored once while the frames are fused in the given order, so the
+    /// result matches integrating the frames one by one.
+    /// All the depth images (and color images, if any) must share the same
+    /// size. \p colors can be empty for depth-only integration.
+    /// The block coordinates can be taken from the batched
+    /// GetUniqueBlockCoordinates.
+    void Integrate(const core::Tensor &block_coords,
+                   const std::vector<Image> &depths,
+                   const std::vector<Image> &colors,
+                   const core::Tensor &depth_intrinsic,
+                   const core::Tensor &color_intrinsic,
+                   const std::vector<core::Tensor> &extrinsics,
+                   float depth_scale = 1000.0f,
+                   float depth_max = 3.0f,
+                   float trunc_voxel_multiplier = 8.0f);
+
     /// Specific operation for TSDF volumes.
     /// Perform volumetric ray casting in the selected block coordinates.
     /// Return selected properties from the frame.
@@ -231,6 +262,48 @@ public:
     TriangleMesh ExtractTriangleMesh(float weight_threshold = 3.0f,
                                      int estimated_vertex_numer = -1);
 
+    /// Specific operation for TSDF volumes.
+    /// Extract point cloud at isosurface points, restricted to the voxels in
+    /// the given (N, 3) block coordinates. Inactive blocks are ignored.
+    PointCloud ExtractPointCloud(const core::Tensor &block_coords,
+                                 float weight_threshold = 3.0f,
+                                 int estimated_point_number = -1);
+
+    /// Specific operation for TSDF volumes.
+    /// Extract mesh with Marching Cubes, restricted to the cubes in the given
+    /// (N, 3) block coordinates. Inactive blocks are ignored.
+    /// Each block forms a self-contained chunk: the (T, 3) Int32 triangle
+    /// attribute "block_coords" stores the block that owns every triangle.
+    /// Vertices on the boundary of two requested blocks are shared, but not
+    /// with blocks outside the request.
+    TriangleMesh ExtractTriangleMesh(const core::Tensor &block_coords,
+                                     float weight_threshold = 3.0f,
+                                     int estimated_vertex_number = -1);
+
+    /// Specific operation for TSDF volumes.
+    /// Incremental mesh extraction. Re-mesh only the active blocks whose
+    /// surface may have changed since the last call, i.e. the dirty blocks and
+    /// their 26 neighbors, and clear the dirty blocks.
+    /// Return the mesh patch (with the triangle attribute "block_coords") and
+    /// the (M, 3) coordinates of the re-meshed blocks. A client keeping
+    /// per-block chunks replaces the chunks of these M blocks with the patch.
+    std::pair<TriangleMesh, core::Tensor> ExtractTriangleMeshUpdate(
+            float weight_threshold = 3.0f, int estimated_vertex_number = -1);
+
+    /// Mark blocks as modified. Integrate marks its block coordinates
+    /// automatically; call this after customized operations that write to
+    /// GetAttribute() tensors.
+    void MarkBlocksDirty(const core::Tensor &block_coords);
+
+    /// Get (N, 3) coordinates of the blocks modified since the last
+    /// ClearDirtyBlocks() or ExtractTriangleMeshUpdate(). With
+    /// \p include_neighbors, the active 26-neighbors of these blocks, whose
+    /// iso-surface may also have changed, are included.
+    core::Tensor GetDirtyBlockCoordinates(bool include_neighbors = false) const;
+
+    /// Reset dirty block tracking.
+    void ClearDirtyBlocks();
+
     /// Save a voxel block grid to a .npz file.
     void Save(const std::string &file_name) const;
 
@@ -240,6 +313,19 @@ public:
 private:
     void AssertInitialized() const;
 
+    // Active buffer indices of the dirty blocks and optionally their
+    // neighbors, without duplicates.
+    core::Tensor GetDirtyBufferIndices(bool include_neighbors) const;
+
+    PointCloud ExtractPointCloudFromBuffer(const core::Tensor &buf_indices,
+                                           float weight_threshold,
+                                           int estimated_point_number);
+
+    TriangleMesh ExtractTriangleMeshFromBuffer(
+            const core::Tensor &surface_buf_indices,
+            float weight_threshold,
+            int estimated_vertex_number);
+
     float voxel_size_ = -1;
     int64_t block_resolution_ = -1;
 
@@ -249,6 +335,9 @@ private:
     // Local hash map: 3D coords -> indices in block_hashmap_.
     std::shared_ptr<core::HashMap> frustum_hashmap_;
 
+    // Coordinates of blocks modified since the last incremental extraction.
+    std::shared_ptr<core::HashSet> dirty_block_set_;
+
     // Map: attribute name -> index to access the attribute in SoA.
     std::unordered_map<std::string, int> name_attr_map_;
 };
@@ -185,6 +185,8 @@ public:
         }
     }
 
+    /// Indexes \p ndarray for reading. Memory shared copy-on-write stays
+    /// shared, so the indexer must not be used for writing.
     TArrayIndexer(const core::Tensor& ndarray, index_t active_dims) {
         if (!ndarray.IsContiguous()) {
             utility::LogError(
@@ -218,6 +220,14 @@ public:
         ptr_ = const_cast<void*>(ndarray.GetDataPtr());
     }
 
+    /// Indexes \p ndarray for reading and writing. Memory shared
+    /// copy-on-write is detached first.
+    TArrayIndexer(core::Tensor& ndarray, index_t active_dims)
+        : TArrayIndexer(static_cast<const core::Tensor&>(ndarray),
+                        active_dims) {
+        ptr_ = ndarray.GetDataPtr();
+    }
+
     /// Only used for simple shapes
     TArrayIndexer(const core::SizeVector& shape) {
         index_t n = static_cast<index_t>(shape.size());
@@ -26,7 +26,11 @@
 
 #include "open3d/t/geometry/kernel/Image.h"
 
+#include <cmath>
+#include <vector>
+
 #include "open3d/core/CUDAUtils.h"
+
 namespace open3d {
 namespace t {
 namespace geometry {
@@ -123,6 +127,126 @@ void ColorizeDepth(const core::Tensor &src,
     }
 }
 
+void Filter(const core::Tensor &src,
+            core::Tensor &dst,
+            const core::Tensor &kernel) {
+    core::Device device = src.GetDevice();
+    core::Tensor kernel_d = kernel.To(device, core::Float32).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterCPU(src, dst, kernel_d);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterCUDA, src, dst, kernel_d);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel_x,
+                     const core::Tensor &kernel_y) {
+    core::Device device = src.GetDevice();
+    core::Tensor kernel_x_d = kernel_x.To(device, core::Float32).Contiguous();
+    core::Tensor kernel_y_d = kernel_y.To(device, core::Float32).Contiguous();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterSeparableCPU(src, dst, kernel_x_d, kernel_y_d);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterSeparableCUDA, src, dst, kernel_x_d, kernel_y_d);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void FilterGaussian(const core::Tensor &src,
+                    core::Tensor &dst,
+                    int kernel_size,
+                    float sigma) {
+    if (!(sigma > 0)) {
+        utility::LogError("sigma must be positive, but got {}.", sigma);
+    }
+    std::vector<float> weights(kernel_size);
+    const int radius = kernel_size / 2;
+    float sum = 0;
+    for (int i = 0; i < kernel_size; ++i) {
+        const float d = static_cast<float>(i - radius);
+        weights[i] = std::exp(-d * d / (2 * sigma * sigma));
+        sum += weights[i];
+    }
+    for (float &w : weights) {
+        w /= sum;
+    }
+    core::Tensor kernel(weights, {kernel_size}, core::Float32);
+    FilterSeparable(src, dst, kernel, kernel);
+}
+
+void FilterSobel(const core::Tensor &src,
+                 core::Tensor &dst_dx,
+                 core::Tensor &dst_dy,
+                 int kernel_size) {
+    // Right minus left (bottom minus top) derivative and binomial smoothing.
+    std::vector<float> derivative, smoothing;
+    if (kernel_size == 3) {
+        derivative = {-1, 0, 1};
+        smoothing = {1, 2, 1};
+    } else if (kernel_size == 5) {
+        derivative = {-1, -2, 0, 2, 1};
+        smoothing = {1, 4, 6, 4, 1};
+    } else {
+        utility::LogError("Unsupported kernel size {} for FilterSobel",
+                          kernel_size);
+    }
+    core::Tensor d(derivative, {kernel_size}, core::Float32);
+    core::Tensor s(smoothing, {kernel_size}, core::Float32);
+    FilterSeparable(src, dst_dx, d, s);
+    FilterSeparable(src, dst_dy, s, d);
+}
+
+void FilterBilateral(const core::Tensor &src,
+                     core::Tensor &dst,
+                     int kernel_size,
+                     float value_sigma,
+                     float distance_sigma) {
+    if (!(value_sigma > 0) || !(distance_sigma > 0)) {
+        utility::LogError(
+                "value_sigma and distance_sigma must be positive, but got {} "
+                "and {}.",
+                value_sigma, distance_sigma);
+    }
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        FilterBilateralCPU(src, dst, kernel_size, value_sigma, distance_sigma);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterBilateralCUDA, src, dst, kernel_size, value_sigma,
+                  distance_sigma);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Dilate(const core::Tensor &src, core::Tensor &dst, int kernel_size) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        DilateCPU(src, dst, kernel_size);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(DilateCUDA, src, dst, kernel_size);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void Resize(const core::Tensor &src,
+            core::Tensor &dst,
+            Image::InterpType interp_type) {
+    core::Device device = src.GetDevice();
+    if (device.GetType() == core::Device::DeviceType::CPU) {
+        ResizeCPU(src, dst, interp_type);
+    } else if (device.GetType() == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ResizeCUDA, src, dst, interp_type);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace image
 }  // namespace kernel
 }  // namespace geometry
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
 
 namespace open3d {
 namespace t {
@@ -66,6 +67,43 @@ void ColorizeDepth(const core::Tensor &src,
                    float min_value,
                    float max_value);
 
+/// Native filters and resampling, used where IPP (CPU) or NPP (CUDA) do not
+/// support the device, dtype or channel count. Borders are replicated. src
+/// and dst are contiguous {rows, cols, channels} images on the same device.
+void Filter(const core::Tensor &src,
+            core::Tensor &dst,
+            const core::Tensor &kernel);
+
+/// Filters with the outer product of the 1D Float32 kernels, i.e. kernel_y
+/// along the rows and kernel_x along the columns. dst may have a different
+/// dtype than src.
+void FilterSeparable(const core::Tensor &src,
+                     core::Tensor &dst,
+                     const core::Tensor &kernel_x,
+                     const core::Tensor &kernel_y);
+
+void FilterGaussian(const core::Tensor &src,
+                    core::Tensor &dst,
+                    int kernel_size,
+                    float sigma);
+
+void FilterSobel(const core::Tensor &src,
+                 core::Tensor &dst_dx,
+                 core::Tensor &dst_dy,
+                 int kernel_size);
+
+void FilterBilateral(const core::Tensor &src,
+                     core::Tensor &dst,
+                     int kernel_size,
+                     float value_sigma,
+                     float distance_sigma);
+
+void Dilate(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
+void Resize(const core::Tensor &src,
+            core::Tensor &dst,
+            Image::InterpType interp_type);
+
 void ToCPU(const core::Tensor &src,
            core::Tensor &dst,
            double scale,
@@ -98,6 +136,27 @@ void ColorizeDepthCPU(const core::Tensor &src,
                       float min_value,
                       float max_value);
 
+void FilterCPU(const core::Tensor &src,
+              core::Tensor &dst,
+              const core::Tensor &kernel);
+
+void FilterSeparableCPU(const core::Tensor &src,
+                       core::Tensor &dst,
+                       const core::Tensor &kernel_x,
+                       const core::Tensor &kernel_y);
+
+void FilterBilateralCPU(const core::Tensor &src,
+                       core::Tensor &dst,
+                       int kernel_size,
+                       float value_sigma,
+                       float distance_sigma);
+
+void DilateCPU(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
+void ResizeCPU(const core::Tensor &src,
+              core::Tensor &dst,
+              Image::InterpType interp_type);
+
 #ifdef BUILD_CUDA_MODULE
 void ToCUDA(const core::Tensor &src,
             core::Tensor &dst,
@@ -131,6 +190,27 @@ void ColorizeDepthCUDA(const core::Tensor &src,
                        float min_value,
                        float max_value);
 
+void FilterCUDA(const core::Tensor &src,
+               core::Tensor &dst,
+               const core::Tensor &kernel);
+
+void FilterSeparableCUDA(const core::Tensor &src,
+                        core::Tensor &dst,
+                        const core::Tensor &kernel_x,
+                        const core::Tensor &kernel_y);
+
+void FilterBilateralCUDA(const core::Tensor &src,
+                        core::Tensor &dst,
+                        int kernel_size,
+                        float value_sigma,
+                        float distance_sigma);
+
+void DilateCUDA(const core::Tensor &src, core::Tensor &dst, int kernel_size);
+
+void ResizeCUDA(const core::Tensor &src,
+               core::Tensor &dst,
+               Image::InterpType interp_type);
+
 #endif
 }  // namespace image
 }  // namespace kernel
@@ -24,12 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <type_traits>
 
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/Dispatch.h"
 #include "open3d/core/Indexer.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/kernel/GeometryIndexer.h"
 #include "open3d/t/geometry/kernel/GeometryMacros.h"
 
@@ -44,6 +48,256 @@ using std::isinf;
 using std::isnan;
 #endif
 
+/// Range of scalar_t used to saturate filter results. Computed on the host
+/// and captured by the kernels.
+template <typename scalar_t>
+inline void GetSaturationRange(double* lo, double* hi) {
+    *lo = static_cast<double>(std::numeric_limits<scalar_t>::lowest());
+    *hi = static_cast<double>(std::numeric_limits<scalar_t>::max());
+}
+
+/// Converts a filter result to scalar_t. Integer results are rounded to the
+/// nearest value, ties to even as in IPP, and saturated to [lo, hi].
+template <typename scalar_t>
+OPEN3D_HOST_DEVICE inline scalar_t SaturateCast(float v, double lo, double hi) {
+    if (std::is_floating_point<scalar_t>::value) {
+        return static_cast<scalar_t>(v);
+    }
+    double r = static_cast<double>(rintf(v));
+    r = r < lo ? lo : r;
+    r = r > hi ? hi : r;
+    return static_cast<scalar_t>(r);
+}
+
+/// Replicated border: clamps a pixel coordinate to [0, size - 1].
+OPEN3D_HOST_DEVICE inline int64_t ClampIndex(int64_t i, int64_t size) {
+    return i < 0 ? 0 : (i >= size ? size - 1 : i);
+}
+
+/// Tap coordinate of a filter window. Only windows on the image border need
+/// clamping, the check is resolved at compile time for the interior.
+template <bool kBorder>
+OPEN3D_HOST_DEVICE inline int64_t TapIndex(int64_t i, int64_t size) {
+    return kBorder ? ClampIndex(i, size) : i;
+}
+
+/// Splits an image into the interior, where a filter window reaching from
+/// (x - left, y - top) to (x + right, y + bottom) lies within the image, and
+/// the border around it. Filters run one ParallelFor over each, so that only
+/// the border pixels clamp their taps.
+class ImageBorder {
+public:
+    ImageBorder(int64_t rows,
+                int64_t cols,
+                int64_t top,
+                int64_t bottom,
+                int64_t left,
+                int64_t right)
+        : rows_(rows), cols_(cols) {
+        y0_ = std::min(top, rows);
+        y1_ = std::max(y0_, rows - bottom);
+        x0_ = std::min(left, cols);
+        x1_ = std::max(x0_, cols - right);
+    }
+
+    int64_t NumInteriorPixels() const { return (y1_ - y0_) * (x1_ - x0_); }
+    int64_t NumBorderPixels() const {
+        return rows_ * cols_ - NumInteriorPixels();
+    }
+
+    OPEN3D_HOST_DEVICE void GetInteriorPixel(int64_t workload_idx,
+                                             int64_t* x,
+                                             int64_t* y) const {
+        const int64_t width = x1_ - x0_;
+        *y = y0_ + workload_idx / width;
+        *x = x0_ + workload_idx % width;
+    }
+
+    /// The full rows above and below the interior come first, followed by
+    /// the left and right margins of the interior rows.
+    OPEN3D_HOST_DEVICE void GetBorderPixel(int64_t workload_idx,
+                                           int64_t* x,
+                                           int64_t* y) const {
+        const int64_t num_full_rows = rows_ - (y1_ - y0_);
+        if (workload_idx < num_full_rows * cols_) {
+            const int64_t row = workload_idx / cols_;
+            *y = row < y0_ ? row : y1_ + (row - y0_);
+            *x = workload_idx % cols_;
+            return;
+        }
+        workload_idx -= num_full_rows * cols_;
+        const int64_t margin = cols_ - (x1_ - x0_);
+        *y = y0_ + workload_idx / margin;
+        const int64_t col = workload_idx % margin;
+        *x = col < x0_ ? col : x1_ + (col - x0_);
+    }
+
+private:
+    int64_t rows_;
+    int64_t cols_;
+    int64_t y0_;
+    int64_t y1_;
+    int64_t x0_;
+    int64_t x1_;
+};
+
+template <typename scalar_t, bool kBorder>
+OPEN3D_HOST_DEVICE inline void FilterPixel(const NDArrayIndexer& src_indexer,
+                                           const NDArrayIndexer& dst_indexer,
+                                           const float* kernel_ptr,
+                                           int64_t kernel_rows,
+                                           int64_t kernel_cols,
+                                           int64_t channels,
+                                           double lo,
+                                           double hi,
+                                           int64_t x,
+                                           int64_t y) {
+    const int64_t rows = src_indexer.GetShape(0);
+    const int64_t cols = src_indexer.GetShape(1);
+    const int64_t y_begin = y - kernel_rows / 2;
+    const int64_t x_begin = x - kernel_cols / 2;
+    scalar_t* dst_ptr = dst_indexer.GetDataPtr<scalar_t>(x, y);
+    for (int64_t c = 0; c < channels; ++c) {
+        float sum = 0;
+        for (int64_t ky = 0; ky < kernel_rows; ++ky) {
+            const int64_t yk = TapIndex<kBorder>(y_begin + ky, rows);
+            const float* kernel_row = kernel_ptr + ky * kernel_cols;
+            for (int64_t kx = 0; kx < kernel_cols; ++kx) {
+                const int64_t xk = TapIndex<kBorder>(x_begin + kx, cols);
+                sum += kernel_row[kx] *
+                       static_cast<float>(
+                               src_indexer.GetDataPtr<scalar_t>(xk, yk)[c]);
+            }
+        }
+        dst_ptr[c] = SaturateCast<scalar_t>(sum, lo, hi);
+    }
+}
+
+/// One pass of a separable filter, along x if kAlongX is set and along y
+/// otherwise. src_t is the input and dst_t the output type of the pass.
+template <typename src_t, typename dst_t, bool kAlongX, bool kBorder>
+OPEN3D_HOST_DEVICE inline void FilterSeparablePixel(
+        const NDArrayIndexer& src_indexer,
+        const NDArrayIndexer& dst_indexer,
+        const float* kernel_ptr,
+        int64_t kernel_size,
+        int64_t channels,
+        double lo,
+        double hi,
+        int64_t x,
+        int64_t y) {
+    const int64_t size = src_indexer.GetShape(kAlongX ? 1 : 0);
+    const int64_t begin = (kAlongX ? x : y) - kernel_size / 2;
+    dst_t* dst_ptr = dst_indexer.GetDataPtr<dst_t>(x, y);
+    for (int64_t c = 0; c < channels; ++c) {
+        float sum = 0;
+        for (int64_t k = 0; k < kernel_size; ++k) {
+            const int64_t i = TapIndex<kBorder>(begin + k, size);
+            sum += kernel_ptr[k] *
+                   static_cast<float>(
+                           kAlongX ? src_indexer.GetDataPtr<src_t>(i, y)[c]
+                                   : src_indexer.GetDataPtr<src_t>(x, i)[c]);
+        }
+        dst_ptr[c] = SaturateCast<dst_t>(sum, lo, hi);
+    }
+}
+
+/// Resamples one pixel from the taps x0 + [0, taps) and y0 + [0, taps) with
+/// the weights wx and wy.
+template <typename scalar_t, bool kBorder>
+OPEN3D_HOST_DEVICE inline void ResizePixel(const NDArrayIndexer& src_indexer,
+                                           scalar_t* dst_ptr,
+                                           const float* wx,
+                                           const float* wy,
+                                           int taps,
+                                           int64_t x0,
+                                           int64_t y0,
+                                           int64_t channels,
+                                           float scale,
+                                           double lo,
+                                           double hi) {
+    const int64_t rows = src_indexer.GetShape(0);
+    const int64_t cols = src_indexer.GetShape(1);
+    for (int64_t c = 0; c < channels; ++c) {
+        float sum = 0;
+        for (int ky = 0; ky < taps; ++ky) {
+            const int64_t yk = TapIndex<kBorder>(y0 + ky, rows);
+            float row_sum = 0;
+            for (int kx = 0; kx < taps; ++kx) {
+                const int64_t xk = TapIndex<kBorder>(x0 + kx, cols);
+                row_sum += wx[kx] *
+                           static_cast<float>(
+                                   src_indexer.GetDataPtr<scalar_t>(xk, yk)[c]);
+            }
+            sum += wy[ky] * row_sum;
+        }
+        dst_ptr[c] = SaturateCast<scalar_t>(sum * scale, lo, hi);
+    }
+}
+
+template <typename scalar_t, bool kBorder>
+OPEN3D_HOST_DEVICE inline void FilterBilateralPixel(
+        const NDArrayIndexer& src_indexer,
+        const NDArrayIndexer& dst_indexer,
+        int64_t radius,
+        float value_coeff,
+        float distance_coeff,
+        int64_t channels,
+        double lo,
+        double hi,
+        int64_t x,
+        int64_t y) {
+    const int64_t rows = src_indexer.GetShape(0);
+    const int64_t cols = src_indexer.GetShape(1);
+    const scalar_t* center = src_indexer.GetDataPtr<scalar_t>(x, y);
+    float sum[4] = {0, 0, 0, 0};
+    float weight_sum = 0;
+    for (int64_t dy = -radius; dy <= radius; ++dy) {
+        const int64_t yk = TapIndex<kBorder>(y + dy, rows);
+        for (int64_t dx = -radius; dx <= radius; ++dx) {
+            const int64_t dist2 = dx * dx + dy * dy;
+            if (dist2 > radius * radius) continue;
+
+            const scalar_t* v = src_indexer.GetDataPtr<scalar_t>(
+                    TapIndex<kBorder>(x + dx, cols), yk);
+            float diff = 0;
+            for (int64_t c = 0; c < channels; ++c) {
+                diff += fabsf(static_cast<float>(v[c]) -
+                              static_cast<float>(center[c]));
+            }
+            const float w =
+                    expf(distance_coeff * dist2 + value_coeff * diff * diff);
+            for (int64_t c = 0; c < channels; ++c) {
+                sum[c] += w * static_cast<float>(v[c]);
+            }
+            weight_sum += w;
+        }
+    }
+
+    scalar_t* dst_ptr = dst_indexer.GetDataPtr<scalar_t>(x, y);
+    for (int64_t c = 0; c < channels; ++c) {
+        dst_ptr[c] = SaturateCast<scalar_t>(sum[c] / weight_sum, lo, hi);
+    }
+}
+
+/// Weight of a source pixel at distance t for resampling. Cubic is the
+/// Catmull-Rom spline, Lanczos uses 3 lobes.
+OPEN3D_HOST_DEVICE inline float ResizeWeight(int interp_type, float t) {
+    const float PI = 3.14159265358979323846f;
+    t = fabsf(t);
+    if (interp_type == static_cast<int>(Image::InterpType::Cubic)) {
+        if (t < 1.0f) return (1.5f * t - 2.5f) * t * t + 1.0f;
+        if (t < 2.0f) return ((-0.5f * t + 2.5f) * t - 4.0f) * t + 2.0f;
+        return 0.0f;
+    } else if (interp_type == static_cast<int>(Image::InterpType::Lanczos)) {
+        if (t < 1e-6f) return 1.0f;
+        if (t >= 3.0f) return 0.0f;
+        const float pt = PI * t;
+        return 3.0f * sinf(pt) * sinf(pt / 3.0f) / (pt * pt);
+    }
+    return t < 1.0f ? 1.0f - t : 0.0f;
+}
+
 #ifdef __CUDACC__
 void ToCUDA
 #else
@@ -362,6 +616,382 @@ void ColorizeDepthCPU
     });
 }
 
+#ifdef __CUDACC__
+void FilterCUDA
+#else
+void FilterCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t kernel_rows = kernel.GetShape(0);
+    const int64_t kernel_cols = kernel.GetShape(1);
+    const int64_t anchor_y = kernel_rows / 2;
+    const int64_t anchor_x = kernel_cols / 2;
+    const float* kernel_ptr = kernel.GetDataPtr<float>();
+    const ImageBorder border(rows, cols, anchor_y, kernel_rows - 1 - anchor_y,
+                             anchor_x, kernel_cols - 1 - anchor_x);
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        double lo, hi;
+        GetSaturationRange<scalar_t>(&lo, &hi);
+        core::ParallelFor(
+                src.GetDevice(), border.NumInteriorPixels(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t x, y;
+                    border.GetInteriorPixel(workload_idx, &x, &y);
+                    FilterPixel<scalar_t, false>(
+                            src_indexer, dst_indexer, kernel_ptr, kernel_rows,
+                            kernel_cols, channels, lo, hi, x, y);
+                });
+        core::ParallelFor(
+                src.GetDevice(), border.NumBorderPixels(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t x, y;
+                    border.GetBorderPixel(workload_idx, &x, &y);
+                    FilterPixel<scalar_t, true>(
+                            src_indexer, dst_indexer, kernel_ptr, kernel_rows,
+                            kernel_cols, channels, lo, hi, x, y);
+                });
+    });
+}
+
+// Separable filters run as a horizontal pass into a Float32 buffer followed
+// by a vertical pass. Both passes stream whole rows, so the source and the
+// buffer are read once per output row instead of once per kernel tap.
+#ifdef __CUDACC__
+void FilterSeparableCUDA
+#else
+void FilterSeparableCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         const core::Tensor& kernel_x,
+         const core::Tensor& kernel_y) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t kernel_x_size = kernel_x.GetLength();
+    const int64_t kernel_y_size = kernel_y.GetLength();
+    const int64_t anchor_x = kernel_x_size / 2;
+    const int64_t anchor_y = kernel_y_size / 2;
+    const float* kernel_x_ptr = kernel_x.GetDataPtr<float>();
+    const float* kernel_y_ptr = kernel_y.GetDataPtr<float>();
+    const ImageBorder border_x(rows, cols, 0, 0, anchor_x,
+                               kernel_x_size - 1 - anchor_x);
+    const ImageBorder border_y(rows, cols, anchor_y,
+                               kernel_y_size - 1 - anchor_y, 0, 0);
+
+    core::Tensor buffer = core::Tensor::Empty({rows, cols, channels},
+                                              core::Float32, src.GetDevice());
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer buffer_indexer(buffer, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    double buffer_lo, buffer_hi;
+    GetSaturationRange<float>(&buffer_lo, &buffer_hi);
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        core::ParallelFor(
+                src.GetDevice(), border_x.NumInteriorPixels(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t x, y;
+                    border_x.GetInteriorPixel(workload_idx, &x, &y);
+                    FilterSeparablePixel<scalar_t, float, true, false>(
+                            src_indexer, buffer_indexer, kernel_x_ptr,
+                            kernel_x_size, channels, buffer_lo, buffer_hi, x,
+                            y);
+                });
+        core::ParallelFor(
+                src.GetDevice(), border_x.NumBorderPixels(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t x, y;
+                    border_x.GetBorderPixel(workload_idx, &x, &y);
+                    FilterSeparablePixel<scalar_t, float, true, true>(
+                            src_indexer, buffer_indexer, kernel_x_ptr,
+                            kernel_x_size, channels, buffer_lo, buffer_hi, x,
+                            y);
+                });
+    });
+
+    DISPATCH_DTYPE_TO_TEMPLATE(dst.GetDtype(), [&]() {
+        double lo, hi;
+        GetSaturationRange<scalar_t>(&lo, &hi);
+        core::ParallelFor(
+                src.GetDevice(), border_y.NumInteriorPixels(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t x, y;
+                    border_y.GetInteriorPixel(workload_idx, &x, &y);
+                    FilterSeparablePixel<float, scalar_t, false, false>(
+                            buffer_indexer, dst_indexer, kernel_y_ptr,
+                            kernel_y_size, channels, lo, hi, x, y);
+                });
+        core::ParallelFor(
+                src.GetDevice(), border_y.NumBorderPixels(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t x, y;
+                    border_y.GetBorderPixel(workload_idx, &x, &y);
+                    FilterSeparablePixel<float, scalar_t, false, true>(
+                            buffer_indexer, dst_indexer, kernel_y_ptr,
+                            kernel_y_size, channels, lo, hi, x, y);
+                });
+    });
+}
+
+// Follows IPP: a round window of radius kernel_size / 2, and the L1 distance
+// between the color vectors as the value difference.
+#ifdef __CUDACC__
+void FilterBilateralCUDA
+#else
+void FilterBilateralCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         int kernel_size,
+         float value_sigma,
+         float distance_sigma) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    if (channels > 4) {
+        utility::LogError("FilterBilateral supports up to 4 channels, got {}.",
+                          channels);
+    }
+
+    const int64_t radius = kernel_size / 2;
+    const float value_coeff = -0.5f / (value_sigma * value_sigma);
+    const float distance_coeff = -0.5f / (distance_sigma * distance_sigma);
+
+    const ImageBorder border(rows, cols, radius, radius, radius, radius);
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        double lo, hi;
+        GetSaturationRange<scalar_t>(&lo, &hi);
+        core::ParallelFor(
+                src.GetDevice(), border.NumInteriorPixels(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t x, y;
+                    border.GetInteriorPixel(workload_idx, &x, &y);
+                    FilterBilateralPixel<scalar_t, false>(
+                            src_indexer, dst_indexer, radius, value_coeff,
+                            distance_coeff, channels, lo, hi, x, y);
+                });
+        core::ParallelFor(
+                src.GetDevice(), border.NumBorderPixels(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    int64_t x, y;
+                    border.GetBorderPixel(workload_idx, &x, &y);
+                    FilterBilateralPixel<scalar_t, true>(
+                            src_indexer, dst_indexer, radius, value_coeff,
+                            distance_coeff, channels, lo, hi, x, y);
+                });
+    });
+}
+
+// Dilation with a square mask is separable into a row and a column maximum.
+#ifdef __CUDACC__
+void DilateCUDA
+#else
+void DilateCPU
+#endif
+        (const core::Tensor& src, core::Tensor& dst, int kernel_size) {
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t radius = kernel_size / 2;
+
+    core::Tensor buffer = core::Tensor::EmptyLike(src);
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer buffer_indexer(buffer, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+#ifndef __CUDACC__
+    using std::max;
+    using std::min;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE_WITH_BOOL(src.GetDtype(), [&]() {
+        core::ParallelFor(
+                src.GetDevice(), rows * cols,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t y = workload_idx / cols;
+                    const int64_t x = workload_idx % cols;
+                    const int64_t x_min = max(int64_t(0), x - radius);
+                    const int64_t x_max = min(cols - 1, x + radius);
+
+                    scalar_t* buffer_ptr =
+                            buffer_indexer.GetDataPtr<scalar_t>(x, y);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        scalar_t v = src_indexer.GetDataPtr<scalar_t>(x_min,
+                                                                      y)[c];
+                        for (int64_t xk = x_min + 1; xk <= x_max; ++xk) {
+                            const scalar_t vk =
+                                    src_indexer.GetDataPtr<scalar_t>(xk, y)[c];
+                            v = vk > v ? vk : v;
+                        }
+                        buffer_ptr[c] = v;
+                    }
+                });
+        core::ParallelFor(
+                src.GetDevice(), rows * cols,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t y = workload_idx / cols;
+                    const int64_t x = workload_idx % cols;
+                    const int64_t y_min = max(int64_t(0), y - radius);
+                    const int64_t y_max = min(rows - 1, y + radius);
+
+                    scalar_t* dst_ptr = dst_indexer.GetDataPtr<scalar_t>(x, y);
+                    for (int64_t c = 0; c < channels; ++c) {
+                        scalar_t v = buffer_indexer.GetDataPtr<scalar_t>(
+                                x, y_min)[c];
+                        for (int64_t yk = y_min + 1; yk <= y_max; ++yk) {
+                            const scalar_t vk =
+                                    buffer_indexer.GetDataPtr<scalar_t>(x,
+                                                                        yk)[c];
+                            v = vk > v ? vk : v;
+                        }
+                        dst_ptr[c] = v;
+                    }
+                });
+    });
+}
+
+// Nearest picks the top-left source pixel of each destination pixel, as IPP
+// does. Linear, Cubic and Lanczos sample at the pixel centers with replicated
+// borders. Super averages the covered source area and falls back to Linear
+// when upsampling.
+#ifdef __CUDACC__
+void ResizeCUDA
+#else
+void ResizeCPU
+#endif
+        (const core::Tensor& src,
+         core::Tensor& dst,
+         Image::InterpType interp_type) {
+    NDArrayIndexer src_indexer(src, 2);
+    NDArrayIndexer dst_indexer(dst, 2);
+
+    const int64_t rows = src.GetShape(0);
+    const int64_t cols = src.GetShape(1);
+    const int64_t channels = src.GetShape(2);
+    const int64_t dst_rows = dst.GetShape(0);
+    const int64_t dst_cols = dst.GetShape(1);
+    const float scale_y = static_cast<float>(rows) / dst_rows;
+    const float scale_x = static_cast<float>(cols) / dst_cols;
+
+    int interp = static_cast<int>(interp_type);
+    if (interp_type == Image::InterpType::Super &&
+        (scale_x < 1.0f || scale_y < 1.0f)) {
+        interp = static_cast<int>(Image::InterpType::Linear);
+    }
+    const int taps =
+            interp == static_cast<int>(Image::InterpType::Cubic)
+                    ? 4
+                    : (interp == static_cast<int>(Image::InterpType::Lanczos)
+                               ? 6
+                               : 2);
+    constexpr int kMaxTaps = 6;
+
+#ifndef __CUDACC__
+    using std::max;
+    using std::min;
+#endif
+
+    DISPATCH_DTYPE_TO_TEMPLATE(src.GetDtype(), [&]() {
+        double lo, hi;
+        GetSaturationRange<scalar_t>(&lo, &hi);
+        core::ParallelFor(
+                src.GetDevice(), dst_rows * dst_cols,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t y = workload_idx / dst_cols;
+                    const int64_t x = workload_idx % dst_cols;
+                    scalar_t* dst_ptr = dst_indexer.GetDataPtr<scalar_t>(x, y);
+
+                    if (interp ==
+                        static_cast<int>(Image::InterpType::Nearest)) {
+                        const int64_t xs = min(
+                                static_cast<int64_t>(x * scale_x), cols - 1);
+                        const int64_t ys = min(
+                                static_cast<int64_t>(y * scale_y), rows - 1);
+                        const scalar_t* src_ptr =
+                                src_indexer.GetDataPtr<scalar_t>(xs, ys);
+                        for (int64_t c = 0; c < channels; ++c) {
+                            dst_ptr[c] = src_ptr[c];
+                        }
+                        return;
+                    }
+
+                    if (interp == static_cast<int>(Image::InterpType::Super)) {
+                        const float fx0 = x * scale_x, fx1 = fx0 + scale_x;
+                        const float fy0 = y * scale_y, fy1 = fy0 + scale_y;
+                        const int64_t x_max =
+                                min(static_cast<int64_t>(ceilf(fx1)), cols);
+                        const int64_t y_max =
+                                min(static_cast<int64_t>(ceilf(fy1)), rows);
+                        const float inv_area = 1.0f / (scale_x * scale_y);
+                        for (int64_t c = 0; c < channels; ++c) {
+                            float sum = 0;
+                            for (int64_t ys = static_cast<int64_t>(fy0);
+                                 ys < y_max; ++ys) {
+                                const float wy =
+                                        min(ys + 1.0f, fy1) -
+                                        max(static_cast<float>(ys), fy0);
+                                for (int64_t xs = static_cast<int64_t>(fx0);
+                                     xs < x_max; ++xs) {
+                                    const float wx =
+                                            min(xs + 1.0f, fx1) -
+                                            max(static_cast<float>(xs), fx0);
+                                    sum += wx * wy *
+                                           static_cast<float>(
+                                                   src_indexer.GetDataPtr<
+                                                           scalar_t>(xs,
+                                                                     ys)[c]);
+                                }
+                            }
+                            dst_ptr[c] = SaturateCast<scalar_t>(
+                                    sum * inv_area, lo, hi);
+                        }
+                        return;
+                    }
+
+                    // Separable resampling with normalized weights.
+                    const float xf = (x + 0.5f) * scale_x - 0.5f;
+                    const float yf = (y + 0.5f) * scale_y - 0.5f;
+                    const int64_t x0 =
+                            static_cast<int64_t>(floorf(xf)) - (taps / 2 - 1);
+                    const int64_t y0 =
+                            static_cast<int64_t>(floorf(yf)) - (taps / 2 - 1);
+                    float wx[kMaxTaps], wy[kMaxTaps];
+                    float wx_sum = 0, wy_sum = 0;
+                    for (int k = 0; k < taps; ++k) {
+                        wx[k] = ResizeWeight(interp, xf - (x0 + k));
+                        wy[k] = ResizeWeight(interp, yf - (y0 + k));
+                        wx_sum += wx[k];
+                        wy_sum += wy[k];
+                    }
+                    const float inv_w = 1.0f / (wx_sum * wy_sum);
+                    if (x0 < 0 || y0 < 0 || x0 + taps > cols ||
+                        y0 + taps > rows) {
+                        ResizePixel<scalar_t, true>(src_indexer, dst_ptr, wx,
+                                                    wy, taps, x0, y0, channels,
+                                                    inv_w, lo, hi);
+                    } else {
+                        ResizePixel<scalar_t, false>(src_indexer, dst_ptr, wx,
+                                                     wy, taps, x0, y0,
+                                                     channels, inv_w, lo, hi);
+                    }
+                });
+    });
+}
+
 }  // namespace image
 }  // namespace kernel
 }  // namespace geometry
@@ -31,6 +31,7 @@
 #include "open3d/core/CUDAUtils.h"
 #include "open3d/core/ShapeUtil.h"
 #include "open3d/core/Tensor.h"
+#include "open3d/core/TensorCheck.h"
 #include "open3d/utility/Logging.h"
 
 namespace open3d {
@@ -118,6 +119,67 @@ void Project(
     }
 }
 
+void FarthestPointSample(const core::Tensor& points,
+                         int64_t start_index,
+                         int64_t bucket_size,
+                         core::Tensor& sample_indices) {
+    const core::Device device = points.GetDevice();
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorDtype(sample_indices, core::Int64);
+    core::AssertTensorDevice(sample_indices, device);
+
+    const int64_t num_points = points.GetLength();
+    const int64_t num_samples = sample_indices.GetLength();
+    if (num_samples > num_points) {
+        utility::LogError(
+                "Illegal number of samples: {}, must <= point size: {}",
+                num_samples, num_points);
+    }
+    if (num_samples == 0) {
+        return;
+    }
+    if (start_index < 0 || start_index >= num_points) {
+        utility::LogError("Illegal start index: {}, must < point size: {}",
+                          start_index, num_points);
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FarthestPointSampleCPU(points.Contiguous(), start_index, bucket_size,
+                               sample_indices);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FarthestPointSampleCUDA, points.Contiguous(), start_index,
+                  sample_indices);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void EvaluatePlanes(const core::Tensor& points,
+                    const core::Tensor& planes,
+                    double distance_threshold,
+                    core::Tensor& inlier_counts,
+                    core::Tensor& inlier_errors) {
+    const core::Device device = points.GetDevice();
+    core::AssertTensorShape(points, {utility::nullopt, 3});
+    core::AssertTensorDtypes(points, {core::Float32, core::Float64});
+    core::AssertTensorShape(planes, {utility::nullopt, 4});
+    core::AssertTensorDtype(planes, core::Float64);
+    core::AssertTensorDevice(planes, device);
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        EvaluatePlanesCPU(points.Contiguous(), planes.Contiguous(),
+                          distance_threshold, inlier_counts, inlier_errors);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(EvaluatePlanesCUDA, points.Contiguous(), planes.Contiguous(),
+                  distance_threshold, inlier_counts, inlier_errors);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
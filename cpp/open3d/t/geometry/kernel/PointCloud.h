@@ -57,6 +57,36 @@ void Project(
         float depth_scale,
         float depth_max);
 
+/// \brief Farthest point sampling, see PointCloud::FarthestPointDownSample.
+///
+/// \param points Point positions of shape {N, 3} and Float32 or Float64 dtype.
+/// \param start_index Index of the first sample.
+/// \param bucket_size If positive, CPU sampling partitions the points into
+/// buckets of at most this many points to skip distance updates. Ignored on
+/// CUDA.
+/// \param sample_indices [out] Int64 tensor of shape {num_samples} on the
+/// device of \p points, receiving the indices of the samples.
+void FarthestPointSample(const core::Tensor& points,
+                         int64_t start_index,
+                         int64_t bucket_size,
+                         core::Tensor& sample_indices);
+
+/// \brief Scores plane hypotheses, see PointCloud::SegmentPlane.
+///
+/// \param points Point positions of shape {N, 3} and Float32 or Float64 dtype.
+/// \param planes Float64 tensor of shape {H, 4} with the plane models
+/// ax + by + cz + d = 0 of the hypotheses, on the device of \p points.
+/// \param distance_threshold Max distance of an inlier from the plane.
+/// \param inlier_counts [out] Int64 tensor of shape {H} with the number of
+/// inliers of every hypothesis.
+/// \param inlier_errors [out] Float64 tensor of shape {H} with the summed
+/// distances of the inliers of every hypothesis.
+void EvaluatePlanes(const core::Tensor& points,
+                    const core::Tensor& planes,
+                    double distance_threshold,
+                    core::Tensor& inlier_counts,
+                    core::Tensor& inlier_errors);
+
 void UnprojectCPU(
         const core::Tensor& depth,
         utility::optional<std::reference_wrapper<const core::Tensor>>
@@ -79,6 +109,30 @@ void ProjectCPU(
         float depth_scale,
         float depth_max);
 
+void FarthestPointSampleCPU(const core::Tensor& points,
+                            int64_t start_index,
+                            int64_t bucket_size,
+                            core::Tensor& sample_indices);
+
+void EvaluatePlanesCPU(const core::Tensor& points,
+                       const core::Tensor& planes,
+                       double distance_threshold,
+                       core::Tensor& inlier_counts,
+                       core::Tensor& inlier_errors);
+
+/// \brief Consistent normal orientation on the k nearest neighbor graph, see
+/// PointCloud::OrientNormalsConsistentTangentPlane. Only implemented on CPU.
+///
+/// \param points Point positions of shape {N, 3} and Float32 or Float64 dtype.
+/// \param normals [in, out] Contiguous normals of shape {N, 3} with the dtype
+/// of \p points, flipped in place.
+/// \param neighbor_indices Int64 tensor of shape {N, k} with the indices of the
+/// nearest neighbors of every point.
+void OrientNormalsConsistentTangentPlaneCPU(
+        const core::Tensor& points,
+        core::Tensor& normals,
+        const core::Tensor& neighbor_indices);
+
 #ifdef BUILD_CUDA_MODULE
 void UnprojectCUDA(
         const core::Tensor& depth,
@@ -101,6 +155,16 @@ void ProjectCUDA(
         const core::Tensor& extrinsics,
         float depth_scale,
         float depth_max);
+
+void FarthestPointSampleCUDA(const core::Tensor& points,
+                             int64_t start_index,
+                             core::Tensor& sample_indices);
+
+void EvaluatePlanesCUDA(const core::Tensor& points,
+                        const core::Tensor& planes,
+                        double distance_threshold,
+                        core::Tensor& inlier_counts,
+                        core::Tensor& inlier_errors);
 #endif
 
 void EstimateCovariancesUsingHybridSearchCPU(const core::Tensor& points,
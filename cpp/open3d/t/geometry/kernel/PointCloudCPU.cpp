@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/geometry/FarthestPointSampling.h"
+#include "open3d/geometry/NormalOrientation.h"
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
 
 namespace open3d {
@@ -99,6 +101,30 @@ void ProjectCPU(
     });
 }
 
+void FarthestPointSampleCPU(const core::Tensor& points,
+                            int64_t start_index,
+                            int64_t bucket_size,
+                            core::Tensor& sample_indices) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        open3d::geometry::FarthestPointSampling(
+                points.GetDataPtr<scalar_t>(), points.GetLength(),
+                sample_indices.GetLength(), start_index, bucket_size,
+                sample_indices.GetDataPtr<int64_t>());
+    });
+}
+
+void OrientNormalsConsistentTangentPlaneCPU(
+        const core::Tensor& points,
+        core::Tensor& normals,
+        const core::Tensor& neighbor_indices) {
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        open3d::geometry::OrientNormalsAlongMinimumSpanningTree(
+                points.GetDataPtr<scalar_t>(), normals.GetDataPtr<scalar_t>(),
+                points.GetLength(), neighbor_indices.GetDataPtr<int64_t>(),
+                neighbor_indices.GetShape(1));
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
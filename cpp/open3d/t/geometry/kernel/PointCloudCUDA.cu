@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <limits>
+
 #include "open3d/t/geometry/kernel/PointCloudImpl.h"
 
 namespace open3d {
@@ -116,6 +118,51 @@ void ProjectCUDA(
             });
 }
 
+void FarthestPointSampleCUDA(const core::Tensor& points,
+                             int64_t start_index,
+                             core::Tensor& sample_indices) {
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+    const int64_t num_samples = sample_indices.GetLength();
+    int64_t* sample_indices_ptr = sample_indices.GetDataPtr<int64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        core::Tensor distances = core::Tensor::Full(
+                {num_points}, std::numeric_limits<scalar_t>::infinity(),
+                points.GetDtype(), device);
+        scalar_t* distances_ptr = distances.GetDataPtr<scalar_t>();
+
+        // The index of the farthest point stays on the device, so that the
+        // samples are selected without synchronizing with the host.
+        core::Tensor farthest =
+                core::Tensor::Init<int64_t>({start_index}, device);
+        for (int64_t k = 0; k < num_samples; ++k) {
+            const int64_t* farthest_ptr = farthest.GetDataPtr<int64_t>();
+            core::ParallelFor(
+                    device, num_points,
+                    [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                        const int64_t sample_idx = farthest_ptr[0];
+                        if (workload_idx == 0) {
+                            sample_indices_ptr[k] = sample_idx;
+                        }
+                        const scalar_t* sample = points_ptr + 3 * sample_idx;
+                        const scalar_t* point = points_ptr + 3 * workload_idx;
+                        const scalar_t dx = point[0] - sample[0];
+                        const scalar_t dy = point[1] - sample[1];
+                        const scalar_t dz = point[2] - sample[2];
+                        const scalar_t distance = dx * dx + dy * dy + dz * dz;
+                        if (distance < distances_ptr[workload_idx]) {
+                            distances_ptr[workload_idx] = distance;
+                        }
+                    });
+            if (k + 1 < num_samples) {
+                farthest = distances.ArgMax({0}).Reshape({1});
+            }
+        }
+    });
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
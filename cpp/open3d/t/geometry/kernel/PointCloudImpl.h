@@ -858,6 +858,67 @@ void EstimateColorGradientsUsingKNNSearchCPU
     core::cuda::Synchronize(points.GetDevice());
 }
 
+#if defined(__CUDACC__)
+void EvaluatePlanesCUDA
+#else
+void EvaluatePlanesCPU
+#endif
+        (const core::Tensor& points,
+         const core::Tensor& planes,
+         double distance_threshold,
+         core::Tensor& inlier_counts,
+         core::Tensor& inlier_errors) {
+    // Every workload scores one hypothesis on one chunk of points and writes
+    // its own partial sums, which are reduced afterwards. This is
+    // deterministic and needs no atomics.
+    constexpr int64_t kPointChunkSize = 1024;
+    const core::Device device = points.GetDevice();
+    const int64_t num_points = points.GetLength();
+    const int64_t num_planes = planes.GetLength();
+    const int64_t num_chunks =
+            std::max<int64_t>(1, (num_points + kPointChunkSize - 1) /
+                                         kPointChunkSize);
+
+    core::Tensor partial_counts =
+            core::Tensor::Empty({num_planes, num_chunks}, core::Int64, device);
+    core::Tensor partial_errors = core::Tensor::Empty(
+            {num_planes, num_chunks}, core::Float64, device);
+    int64_t* partial_counts_ptr = partial_counts.GetDataPtr<int64_t>();
+    double* partial_errors_ptr = partial_errors.GetDataPtr<double>();
+    const double* planes_ptr = planes.GetDataPtr<double>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(points.GetDtype(), [&]() {
+        const scalar_t* points_ptr = points.GetDataPtr<scalar_t>();
+        core::ParallelFor(
+                device, num_planes * num_chunks,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t plane_idx = workload_idx / num_chunks;
+                    const int64_t chunk_idx = workload_idx % num_chunks;
+                    const double* plane = planes_ptr + 4 * plane_idx;
+                    const int64_t begin = chunk_idx * kPointChunkSize;
+                    const int64_t end =
+                            min(begin + kPointChunkSize, num_points);
+                    int64_t count = 0;
+                    double error = 0;
+                    for (int64_t idx = begin; idx < end; ++idx) {
+                        const scalar_t* point = points_ptr + 3 * idx;
+                        const double distance =
+                                abs(plane[0] * point[0] + plane[1] * point[1] +
+                                    plane[2] * point[2] + plane[3]);
+                        if (distance < distance_threshold) {
+                            ++count;
+                            error += distance;
+                        }
+                    }
+                    partial_counts_ptr[workload_idx] = count;
+                    partial_errors_ptr[workload_idx] = error;
+                });
+    });
+
+    inlier_counts = partial_counts.Sum({1});
+    inlier_errors = partial_errors.Sum({1});
+}
+
 }  // namespace pointcloud
 }  // namespace kernel
 }  // namespace geometry
@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/ShapeUtil.h"
+#include "open3d/core/TensorCheck.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+void FilterVertexAttr(const core::Tensor& adjacency_offsets,
+                      const core::Tensor& adjacency_neighbors,
+                      const core::Tensor& positions,
+                      const core::Tensor& attr_in,
+                      core::Tensor& attr_out,
+                      VertexFilterType type,
+                      double strength) {
+    const core::Device device = attr_in.GetDevice();
+    const int64_t num_vertices = attr_in.GetLength();
+    core::AssertTensorShape(attr_in, {utility::nullopt, 3});
+    core::AssertTensorDtypes(attr_in, {core::Float32, core::Float64});
+    core::AssertTensorShape(positions, {num_vertices, 3});
+    core::AssertTensorDtype(positions, attr_in.GetDtype());
+    core::AssertTensorDevice(positions, device);
+    core::AssertTensorShape(attr_out, {num_vertices, 3});
+    core::AssertTensorDtype(attr_out, attr_in.GetDtype());
+    core::AssertTensorDevice(attr_out, device);
+    core::AssertTensorShape(adjacency_offsets, {num_vertices + 1});
+    core::AssertTensorDtype(adjacency_offsets, core::Int64);
+    core::AssertTensorDevice(adjacency_offsets, device);
+    core::AssertTensorShape(adjacency_neighbors, {utility::nullopt});
+    core::AssertTensorDtype(adjacency_neighbors, core::Int32);
+    core::AssertTensorDevice(adjacency_neighbors, device);
+    if (!attr_out.IsContiguous()) {
+        utility::LogError("attr_out must be contiguous.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        FilterVertexAttrCPU(adjacency_offsets.Contiguous(),
+                            adjacency_neighbors.Contiguous(),
+                            positions.Contiguous(), attr_in.Contiguous(),
+                            attr_out, type, strength);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(FilterVertexAttrCUDA, adjacency_offsets.Contiguous(),
+                  adjacency_neighbors.Contiguous(), positions.Contiguous(),
+                  attr_in.Contiguous(), attr_out, type, strength);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+void ApplyVertexStencils(const core::Tensor& stencil_offsets,
+                         const core::Tensor& stencil_vertices,
+                         const core::Tensor& stencil_weights,
+                         const core::Tensor& attr_in,
+                         core::Tensor& attr_out) {
+    const core::Device device = attr_in.GetDevice();
+    core::AssertTensorShape(attr_in, {utility::nullopt, 3});
+    core::AssertTensorDtypes(attr_in, {core::Float32, core::Float64});
+    core::AssertTensorShape(stencil_offsets, {attr_out.GetLength() + 1});
+    core::AssertTensorDtype(stencil_offsets, core::Int64);
+    core::AssertTensorDevice(stencil_offsets, device);
+    core::AssertTensorShape(stencil_vertices, {utility::nullopt});
+    core::AssertTensorDtype(stencil_vertices, core::Int32);
+    core::AssertTensorDevice(stencil_vertices, device);
+    core::AssertTensorShape(stencil_weights, {stencil_vertices.GetLength()});
+    core::AssertTensorDtype(stencil_weights, attr_in.GetDtype());
+    core::AssertTensorDevice(stencil_weights, device);
+    core::AssertTensorShape(attr_out, {utility::nullopt, 3});
+    core::AssertTensorDtype(attr_out, attr_in.GetDtype());
+    core::AssertTensorDevice(attr_out, device);
+    if (!attr_out.IsContiguous()) {
+        utility::LogError("attr_out must be contiguous.");
+    }
+
+    core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ApplyVertexStencilsCPU(stencil_offsets.Contiguous(),
+                               stencil_vertices.Contiguous(),
+                               stencil_weights.Contiguous(),
+                               attr_in.Contiguous(), attr_out);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ApplyVertexStencilsCUDA, stencil_offsets.Contiguous(),
+                  stencil_vertices.Contiguous(), stencil_weights.Contiguous(),
+                  attr_in.Contiguous(), attr_out);
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include "open3d/core/Tensor.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+/// Update rule of FilterVertexAttr.
+enum class VertexFilterType {
+    /// v + strength * (|N| * v - sum of the neighbors).
+    Sharpen,
+    /// (v + sum of the neighbors) / (|N| + 1).
+    SmoothSimple,
+    /// v + strength * (inverse distance weighted mean of the neighbors - v).
+    SmoothLaplacian,
+};
+
+/// \brief One pass of a vertex filter.
+///
+/// Computes \p attr_out from \p attr_in and the vertex adjacency in
+/// compressed sparse row format: the neighbors of vertex v are
+/// adjacency_neighbors[adjacency_offsets[v]] to
+/// adjacency_neighbors[adjacency_offsets[v + 1] - 1]. The inverse distance
+/// weights of SmoothLaplacian are computed from \p positions. Vertices
+/// without neighbors keep their values.
+///
+/// \param adjacency_offsets Int64 tensor of shape {N + 1}.
+/// \param adjacency_neighbors Int32 tensor of shape {adjacency_offsets[N]}.
+/// \param positions Vertex positions of shape {N, 3}.
+/// \param attr_in Vertex attribute of shape {N, 3} with the dtype of
+/// \p positions.
+/// \param attr_out [out] Contiguous tensor with the shape and dtype of
+/// \p attr_in.
+void FilterVertexAttr(const core::Tensor& adjacency_offsets,
+                      const core::Tensor& adjacency_neighbors,
+                      const core::Tensor& positions,
+                      const core::Tensor& attr_in,
+                      core::Tensor& attr_out,
+                      VertexFilterType type,
+                      double strength);
+
+/// \brief Applies linear vertex stencils, such as the ones of
+/// open3d::geometry::LoopSubdivision.
+///
+/// Row i of \p attr_out is the sum of
+/// stencil_weights[j] * attr_in[stencil_vertices[j]] for j from
+/// stencil_offsets[i] to stencil_offsets[i + 1] - 1.
+///
+/// \param stencil_offsets Int64 tensor of shape {M + 1}.
+/// \param stencil_vertices Int32 tensor of shape {stencil_offsets[M]}.
+/// \param stencil_weights Tensor of shape {stencil_offsets[M]} with the dtype
+/// of \p attr_in.
+/// \param attr_in Vertex attribute of shape {N, 3}.
+/// \param attr_out [out] Contiguous tensor of shape {M, 3} with the dtype of
+/// \p attr_in.
+void ApplyVertexStencils(const core::Tensor& stencil_offsets,
+                         const core::Tensor& stencil_vertices,
+                         const core::Tensor& stencil_weights,
+                         const core::Tensor& attr_in,
+                         core::Tensor& attr_out);
+
+void FilterVertexAttrCPU(const core::Tensor& adjacency_offsets,
+                         const core::Tensor& adjacency_neighbors,
+                         const core::Tensor& positions,
+                         const core::Tensor& attr_in,
+                         core::Tensor& attr_out,
+                         VertexFilterType type,
+                         double strength);
+
+void ApplyVertexStencilsCPU(const core::Tensor& stencil_offsets,
+                            const core::Tensor& stencil_vertices,
+                            const core::Tensor& stencil_weights,
+                            const core::Tensor& attr_in,
+                            core::Tensor& attr_out);
+
+#ifdef BUILD_CUDA_MODULE
+void FilterVertexAttrCUDA(const core::Tensor& adjacency_offsets,
+                          const core::Tensor& adjacency_neighbors,
+                          const core::Tensor& positions,
+                          const core::Tensor& attr_in,
+                          core::Tensor& attr_out,
+                          VertexFilterType type,
+                          double strength);
+
+void ApplyVertexStencilsCUDA(const core::Tensor& stencil_offsets,
+                             const core::Tensor& stencil_vertices,
+                             const core::Tensor& stencil_weights,
+                             const core::Tensor& attr_in,
+                             core::Tensor& attr_out);
+#endif
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -0,0 +1,158 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/CUDAUtils.h"
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/geometry/kernel/TriangleMesh.h"
+
+namespace open3d {
+namespace t {
+namespace geometry {
+namespace kernel {
+namespace trianglemesh {
+
+#ifndef __CUDACC__
+using std::sqrt;
+#endif
+
+#ifdef __CUDACC__
+void FilterVertexAttrCUDA
+#else
+void FilterVertexAttrCPU
+#endif
+        (const core::Tensor& adjacency_offsets,
+         const core::Tensor& adjacency_neighbors,
+         const core::Tensor& positions,
+         const core::Tensor& attr_in,
+         core::Tensor& attr_out,
+         VertexFilterType type,
+         double strength) {
+    const int64_t* offsets_ptr = adjacency_offsets.GetDataPtr<int64_t>();
+    const int32_t* neighbors_ptr = adjacency_neighbors.GetDataPtr<int32_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(attr_in.GetDtype(), [&]() {
+        const scalar_t* positions_ptr = positions.GetDataPtr<scalar_t>();
+        const scalar_t* in_ptr = attr_in.GetDataPtr<scalar_t>();
+        scalar_t* out_ptr = attr_out.GetDataPtr<scalar_t>();
+        const scalar_t s = static_cast<scalar_t>(strength);
+
+        core::ParallelFor(
+                attr_in.GetDevice(), attr_in.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t begin = offsets_ptr[workload_idx];
+                    const int64_t end = offsets_ptr[workload_idx + 1];
+                    const scalar_t* value = in_ptr + 3 * workload_idx;
+                    scalar_t* filtered = out_ptr + 3 * workload_idx;
+                    if (begin == end) {
+                        filtered[0] = value[0];
+                        filtered[1] = value[1];
+                        filtered[2] = value[2];
+                        return;
+                    }
+
+                    const scalar_t* position = positions_ptr + 3 * workload_idx;
+                    scalar_t sum[3] = {0, 0, 0};
+                    scalar_t total_weight = 0;
+                    for (int64_t i = begin; i < end; ++i) {
+                        const int64_t nb = neighbors_ptr[i];
+                        scalar_t weight = 1;
+                        if (type == VertexFilterType::SmoothLaplacian) {
+                            const scalar_t* other = positions_ptr + 3 * nb;
+                            const scalar_t dx = position[0] - other[0];
+                            const scalar_t dy = position[1] - other[1];
+                            const scalar_t dz = position[2] - other[2];
+                            weight = 1 / (sqrt(dx * dx + dy * dy + dz * dz) +
+                                          scalar_t(1e-12));
+                        }
+                        total_weight += weight;
+                        sum[0] += weight * in_ptr[3 * nb + 0];
+                        sum[1] += weight * in_ptr[3 * nb + 1];
+                        sum[2] += weight * in_ptr[3 * nb + 2];
+                    }
+
+                    const scalar_t nb_size = static_cast<scalar_t>(end - begin);
+                    for (int k = 0; k < 3; ++k) {
+                        if (type == VertexFilterType::Sharpen) {
+                            filtered[k] = value[k] +
+                                          s * (value[k] * nb_size - sum[k]);
+                        } else if (type == VertexFilterType::SmoothSimple) {
+                            filtered[k] = (value[k] + sum[k]) / (1 + nb_size);
+                        } else {
+                            filtered[k] =
+                                    value[k] +
+                                    s * (sum[k] / total_weight - value[k]);
+                        }
+                    }
+                });
+    });
+}
+
+#ifdef __CUDACC__
+void ApplyVertexStencilsCUDA
+#else
+void ApplyVertexStencilsCPU
+#endif
+        (const core::Tensor& stencil_offsets,
+         const core::Tensor& stencil_vertices,
+         const core::Tensor& stencil_weights,
+         const core::Tensor& attr_in,
+         core::Tensor& attr_out) {
+    const int64_t* offsets_ptr = stencil_offsets.GetDataPtr<int64_t>();
+    const int32_t* vertices_ptr = stencil_vertices.GetDataPtr<int32_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(attr_in.GetDtype(), [&]() {
+        const scalar_t* weights_ptr = stencil_weights.GetDataPtr<scalar_t>();
+        const scalar_t* in_ptr = attr_in.GetDataPtr<scalar_t>();
+        scalar_t* out_ptr = attr_out.GetDataPtr<scalar_t>();
+
+        core::ParallelFor(
+                attr_in.GetDevice(), attr_out.GetLength(),
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    scalar_t sum[3] = {0, 0, 0};
+                    for (int64_t j = offsets_ptr[workload_idx];
+                         j < offsets_ptr[workload_idx + 1]; ++j) {
+                        const scalar_t* value = in_ptr + 3 * vertices_ptr[j];
+                        sum[0] += weights_ptr[j] * value[0];
+                        sum[1] += weights_ptr[j] * value[1];
+                        sum[2] += weights_ptr[j] * value[2];
+                    }
+                    scalar_t* subdivided = out_ptr + 3 * workload_idx;
+                    subdivided[0] = sum[0];
+                    subdivided[1] = sum[1];
+                    subdivided[2] = sum[2];
+                });
+    });
+}
+
+}  // namespace trianglemesh
+}  // namespace kernel
+}  // namespace geometry
+}  // namespace t
+}  // namespace open3d
@@ -216,6 +216,77 @@ void Integrate(const core::Tensor& depth,
     }
 }
 
+void IntegrateFrames(const core::Tensor& depths,
+                     const core::Tensor& colors,
+                     const core::Tensor& block_indices,
+                     const core::Tensor& block_keys,
+                     TensorMap& block_value_map,
+                     const core::Tensor& depth_intrinsic,
+                     const core::Tensor& color_intrinsic,
+                     const core::Tensor& extrinsics,
+                     index_t resolution,
+                     float voxel_size,
+                     float sdf_trunc,
+                     float depth_scale,
+                     float depth_max) {
+    using tsdf_t = float;
+    core::Dtype block_weight_dtype = core::Dtype::Float32;
+    core::Dtype block_color_dtype = core::Dtype::Float32;
+    if (block_value_map.Contains("weight")) {
+        block_weight_dtype = block_value_map.at("weight").GetDtype();
+    }
+    if (block_value_map.Contains("color")) {
+        block_color_dtype = block_value_map.at("color").GetDtype();
+    }
+
+    core::Dtype input_depth_dtype = depths.GetDtype();
+    core::Dtype input_color_dtype = (input_depth_dtype == core::Dtype::Float32)
+                                            ? core::Dtype::Float32
+                                            : core::Dtype::UInt8;
+    if (colors.NumElements() > 0) {
+        input_color_dtype = colors.GetDtype();
+    }
+
+    core::Device::DeviceType device_type = depths.GetDevice().GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
+                input_depth_dtype, input_color_dtype, [&] {
+                    DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
+                            block_weight_dtype, block_color_dtype, [&] {
+                                IntegrateFramesCPU<
+                                        input_depth_t, input_color_t, tsdf_t,
+                                        weight_t, color_t>(
+                                        depths, colors, block_indices,
+                                        block_keys, block_value_map,
+                                        depth_intrinsic, color_intrinsic,
+                                        extrinsics, resolution, voxel_size,
+                                        sdf_trunc, depth_scale, depth_max);
+                            });
+                });
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+#ifdef BUILD_CUDA_MODULE
+        DISPATCH_INPUT_DTYPE_TO_TEMPLATE(
+                input_depth_dtype, input_color_dtype, [&] {
+                    DISPATCH_VALUE_DTYPE_TO_TEMPLATE(
+                            block_weight_dtype, block_color_dtype, [&] {
+                                IntegrateFramesCUDA<
+                                        input_depth_t, input_color_t, tsdf_t,
+                                        weight_t, color_t>(
+                                        depths, colors, block_indices,
+                                        block_keys, block_value_map,
+                                        depth_intrinsic, color_intrinsic,
+                                        extrinsics, resolution, voxel_size,
+                                        sdf_trunc, depth_scale, depth_max);
+                            });
+                });
+#else
+        utility::LogError("Not compiled with CUDA, but CUDA device is used.");
+#endif
+    } else {
+        utility::LogError("Unimplemented device");
+    }
+}
+
 void EstimateRange(const core::Tensor& block_keys,
                    core::Tensor& range_minmax_map,
                    const core::Tensor& intrinsics,
@@ -371,7 +442,9 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
-                         int& vertex_count) {
+                         int& vertex_count,
+                         index_t num_surface_blocks,
+                         core::Tensor& triangle_block_indices) {
     using tsdf_t = float;
     core::Dtype block_weight_dtype = core::Dtype::Float32;
     core::Dtype block_color_dtype = core::Dtype::Float32;
@@ -391,7 +464,8 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                             nb_block_masks, block_keys, block_value_map,
                             vertices, triangles, vertex_normals, vertex_colors,
                             block_resolution, voxel_size, weight_threshold,
-                            vertex_count);
+                            vertex_count, num_surface_blocks,
+                            triangle_block_indices);
                 });
     } else if (device_type == core::Device::DeviceType::CUDA) {
 #ifdef BUILD_CUDA_MODULE
@@ -402,7 +476,8 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                             nb_block_masks, block_keys, block_value_map,
                             vertices, triangles, vertex_normals, vertex_colors,
                             block_resolution, voxel_size, weight_threshold,
-                            vertex_count);
+                            vertex_count, num_surface_blocks,
+                            triangle_block_indices);
                 });
 #else
         utility::LogError("Not compiled with CUDA, but CUDA device is used.");
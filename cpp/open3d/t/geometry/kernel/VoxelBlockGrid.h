@@ -80,6 +80,24 @@ void Integrate(const core::Tensor& depth,
                float depth_scale,
                float depth_max);
 
+/// Integrates a batch of frames into the selected blocks. \p depths is a
+/// {F, H, W, 1} stack, \p colors a {F, H, W, 3} stack (or empty), and
+/// \p extrinsics is {F, 4, 4}. Each voxel is read and written once, frames are
+/// fused in order.
+void IntegrateFrames(const core::Tensor& depths,
+                     const core::Tensor& colors,
+                     const core::Tensor& block_indices,
+                     const core::Tensor& block_keys,
+                     TensorMap& block_value_map,
+                     const core::Tensor& depth_intrinsic,
+                     const core::Tensor& color_intrinsic,
+                     const core::Tensor& extrinsics,
+                     index_t resolution,
+                     float voxel_size,
+                     float sdf_trunc,
+                     float depth_scale,
+                     float depth_max);
+
 void EstimateRange(const core::Tensor& block_keys,
                    core::Tensor& range_minmax_map,
                    const core::Tensor& intrinsics,
@@ -122,6 +140,11 @@ void ExtractPointCloud(const core::Tensor& block_indices,
                        float weight_threshold,
                        index_t& valid_size);
 
+/// Marching cubes over the blocks in \p block_indices. Only the first
+/// \p num_surface_blocks blocks produce triangles, the rest must cover the
+/// (+x, +y, +z) neighbors that hold their shared boundary vertices. In that
+/// case \p triangle_block_indices receives the buffer index of the block owning
+/// each triangle. Use -1 to triangulate all the blocks.
 void ExtractTriangleMesh(const core::Tensor& block_indices,
                          const core::Tensor& inv_block_indices,
                          const core::Tensor& nb_block_indices,
@@ -135,7 +158,9 @@ void ExtractTriangleMesh(const core::Tensor& block_indices,
                          index_t block_resolution,
                          float voxel_size,
                          float weight_threshold,
-                         index_t& vertex_count);
+                         index_t& vertex_count,
+                         index_t num_surface_blocks,
+                         core::Tensor& triangle_block_indices);
 
 /// CPU
 void PointCloudTouchCPU(std::shared_ptr<core::HashMap>& hashmap,
@@ -183,6 +208,25 @@ void IntegrateCPU(const core::Tensor& depth,
                   float depth_scale,
                   float depth_max);
 
+template <typename input_depth_t,
+          typename input_color_t,
+          typename tsdf_t,
+          typename weight_t,
+          typename color_t>
+void IntegrateFramesCPU(const core::Tensor& depths,
+                        const core::Tensor& colors,
+                        const core::Tensor& block_indices,
+                        const core::Tensor& block_keys,
+                        TensorMap& block_value_map,
+                        const core::Tensor& depth_intrinsic,
+                        const core::Tensor& color_intrinsic,
+                        const core::Tensor& extrinsics,
+                        index_t resolution,
+                        float voxel_size,
+                        float sdf_trunc,
+                        float depth_scale,
+                        float depth_max);
+
 void EstimateRangeCPU(const core::Tensor& block_keys,
                       core::Tensor& range_minmax_map,
                       const core::Tensor& intrinsics,
@@ -241,7 +285,9 @@ void ExtractTriangleMeshCPU(const core::Tensor& block_indices,
                             index_t block_resolution,
                             float voxel_size,
                             float weight_threshold,
-                            index_t& vertex_count);
+                            index_t& vertex_count,
+                            index_t num_surface_blocks,
+                            core::Tensor& triangle_block_indices);
 
 #ifdef BUILD_CUDA_MODULE
 void PointCloudTouchCUDA(std::shared_ptr<core::HashMap>& hashmap,
@@ -289,6 +335,25 @@ void IntegrateCUDA(const core::Tensor& depth,
                    float depth_scale,
                    float depth_max);
 
+template <typename input_depth_t,
+          typename input_color_t,
+          typename tsdf_t,
+          typename weight_t,
+          typename color_t>
+void IntegrateFramesCUDA(const core::Tensor& depths,
+                         const core::Tensor& colors,
+                         const core::Tensor& block_indices,
+                         const core::Tensor& block_keys,
+                         TensorMap& block_value_map,
+                         const core::Tensor& depth_intrinsic,
+                         const core::Tensor& color_intrinsic,
+                         const core::Tensor& extrinsics,
+                         index_t resolution,
+                         float voxel_size,
+                         float sdf_trunc,
+                         float depth_scale,
+                         float depth_max);
+
 void EstimateRangeCUDA(const core::Tensor& block_keys,
                        core::Tensor& range_minmax_map,
                        const core::Tensor& intrinsics,
@@ -347,7 +412,9 @@ void ExtractTriangleMeshCUDA(const core::Tensor& block_indices,
                              index_t block_resolution,
                              float voxel_size,
                              float weight_threshold,
-                             index_t& vertex_count);
+                             index_t& vertex_count,
+                             index_t num_surface_blocks,
+                             core::Tensor& triangle_block_indices);
 
 #endif
 }  // namespace voxel_grid
@@ -236,6 +236,15 @@ template void IntegrateCPU<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCPU<float, float, float, float, float>(FN_ARGUMENTS);
 
+template void IntegrateFramesCPU<uint16_t, uint8_t, float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void IntegrateFramesCPU<uint16_t, uint8_t, float, float, float>(
+        FN_ARGUMENTS);
+template void IntegrateFramesCPU<float, float, float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void IntegrateFramesCPU<float, float, float, float, float>(
+        FN_ARGUMENTS);
+
 #undef FN_ARGUMENTS
 
 #define FN_ARGUMENTS                                                           \
@@ -273,7 +282,8 @@ template void ExtractPointCloudCPU<float, float, float>(FN_ARGUMENTS);
             core::Tensor &vertices, core::Tensor &triangles,                  \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
             index_t block_resolution, float voxel_size,                       \
-            float weight_threshold, index_t &vertex_count
+            float weight_threshold, index_t &vertex_count,                    \
+            index_t num_surface_blocks, core::Tensor &triangle_block_indices
 
 template void ExtractTriangleMeshCPU<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCPU<float, float, float>(FN_ARGUMENTS);
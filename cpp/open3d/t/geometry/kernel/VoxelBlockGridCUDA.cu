@@ -262,6 +262,15 @@ template void IntegrateCUDA<float, float, float, uint16_t, uint16_t>(
         FN_ARGUMENTS);
 template void IntegrateCUDA<float, float, float, float, float>(FN_ARGUMENTS);
 
+template void IntegrateFramesCUDA<uint16_t, uint8_t, float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void IntegrateFramesCUDA<uint16_t, uint8_t, float, float, float>(
+        FN_ARGUMENTS);
+template void IntegrateFramesCUDA<float, float, float, uint16_t, uint16_t>(
+        FN_ARGUMENTS);
+template void IntegrateFramesCUDA<float, float, float, float, float>(
+        FN_ARGUMENTS);
+
 #undef FN_ARGUMENTS
 
 #define FN_ARGUMENTS                                                           \
@@ -304,7 +313,9 @@ void ExtractTriangleMeshCUDA(const core::Tensor &block_indices,
                              index_t block_resolution,
                              float voxel_size,
                              float weight_threshold,
-                             index_t &vertex_count);
+                             index_t &vertex_count,
+                             index_t num_surface_blocks,
+                             core::Tensor &triangle_block_indices);
 
 #define FN_ARGUMENTS                                                          \
     const core::Tensor &block_indices, const core::Tensor &inv_block_indices, \
@@ -314,7 +325,8 @@ void ExtractTriangleMeshCUDA(const core::Tensor &block_indices,
             core::Tensor &vertices, core::Tensor &triangles,                  \
             core::Tensor &vertex_normals, core::Tensor &vertex_colors,        \
             index_t block_resolution, float voxel_size,                       \
-            float weight_threshold, index_t &vertex_count
+            float weight_threshold, index_t &vertex_count,                    \
+            index_t num_surface_blocks, core::Tensor &triangle_block_indices
 
 template void ExtractTriangleMeshCUDA<float, uint16_t, uint16_t>(FN_ARGUMENTS);
 template void ExtractTriangleMeshCUDA<float, float, float>(FN_ARGUMENTS);
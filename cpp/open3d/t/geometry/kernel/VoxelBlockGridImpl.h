@@ -312,6 +312,193 @@ void IntegrateCPU
 #endif
 }
 
+template <typename input_depth_t,
+          typename input_color_t,
+          typename tsdf_t,
+          typename weight_t,
+          typename color_t>
+#if defined(__CUDACC__)
+void IntegrateFramesCUDA
+#else
+void IntegrateFramesCPU
+#endif
+        (const core::Tensor& depths,
+         const core::Tensor& colors,
+         const core::Tensor& indices,
+         const core::Tensor& block_keys,
+         TensorMap& block_value_map,
+         const core::Tensor& depth_intrinsic,
+         const core::Tensor& color_intrinsic,
+         const core::Tensor& extrinsics,
+         index_t resolution,
+         float voxel_size,
+         float sdf_trunc,
+         float depth_scale,
+         float depth_max) {
+    // Parameters
+    index_t resolution2 = resolution * resolution;
+    index_t resolution3 = resolution2 * resolution;
+    index_t num_frames = depths.GetLength();
+
+    // Only the intrinsics are used from the indexers, per-frame extrinsics are
+    // read from a flattened {F, 3, 4} Float32 array on the target device.
+    core::Tensor identity =
+            core::Tensor::Eye(4, core::Dtype::Float64, core::Device("CPU:0"));
+    TransformIndexer transform_indexer(depth_intrinsic, identity, voxel_size);
+    TransformIndexer colormap_indexer(color_intrinsic, identity);
+
+    core::Device device = block_keys.GetDevice();
+    core::Tensor extrinsics_3x4 = extrinsics.Slice(1, 0, 3)
+                                          .To(device, core::Float32)
+                                          .Contiguous();
+    const float* extrinsics_ptr = extrinsics_3x4.GetDataPtr<float>();
+
+    ArrayIndexer voxel_indexer({resolution, resolution, resolution});
+
+    ArrayIndexer block_keys_indexer(block_keys, 1);
+    ArrayIndexer depth_indexer(depths, 3);
+
+    const index_t* indices_ptr = indices.GetDataPtr<index_t>();
+
+    if (!block_value_map.Contains("tsdf") ||
+        !block_value_map.Contains("weight")) {
+        utility::LogError(
+                "TSDF and/or weight not allocated in blocks, please implement "
+                "customized integration.");
+    }
+    tsdf_t* tsdf_base_ptr = block_value_map.at("tsdf").GetDataPtr<tsdf_t>();
+    weight_t* weight_base_ptr =
+            block_value_map.at("weight").GetDataPtr<weight_t>();
+
+    bool integrate_color =
+            block_value_map.Contains("color") && colors.NumElements() > 0;
+    color_t* color_base_ptr = nullptr;
+    ArrayIndexer color_indexer;
+
+    float color_multiplier = 1.0;
+    if (integrate_color) {
+        color_base_ptr = block_value_map.at("color").GetDataPtr<color_t>();
+        color_indexer = ArrayIndexer(colors, 3);
+
+        // Float32: [0, 1] -> [0, 255]
+        if (colors.GetDtype() == core::Float32) {
+            color_multiplier = 255.0;
+        }
+    }
+
+    index_t n = indices.GetLength() * resolution3;
+    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t workload_idx) {
+        // Natural index (0, N) -> (block_idx, voxel_idx)
+        index_t block_idx = indices_ptr[workload_idx / resolution3];
+        index_t voxel_idx = workload_idx % resolution3;
+
+        /// Coordinate transform
+        // block_idx -> (x_block, y_block, z_block)
+        index_t* block_key_ptr =
+                block_keys_indexer.GetDataPtr<index_t>(block_idx);
+        index_t xb = block_key_ptr[0];
+        index_t yb = block_key_ptr[1];
+        index_t zb = block_key_ptr[2];
+
+        // voxel_idx -> (x_voxel, y_voxel, z_voxel)
+        index_t xv, yv, zv;
+        voxel_indexer.WorkloadToCoord(voxel_idx, &xv, &yv, &zv);
+
+        // coordinate in world (in voxel -> in meter)
+        float xw = static_cast<float>(xb * resolution + xv) * voxel_size;
+        float yw = static_cast<float>(yb * resolution + yv) * voxel_size;
+        float zw = static_cast<float>(zb * resolution + zv) * voxel_size;
+
+        index_t linear_idx = block_idx * resolution3 + voxel_idx;
+
+        // Load the voxel once, fuse all frames in order, and store once. The
+        // running values are kept in the storage types so that the result is
+        // identical to integrating the frames one by one.
+        tsdf_t tsdf = tsdf_base_ptr[linear_idx];
+        weight_t weight_value = weight_base_ptr[linear_idx];
+        color_t color[3] = {0, 0, 0};
+        if (integrate_color) {
+            for (index_t i = 0; i < 3; ++i) {
+                color[i] = color_base_ptr[3 * linear_idx + i];
+            }
+        }
+        bool updated = false;
+
+        for (index_t f = 0; f < num_frames; ++f) {
+            const float* T = extrinsics_ptr + 12 * f;
+
+            // coordinate in camera (in meter)
+            float xc = xw * T[0] + yw * T[1] + zw * T[2] + T[3];
+            float yc = xw * T[4] + yw * T[5] + zw * T[6] + T[7];
+            float zc = xw * T[8] + yw * T[9] + zw * T[10] + T[11];
+
+            // coordinate in image (in pixel)
+            float u, v;
+            transform_indexer.Project(xc, yc, zc, &u, &v);
+            if (!depth_indexer.InBoundary(u, v, static_cast<float>(f))) {
+                continue;
+            }
+
+            index_t ui = static_cast<index_t>(u);
+            index_t vi = static_cast<index_t>(v);
+
+            float depth = *depth_indexer.GetDataPtr<input_depth_t>(ui, vi, f) /
+                          depth_scale;
+
+            float sdf = depth - zc;
+            if (depth <= 0 || depth > depth_max || zc <= 0 ||
+                sdf < -sdf_trunc) {
+                continue;
+            }
+            sdf = sdf < sdf_trunc ? sdf : sdf_trunc;
+            sdf /= sdf_trunc;
+
+            float inv_wsum = 1.0f / (weight_value + 1);
+            float weight = weight_value;
+            tsdf = (weight * tsdf + sdf) * inv_wsum;
+
+            if (integrate_color) {
+                // Unproject ui, vi with depth_intrinsic, then project back
+                // with color_intrinsic
+                float x, y, z;
+                transform_indexer.Unproject(ui, vi, 1.0, &x, &y, &z);
+
+                float uf, vf;
+                colormap_indexer.Project(x, y, z, &uf, &vf);
+                if (color_indexer.InBoundary(uf, vf, static_cast<float>(f))) {
+                    ui = round(uf);
+                    vi = round(vf);
+
+                    input_color_t* input_color_ptr =
+                            color_indexer.GetDataPtr<input_color_t>(ui, vi, f);
+
+                    for (index_t i = 0; i < 3; ++i) {
+                        color[i] = (weight * color[i] +
+                                    input_color_ptr[i] * color_multiplier) *
+                                   inv_wsum;
+                    }
+                }
+            }
+            weight_value = weight + 1;
+            updated = true;
+        }
+
+        if (updated) {
+            tsdf_base_ptr[linear_idx] = tsdf;
+            weight_base_ptr[linear_idx] = weight_value;
+            if (integrate_color) {
+                for (index_t i = 0; i < 3; ++i) {
+                    color_base_ptr[3 * linear_idx + i] = color[i];
+                }
+            }
+        }
+    });
+
+#if defined(__CUDACC__)
+    core::cuda::Synchronize();
+#endif
+}
+
 #if defined(__CUDACC__)
 void EstimateRangeCUDA
 #else
@@ -1298,7 +1485,9 @@ void ExtractTriangleMeshCPU
          index_t block_resolution,
          float voxel_size,
          float weight_threshold,
-         index_t& vertex_count) {
+         index_t& vertex_count,
+         index_t num_surface_blocks,
+         core::Tensor& triangle_block_indices) {
     core::Device device = block_indices.GetDevice();
 
     index_t resolution = block_resolution;
@@ -1350,10 +1539,19 @@ void ExtractTriangleMeshCPU
     }
 
     index_t n = n_blocks * resolution3;
+
+    // Only the leading surface blocks produce triangles. The remaining blocks
+    // only hold the vertices on edges shared with the surface blocks.
+    bool output_block_indices = num_surface_blocks >= 0;
+    if (!output_block_indices) {
+        num_surface_blocks = n_blocks;
+    }
+    index_t n_surface = num_surface_blocks * resolution3;
+
     // Pass 0: analyze mesh structure, set up one-on-one correspondences
     // from edges to vertices.
 
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelFor(device, n_surface, [=] OPEN3D_DEVICE(index_t widx) {
         auto GetLinearIdx = [&] OPEN3D_DEVICE(
                                     index_t xo, index_t yo, index_t zo,
                                     index_t curr_block_idx) -> index_t {
@@ -1611,13 +1809,20 @@ void ExtractTriangleMeshCPU
     triangles = core::Tensor({triangle_count, 3}, core::Int32, device);
     ArrayIndexer triangle_indexer(triangles, 1);
 
+    index_t* triangle_block_ptr = nullptr;
+    if (output_block_indices) {
+        triangle_block_indices =
+                core::Tensor({triangle_count}, core::Int32, device);
+        triangle_block_ptr = triangle_block_indices.GetDataPtr<index_t>();
+    }
+
 #if defined(__CUDACC__)
     count = core::Tensor(std::vector<index_t>{0}, {}, core::Int32, device);
     count_ptr = count.GetDataPtr<index_t>();
 #else
     (*count_ptr) = 0;
 #endif
-    core::ParallelFor(device, n, [=] OPEN3D_DEVICE(index_t widx) {
+    core::ParallelFor(device, n_surface, [=] OPEN3D_DEVICE(index_t widx) {
         // Natural index (0, N) -> (block_idx, voxel_idx)
         index_t workload_block_idx = widx / resolution3;
         index_t voxel_idx = widx % resolution3;
@@ -1637,6 +1842,9 @@ void ExtractTriangleMeshCPU
             if (tri_table[table_idx][tri] == -1) return;
 
             index_t tri_idx = OPEN3D_ATOMIC_ADD(count_ptr, 1);
+            if (triangle_block_ptr) {
+                triangle_block_ptr[tri_idx] = indices_ptr[workload_block_idx];
+            }
 
             for (index_t vertex = 0; vertex < 3; ++vertex) {
                 index_t edge = tri_table[table_idx][tri + vertex];
@@ -1676,6 +1884,10 @@ void ExtractTriangleMeshCPU
 #endif
     utility::LogDebug("Total triangle count = {}", triangle_count);
     triangles = triangles.Slice(0, 0, triangle_count);
+    if (output_block_indices) {
+        triangle_block_indices =
+                triangle_block_indices.Slice(0, 0, triangle_count);
+    }
 }
 
 }  // namespace voxel_grid
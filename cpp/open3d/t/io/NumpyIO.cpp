@@ -431,6 +431,16 @@ static void WriteNpzOneTensor(const std::string& file_name,
     // The ".npy" suffix will be removed when npz is read.
     std::string var_name = tensor_name + ".npy";
 
+    // Pad the extra field of the local header such that the array data is 64
+    // byte aligned in the file, so ReadNpz() can memory map it in place. An
+    // extra field holds at least its 4 byte id and size.
+    const size_t unpadded_data_offset = global_header_offset + 30 +
+                                        var_name.size() + npy_header.Size();
+    size_t extra_field_len = (64 - unpadded_data_offset % 64) % 64;
+    if (extra_field_len > 0 && extra_field_len < 4) {
+        extra_field_len += 64;
+    }
+
     // Build the local header.
     CharVector local_header;
     local_header.Append("PK");                       // First part of sig
@@ -444,14 +454,20 @@ static void WriteNpzOneTensor(const std::string& file_name,
     local_header.Append<uint32_t>(nbytes);           // Compressed size
     local_header.Append<uint32_t>(nbytes);           // Uncompressed size
     local_header.Append<uint16_t>(var_name.size());  // Varaible's name length
-    local_header.Append<uint16_t>(0);                // Extra field length
+    local_header.Append<uint16_t>(extra_field_len);  // Extra field length
     local_header.Append(var_name);
+    if (extra_field_len > 0) {
+        local_header.Append<uint16_t>(0xD935);  // Alignment padding id
+        local_header.Append<uint16_t>(extra_field_len - 4);
+        local_header.Append(extra_field_len - 4, '\0');
+    }
 
     // Build global header.
     global_header.Append("PK");              // First part of sig
     global_header.Append<uint16_t>(0x0201);  // Second part of sig
     global_header.Append<uint16_t>(20);      // Version made by
-    global_header.Append(local_header.Begin() + 4, local_header.Begin() + 30);
+    global_header.Append(local_header.Begin() + 4, local_header.Begin() + 28);
+    global_header.Append<uint16_t>(0);  // Extra field length
     global_header.Append<uint16_t>(0);  // File comment length
     global_header.Append<uint16_t>(0);  // Disk number where file starts
     global_header.Append<uint16_t>(0);  // Internal file attributes
@@ -532,6 +548,18 @@ public:
         blob_ = std::make_shared<core::Blob>(NumBytes(), core::Device("CPU:0"));
     }
 
+    /// Wraps existing memory, e.g. a memory mapped file, owned by \p blob.
+    NumpyArray(const core::SizeVector& shape,
+               char type,
+               int64_t word_size,
+               bool fortran_order,
+               const std::shared_ptr<core::Blob>& blob)
+        : blob_(blob),
+          shape_(shape),
+          type_(type),
+          word_size_(word_size),
+          fortran_order_(fortran_order) {}
+
     template <typename T>
     T* GetDataPtr() {
         return reinterpret_cast<T*>(blob_->GetDataPtr());
@@ -628,16 +656,11 @@ static NumpyArray CreateNumpyArrayFromFile(FILE* fp) {
     return arr;
 }
 
-static NumpyArray CreateNumpyArrayFromCompressedFile(
-        FILE* fp,
+static NumpyArray CreateNumpyArrayFromCompressedBuffer(
+        const char* buffer_compressed,
         uint32_t num_compressed_bytes,
         uint32_t num_uncompressed_bytes) {
-    CharVector buffer_compressed(num_compressed_bytes);
     CharVector buffer_uncompressed(num_uncompressed_bytes);
-    size_t nread = fread(buffer_compressed.Data(), 1, num_compressed_bytes, fp);
-    if (nread != num_compressed_bytes) {
-        utility::LogError("Failed to read compressed data.");
-    }
 
     int err;
     z_stream d_stream;
@@ -650,8 +673,8 @@ static NumpyArray CreateNumpyArrayFromCompressedFile(
     err = inflateInit2(&d_stream, -MAX_WBITS);
 
     d_stream.avail_in = num_compressed_bytes;
-    d_stream.next_in =
-            reinterpret_cast<unsigned char*>(buffer_compressed.Data());
+    d_stream.next_in = reinterpret_cast<unsigned char*>(
+            const_cast<char*>(buffer_compressed));
     d_stream.avail_out = num_uncompressed_bytes;
     d_stream.next_out =
             reinterpret_cast<unsigned char*>(buffer_uncompressed.Data());
@@ -678,7 +701,200 @@ static NumpyArray CreateNumpyArrayFromCompressedFile(
     return array;
 }
 
-core::Tensor ReadNpy(const std::string& file_name) {
+static NumpyArray CreateNumpyArrayFromCompressedFile(
+        FILE* fp,
+        uint32_t num_compressed_bytes,
+        uint32_t num_uncompressed_bytes) {
+    CharVector buffer_compressed(num_compressed_bytes);
+    size_t nread = fread(buffer_compressed.Data(), 1, num_compressed_bytes, fp);
+    if (nread != num_compressed_bytes) {
+        utility::LogError("Failed to read compressed data.");
+    }
+    return CreateNumpyArrayFromCompressedBuffer(
+            buffer_compressed.Data(), num_compressed_bytes,
+            num_uncompressed_bytes);
+}
+
+// Returns the array whose .npy file starts at \p offset in \p mapped_file.
+// The array refers to the mapped pages and keeps the mapping alive. If the
+// data is not aligned to the element size, it is copied instead.
+static NumpyArray CreateNumpyArrayFromMappedFile(
+        const std::shared_ptr<utility::filesystem::MappedFile>& mapped_file,
+        size_t offset) {
+    const char* data = static_cast<const char*>(mapped_file->GetData());
+    const size_t size = mapped_file->GetSize();
+    const size_t preamble_len = 10;  // Version 1.0 assumed.
+    if (offset > size || preamble_len > size - offset) {
+        utility::LogError("Header preamble cannot be read.");
+    }
+    const size_t header_len = ParseNpyPreamble(data + offset);
+    if (header_len > size - offset - preamble_len) {
+        utility::LogError("Failed to read header dictionary.");
+    }
+
+    core::SizeVector shape;
+    char type;
+    int64_t word_size;
+    bool fortran_order;
+    std::tie(shape, type, word_size, fortran_order) =
+            ParseNpyHeaderFromBuffer(data + offset);
+    const size_t data_offset = offset + preamble_len + header_len;
+    const size_t num_elements = static_cast<size_t>(shape.NumElements());
+    if (word_size > 0 && num_elements > (size - data_offset) / word_size) {
+        utility::LogError("Failed to read array data.");
+    }
+    const size_t num_bytes = num_elements * word_size;
+
+    char* array_data =
+            static_cast<char*>(mapped_file->GetMutableData()) + data_offset;
+    if (word_size > 0 &&
+        reinterpret_cast<uintptr_t>(array_data) % word_size != 0) {
+        NumpyArray array(shape, type, word_size, fortran_order);
+        memcpy(array.GetDataPtr<char>(), array_data, num_bytes);
+        return array;
+    }
+    // The deleter holds a reference to the mapping, so the mapping is
+    // released together with the last tensor referring to it.
+    auto blob = std::make_shared<core::Blob>(
+            core::Device("CPU:0"), array_data,
+            [mapped_file](void*) { (void)mapped_file; });
+    return NumpyArray(shape, type, word_size, fortran_order, blob);
+}
+
+static std::shared_ptr<utility::filesystem::MappedFile> MapFile(
+        const std::string& file_name) {
+    auto mapped_file = std::make_shared<utility::filesystem::MappedFile>();
+    if (!mapped_file->Open(file_name, /*copy_on_write=*/true)) {
+        utility::LogError("Failed to map file {}, error: {}.", file_name,
+                          mapped_file->GetError());
+    }
+    return mapped_file;
+}
+
+static std::unordered_map<std::string, core::Tensor> ReadNpzMapped(
+        const std::string& file_name) {
+    std::shared_ptr<utility::filesystem::MappedFile> mapped_file =
+            MapFile(file_name);
+    const char* data = static_cast<const char*>(mapped_file->GetData());
+    const size_t size = mapped_file->GetSize();
+
+    std::unordered_map<std::string, core::Tensor> tensor_map;
+
+    // An empty zip file has exactly 22 bytes and only contains the footer.
+    if (size == 22 && data[0] == 'P' && data[1] == 'K' && data[2] == 0x05 &&
+        data[3] == 0x06) {
+        return tensor_map;
+    }
+
+    size_t offset = 0;
+    while (true) {
+        if (30 > size - offset) {
+            utility::LogError("Failed to read local header in npz.");
+        }
+        const char* local_header = data + offset;
+
+        // If we've reached the global header, stop reading.
+        if (local_header[2] != 0x03 || local_header[3] != 0x04) {
+            break;
+        }
+
+        uint16_t tensor_name_len;
+        uint16_t extra_field_len;
+        uint16_t compressed_method;
+        uint32_t num_compressed_bytes_32;
+        uint32_t num_uncompressed_bytes_32;
+        memcpy(&tensor_name_len, local_header + 26, sizeof(uint16_t));
+        memcpy(&extra_field_len, local_header + 28, sizeof(uint16_t));
+        memcpy(&compressed_method, local_header + 8, sizeof(uint16_t));
+        memcpy(&num_compressed_bytes_32, local_header + 18, sizeof(uint32_t));
+        memcpy(&num_uncompressed_bytes_32, local_header + 22,
+               sizeof(uint32_t));
+        uint64_t num_compressed_bytes = num_compressed_bytes_32;
+        uint64_t num_uncompressed_bytes = num_uncompressed_bytes_32;
+
+        const size_t name_offset = offset + 30;
+        const size_t extra_offset = name_offset + tensor_name_len;
+        const size_t npy_offset = extra_offset + extra_field_len;
+        if (tensor_name_len < 4 ||
+            size_t(tensor_name_len) + extra_field_len > size - name_offset) {
+            utility::LogError("Failed to read local header in npz.");
+        }
+
+        // Sizes of 0xFFFFFFFF are stored in a Zip64 extra field, which only
+        // holds those sizes, the uncompressed size first.
+        const bool zip64_uncompressed = num_uncompressed_bytes_32 == 0xFFFFFFFF;
+        const bool zip64_compressed = num_compressed_bytes_32 == 0xFFFFFFFF;
+        if (zip64_uncompressed || zip64_compressed) {
+            size_t field = extra_offset;
+            bool found = false;
+            while (!found && 4 <= npy_offset - field) {
+                uint16_t field_id;
+                uint16_t field_len;
+                memcpy(&field_id, data + field, sizeof(uint16_t));
+                memcpy(&field_len, data + field + 2, sizeof(uint16_t));
+                const size_t value_offset = field + 4;
+                if (field_len > npy_offset - value_offset) {
+                    break;
+                }
+                if (field_id == 0x0001) {
+                    const size_t num_values = size_t(zip64_uncompressed) +
+                                              size_t(zip64_compressed);
+                    if (field_len < num_values * sizeof(uint64_t)) {
+                        break;
+                    }
+                    const char* value = data + value_offset;
+                    if (zip64_uncompressed) {
+                        memcpy(&num_uncompressed_bytes, value,
+                               sizeof(uint64_t));
+                        value += sizeof(uint64_t);
+                    }
+                    if (zip64_compressed) {
+                        memcpy(&num_compressed_bytes, value, sizeof(uint64_t));
+                    }
+                    found = true;
+                }
+                field = value_offset + field_len;
+            }
+            if (!found) {
+                utility::LogError("Failed to read Zip64 sizes in npz.");
+            }
+        }
+        if (num_compressed_bytes > size - npy_offset) {
+            utility::LogError("Failed to read tensor data in npz.");
+        }
+
+        // Erase the trailing ".npy".
+        std::string tensor_name(data + name_offset, tensor_name_len - 4);
+
+        if (compressed_method == 0) {
+            tensor_map[tensor_name] =
+                    CreateNumpyArrayFromMappedFile(mapped_file, npy_offset)
+                            .ToTensor();
+        } else {
+            if (num_uncompressed_bytes > 0xFFFFFFFF) {
+                utility::LogError(
+                        "Compressed arrays larger than 4GiB are not "
+                        "supported.");
+            }
+            tensor_map[tensor_name] =
+                    CreateNumpyArrayFromCompressedBuffer(
+                            data + npy_offset,
+                            static_cast<uint32_t>(num_compressed_bytes),
+                            static_cast<uint32_t>(num_uncompressed_bytes))
+                            .ToTensor();
+        }
+        offset = npy_offset + num_compressed_bytes;
+    }
+
+    return tensor_map;
+}
+
+core::Tensor ReadNpy(const std::string& file_name, bool memory_map) {
+    if (memory_map) {
+        return CreateNumpyArrayFromMappedFile(MapFile(file_name), 0)
+                .ToTensor();
+    }
+
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
@@ -692,7 +908,11 @@ void WriteNpy(const std::string& file_name, const core::Tensor& tensor) {
 }
 
 std::unordered_map<std::string, core::Tensor> ReadNpz(
-        const std::string& file_name) {
+        const std::string& file_name, bool memory_map) {
+    if (memory_map) {
+        return ReadNpzMapped(file_name);
+    }
+
     utility::filesystem::CFile cfile;
     if (!cfile.Open(file_name, "rb")) {
         utility::LogError("Failed to open file {}, error: {}.", file_name,
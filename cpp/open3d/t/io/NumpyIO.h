@@ -38,7 +38,12 @@ namespace io {
 /// Read Numpy .npy file to a tensor.
 ///
 /// \param file_name The file name to read from.
-core::Tensor ReadNpy(const std::string& file_name);
+/// \param memory_map If true, the file is memory mapped and the returned CPU
+/// tensor refers to the mapped pages instead of a copy of the data. The
+/// mapping is copy-on-write: clean pages are shared by all processes mapping
+/// the same file and writes to the tensor never reach the file. The mapping
+/// is released together with the last tensor referring to it.
+core::Tensor ReadNpy(const std::string& file_name, bool memory_map = false);
 
 /// Save a tensor to a Numpy .npy file.
 ///
@@ -49,8 +54,12 @@ void WriteNpy(const std::string& file_name, const core::Tensor& tensor);
 /// Read Numpy .npz file to an unordered_map from string to tensor.
 ///
 /// \param file_name The file name to read from.
+/// \param memory_map If true, uncompressed arrays refer to a copy-on-write
+/// memory mapping of the file instead of a copy of the data, see ReadNpy().
+/// Compressed arrays, and arrays whose data is not aligned to the element
+/// size in the file, are still decoded into newly allocated memory.
 std::unordered_map<std::string, core::Tensor> ReadNpz(
-        const std::string& file_name);
+        const std::string& file_name, bool memory_map = false);
 
 /// Save a string to tensor map as Numpy .npz file.
 ///
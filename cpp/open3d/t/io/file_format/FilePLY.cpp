@@ -31,6 +31,7 @@
 #include "open3d/core/Dtype.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/io/FileFormatIO.h"
+#include "open3d/io/file_format/PLYBinaryReader.h"
 #include "open3d/t/geometry/TensorMap.h"
 #include "open3d/t/io/PointCloudIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -142,6 +143,24 @@ static core::Dtype GetDtype(e_ply_type type) {
     }
 }
 
+static core::Dtype GetDtype(open3d::io::ply::PLYType type) {
+    using open3d::io::ply::PLYType;
+    // Same set of datatypes as for rply above.
+    if (type == PLYType::UInt8) {
+        return core::UInt8;
+    } else if (type == PLYType::UInt16) {
+        return core::UInt16;
+    } else if (type == PLYType::Int32) {
+        return core::Int32;
+    } else if (type == PLYType::Float32) {
+        return core::Float32;
+    } else if (type == PLYType::Float64) {
+        return core::Float64;
+    } else {
+        return core::Undefined;
+    }
+}
+
 static std::tuple<std::string, int, int> GetNameStrideOffsetForAttribute(
         const std::string &name) {
     // Positions attribute.
@@ -163,9 +182,85 @@ static std::tuple<std::string, int, int> GetNameStrideOffsetForAttribute(
     return std::make_tuple(name, 1, 0);
 }
 
+/// Decodes the "vertex" element of a binary PLY file in bulk, writing every
+/// property straight into its attribute tensor.
+static bool ReadPointCloudFromBinaryPLY(
+        open3d::io::ply::PLYBinaryReader &reader,
+        const std::string &filename,
+        geometry::PointCloud &pointcloud,
+        const open3d::io::ReadPointCloudOption &params) {
+    const open3d::io::ply::PLYElement *element = reader.FindElement("vertex");
+    if (!element) {
+        utility::LogWarning("Read PLY failed: no vertex attribute.");
+        return false;
+    }
+    const int64_t element_size = element->size_;
+
+    utility::CountingProgressReporter reporter(params.update_progress);
+    reporter.SetTotal(element_size);
+
+    std::unordered_map<std::string, bool> primary_attr_init = {
+            {"positions", false}, {"normals", false}, {"colors", false}};
+
+    for (const open3d::io::ply::PLYProperty &property : element->properties_) {
+        const core::Dtype dtype = property.IsList()
+                                          ? core::Undefined
+                                          : GetDtype(property.type_);
+        if (dtype == core::Undefined) {
+            utility::LogWarning(
+                    "Read PLY warning: skipping property \"{}\", unsupported "
+                    "datatype \"{}\".",
+                    property.name_,
+                    property.IsList()
+                            ? "list"
+                            : open3d::io::ply::GetPLYTypeName(property.type_));
+            continue;
+        }
+
+        std::string attr_name;
+        int stride, offset;
+        std::tie(attr_name, stride, offset) =
+                GetNameStrideOffsetForAttribute(property.name_);
+        if (!primary_attr_init.count(attr_name) ||
+            !primary_attr_init.at(attr_name)) {
+            pointcloud.SetPointAttr(
+                    attr_name,
+                    core::Tensor::Empty({element_size, stride}, dtype));
+            if (primary_attr_init.count(attr_name)) {
+                primary_attr_init[attr_name] = true;
+            }
+        }
+
+        core::Tensor attr = pointcloud.GetPointAttr(attr_name);
+        bool success = false;
+        DISPATCH_DTYPE_TO_TEMPLATE(attr.GetDtype(), [&]() {
+            success = reader.ReadProperty<scalar_t>(
+                    "vertex", property.name_,
+                    attr.GetDataPtr<scalar_t>() + offset, stride);
+        });
+        if (!success) {
+            utility::LogWarning(
+                    "Read PLY failed: unable to read file: {} ({}).", filename,
+                    reader.GetError());
+            return false;
+        }
+    }
+
+    reporter.Finish();
+    return true;
+}
+
 bool ReadPointCloudFromPLY(const std::string &filename,
                            geometry::PointCloud &pointcloud,
                            const open3d::io::ReadPointCloudOption &params) {
+    // Binary files are decoded in bulk from a memory map, ASCII files go
+    // through the rply callbacks.
+    open3d::io::ply::PLYBinaryReader reader;
+    if (reader.Open(filename)) {
+        return ReadPointCloudFromBinaryPLY(reader, filename, pointcloud,
+                                           params);
+    }
+
     p_ply ply_file = ply_open(filename.c_str(), nullptr, 0, nullptr);
     if (!ply_file) {
         utility::LogWarning("Read PLY failed: unable to open file: {}.",
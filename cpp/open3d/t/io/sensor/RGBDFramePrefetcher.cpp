@@ -0,0 +1,271 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/sensor/RGBDFramePrefetcher.h"
+
+#include <algorithm>
+
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Timer.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// If BUFFER_REFILL_FACTOR is odr-used, a definition is required.
+const size_t RGBDFramePrefetcher::BUFFER_REFILL_FACTOR;
+
+RGBDFramePrefetcher::RGBDFramePrefetcher(size_t buffer_size,
+                                         size_t num_workers)
+    : slots_(buffer_size), num_workers_(num_workers) {
+    if (buffer_size == 0) {
+        utility::LogError("buffer_size must be > 0.");
+    }
+    if (num_workers == 0) {
+        utility::LogError("num_workers must be > 0.");
+    }
+}
+
+RGBDFramePrefetcher::~RGBDFramePrefetcher() { Stop(); }
+
+void RGBDFramePrefetcher::Start(FetchFunction fetch,
+                                int64_t first_frame,
+                                std::function<void()> on_pause,
+                                std::function<void()> on_resume) {
+    Stop();
+    fetch_ = fetch;
+    on_pause_ = on_pause;
+    on_resume_ = on_resume;
+    stop_ = false;
+    seeking_ = false;
+    paused_ = false;
+    head_ = first_frame;
+    tail_ = first_frame;
+    end_ = -1;
+    num_decoding_ = 0;
+    statistics_ = RGBDVideoReaderStatistics();
+    start_time_ms_ = utility::Timer::GetSystemTimeInMilliseconds();
+    for (size_t worker_id = 0; worker_id < num_workers_; ++worker_id) {
+        workers_.emplace_back(&RGBDFramePrefetcher::Work, this, worker_id);
+    }
+}
+
+void RGBDFramePrefetcher::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    slot_freed_.notify_all();
+    slot_ready_.notify_all();
+    for (std::thread &worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+    for (Slot &slot : slots_) {
+        slot = Slot();
+    }
+}
+
+void RGBDFramePrefetcher::Work(size_t worker_id) {
+    const int64_t buffer_size = static_cast<int64_t>(slots_.size());
+    const int64_t refill_size = std::max<int64_t>(
+            1, buffer_size / static_cast<int64_t>(BUFFER_REFILL_FACTOR));
+    while (true) {
+        std::unique_lock<std::mutex> fetch_lock(fetch_mutex_);
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stop_) {
+            return;
+        }
+        if (seeking_ || end_ >= 0) {
+            // Release the fetch lock for Seek() and wait until it is done.
+            fetch_lock.unlock();
+            slot_freed_.wait(lock, [this] {
+                return stop_ || (!seeking_ && end_ < 0);
+            });
+            continue;
+        }
+        // After a pause, the ring is only refilled once it has drained.
+        if (head_ >= tail_ + (paused_ ? refill_size : buffer_size)) {
+            if (on_pause_ && !paused_) {
+                paused_ = true;
+                lock.unlock();
+                on_pause_();
+                lock.lock();
+            }
+            slot_freed_.wait(lock, [&] {
+                return stop_ || seeking_ ||
+                       head_ < tail_ + (paused_ ? refill_size : buffer_size);
+            });
+            continue;
+        }
+        if (paused_) {
+            paused_ = false;
+            lock.unlock();
+            if (on_resume_) {
+                on_resume_();
+            }
+            lock.lock();
+        }
+
+        const int64_t frame_index = head_++;
+        Slot &slot = GetSlot(frame_index);
+        slot.state_ = SlotState::Decoding;
+        ++num_decoding_;
+        lock.unlock();
+
+        const double start_time_ms =
+                utility::Timer::GetSystemTimeInMilliseconds();
+        DecodeFunction decode;
+        try {
+            decode = fetch_(frame_index);
+        } catch (const std::exception &e) {
+            utility::LogWarning("Stop reading at frame {}: {}", frame_index,
+                                e.what());
+        }
+        if (!decode) {
+            // End of stream. No later frame has been claimed, since claims
+            // are made under the fetch lock.
+            lock.lock();
+            end_ = frame_index;
+            head_ = frame_index;
+            slot.state_ = SlotState::Free;
+            --num_decoding_;
+            slot_ready_.notify_all();
+            decode_done_.notify_all();
+            continue;
+        }
+        fetch_lock.unlock();
+
+        bool success = false;
+        try {
+            success = decode(worker_id, slot.frame_, slot.timestamp_us_);
+        } catch (const std::exception &e) {
+            utility::LogWarning("Failed to decode frame {}: {}", frame_index,
+                                e.what());
+        }
+        const double decode_time_ms =
+                utility::Timer::GetSystemTimeInMilliseconds() - start_time_ms;
+
+        lock.lock();
+        slot.state_ = success ? SlotState::Ready : SlotState::Failed;
+        --num_decoding_;
+        ++statistics_.num_frames_decoded_;
+        statistics_.decode_time_ += decode_time_ms / 1000.0;
+        slot_ready_.notify_all();
+        decode_done_.notify_all();
+    }
+}
+
+bool RGBDFramePrefetcher::Next(t::geometry::RGBDImage &frame,
+                               uint64_t &timestamp_us) {
+    if (!IsStarted()) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto is_available = [this] {
+        return stop_ || (end_ >= 0 && tail_ >= end_) ||
+               (tail_ < head_ &&
+                GetSlot(tail_).state_ != SlotState::Decoding);
+    };
+    if (!is_available()) {
+        const double start_time_ms =
+                utility::Timer::GetSystemTimeInMilliseconds();
+        slot_ready_.wait(lock, is_available);
+        ++statistics_.num_stalls_;
+        statistics_.stall_time_ +=
+                (utility::Timer::GetSystemTimeInMilliseconds() -
+                 start_time_ms) /
+                1000.0;
+    }
+    if (tail_ >= head_ || GetSlot(tail_).state_ == SlotState::Decoding) {
+        return false;
+    }
+
+    Slot &slot = GetSlot(tail_++);
+    // The slot drops its reference, so the next decode into this slot
+    // cannot overwrite the returned frame.
+    frame = slot.state_ == SlotState::Ready ? slot.frame_
+                                            : t::geometry::RGBDImage();
+    timestamp_us = slot.timestamp_us_;
+    slot.frame_ = t::geometry::RGBDImage();
+    slot.state_ = SlotState::Free;
+    ++statistics_.num_frames_read_;
+    lock.unlock();
+    slot_freed_.notify_all();
+    return true;
+}
+
+bool RGBDFramePrefetcher::IsEOF() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return end_ >= 0 && tail_ >= end_;
+}
+
+bool RGBDFramePrefetcher::IsEndOfStream() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return end_ >= 0;
+}
+
+void RGBDFramePrefetcher::Seek(int64_t frame_index,
+                               std::function<void()> on_seek) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        seeking_ = true;
+    }
+    slot_freed_.notify_all();
+    // Wait for the running fetch and all decodes to finish.
+    std::unique_lock<std::mutex> fetch_lock(fetch_mutex_);
+    std::unique_lock<std::mutex> lock(mutex_);
+    decode_done_.wait(lock, [this] { return num_decoding_ == 0; });
+    if (on_seek) {
+        on_seek();
+    }
+    for (Slot &slot : slots_) {
+        slot = Slot();
+    }
+    head_ = frame_index;
+    tail_ = frame_index;
+    end_ = -1;
+    seeking_ = false;
+    lock.unlock();
+    slot_freed_.notify_all();
+}
+
+RGBDVideoReaderStatistics RGBDFramePrefetcher::GetStatistics() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RGBDVideoReaderStatistics statistics = statistics_;
+    if (IsStarted()) {
+        statistics.elapsed_time_ =
+                (utility::Timer::GetSystemTimeInMilliseconds() -
+                 start_time_ms_) /
+                1000.0;
+    }
+    return statistics;
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
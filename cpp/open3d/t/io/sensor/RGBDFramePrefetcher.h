@@ -0,0 +1,167 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDFramePrefetcher
+///
+/// Decodes RGBD frames ahead of the consumer on a pool of worker threads into
+/// a ring of preallocated frame slots.
+///
+/// Decoding a frame is split in two stages. The fetch stage is called for one
+/// frame at a time in frame order, e.g. to read the next frameset from a
+/// sequential stream, and returns the decode stage for that frame. Decode
+/// stages of different frames run concurrently on the workers. Frames are
+/// returned to the consumer in frame order.
+class RGBDFramePrefetcher {
+public:
+    /// Decodes a fetched frame into \p frame and sets its timestamp (us).
+    /// \p worker_id is in [0, num_workers) and identifies the calling worker,
+    /// e.g. to use per worker state. Returns false if decoding failed.
+    using DecodeFunction = std::function<bool(
+            size_t worker_id, t::geometry::RGBDImage &frame,
+            uint64_t &timestamp_us)>;
+    /// Fetches frame \p frame_index and returns its decode function, or an
+    /// empty function at the end of the stream.
+    using FetchFunction = std::function<DecodeFunction(int64_t frame_index)>;
+
+    /// After a pause, the ring is refilled only once it has drained to
+    /// 1/BUFFER_REFILL_FACTOR of its size, so that a paused source is resumed
+    /// for bursts of frames.
+    static const size_t BUFFER_REFILL_FACTOR = 4;
+
+    /// \param buffer_size Number of frame slots in the ring.
+    /// \param num_workers Number of decode worker threads.
+    RGBDFramePrefetcher(size_t buffer_size, size_t num_workers);
+    RGBDFramePrefetcher(const RGBDFramePrefetcher &) = delete;
+    RGBDFramePrefetcher &operator=(const RGBDFramePrefetcher &) = delete;
+    ~RGBDFramePrefetcher();
+
+    /// Start decoding from \p first_frame with the worker threads.
+    ///
+    /// \param fetch Fetch stage, see FetchFunction.
+    /// \param first_frame Index of the first frame to fetch.
+    /// \param on_pause (optional) Called by the fetching worker before it
+    /// waits for free slots, e.g. to pause a real time playback.
+    /// \param on_resume (optional) Called by the fetching worker when it
+    /// resumes fetching after on_pause.
+    void Start(FetchFunction fetch,
+               int64_t first_frame = 0,
+               std::function<void()> on_pause = nullptr,
+               std::function<void()> on_resume = nullptr);
+
+    /// Stop and join the worker threads and discard all decoded frames.
+    void Stop();
+
+    /// Is the prefetcher started?
+    bool IsStarted() const { return !workers_.empty(); }
+
+    /// Wait for the next frame and return it. Returns false without waiting
+    /// if the end of the stream was reached and all frames have been read.
+    ///
+    /// \param frame The next frame. The ring keeps no reference to it, so it
+    /// stays valid while later frames are decoded.
+    /// \param timestamp_us Timestamp (us) of the next frame.
+    bool Next(t::geometry::RGBDImage &frame, uint64_t &timestamp_us);
+
+    /// Have all frames been read?
+    bool IsEOF() const;
+
+    /// Has the fetch stage reached the end of the stream?
+    bool IsEndOfStream() const;
+
+    /// Discard all decoded frames and continue decoding from \p frame_index.
+    ///
+    /// \param frame_index Index of the next frame to fetch.
+    /// \param on_seek (optional) Called while no fetch or decode stage runs,
+    /// e.g. to reposition a sequential stream.
+    void Seek(int64_t frame_index, std::function<void()> on_seek = nullptr);
+
+    /// Get decode and stall statistics since Start().
+    RGBDVideoReaderStatistics GetStatistics() const;
+
+private:
+    enum class SlotState { Free, Decoding, Ready, Failed };
+
+    struct Slot {
+        t::geometry::RGBDImage frame_;
+        uint64_t timestamp_us_ = 0;
+        SlotState state_ = SlotState::Free;
+    };
+
+    void Work(size_t worker_id);
+
+    /// Slot of frame \p frame_index.
+    Slot &GetSlot(int64_t frame_index) {
+        return slots_[frame_index % slots_.size()];
+    }
+
+    std::vector<Slot> slots_;
+    size_t num_workers_;
+    std::vector<std::thread> workers_;
+    FetchFunction fetch_;
+    std::function<void()> on_pause_;
+    std::function<void()> on_resume_;
+
+    /// Guards all state below. The fetch stage runs under fetch_mutex_ only,
+    /// which serializes fetches and keeps them in frame order.
+    mutable std::mutex mutex_;
+    std::mutex fetch_mutex_;
+    std::condition_variable slot_freed_;
+    std::condition_variable slot_ready_;
+    std::condition_variable decode_done_;
+    bool stop_ = false;
+    bool seeking_ = false;
+    bool paused_ = false;
+    /// Frames [tail_, head_) are being decoded or are ready to be read.
+    int64_t head_ = 0;
+    int64_t tail_ = 0;
+    /// Index of the first frame past the end of the stream, if reached.
+    int64_t end_ = -1;
+    /// Number of fetch and decode stages in flight.
+    int64_t num_decoding_ = 0;
+
+    RGBDVideoReaderStatistics statistics_;
+    double start_time_ms_ = 0;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
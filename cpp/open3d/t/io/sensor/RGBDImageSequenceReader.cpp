@@ -0,0 +1,220 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/sensor/RGBDImageSequenceReader.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "open3d/io/IJsonConvertibleIO.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "open3d/utility/Logging.h"
+#include "open3d/utility/Parallel.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+// If DEFAULT_BUFFER_SIZE is odr-used, a definition is required.
+const size_t RGBDImageSequenceReader::DEFAULT_BUFFER_SIZE;
+
+/// Sorted list of images in \p directory with one of the \p extensions.
+static std::vector<std::string> ListImages(
+        const std::string &directory,
+        const std::vector<std::string> &extensions) {
+    std::vector<std::string> filenames;
+    std::vector<std::string> all_filenames;
+    utility::filesystem::ListFilesInDirectory(directory, all_filenames);
+    for (const std::string &filename : all_filenames) {
+        const std::string extension =
+                utility::filesystem::GetFileExtensionInLowerCase(filename);
+        if (std::find(extensions.begin(), extensions.end(), extension) !=
+            extensions.end()) {
+            filenames.push_back(filename);
+        }
+    }
+    std::sort(filenames.begin(), filenames.end());
+    return filenames;
+}
+
+RGBDImageSequenceReader::RGBDImageSequenceReader(size_t buffer_size,
+                                                 size_t num_workers,
+                                                 double fps)
+    : default_fps_(fps),
+      prefetcher_(buffer_size,
+                  num_workers > 0
+                          ? num_workers
+                          : static_cast<size_t>(std::max(
+                                    1, utility::EstimateMaxThreads()))) {
+    if (fps <= 0) {
+        utility::LogError("fps must be > 0, but got {}.", fps);
+    }
+}
+
+RGBDImageSequenceReader::~RGBDImageSequenceReader() {
+    if (IsOpened()) Close();
+}
+
+bool RGBDImageSequenceReader::Open(const std::string &filename) {
+    if (IsOpened()) {
+        Close();
+    }
+    if (!utility::filesystem::DirectoryExists(filename)) {
+        utility::LogWarning("Unable to open image sequence {}: not a directory",
+                            filename);
+        return false;
+    }
+    std::string color_directory;
+    for (const char *name : {"color", "image", "rgb"}) {
+        if (utility::filesystem::DirectoryExists(filename + "/" + name)) {
+            color_directory = filename + "/" + name;
+            break;
+        }
+    }
+    if (color_directory.empty()) {
+        utility::LogWarning(
+                "Unable to open image sequence {}: no color, image or rgb "
+                "subfolder.",
+                filename);
+        return false;
+    }
+    color_filenames_ = ListImages(color_directory, {"jpg", "jpeg", "png"});
+    depth_filenames_ = ListImages(filename + "/depth", {"png"});
+    if (color_filenames_.empty() ||
+        color_filenames_.size() != depth_filenames_.size()) {
+        utility::LogWarning(
+                "Unable to open image sequence {}: found {} color and {} "
+                "depth images.",
+                filename, color_filenames_.size(), depth_filenames_.size());
+        return false;
+    }
+
+    metadata_ = RGBDVideoMetadata();
+    const std::string metadata_filename = filename + "/intrinsic.json";
+    if (utility::filesystem::FileExists(metadata_filename)) {
+        open3d::io::ReadIJsonConvertibleFromJSON(metadata_filename, metadata_);
+    } else {
+        metadata_.intrinsics_ = camera::PinholeCameraIntrinsic(
+                camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+        metadata_.depth_scale_ = 1000.0;
+    }
+    if (!(metadata_.fps_ > 0)) {
+        metadata_.fps_ = default_fps_;
+    }
+    t::geometry::RGBDImage first_frame;
+    if (!ReadFrame(0, first_frame)) {
+        utility::LogWarning("Unable to read the first frame of {}", filename);
+        return false;
+    }
+    metadata_.width_ = static_cast<int>(first_frame.color_.GetCols());
+    metadata_.height_ = static_cast<int>(first_frame.color_.GetRows());
+    metadata_.color_dt_ = first_frame.color_.GetDtype();
+    metadata_.depth_dt_ = first_frame.depth_.GetDtype();
+    metadata_.color_channels_ =
+            static_cast<uint8_t>(first_frame.color_.GetChannels());
+    metadata_.stream_length_usec_ = GetFrameTimestamp(GetNumFrames());
+
+    filename_ = filename;
+    timestamp_us_ = 0;
+    is_opened_ = true;
+    prefetcher_.Start([this](int64_t frame_index)
+                              -> RGBDFramePrefetcher::DecodeFunction {
+        if (frame_index >= GetNumFrames()) {
+            return nullptr;
+        }
+        return [this, frame_index](size_t, t::geometry::RGBDImage &frame,
+                                   uint64_t &timestamp_us) {
+            timestamp_us = GetFrameTimestamp(frame_index);
+            return ReadFrame(frame_index, frame);
+        };
+    });
+    utility::LogInfo("Image sequence {} with {} frames opened", filename,
+                     GetNumFrames());
+    return true;
+}
+
+void RGBDImageSequenceReader::Close() {
+    is_opened_ = false;
+    prefetcher_.Stop();
+}
+
+bool RGBDImageSequenceReader::IsEOF() const { return prefetcher_.IsEOF(); }
+
+t::geometry::RGBDImage RGBDImageSequenceReader::NextFrame() {
+    if (!IsOpened()) {
+        utility::LogError("Null file handler. Please call Open().");
+    }
+    t::geometry::RGBDImage frame;
+    if (!prefetcher_.Next(frame, timestamp_us_)) {
+        utility::LogInfo("EOF reached");
+        return t::geometry::RGBDImage();
+    }
+    return frame;
+}
+
+bool RGBDImageSequenceReader::SeekTimestamp(uint64_t timestamp) {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return false;
+    }
+    if (timestamp >= metadata_.stream_length_usec_) {
+        utility::LogWarning("Timestamp {} exceeds maximum {} (us).", timestamp,
+                            metadata_.stream_length_usec_);
+        return false;
+    }
+    const int64_t frame_index = std::min(
+            GetNumFrames() - 1,
+            static_cast<int64_t>(std::round(timestamp * metadata_.fps_ / 1e6)));
+    prefetcher_.Seek(frame_index);
+    timestamp_us_ = GetFrameTimestamp(frame_index);
+    return true;
+}
+
+uint64_t RGBDImageSequenceReader::GetTimestamp() const {
+    if (!IsOpened()) {
+        utility::LogWarning("Null file handler. Please call Open().");
+        return UINT64_MAX;
+    }
+    return timestamp_us_;
+}
+
+uint64_t RGBDImageSequenceReader::GetFrameTimestamp(
+        int64_t frame_index) const {
+    return static_cast<uint64_t>(
+            std::round(frame_index * 1e6 / metadata_.fps_));
+}
+
+bool RGBDImageSequenceReader::ReadFrame(int64_t frame_index,
+                                        t::geometry::RGBDImage &frame) const {
+    return ReadImage(color_filenames_[frame_index], frame.color_) &&
+           ReadImage(depth_filenames_[frame_index], frame.depth_);
+}
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
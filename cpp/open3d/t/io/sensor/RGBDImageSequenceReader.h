@@ -0,0 +1,145 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "open3d/t/io/sensor/RGBDFramePrefetcher.h"
+#include "open3d/t/io/sensor/RGBDVideoReader.h"
+
+namespace open3d {
+namespace t {
+namespace io {
+
+/// \class RGBDImageSequenceReader
+///
+/// Reader for RGBD datasets stored as a directory of images, such as the
+/// frames written by RGBDVideoReader::SaveFrames() or Redwood and TUM style
+/// datasets.
+///
+/// The directory must contain a 'depth' subfolder with 16 bit PNG depth images
+/// and a 'color', 'image' or 'rgb' subfolder with JPG or PNG color images.
+/// Color and depth images are paired in sorted filename order, so both
+/// subfolders must have the same number of images. If the directory contains
+/// 'intrinsic.json' with RGBDVideoMetadata, the intrinsics, depth scale and
+/// frame rate are read from it. Otherwise the PrimeSense default intrinsics
+/// and a depth scale of 1000 are used.
+///
+/// Frames are decoded ahead of the consumer on a pool of worker threads, so
+/// that image decoding overlaps with the processing of earlier frames.
+class RGBDImageSequenceReader : public RGBDVideoReader {
+public:
+    static const size_t DEFAULT_BUFFER_SIZE = 32;
+
+    /// Constructor
+    ///
+    /// \param buffer_size (optional) Max number of decoded frames to store in
+    /// the frame buffer.
+    /// \param num_workers (optional) Number of decode worker threads. 0 uses
+    /// one worker per hardware thread.
+    /// \param fps (optional) Frame rate of the sequence, used for timestamps
+    /// if the directory has no 'intrinsic.json'.
+    explicit RGBDImageSequenceReader(size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                                     size_t num_workers = 0,
+                                     double fps = 30.0);
+
+    RGBDImageSequenceReader(const RGBDImageSequenceReader &) = delete;
+    RGBDImageSequenceReader &operator=(const RGBDImageSequenceReader &) =
+            delete;
+    virtual ~RGBDImageSequenceReader();
+
+    /// Check If the image sequence is opened.
+    virtual bool IsOpened() const override { return is_opened_; }
+
+    /// Check if the image sequence is all read.
+    virtual bool IsEOF() const override;
+
+    /// Open an image sequence.
+    ///
+    /// \param filename Path to the dataset directory.
+    virtual bool Open(const std::string &filename) override;
+
+    /// Close the opened image sequence.
+    virtual void Close() override;
+
+    /// Get (read-only) metadata of the image sequence.
+    virtual const RGBDVideoMetadata &GetMetadata() const override {
+        return metadata_;
+    }
+
+    /// Get reference to the metadata of the image sequence.
+    virtual RGBDVideoMetadata &GetMetadata() override { return metadata_; }
+
+    /// Seek to the timestamp (in us).
+    ///
+    /// \param timestamp Time in us to seek to.
+    virtual bool SeekTimestamp(uint64_t timestamp) override;
+
+    /// Get current timestamp (in us).
+    virtual uint64_t GetTimestamp() const override;
+
+    /// Return the next decoded frame of the image sequence.
+    virtual t::geometry::RGBDImage NextFrame() override;
+
+    /// Return path of the dataset directory being read.
+    virtual std::string GetFilename() const override { return filename_; };
+
+    /// Get decode throughput and consumer stall statistics since Open().
+    virtual RGBDVideoReaderStatistics GetStatistics() const override {
+        return prefetcher_.GetStatistics();
+    }
+
+    /// Number of frames in the image sequence.
+    int64_t GetNumFrames() const {
+        return static_cast<int64_t>(color_filenames_.size());
+    }
+
+    using RGBDVideoReader::SaveFrames;
+    using RGBDVideoReader::ToString;
+
+private:
+    /// Timestamp (us) of frame \p frame_index.
+    uint64_t GetFrameTimestamp(int64_t frame_index) const;
+
+    /// Read frame \p frame_index synchronously.
+    bool ReadFrame(int64_t frame_index, t::geometry::RGBDImage &frame) const;
+
+    std::string filename_;
+    RGBDVideoMetadata metadata_;
+    double default_fps_;
+    bool is_opened_ = false;
+    uint64_t timestamp_us_ = 0;
+    std::vector<std::string> color_filenames_;
+    std::vector<std::string> depth_filenames_;
+    RGBDFramePrefetcher prefetcher_;
+};
+
+}  // namespace io
+}  // namespace t
+}  // namespace open3d
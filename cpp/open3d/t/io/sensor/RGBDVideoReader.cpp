@@ -30,6 +30,7 @@
 
 #include "open3d/io/IJsonConvertibleIO.h"
 #include "open3d/io/ImageIO.h"
+#include "open3d/t/io/sensor/RGBDImageSequenceReader.h"
 #include "open3d/t/io/sensor/realsense/RSBagReader.h"
 #include "open3d/utility/FileSystem.h"
 
@@ -37,6 +38,15 @@ namespace open3d {
 namespace t {
 namespace io {
 
+std::string RGBDVideoReaderStatistics::ToString() const {
+    return fmt::format(
+            "RGBDVideoReaderStatistics: {} frames decoded in {:.3f}s of "
+            "decode time ({:.1f} frames/s), {} frames read, {} stalls "
+            "totalling {:.3f}s",
+            num_frames_decoded_, decode_time_, GetDecodeThroughput(),
+            num_frames_read_, num_stalls_, stall_time_);
+}
+
 std::string RGBDVideoReader::ToString() const {
     if (IsOpened()) {
         return fmt::format(
@@ -96,6 +106,11 @@ void RGBDVideoReader::SaveFrames(const std::string &frame_path,
 
 std::unique_ptr<RGBDVideoReader> RGBDVideoReader::Create(
         const std::string &filename) {
+    if (utility::filesystem::DirectoryExists(filename)) {
+        auto reader = std::make_unique<RGBDImageSequenceReader>();
+        reader->Open(filename);
+        return reader;
+    }
 #ifdef BUILD_LIBREALSENSE
     if (utility::ToLower(filename).compare(filename.length() - 4, 4, ".bag") ==
         0) {
@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+
 #include "open3d/io/sensor/RGBDSensorConfig.h"
 #include "open3d/t/geometry/RGBDImage.h"
 #include "open3d/t/io/sensor/RGBDVideoMetadata.h"
@@ -34,6 +37,31 @@ namespace open3d {
 namespace t {
 namespace io {
 
+/// Decode and playback statistics of an RGBD video reader, accumulated since
+/// the video was opened.
+struct RGBDVideoReaderStatistics {
+    /// Number of frames decoded, including frames discarded by a seek.
+    int64_t num_frames_decoded_ = 0;
+    /// Time (s) spent decoding frames, summed over all decode workers.
+    double decode_time_ = 0;
+    /// Number of frames returned to the consumer.
+    int64_t num_frames_read_ = 0;
+    /// Number of frames the consumer had to wait for.
+    int64_t num_stalls_ = 0;
+    /// Time (s) the consumer spent waiting for frames to be decoded.
+    double stall_time_ = 0;
+    /// Wall time (s) since the video was opened.
+    double elapsed_time_ = 0;
+
+    /// Frames decoded per second of wall time.
+    double GetDecodeThroughput() const {
+        return elapsed_time_ > 0 ? num_frames_decoded_ / elapsed_time_ : 0;
+    }
+
+    /// Text description.
+    std::string ToString() const;
+};
+
 class RGBDVideoReader {
 public:
     RGBDVideoReader() {}
@@ -85,10 +113,15 @@ public:
     /// Return filename being read.
     virtual std::string GetFilename() const = 0;
 
+    /// Get decode throughput and consumer stall statistics. Readers that
+    /// decode synchronously return empty statistics.
+    virtual RGBDVideoReaderStatistics GetStatistics() const { return {}; }
+
     /// Text description.
     virtual std::string ToString() const;
 
-    /// Factory function to create object based on RGBD video file type.
+    /// Factory function to create object based on RGBD video file type. A
+    /// directory is read as an image sequence with RGBDImageSequenceReader.
     static std::unique_ptr<RGBDVideoReader> Create(const std::string &filename);
 };
 
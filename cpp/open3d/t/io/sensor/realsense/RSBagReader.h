@@ -27,19 +27,20 @@
 #pragma once
 
 #include <atomic>
-#include <condition_variable>
+#include <memory>
 #include <string>
-#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "open3d/io/sensor/RGBDSensorConfig.h"
+#include "open3d/t/io/sensor/RGBDFramePrefetcher.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #include "open3d/utility/IJsonConvertible.h"
 
 // Forward declarations for librealsense classes
 namespace rs2 {
 class pipeline;
+class align;
 }  // namespace rs2
 
 namespace open3d {
@@ -61,6 +62,9 @@ namespace io {
 /// https://intelrealsense.github.io/librealsense/doxygen/rs__sensor_8h.html#ae04b7887ce35d16dbd9d2d295d23aac7
 /// for format documentation
 ///
+/// Framesets are read from the bag file in order, while aligning the depth
+/// frame and copying both frames to tensors runs on \p num_workers threads.
+///
 /// Note: A few frames may be dropped if user code takes a long time (>10 frame
 /// intervals) to process a frame.
 ///
@@ -72,7 +76,10 @@ public:
     ///
     /// \param buffer_size (optional) Max number of frames to store in the frame
     /// buffer
-    explicit RSBagReader(size_t buffer_size = DEFAULT_BUFFER_SIZE);
+    /// \param num_workers (optional) Number of threads aligning and copying
+    /// frames.
+    explicit RSBagReader(size_t buffer_size = DEFAULT_BUFFER_SIZE,
+                         size_t num_workers = 1);
 
     RSBagReader(const RSBagReader &) = delete;
     RSBagReader &operator=(const RSBagReader &) = delete;
@@ -114,6 +121,11 @@ public:
     /// Return filename being read
     virtual std::string GetFilename() const override { return filename_; };
 
+    /// Get decode throughput and consumer stall statistics since Open().
+    virtual RGBDVideoReaderStatistics GetStatistics() const override {
+        return prefetcher_.GetStatistics();
+    }
+
     using RGBDVideoReader::SaveFrames;
     using RGBDVideoReader::ToString;
 
@@ -121,34 +133,26 @@ private:
     std::string filename_;
     RGBDVideoMetadata metadata_;
 
-    std::atomic<bool> is_eof_{false};     // Write by frame_reader_thread.
-    std::atomic<bool> is_opened_{false};  // Read by frame_reader_thread.
-    /// A frame buffer and a separate frame reader thread are used to prevent
-    /// frame drops in non real time applications, when the frames
-    /// are processed by user code for an arbitrarily long time. The
-    /// librealsense2 API for this use case rs2::playback::set_real_time(false)
-    /// results in a deadlock after 4 frames on macOS and Linux with SDK
-    /// v2.40.0. The recommended workaround with rs2::playback::pause() and
-    /// rs2::playback::resume() after reading each frame results in memory
-    /// corruption in macOS (not in Linux).
-    /// https://github.com/IntelRealSense/librealsense/issues/7547#issuecomment-706984376
-    std::vector<t::geometry::RGBDImage> frame_buffer_;
-    std::vector<uint64_t>
-            frame_position_us_;  ///< Buffer for frame position in us.
-    static const size_t BUFFER_REFILL_FACTOR =
-            4;  ///< Refill frame buffer when it is only (eg 1/4th ) full.
-    std::atomic<uint64_t> head_fid_{
-            0};  ///< Next write position by frame_reader_thread.
-    std::atomic<uint64_t> tail_fid_{0};  ///< Next unread frame position.
+    std::atomic<bool> is_opened_{false};
     std::atomic<uint64_t> seek_to_{UINT64_MAX};
-    std::condition_variable need_frames_;
-    /// This workaround implements a single producer single consumer frame queue
-    /// with a circular buffer. The producer thread (frame_reader_thread) keeps
-    /// the buffer full. The main thread reads from the current position in the
-    /// buffer and signals the producer thread with a condition variable for
-    /// more frames if less than a quarter of the frames remain.
-    void fill_frame_buffer();
-    std::thread frame_reader_thread_;
+    uint64_t timestamp_us_ = 0;  ///< Timestamp of the last returned frame.
+    /// A frame buffer filled by worker threads is used to prevent frame drops
+    /// in non real time applications, when the frames are processed by user
+    /// code for an arbitrarily long time. The librealsense2 API for this use
+    /// case rs2::playback::set_real_time(false) results in a deadlock after 4
+    /// frames on macOS and Linux with SDK v2.40.0. The recommended workaround
+    /// with rs2::playback::pause() and rs2::playback::resume() after reading
+    /// each frame results in memory corruption in macOS (not in Linux).
+    /// https://github.com/IntelRealSense/librealsense/issues/7547#issuecomment-706984376
+    /// Instead, the playback is paused only when the frame buffer is full and
+    /// resumed when less than a quarter of the frames remain.
+    RGBDFramePrefetcher prefetcher_;
+    /// Read the next frameset from the bag file and return the task that
+    /// aligns and copies it. Called by one worker at a time.
+    RGBDFramePrefetcher::DecodeFunction FetchFrame();
+    uint64_t dev_color_fid_ = 0;  ///< Device frame number of the last frame.
+    /// Depth to color alignment for each worker.
+    std::vector<std::unique_ptr<rs2::align>> align_to_color_;
 
     std::unique_ptr<rs2::pipeline> pipe_;
 
@@ -0,0 +1,207 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <cmath>
+
+#include "open3d/core/Dispatch.h"
+#include "open3d/core/ParallelFor.h"
+#include "open3d/core/Tensor.h"
+#include "open3d/t/pipelines/kernel/RegistrationImpl.h"
+
+namespace open3d {
+namespace t {
+namespace pipelines {
+namespace kernel {
+
+#if defined(__CUDACC__)
+void ComputeCorrespondenceQueryMaskCUDA
+#else
+void ComputeCorrespondenceQueryMaskCPU
+#endif
+        (const core::Tensor &source_points,
+         const core::Tensor &reference_points,
+         const core::Tensor &search_bounds,
+         core::Tensor &query_mask,
+         const double tolerance) {
+    const int64_t n = source_points.GetLength();
+    bool *query_mask_ptr = query_mask.GetDataPtr<bool>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(source_points.GetDtype(), [&]() {
+        const scalar_t *source_points_ptr =
+                source_points.GetDataPtr<scalar_t>();
+        const scalar_t *reference_points_ptr =
+                reference_points.GetDataPtr<scalar_t>();
+        const scalar_t *search_bounds_ptr =
+                search_bounds.GetDataPtr<scalar_t>();
+        const scalar_t tolerance_s = static_cast<scalar_t>(tolerance);
+
+        core::ParallelFor(
+                source_points.GetDevice(), n,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const scalar_t bound = search_bounds_ptr[workload_idx];
+                    if (bound < 0) {
+                        query_mask_ptr[workload_idx] = true;
+                        return;
+                    }
+                    const scalar_t *p = source_points_ptr + 3 * workload_idx;
+                    const scalar_t *r = reference_points_ptr + 3 * workload_idx;
+                    const scalar_t dx = p[0] - r[0];
+                    const scalar_t dy = p[1] - r[1];
+                    const scalar_t dz = p[2] - r[2];
+                    const scalar_t threshold = bound + tolerance_s;
+                    query_mask_ptr[workload_idx] =
+                            dx * dx + dy * dy + dz * dz > threshold * threshold;
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void UpdateCorrespondenceCacheCUDA
+#else
+void UpdateCorrespondenceCacheCPU
+#endif
+        (const core::Tensor &source_points,
+         const core::Tensor &query_indices,
+         const core::Tensor &neighbor_indices,
+         const core::Tensor &neighbor_distances,
+         const core::Tensor &neighbor_counts,
+         const double max_correspondence_distance,
+         core::Tensor &correspondence_indices,
+         core::Tensor &reference_points,
+         core::Tensor &search_bounds) {
+    const int64_t m = query_indices.GetLength();
+    const int64_t *query_indices_ptr = query_indices.GetDataPtr<int64_t>();
+    const int64_t *neighbor_indices_ptr =
+            neighbor_indices.GetDataPtr<int64_t>();
+    const int64_t *neighbor_counts_ptr = neighbor_counts.GetDataPtr<int64_t>();
+    int64_t *correspondence_indices_ptr =
+            correspondence_indices.GetDataPtr<int64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(source_points.GetDtype(), [&]() {
+        const scalar_t *source_points_ptr =
+                source_points.GetDataPtr<scalar_t>();
+        const scalar_t *neighbor_distances_ptr =
+                neighbor_distances.GetDataPtr<scalar_t>();
+        scalar_t *reference_points_ptr =
+                reference_points.GetDataPtr<scalar_t>();
+        scalar_t *search_bounds_ptr = search_bounds.GetDataPtr<scalar_t>();
+        const scalar_t radius =
+                static_cast<scalar_t>(max_correspondence_distance);
+
+        core::ParallelFor(
+                source_points.GetDevice(), m,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t idx = query_indices_ptr[workload_idx];
+                    const int64_t count = neighbor_counts_ptr[workload_idx];
+                    const int64_t *indices =
+                            neighbor_indices_ptr + 2 * workload_idx;
+                    const scalar_t *distances =
+                            neighbor_distances_ptr + 2 * workload_idx;
+
+                    // The nearest neighbor cannot change while the point
+                    // moves less than half the distance between the nearest
+                    // and the second nearest candidate, where any target
+                    // point outside the search radius is a candidate at the
+                    // radius.
+                    scalar_t bound = 0;
+                    if (count == 0) {
+                        correspondence_indices_ptr[idx] = -1;
+                    } else {
+                        correspondence_indices_ptr[idx] = indices[0];
+                        const scalar_t first = sqrt(distances[0]);
+                        const scalar_t second =
+                                count > 1 ? sqrt(distances[1]) : radius;
+                        bound = (second - first) / 2;
+                    }
+                    search_bounds_ptr[idx] = bound;
+
+                    const scalar_t *p = source_points_ptr + 3 * idx;
+                    scalar_t *r = reference_points_ptr + 3 * idx;
+                    r[0] = p[0];
+                    r[1] = p[1];
+                    r[2] = p[2];
+                });
+    });
+}
+
+#if defined(__CUDACC__)
+void ComputeCachedCorrespondenceDistancesCUDA
+#else
+void ComputeCachedCorrespondenceDistancesCPU
+#endif
+        (const core::Tensor &source_points,
+         const core::Tensor &target_points,
+         const core::Tensor &correspondence_indices,
+         core::Tensor &valid_correspondence_indices,
+         core::Tensor &squared_distances,
+         const double max_correspondence_distance) {
+    const int64_t n = source_points.GetLength();
+    const int64_t *correspondence_indices_ptr =
+            correspondence_indices.GetDataPtr<int64_t>();
+    int64_t *valid_correspondence_indices_ptr =
+            valid_correspondence_indices.GetDataPtr<int64_t>();
+
+    DISPATCH_FLOAT_DTYPE_TO_TEMPLATE(source_points.GetDtype(), [&]() {
+        const scalar_t *source_points_ptr =
+                source_points.GetDataPtr<scalar_t>();
+        const scalar_t *target_points_ptr =
+                target_points.GetDataPtr<scalar_t>();
+        scalar_t *squared_distances_ptr =
+                squared_distances.GetDataPtr<scalar_t>();
+        const scalar_t squared_radius = static_cast<scalar_t>(
+                max_correspondence_distance * max_correspondence_distance);
+
+        core::ParallelFor(
+                source_points.GetDevice(), n,
+                [=] OPEN3D_DEVICE(int64_t workload_idx) {
+                    const int64_t target_idx =
+                            correspondence_indices_ptr[workload_idx];
+                    valid_correspondence_indices_ptr[workload_idx] = -1;
+                    squared_distances_ptr[workload_idx] = 0;
+                    if (target_idx < 0) {
+                        return;
+                    }
+
+                    const scalar_t *p = source_points_ptr + 3 * workload_idx;
+                    const scalar_t *q = target_points_ptr + 3 * target_idx;
+                    const scalar_t dx = p[0] - q[0];
+                    const scalar_t dy = p[1] - q[1];
+                    const scalar_t dz = p[2] - q[2];
+                    const scalar_t squared_distance =
+                            dx * dx + dy * dy + dz * dz;
+                    if (squared_distance <= squared_radius) {
+                        valid_correspondence_indices_ptr[workload_idx] =
+                                target_idx;
+                        squared_distances_ptr[workload_idx] = squared_distance;
+                    }
+                });
+    });
+}
+
+}  // namespace kernel
+}  // namespace pipelines
+}  // namespace t
+}  // namespace open3d
@@ -212,6 +212,145 @@ core::Tensor ComputeInformationMatrix(
     return information_matrix;
 }
 
+core::Tensor ComputeCorrespondenceQueryMask(
+        const core::Tensor &source_positions,
+        const core::Tensor &reference_positions,
+        const core::Tensor &search_bounds,
+        const double tolerance) {
+    const core::Device device = source_positions.GetDevice();
+    const core::Dtype dtype = source_positions.GetDtype();
+    const int64_t n = source_positions.GetLength();
+    core::AssertTensorDtypes(source_positions, {core::Float64, core::Float32});
+    core::AssertTensorShape(source_positions, {n, 3});
+    core::AssertTensorShape(reference_positions, {n, 3});
+    core::AssertTensorShape(search_bounds, {n});
+    core::AssertTensorDtype(reference_positions, dtype);
+    core::AssertTensorDtype(search_bounds, dtype);
+    core::AssertTensorDevice(reference_positions, device);
+    core::AssertTensorDevice(search_bounds, device);
+
+    core::Tensor query_mask = core::Tensor::Empty({n}, core::Bool, device);
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeCorrespondenceQueryMaskCPU(
+                source_positions.Contiguous(), reference_positions.Contiguous(),
+                search_bounds.Contiguous(), query_mask, tolerance);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeCorrespondenceQueryMaskCUDA,
+                  source_positions.Contiguous(),
+                  reference_positions.Contiguous(), search_bounds.Contiguous(),
+                  query_mask, tolerance);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    return query_mask;
+}
+
+void UpdateCorrespondenceCache(const core::Tensor &source_positions,
+                               const core::Tensor &query_indices,
+                               const core::Tensor &neighbor_indices,
+                               const core::Tensor &neighbor_distances,
+                               const core::Tensor &neighbor_counts,
+                               const double max_correspondence_distance,
+                               core::Tensor &correspondence_indices,
+                               core::Tensor &reference_positions,
+                               core::Tensor &search_bounds) {
+    const core::Device device = source_positions.GetDevice();
+    const core::Dtype dtype = source_positions.GetDtype();
+    const int64_t n = source_positions.GetLength();
+    const int64_t m = query_indices.GetLength();
+    core::AssertTensorDtypes(source_positions, {core::Float64, core::Float32});
+    core::AssertTensorShape(source_positions, {n, 3});
+    core::AssertTensorShape(query_indices, {m});
+    core::AssertTensorShape(neighbor_indices, {m, 2});
+    core::AssertTensorShape(neighbor_distances, {m, 2});
+    core::AssertTensorShape(neighbor_counts, {m});
+    core::AssertTensorDtype(query_indices, core::Int64);
+    core::AssertTensorDtype(neighbor_distances, dtype);
+    core::AssertTensorDevice(query_indices, device);
+    core::AssertTensorDevice(neighbor_indices, device);
+    core::AssertTensorDevice(neighbor_distances, device);
+    core::AssertTensorDevice(neighbor_counts, device);
+
+    // The cache is updated in place, so it has to be contiguous already.
+    core::AssertTensorShape(correspondence_indices, {n});
+    core::AssertTensorShape(reference_positions, {n, 3});
+    core::AssertTensorShape(search_bounds, {n});
+    core::AssertTensorDtype(correspondence_indices, core::Int64);
+    core::AssertTensorDtype(reference_positions, dtype);
+    core::AssertTensorDtype(search_bounds, dtype);
+    if (!correspondence_indices.IsContiguous() ||
+        !reference_positions.IsContiguous() || !search_bounds.IsContiguous()) {
+        utility::LogError("Correspondence cache must be contiguous.");
+    }
+
+    // The index dtype of the neighbor search may be Int32 or Int64.
+    const core::Tensor neighbor_indices_int64 =
+            neighbor_indices.To(core::Int64).Contiguous();
+    const core::Tensor neighbor_counts_int64 =
+            neighbor_counts.To(core::Int64).Contiguous();
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        UpdateCorrespondenceCacheCPU(
+                source_positions.Contiguous(), query_indices.Contiguous(),
+                neighbor_indices_int64, neighbor_distances.Contiguous(),
+                neighbor_counts_int64, max_correspondence_distance,
+                correspondence_indices, reference_positions, search_bounds);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(UpdateCorrespondenceCacheCUDA, source_positions.Contiguous(),
+                  query_indices.Contiguous(), neighbor_indices_int64,
+                  neighbor_distances.Contiguous(), neighbor_counts_int64,
+                  max_correspondence_distance, correspondence_indices,
+                  reference_positions, search_bounds);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+}
+
+std::tuple<core::Tensor, core::Tensor> ComputeCachedCorrespondenceDistances(
+        const core::Tensor &source_positions,
+        const core::Tensor &target_positions,
+        const core::Tensor &correspondence_indices,
+        const double max_correspondence_distance) {
+    const core::Device device = source_positions.GetDevice();
+    const core::Dtype dtype = source_positions.GetDtype();
+    const int64_t n = source_positions.GetLength();
+    core::AssertTensorDtypes(source_positions, {core::Float64, core::Float32});
+    core::AssertTensorShape(source_positions, {n, 3});
+    core::AssertTensorShape(target_positions, {utility::nullopt, 3});
+    core::AssertTensorShape(correspondence_indices, {n});
+    core::AssertTensorDtype(target_positions, dtype);
+    core::AssertTensorDtype(correspondence_indices, core::Int64);
+    core::AssertTensorDevice(target_positions, device);
+    core::AssertTensorDevice(correspondence_indices, device);
+
+    core::Tensor valid_correspondence_indices =
+            core::Tensor::Empty({n}, core::Int64, device);
+    core::Tensor squared_distances = core::Tensor::Empty({n}, dtype, device);
+
+    const core::Device::DeviceType device_type = device.GetType();
+    if (device_type == core::Device::DeviceType::CPU) {
+        ComputeCachedCorrespondenceDistancesCPU(
+                source_positions.Contiguous(), target_positions.Contiguous(),
+                correspondence_indices.Contiguous(),
+                valid_correspondence_indices, squared_distances,
+                max_correspondence_distance);
+    } else if (device_type == core::Device::DeviceType::CUDA) {
+        CUDA_CALL(ComputeCachedCorrespondenceDistancesCUDA,
+                  source_positions.Contiguous(), target_positions.Contiguous(),
+                  correspondence_indices.Contiguous(),
+                  valid_correspondence_indices, squared_distances,
+                  max_correspondence_distance);
+    } else {
+        utility::LogError("Unimplemented device.");
+    }
+
+    return std::make_tuple(valid_correspondence_indices, squared_distances);
+}
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
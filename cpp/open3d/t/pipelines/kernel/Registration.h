@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <tuple>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/t/pipelines/registration/Registration.h"
 #include "open3d/t/pipelines/registration/RobustKernel.h"
@@ -117,6 +119,79 @@ core::Tensor ComputeInformationMatrix(
         const core::Tensor &target_positions,
         const core::Tensor &correspondence_indices);
 
+/// \brief Selects the source points whose cached correspondence has to be
+/// searched again, because they moved farther than their search bound plus
+/// \p tolerance since their last search.
+///
+/// \param source_positions Current source point positions of Float32 or
+/// Float64 dtype.
+/// \param reference_positions Source point positions at the last search, of
+/// same dtype as source point positions.
+/// \param search_bounds Tensor of shape {n} and same dtype as source point
+/// positions, with the distance a point can move without changing its nearest
+/// neighbor. Negative bounds mark points that were never searched.
+/// \param tolerance Distance by which a point may exceed its search bound
+/// before it is searched again.
+/// \return Bool tensor of shape {n}, true for points to search again.
+core::Tensor ComputeCorrespondenceQueryMask(
+        const core::Tensor &source_positions,
+        const core::Tensor &reference_positions,
+        const core::Tensor &search_bounds,
+        const double tolerance);
+
+/// \brief Updates cached correspondences with a hybrid search for the source
+/// points \p query_indices, with a radius of \p max_correspondence_distance
+/// and a max_knn of 2.
+///
+/// The search bound of a point is half the gap between its nearest and second
+/// nearest target point, or between its nearest target point and the search
+/// radius, so that the nearest neighbor cannot change while the point moves
+/// less than the bound.
+///
+/// \param source_positions Current source point positions of Float32 or
+/// Float64 dtype.
+/// \param query_indices Int64 indices of the searched source points.
+/// \param neighbor_indices Int32 tensor of shape {m, 2} from the hybrid search.
+/// \param neighbor_distances Squared distances of shape {m, 2} from the
+/// hybrid search.
+/// \param neighbor_counts Int32 tensor of shape {m} from the hybrid search.
+/// \param max_correspondence_distance Radius of the hybrid search.
+/// \param correspondence_indices [in/out] Int64 tensor of shape {n} with the
+/// cached correspondence of each source point, -1 if there is none.
+/// \param reference_positions [in/out] Source point positions at the last
+/// search.
+/// \param search_bounds [in/out] Search bound of each source point.
+void UpdateCorrespondenceCache(const core::Tensor &source_positions,
+                               const core::Tensor &query_indices,
+                               const core::Tensor &neighbor_indices,
+                               const core::Tensor &neighbor_distances,
+                               const core::Tensor &neighbor_counts,
+                               const double max_correspondence_distance,
+                               core::Tensor &correspondence_indices,
+                               core::Tensor &reference_positions,
+                               core::Tensor &search_bounds);
+
+/// \brief Computes the squared distances of the source points to their cached
+/// correspondences at their current positions.
+///
+/// \param source_positions Current source point positions of Float32 or
+/// Float64 dtype.
+/// \param target_positions Target point positions of same dtype as source
+/// point positions.
+/// \param correspondence_indices Int64 tensor of shape {n} with the cached
+/// correspondence of each source point, -1 if there is none.
+/// \param max_correspondence_distance Correspondences farther apart than this
+/// are dropped.
+/// \return Tuple of (correspondences, squared distances), both of shape {n}.
+/// The correspondences are Int64 with -1 for dropped correspondences, the
+/// squared distances have the dtype of source point positions and are 0 for
+/// dropped correspondences.
+std::tuple<core::Tensor, core::Tensor> ComputeCachedCorrespondenceDistances(
+        const core::Tensor &source_positions,
+        const core::Tensor &target_positions,
+        const core::Tensor &correspondence_indices,
+        const double max_correspondence_distance);
+
 }  // namespace kernel
 }  // namespace pipelines
 }  // namespace t
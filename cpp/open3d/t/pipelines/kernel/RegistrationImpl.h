@@ -114,6 +114,56 @@ void ComputeInformationMatrixCUDA(const core::Tensor &target_points,
                                   const core::Device &device);
 #endif
 
+void ComputeCorrespondenceQueryMaskCPU(const core::Tensor &source_points,
+                                       const core::Tensor &reference_points,
+                                       const core::Tensor &search_bounds,
+                                       core::Tensor &query_mask,
+                                       const double tolerance);
+
+void UpdateCorrespondenceCacheCPU(const core::Tensor &source_points,
+                                  const core::Tensor &query_indices,
+                                  const core::Tensor &neighbor_indices,
+                                  const core::Tensor &neighbor_distances,
+                                  const core::Tensor &neighbor_counts,
+                                  const double max_correspondence_distance,
+                                  core::Tensor &correspondence_indices,
+                                  core::Tensor &reference_points,
+                                  core::Tensor &search_bounds);
+
+void ComputeCachedCorrespondenceDistancesCPU(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondence_indices,
+        core::Tensor &valid_correspondence_indices,
+        core::Tensor &squared_distances,
+        const double max_correspondence_distance);
+
+#ifdef BUILD_CUDA_MODULE
+void ComputeCorrespondenceQueryMaskCUDA(const core::Tensor &source_points,
+                                        const core::Tensor &reference_points,
+                                        const core::Tensor &search_bounds,
+                                        core::Tensor &query_mask,
+                                        const double tolerance);
+
+void UpdateCorrespondenceCacheCUDA(const core::Tensor &source_points,
+                                   const core::Tensor &query_indices,
+                                   const core::Tensor &neighbor_indices,
+                                   const core::Tensor &neighbor_distances,
+                                   const core::Tensor &neighbor_counts,
+                                   const double max_correspondence_distance,
+                                   core::Tensor &correspondence_indices,
+                                   core::Tensor &reference_points,
+                                   core::Tensor &search_bounds);
+
+void ComputeCachedCorrespondenceDistancesCUDA(
+        const core::Tensor &source_points,
+        const core::Tensor &target_points,
+        const core::Tensor &correspondence_indices,
+        core::Tensor &valid_correspondence_indices,
+        core::Tensor &squared_distances,
+        const double max_correspondence_distance);
+#endif
+
 template <typename scalar_t>
 OPEN3D_HOST_DEVICE inline bool GetJacobianPointToPlane(
         int64_t workload_idx,
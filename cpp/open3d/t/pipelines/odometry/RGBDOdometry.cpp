@@ -42,349 +42,204 @@ using core::Tensor;
 using t::geometry::Image;
 using t::geometry::RGBDImage;
 
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsic,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScaleHybrid(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params);
-
-OdometryResult RGBDOdometryMultiScale(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& init_source_to_target,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const Method method,
-        const OdometryLossParams& params) {
-    // TODO (wei): more device check
-    const core::Device device = source.depth_.GetDevice();
-    core::AssertTensorDevice(target.depth_.AsTensor(), device);
-
+RGBDOdometryFrame::RGBDOdometryFrame(const RGBDImage& rgbd,
+                                     const Tensor& intrinsics,
+                                     float depth_scale,
+                                     float depth_max,
+                                     float depth_outlier_trunc)
+    : rgbd_(rgbd),
+      depth_scale_(depth_scale),
+      depth_max_(depth_max),
+      depth_outlier_trunc_(depth_outlier_trunc) {
     core::AssertTensorShape(intrinsics, {3, 3});
-    core::AssertTensorShape(init_source_to_target, {4, 4});
-
-    // 4x4 transformations are always float64 and stay on CPU.
-    const core::Device host("CPU:0");
-    const Tensor intrinsics_d = intrinsics.To(host, core::Float64).Clone();
-    const Tensor trans_d =
-            init_source_to_target.To(host, core::Float64).Clone();
-
-    Image source_depth = source.depth_;
-    Image target_depth = target.depth_;
-
-    Image source_depth_processed =
-            source_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-    Image target_depth_processed =
-            target_depth.ClipTransform(depth_scale, 0, depth_max, NAN);
-
-    RGBDImage source_processed(source.color_, source_depth_processed);
-    RGBDImage target_processed(target.color_, target_depth_processed);
+    // Intrinsics are always float64 and stay on CPU.
+    intrinsics_ = intrinsics.To(core::Device("CPU:0"), core::Float64).Clone();
+}
 
-    if (method == Method::PointToPlane) {
-        return RGBDOdometryMultiScalePointToPlane(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Intensity) {
-        return RGBDOdometryMultiScaleIntensity(
-                source_processed, target_processed, intrinsics_d, trans_d,
-                depth_scale, depth_max, criteria, params);
-    } else if (method == Method::Hybrid) {
-        return RGBDOdometryMultiScaleHybrid(source_processed, target_processed,
-                                            intrinsics_d, trans_d, depth_scale,
-                                            depth_max, criteria, params);
-    } else {
-        utility::LogError("Odometry method not implemented.");
+RGBDOdometryFrame::Level& RGBDOdometryFrame::GetLevel(int64_t level) {
+    if (level < 0) {
+        utility::LogError("Invalid pyramid level {}.", level);
     }
-
-    return OdometryResult(trans_d);
+    while (static_cast<int64_t>(levels_.size()) <= level) {
+        Level next;
+        if (levels_.empty()) {
+            next.intrinsics_ = intrinsics_;
+            next.depth_ = rgbd_.depth_.ClipTransform(depth_scale_, 0,
+                                                     depth_max_, NAN);
+        } else {
+            const Level& prev = levels_.back();
+            next.intrinsics_ = prev.intrinsics_ / 2;
+            next.intrinsics_[-1][-1] = 1;
+            next.depth_ = prev.depth_.PyrDownDepth(depth_outlier_trunc_ * 2,
+                                                   NAN);
+        }
+        levels_.push_back(next);
+    }
+    return levels_[level];
 }
 
-OdometryResult RGBDOdometryMultiScalePointToPlane(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_vertex_maps(n_levels);
-    std::vector<Tensor> target_vertex_maps(n_levels);
-    std::vector<Tensor> target_normal_maps(n_levels);
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid.
-    for (int64_t i = 0; i < n_levels; ++i) {
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_vertex_map =
-                target_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-
-        Image target_depth_curr_smooth =
-                target_depth_curr.FilterBilateral(5, 5, 10);
-        Image target_vertex_map_smooth =
-                target_depth_curr_smooth.CreateVertexMap(intrinsics_pyr, NAN);
-        Image target_normal_map = target_vertex_map_smooth.CreateNormalMap(NAN);
-
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-        target_vertex_maps[n_levels - 1 - i] = target_vertex_map.AsTensor();
-        target_normal_maps[n_levels - 1 - i] = target_normal_map.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
+Tensor RGBDOdometryFrame::GetIntrinsics(int64_t level) {
+    return GetLevel(level).intrinsics_;
+}
 
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
+Tensor RGBDOdometryFrame::GetDepth(int64_t level) {
+    return GetLevel(level).depth_.AsTensor();
+}
 
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
+Tensor RGBDOdometryFrame::GetIntensity(int64_t level) {
+    Level& curr = GetLevel(level);
+    if (!curr.intensity_.has_value()) {
+        if (level == 0) {
+            curr.intensity_ = rgbd_.color_.RGBToGray().To(core::Float32);
+        } else {
+            GetIntensity(level - 1);
+            // Levels are not moved since the depth pyramid is already built.
+            curr.intensity_ = levels_[level - 1].intensity_.value().PyrDown();
         }
     }
+    return curr.intensity_.value().AsTensor();
+}
 
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultPointToPlane(
-                    source_vertex_maps[i], target_vertex_maps[i],
-                    target_normal_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
-            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
-                              iter, delta_result.inlier_rmse_,
-                              delta_result.fitness_);
-
-            if (std::abs(result.fitness_ - delta_result.fitness_) /
-                                result.fitness_ <
-                        criteria[i].relative_fitness_ &&
-                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
-                                result.inlier_rmse_ <
-                        criteria[i].relative_rmse_) {
-                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
-                break;
-            }
-            result.inlier_rmse_ = delta_result.inlier_rmse_;
-            result.fitness_ = delta_result.fitness_;
-        }
+Tensor RGBDOdometryFrame::GetVertexMap(int64_t level) {
+    Level& curr = GetLevel(level);
+    if (!curr.vertex_map_.has_value()) {
+        curr.vertex_map_ =
+                curr.depth_.CreateVertexMap(curr.intrinsics_, NAN).AsTensor();
     }
-
-    return result;
+    return curr.vertex_map_.value();
 }
 
-OdometryResult RGBDOdometryMultiScaleIntensity(
-        const RGBDImage& source,
-        const RGBDImage& target,
-        const Tensor& intrinsics,
-        const Tensor& trans,
-        const float depth_scale,
-        const float depth_max,
-        const std::vector<OdometryConvergenceCriteria>& criteria,
-        const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr = source.depth_;
-    Image target_depth_curr = target.depth_;
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
+Tensor RGBDOdometryFrame::GetNormalMap(int64_t level) {
+    Level& curr = GetLevel(level);
+    if (!curr.normal_map_.has_value()) {
+        Image depth_smooth = curr.depth_.FilterBilateral(5, 5, 10);
+        Image vertex_map_smooth =
+                depth_smooth.CreateVertexMap(curr.intrinsics_, NAN);
+        curr.normal_map_ = vertex_map_smooth.CreateNormalMap(NAN).AsTensor();
+    }
+    return curr.normal_map_.value();
+}
 
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
+Tensor RGBDOdometryFrame::GetDepthDx(int64_t level) {
+    Level& curr = GetLevel(level);
+    if (!curr.depth_grad_.has_value()) {
+        auto depth_grad = curr.depth_.FilterSobel();
+        curr.depth_grad_ = std::make_pair(depth_grad.first.AsTensor(),
+                                          depth_grad.second.AsTensor());
     }
+    return curr.depth_grad_.value().first;
+}
 
-    // Odometry
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
-    for (int64_t i = 0; i < n_levels; ++i) {
-        for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultIntensity(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_intensity_dx[i],
-                    target_intensity_dy[i], source_vertex_maps[i],
-                    intrinsic_matrices[i], result.transformation_,
-                    params.depth_outlier_trunc_, params.intensity_huber_delta_);
-            result.transformation_ =
-                    delta_result.transformation_.Matmul(result.transformation_);
-            utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
-                              iter, delta_result.inlier_rmse_,
-                              delta_result.fitness_);
+Tensor RGBDOdometryFrame::GetDepthDy(int64_t level) {
+    GetDepthDx(level);
+    return levels_[level].depth_grad_.value().second;
+}
 
-            if (std::abs(result.fitness_ - delta_result.fitness_) /
-                                result.fitness_ <
-                        criteria[i].relative_fitness_ &&
-                std::abs(result.inlier_rmse_ - delta_result.inlier_rmse_) /
-                                result.inlier_rmse_ <
-                        criteria[i].relative_rmse_) {
-                utility::LogDebug("Early exit at level {}, iter {}", i, iter);
-                break;
-            }
-            result.inlier_rmse_ = delta_result.inlier_rmse_;
-            result.fitness_ = delta_result.fitness_;
-        }
+Tensor RGBDOdometryFrame::GetIntensityDx(int64_t level) {
+    Level& curr = GetLevel(level);
+    if (!curr.intensity_grad_.has_value()) {
+        auto intensity_grad = Image(GetIntensity(level)).FilterSobel();
+        curr.intensity_grad_ = std::make_pair(intensity_grad.first.AsTensor(),
+                                              intensity_grad.second.AsTensor());
     }
+    return curr.intensity_grad_.value().first;
+}
 
-    return result;
+Tensor RGBDOdometryFrame::GetIntensityDy(int64_t level) {
+    GetIntensityDx(level);
+    return levels_[level].intensity_grad_.value().second;
 }
 
-OdometryResult RGBDOdometryMultiScaleHybrid(
+OdometryResult RGBDOdometryMultiScale(
         const RGBDImage& source,
         const RGBDImage& target,
         const Tensor& intrinsics,
-        const Tensor& trans,
+        const Tensor& init_source_to_target,
         const float depth_scale,
         const float depth_max,
         const std::vector<OdometryConvergenceCriteria>& criteria,
+        const Method method,
         const OdometryLossParams& params) {
-    int64_t n_levels = int64_t(criteria.size());
-    std::vector<Tensor> source_intensity(n_levels);
-    std::vector<Tensor> target_intensity(n_levels);
-
-    std::vector<Tensor> source_depth(n_levels);
-    std::vector<Tensor> target_depth(n_levels);
-    std::vector<Tensor> target_intensity_dx(n_levels);
-    std::vector<Tensor> target_intensity_dy(n_levels);
-
-    std::vector<Tensor> target_depth_dx(n_levels);
-    std::vector<Tensor> target_depth_dy(n_levels);
-
-    std::vector<Tensor> source_vertex_maps(n_levels);
-
-    std::vector<Tensor> intrinsic_matrices(n_levels);
-
-    Image source_depth_curr(source.depth_);
-    Image target_depth_curr(target.depth_);
-
-    Image source_intensity_curr = source.color_.RGBToGray().To(core::Float32);
-    Image target_intensity_curr = target.color_.RGBToGray().To(core::Float32);
-
-    Tensor intrinsics_pyr = intrinsics;
-    // Create image pyramid
-    for (int64_t i = 0; i < n_levels; ++i) {
-        source_depth[n_levels - 1 - i] = source_depth_curr.AsTensor().Clone();
-        target_depth[n_levels - 1 - i] = target_depth_curr.AsTensor().Clone();
-
-        source_intensity[n_levels - 1 - i] =
-                source_intensity_curr.AsTensor().Clone();
-        target_intensity[n_levels - 1 - i] =
-                target_intensity_curr.AsTensor().Clone();
-
-        Image source_vertex_map =
-                source_depth_curr.CreateVertexMap(intrinsics_pyr, NAN);
-        source_vertex_maps[n_levels - 1 - i] = source_vertex_map.AsTensor();
-
-        auto target_intensity_grad = target_intensity_curr.FilterSobel();
-        target_intensity_dx[n_levels - 1 - i] =
-                target_intensity_grad.first.AsTensor();
-        target_intensity_dy[n_levels - 1 - i] =
-                target_intensity_grad.second.AsTensor();
-
-        auto target_depth_grad = target_depth_curr.FilterSobel();
-        target_depth_dx[n_levels - 1 - i] = target_depth_grad.first.AsTensor();
-        target_depth_dy[n_levels - 1 - i] = target_depth_grad.second.AsTensor();
+    RGBDOdometryFrame source_frame(source, intrinsics, depth_scale, depth_max,
+                                   params.depth_outlier_trunc_);
+    RGBDOdometryFrame target_frame(target, intrinsics, depth_scale, depth_max,
+                                   params.depth_outlier_trunc_);
+    return RGBDOdometryMultiScale(source_frame, target_frame,
+                                  init_source_to_target, criteria, method,
+                                  params);
+}
 
-        intrinsic_matrices[n_levels - 1 - i] = intrinsics_pyr.Clone();
-        if (i != n_levels - 1) {
-            source_depth_curr = source_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            target_depth_curr = target_depth_curr.PyrDownDepth(
-                    params.depth_outlier_trunc_ * 2, NAN);
-            source_intensity_curr = source_intensity_curr.PyrDown();
-            target_intensity_curr = target_intensity_curr.PyrDown();
+/// Performs one iteration of odometry with \p method at a pyramid level.
+static OdometryResult ComputeOdometryResultAtLevel(
+        RGBDOdometryFrame& source,
+        RGBDOdometryFrame& target,
+        int64_t level,
+        const Tensor& trans,
+        const Method method,
+        const OdometryLossParams& params) {
+    if (method == Method::PointToPlane) {
+        return ComputeOdometryResultPointToPlane(
+                source.GetVertexMap(level), target.GetVertexMap(level),
+                target.GetNormalMap(level), target.GetIntrinsics(level), trans,
+                params.depth_outlier_trunc_, params.depth_huber_delta_);
+    } else if (method == Method::Intensity) {
+        return ComputeOdometryResultIntensity(
+                source.GetDepth(level), target.GetDepth(level),
+                source.GetIntensity(level), target.GetIntensity(level),
+                target.GetIntensityDx(level), target.GetIntensityDy(level),
+                source.GetVertexMap(level), target.GetIntrinsics(level), trans,
+                params.depth_outlier_trunc_, params.intensity_huber_delta_);
+    } else if (method == Method::Hybrid) {
+        return ComputeOdometryResultHybrid(
+                source.GetDepth(level), target.GetDepth(level),
+                source.GetIntensity(level), target.GetIntensity(level),
+                target.GetDepthDx(level), target.GetDepthDy(level),
+                target.GetIntensityDx(level), target.GetIntensityDy(level),
+                source.GetVertexMap(level), target.GetIntrinsics(level), trans,
+                params.depth_outlier_trunc_, params.depth_huber_delta_,
+                params.intensity_huber_delta_);
+    } else {
+        utility::LogError("Odometry method not implemented.");
+    }
+}
 
-            intrinsics_pyr /= 2;
-            intrinsics_pyr[-1][-1] = 1;
-        }
+OdometryResult RGBDOdometryMultiScale(
+        RGBDOdometryFrame& source,
+        RGBDOdometryFrame& target,
+        const Tensor& init_source_to_target,
+        const std::vector<OdometryConvergenceCriteria>& criteria,
+        const Method method,
+        const OdometryLossParams& params) {
+    if (source.GetDevice() != target.GetDevice()) {
+        utility::LogError("Source device {} and target device {} mismatch.",
+                          source.GetDevice().ToString(),
+                          target.GetDevice().ToString());
     }
+    // The depth pyramids of the frames are built with their own threshold.
+    if (source.GetDepthOutlierTrunc() != params.depth_outlier_trunc_ ||
+        target.GetDepthOutlierTrunc() != params.depth_outlier_trunc_) {
+        utility::LogError(
+                "Frames are built with depth_outlier_trunc {} and {}, but "
+                "params.depth_outlier_trunc_ is {}.",
+                source.GetDepthOutlierTrunc(), target.GetDepthOutlierTrunc(),
+                params.depth_outlier_trunc_);
+    }
+    core::AssertTensorShape(init_source_to_target, {4, 4});
 
-    // Odometry
-    OdometryResult result(trans, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
+    // 4x4 transformations are always float64 and stay on CPU.
+    const core::Device host("CPU:0");
+    const Tensor trans_d =
+            init_source_to_target.To(host, core::Float64).Clone();
+
+    // Levels are ordered from coarse to fine in criteria.
+    int64_t n_levels = int64_t(criteria.size());
+    OdometryResult result(trans_d, /*prev rmse*/ 0.0, /*prev fitness*/ 1.0);
     for (int64_t i = 0; i < n_levels; ++i) {
+        const int64_t level = n_levels - 1 - i;
         for (int iter = 0; iter < criteria[i].max_iteration_; ++iter) {
-            auto delta_result = ComputeOdometryResultHybrid(
-                    source_depth[i], target_depth[i], source_intensity[i],
-                    target_intensity[i], target_depth_dx[i], target_depth_dy[i],
-                    target_intensity_dx[i], target_intensity_dy[i],
-                    source_vertex_maps[i], intrinsic_matrices[i],
-                    result.transformation_, params.depth_outlier_trunc_,
-                    params.depth_huber_delta_, params.intensity_huber_delta_);
+            auto delta_result = ComputeOdometryResultAtLevel(
+                    source, target, level, result.transformation_, method,
+                    params);
             result.transformation_ =
                     delta_result.transformation_.Matmul(result.transformation_);
             utility::LogDebug("level {}, iter {}: rmse = {}, fitness = {}", i,
@@ -30,9 +30,13 @@
 
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/t/geometry/Image.h"
 #include "open3d/t/geometry/RGBDImage.h"
+#include "open3d/utility/Optional.h"
 
 namespace open3d {
 namespace t {
@@ -137,6 +141,91 @@ public:
     float intensity_huber_delta_;
 };
 
+/// \class RGBDOdometryFrame
+///
+/// \brief An RGBD image with the image pyramid and derived maps used by RGBD
+/// odometry.
+///
+/// Pyramid levels, vertex maps, normal maps and gradients are computed on
+/// first use and cached. In frame-to-frame tracking, the target of one
+/// odometry call is the source of the next one, and passing the same frame
+/// object to both calls avoids computing its pyramid twice. Level 0 has the
+/// input resolution, each further level halves the resolution. Frames are not
+/// thread-safe.
+class RGBDOdometryFrame {
+public:
+    /// \brief Constructor for an odometry frame. No computation is done until
+    /// the first access.
+    ///
+    /// \param rgbd RGBD image with a depth image (UInt16 or Float32) and a
+    /// color image (UInt8 x 3). The color image is only used by the Intensity
+    /// and Hybrid methods.
+    /// \param intrinsics (3, 3) intrinsic matrix for projection.
+    /// \param depth_scale Converts depth pixel values to meters by dividing the
+    /// scale factor.
+    /// \param depth_max Max depth to truncate depth image with noisy
+    /// measurements.
+    /// \param depth_outlier_trunc Depth difference threshold used to build the
+    /// depth pyramid, must match OdometryLossParams::depth_outlier_trunc_ of
+    /// the odometry calls the frame is passed to.
+    RGBDOdometryFrame(const t::geometry::RGBDImage& rgbd,
+                      const core::Tensor& intrinsics,
+                      float depth_scale = 1000.0f,
+                      float depth_max = 3.0f,
+                      float depth_outlier_trunc = 0.07f);
+
+    core::Device GetDevice() const { return rgbd_.depth_.GetDevice(); }
+
+    /// Depth difference threshold the depth pyramid is built with.
+    float GetDepthOutlierTrunc() const { return depth_outlier_trunc_; }
+
+    /// (3, 3) Float64 intrinsic matrix of a pyramid level on CPU.
+    core::Tensor GetIntrinsics(int64_t level);
+    /// (rows, cols, 1) Float32 depth in meters, invalid depth is NaN.
+    core::Tensor GetDepth(int64_t level);
+    /// (rows, cols, 1) Float32 intensity.
+    core::Tensor GetIntensity(int64_t level);
+    /// (rows, cols, 3) Float32 vertex map.
+    core::Tensor GetVertexMap(int64_t level);
+    /// (rows, cols, 3) Float32 normal map of the bilateral filtered depth.
+    core::Tensor GetNormalMap(int64_t level);
+    /// (rows, cols, 1) Float32 depth gradient along x-axis.
+    core::Tensor GetDepthDx(int64_t level);
+    /// (rows, cols, 1) Float32 depth gradient along y-axis.
+    core::Tensor GetDepthDy(int64_t level);
+    /// (rows, cols, 1) Float32 intensity gradient along x-axis.
+    core::Tensor GetIntensityDx(int64_t level);
+    /// (rows, cols, 1) Float32 intensity gradient along y-axis.
+    core::Tensor GetIntensityDy(int64_t level);
+
+    /// Returns the number of pyramid levels computed so far.
+    int64_t GetNumCachedLevels() const {
+        return static_cast<int64_t>(levels_.size());
+    }
+
+private:
+    struct Level {
+        core::Tensor intrinsics_;
+        t::geometry::Image depth_;
+        utility::optional<t::geometry::Image> intensity_;
+        utility::optional<core::Tensor> vertex_map_;
+        utility::optional<core::Tensor> normal_map_;
+        utility::optional<std::pair<core::Tensor, core::Tensor>> depth_grad_;
+        utility::optional<std::pair<core::Tensor, core::Tensor>>
+                intensity_grad_;
+    };
+
+    /// Returns the level, computing the depth pyramid up to it if needed.
+    Level& GetLevel(int64_t level);
+
+    t::geometry::RGBDImage rgbd_;
+    core::Tensor intrinsics_;
+    float depth_scale_;
+    float depth_max_;
+    float depth_outlier_trunc_;
+    std::vector<Level> levels_;
+};
+
 /// \brief Create an RGBD image pyramid given the original source and target
 /// RGBD images, and perform hierarchical odometry using specified \p
 /// method.
@@ -174,6 +263,32 @@ OdometryResult RGBDOdometryMultiScale(
         const Method method = Method::Hybrid,
         const OdometryLossParams& params = OdometryLossParams());
 
+/// \brief Perform hierarchical odometry using specified \p method on odometry
+/// frames, which compute and cache their image pyramids on demand.
+/// Use this for frame-to-frame tracking, where the target frame of one call is
+/// passed as the source frame of the next call.
+/// \param source Source odometry frame.
+/// \param target Target odometry frame on the same device as \p source.
+/// \param init_source_to_target (4, 4) initial transformation matrix from
+/// source to target of core::Float64 on CPU.
+/// \param criteria_list Criteria used to define and terminate iterations. In
+/// multiscale odometry the order is from coarse to fine.
+/// \param method Method used to apply RGBD odometry.
+/// \param params Parameters used in loss function, including outlier rejection
+/// threshold and Huber norm parameters. Both frames must have been created
+/// with params.depth_outlier_trunc_.
+/// \return odometry result, with (4, 4) optimized transformation matrix from
+/// source to target, inlier ratio, and fitness.
+OdometryResult RGBDOdometryMultiScale(
+        RGBDOdometryFrame& source,
+        RGBDOdometryFrame& target,
+        const core::Tensor& init_source_to_target =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+        const std::vector<OdometryConvergenceCriteria>& criteria_list = {10, 5,
+                                                                         3},
+        const Method method = Method::Hybrid,
+        const OdometryLossParams& params = OdometryLossParams());
+
 /// \brief Estimates the 4x4 rigid transformation T from source to target, with
 /// inlier rmse and fitness.
 /// Performs one iteration of RGBD odometry using loss function
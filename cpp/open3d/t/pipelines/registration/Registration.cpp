@@ -26,6 +26,8 @@
 
 #include "open3d/t/pipelines/registration/Registration.h"
 
+#include <memory>
+
 #include "open3d/core/Tensor.h"
 #include "open3d/core/TensorCheck.h"
 #include "open3d/core/TensorFunction.h"
@@ -40,6 +42,25 @@ namespace t {
 namespace pipelines {
 namespace registration {
 
+static void ComputeFitnessAndInlierRMSE(const double num_correspondences,
+                                        const double squared_error,
+                                        const int64_t num_points,
+                                        RegistrationResult &result) {
+    if (num_correspondences != 0) {
+        result.fitness_ = num_correspondences / static_cast<double>(num_points);
+        result.inlier_rmse_ = std::sqrt(squared_error / num_correspondences);
+    } else {
+        // Case of no-correspondences.
+        utility::LogWarning(
+                "0 correspondence present between the pointclouds. Try "
+                "increasing the max_correspondence_distance parameter.");
+        result.fitness_ = 0.0;
+        result.inlier_rmse_ = 0.0;
+        result.transformation_ =
+                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    }
+}
+
 static RegistrationResult ComputeRegistrationResult(
         const geometry::PointCloud &source,
         const core::nns::NearestNeighborSearch &target_nns,
@@ -58,25 +79,85 @@ static RegistrationResult ComputeRegistrationResult(
     double num_correspondences =
             counts.Sum({0}).To(core::Float64).Item<double>();
 
-    if (num_correspondences != 0) {
-        // Reduction sum of "distances" for error.
-        const double squared_error =
-                distances.Sum({0}).To(core::Float64).Item<double>();
+    // Reduction sum of "distances" for error.
+    const double squared_error =
+            num_correspondences != 0
+                    ? distances.Sum({0}).To(core::Float64).Item<double>()
+                    : 0.0;
+    ComputeFitnessAndInlierRMSE(num_correspondences, squared_error,
+                                source.GetPointPositions().GetLength(),
+                                result);
+    return result;
+}
 
-        result.fitness_ =
-                num_correspondences /
-                static_cast<double>(source.GetPointPositions().GetLength());
-        result.inlier_rmse_ = std::sqrt(squared_error / num_correspondences);
-    } else {
-        // Case of no-correspondences.
-        utility::LogWarning(
-                "0 correspondence present between the pointclouds. Try "
-                "increasing the max_correspondence_distance parameter.");
-        result.fitness_ = 0.0;
-        result.inlier_rmse_ = 0.0;
-        result.transformation_ =
-                core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+/// Correspondences of the source points of one scale, kept between ICP
+/// iterations together with the positions and search bounds of their last
+/// search.
+struct CorrespondenceCache {
+    explicit CorrespondenceCache(const core::Tensor &source_positions)
+        : correspondences_(core::Tensor::Full({source_positions.GetLength()},
+                                              -1, core::Int64,
+                                              source_positions.GetDevice())),
+          reference_positions_(source_positions.Clone()),
+          search_bounds_(core::Tensor::Full({source_positions.GetLength()},
+                                            -1, source_positions.GetDtype(),
+                                            source_positions.GetDevice())) {}
+
+    core::Tensor correspondences_;
+    core::Tensor reference_positions_;
+    core::Tensor search_bounds_;
+};
+
+/// Same as ComputeRegistrationResult, but only searches the source points that
+/// moved too far for their cached correspondence to be trusted.
+static RegistrationResult ComputeRegistrationResultWithCache(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const core::nns::NearestNeighborSearch &target_nns,
+        const double max_correspondence_distance,
+        const double correspondence_cache_tolerance,
+        const core::Tensor &transformation,
+        CorrespondenceCache &cache) {
+    core::AssertTensorShape(transformation, {4, 4});
+
+    RegistrationResult result(
+            transformation.To(core::Device("CPU:0"), core::Float64));
+
+    const core::Tensor &source_positions = source.GetPointPositions();
+    const core::Tensor query_indices =
+            kernel::ComputeCorrespondenceQueryMask(
+                    source_positions, cache.reference_positions_,
+                    cache.search_bounds_, correspondence_cache_tolerance)
+                    .NonZero()
+                    .Flatten();
+    if (query_indices.GetLength() > 0) {
+        core::Tensor neighbor_indices, neighbor_distances, neighbor_counts;
+        std::tie(neighbor_indices, neighbor_distances, neighbor_counts) =
+                target_nns.HybridSearch(
+                        source_positions.IndexGet({query_indices}),
+                        max_correspondence_distance, 2);
+        kernel::UpdateCorrespondenceCache(
+                source_positions, query_indices, neighbor_indices,
+                neighbor_distances, neighbor_counts,
+                max_correspondence_distance, cache.correspondences_,
+                cache.reference_positions_, cache.search_bounds_);
     }
+
+    core::Tensor distances;
+    std::tie(result.correspondences_, distances) =
+            kernel::ComputeCachedCorrespondenceDistances(
+                    source_positions, target.GetPointPositions(),
+                    cache.correspondences_, max_correspondence_distance);
+    const double num_correspondences = result.correspondences_.Ge(0)
+                                               .To(core::Float64)
+                                               .Sum({0})
+                                               .Item<double>();
+    const double squared_error =
+            num_correspondences != 0
+                    ? distances.Sum({0}).To(core::Float64).Item<double>()
+                    : 0.0;
+    ComputeFitnessAndInlierRMSE(num_correspondences, squared_error,
+                                source_positions.GetLength(), result);
     return result;
 }
 
@@ -118,10 +199,12 @@ ICP(const geometry::PointCloud &source,
     const ICPConvergenceCriteria &criteria,
     const double voxel_size,
     const std::function<void(const std::unordered_map<std::string, core::Tensor>
-                                     &)> &callback_after_iteration) {
+                                     &)> &callback_after_iteration,
+    const double correspondence_cache_tolerance) {
     return MultiScaleICP(source, target, {voxel_size}, {criteria},
                          {max_correspondence_distance}, init_source_to_target,
-                         estimation, callback_after_iteration);
+                         estimation, callback_after_iteration,
+                         correspondence_cache_tolerance);
 }
 
 static void AssertInputMultiScaleICP(
@@ -267,16 +350,28 @@ static std::tuple<RegistrationResult, int> DoSingleScaleICPIterations(
         const core::Dtype &dtype,
         const RegistrationResult &current_result,
         const std::function<void(std::unordered_map<std::string, core::Tensor>
-                                         &)> &callback_after_iteration) {
+                                         &)> &callback_after_iteration,
+        const double correspondence_cache_tolerance) {
     RegistrationResult result(current_result.transformation_);
+    std::unique_ptr<CorrespondenceCache> cache;
+    if (correspondence_cache_tolerance >= 0) {
+        cache.reset(new CorrespondenceCache(source.GetPointPositions()));
+    }
     double prev_fitness = current_result.fitness_;
     double prev_inlier_rmse = current_result.inlier_rmse_;
     int iteration_count = 0;
     for (iteration_count = 0; iteration_count < criteria.max_iteration_;
          ++iteration_count) {
-        result = ComputeRegistrationResult(
-                source.GetPointPositions(), target_nns,
-                max_correspondence_distance, result.transformation_);
+        if (cache) {
+            result = ComputeRegistrationResultWithCache(
+                    source, target, target_nns, max_correspondence_distance,
+                    correspondence_cache_tolerance, result.transformation_,
+                    *cache);
+        } else {
+            result = ComputeRegistrationResult(
+                    source.GetPointPositions(), target_nns,
+                    max_correspondence_distance, result.transformation_);
+        }
 
         if (result.fitness_ <= std::numeric_limits<double>::min()) {
             return std::make_tuple(result,
@@ -343,7 +438,8 @@ RegistrationResult MultiScaleICP(
         const TransformationEstimation &estimation,
         const std::function<
                 void(const std::unordered_map<std::string, core::Tensor> &)>
-                &callback_after_iteration) {
+                &callback_after_iteration,
+        const double correspondence_cache_tolerance) {
     core::AssertTensorDtypes(source.GetPointPositions(),
                              {core::Float64, core::Float32});
 
@@ -391,7 +487,7 @@ RegistrationResult MultiScaleICP(
                 target_nns, criterias[scale_idx],
                 max_correspondence_distances[scale_idx], estimation, scale_idx,
                 iteration_count, device, dtype, result,
-                callback_after_iteration);
+                callback_after_iteration, correspondence_cache_tolerance);
 
         // To calculate final `fitness` and `inlier_rmse` for the current
         // `transformation` stored in `result`.
@@ -145,6 +145,12 @@ RegistrationResult EvaluateRegistration(
 /// tensor map of attributes such as "iteration_index", "scale_index",
 /// "scale_iteration_index", "inlier_rmse", "fitness", "transformation", on CPU
 /// device, updated after each iteration.
+/// \param correspondence_cache_tolerance If non-negative, correspondences are
+/// cached between iterations, and only the source points that moved farther
+/// than their search bound plus this distance are searched again. The search
+/// bound is the distance a point can move without changing its nearest
+/// neighbor, so 0 gives the same correspondences as a full search, and larger
+/// values trade accuracy for speed. A negative value disables the cache.
 RegistrationResult
 ICP(const geometry::PointCloud &source,
     const geometry::PointCloud &target,
@@ -156,7 +162,8 @@ ICP(const geometry::PointCloud &source,
     const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
     const double voxel_size = -1.0,
     const std::function<void(const std::unordered_map<std::string, core::Tensor>
-                                     &)> &callback_after_iteration = nullptr);
+                                     &)> &callback_after_iteration = nullptr,
+    const double correspondence_cache_tolerance = -1.0);
 
 /// \brief Functions for Multi-Scale ICP registration.
 /// It will run ICP on different voxel level, from coarse to dense.
@@ -183,6 +190,12 @@ ICP(const geometry::PointCloud &source,
 /// tensor map of attributes such as "iteration_index", "scale_index",
 /// "scale_iteration_index", "inlier_rmse", "fitness", "transformation", on CPU
 /// device, updated after each iteration.
+/// \param correspondence_cache_tolerance If non-negative, correspondences are
+/// cached between iterations, and only the source points that moved farther
+/// than their search bound plus this distance are searched again. The search
+/// bound is the distance a point can move without changing its nearest
+/// neighbor, so 0 gives the same correspondences as a full search, and larger
+/// values trade accuracy for speed. A negative value disables the cache.
 RegistrationResult MultiScaleICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -195,7 +208,8 @@ RegistrationResult MultiScaleICP(
                 TransformationEstimationPointToPoint(),
         const std::function<
                 void(const std::unordered_map<std::string, core::Tensor> &)>
-                &callback_after_iteration = nullptr);
+                &callback_after_iteration = nullptr,
+        const double correspondence_cache_tolerance = -1.0);
 
 /// \brief Computes `Information Matrix`, from the transformation between source
 /// and target pointcloud. It returns the `Information Matrix` of shape {6, 6},
@@ -43,6 +43,7 @@
 #else
 #include <dirent.h>
 #include <limits.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <unistd.h>
 #endif
@@ -624,6 +625,113 @@ size_t CFile::ReadData(void *data, size_t elem_size, size_t num_elems) {
     return elems;
 }
 
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename, bool copy_on_write) {
+    Close();
+#ifdef WIN32
+    std::wstring filename_w;
+    filename_w.resize(filename.size());
+    int newSize = MultiByteToWideChar(CP_UTF8, 0, filename.c_str(),
+                                      static_cast<int>(filename.length()),
+                                      const_cast<wchar_t *>(filename_w.c_str()),
+                                      static_cast<int>(filename.length()));
+    filename_w.resize(newSize);
+    HANDLE file = CreateFileW(filename_w.c_str(), GENERIC_READ,
+                              FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        error_code_ = ENOENT;
+        return false;
+    }
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        error_code_ = EIO;
+        CloseHandle(file);
+        return false;
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_ > 0) {
+        HANDLE mapping = CreateFileMappingW(
+                file, NULL, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0,
+                0, NULL);
+        if (mapping == NULL) {
+            error_code_ = EIO;
+            CloseHandle(file);
+            return false;
+        }
+        data_ = MapViewOfFile(mapping,
+                              copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0,
+                              0, 0);
+        if (data_ == nullptr) {
+            error_code_ = EIO;
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+        mapping_handle_ = mapping;
+    }
+    file_handle_ = file;
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error_code_ = errno;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        error_code_ = errno;
+        close(fd);
+        return false;
+    }
+    size_ = static_cast<size_t>(st.st_size);
+    if (size_ > 0) {
+        void *data = copy_on_write ? mmap(nullptr, size_,
+                                          PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                                          fd, 0)
+                                   : mmap(nullptr, size_, PROT_READ,
+                                          MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED) {
+            error_code_ = errno;
+            size_ = 0;
+            close(fd);
+            return false;
+        }
+        data_ = data;
+    }
+    // The mapping keeps a reference to the file, the descriptor is not needed.
+    close(fd);
+#endif
+    is_open_ = true;
+    return true;
+}
+
+std::string MappedFile::GetError() { return GetIOErrorString(error_code_); }
+
+void MappedFile::Close() {
+#ifdef WIN32
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle_) {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+    if (file_handle_) {
+        CloseHandle(file_handle_);
+        file_handle_ = nullptr;
+    }
+#else
+    if (data_ && munmap(data_, size_) != 0) {
+        error_code_ = errno;
+        utility::LogWarning("munmap failed: {}", GetError());
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    is_open_ = false;
+}
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
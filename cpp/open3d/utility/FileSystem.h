@@ -169,6 +169,58 @@ private:
     std::vector<char> line_buffer_;
 };
 
+/// RAII wrapper for a read-only memory mapping of a whole file.
+///
+/// The mapping is shared: pages of the same file mapped by several processes
+/// are backed by the same physical memory. The mapping stays valid until the
+/// object is destroyed or Close() is called.
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// The destructor unmaps the file automatically.
+    ~MappedFile();
+
+    /// Map a file read-only. Returns false if the file cannot be opened or
+    /// mapped. Mapping an empty file succeeds with GetData() == nullptr.
+    ///
+    /// If \p copy_on_write is true, the mapped pages may also be written
+    /// through GetMutableData(). Written pages become private copies of this
+    /// process and the file itself is never modified.
+    bool Open(const std::string &filename, bool copy_on_write = false);
+
+    /// Returns the last encountered error for this file.
+    std::string GetError();
+
+    /// Unmap the file.
+    void Close();
+
+    /// Returns true if a file is currently mapped.
+    bool IsOpen() const { return is_open_; }
+
+    /// Returns the start of the mapped region.
+    const void *GetData() const { return data_; }
+
+    /// Returns the start of the mapped region for writing. Only valid if the
+    /// file was opened with \p copy_on_write.
+    void *GetMutableData() { return data_; }
+
+    /// Returns the size of the mapped region in bytes.
+    size_t GetSize() const { return size_; }
+
+private:
+    void *data_ = nullptr;
+    size_t size_ = 0;
+    bool is_open_ = false;
+    int error_code_ = 0;
+#ifdef WIN32
+    void *file_handle_ = nullptr;
+    void *mapping_handle_ = nullptr;
+#endif
+};
+
 }  // namespace filesystem
 }  // namespace utility
 }  // namespace open3d
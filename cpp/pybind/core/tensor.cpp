@@ -525,7 +525,10 @@ Example:
     tensor.def("save", &Tensor::Save, "Save tensor to Numpy's npy format.",
                "file_name"_a);
     tensor.def_static("load", &Tensor::Load,
-                      "Load tensor from Numpy's npy format.", "file_name"_a);
+                      "Load tensor from Numpy's npy format. If memory_map is "
+                      "True, the tensor refers to a copy-on-write memory "
+                      "mapping of the file instead of a copy of its data.",
+                      "file_name"_a, "memory_map"_a = false);
 
     /// Linalg operations.
     tensor.def("det", &Tensor::Det,
@@ -883,6 +886,14 @@ Ref:
     BIND_REDUCTION_OP_NO_KEEPDIM(argmin, ArgMin);
     BIND_REDUCTION_OP_NO_KEEPDIM(argmax, ArgMax);
 
+    // Sorting.
+    tensor.def("sort", &Tensor::Sort, "dim"_a = -1, "descending"_a = false,
+               "Returns the tensor stably sorted along dim.");
+    tensor.def("argsort", &Tensor::ArgSort, "dim"_a = -1,
+               "descending"_a = false,
+               "Returns the int64 indices that stably sort the tensor along "
+               "dim.");
+
     // Comparison.
     tensor.def(
             "allclose", &Tensor::AllClose, "other"_a, "rtol"_a = 1e-5,
@@ -97,6 +97,12 @@ py::array TensorToPyArray(const Tensor& tensor) {
     // https://stackoverflow.com/questions/44659924/returning-numpy-arrays-via-pybind11
     Tensor* base_tensor = new Tensor(tensor);
 
+    // The numpy array may be written at any time, so the memory is never
+    // shared copy-on-write again.
+    if (tensor.GetBlob()) {
+        tensor.GetBlob()->DisableCopyOnWrite();
+    }
+
     // See PyTorch's torch/csrc/Module.cpp
     auto capsule_destructor = [](PyObject* data) {
         Tensor* base_tensor = reinterpret_cast<Tensor*>(
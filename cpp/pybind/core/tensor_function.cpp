@@ -102,6 +102,44 @@ Example:
     [0 1 2 3 4 5]
     Tensor[shape={6}, stride={1}, Int64, CPU:0, 0x55555abc6b70])",
             "self"_a, "values"_a, "axis"_a = py::none());
+
+    m.def(
+            "unique",
+            [](const Tensor& tensor, const utility::optional<int64_t>& dim) {
+                return core::Unique(tensor, dim);
+            },
+            R"(Finds the unique elements of a tensor.
+
+Returns:
+    A tuple (unique, inverse, counts). unique holds the sorted unique elements,
+    or the unique slices along dim if dim is given. inverse holds the index
+    into unique for every element or slice, and counts the number of
+    occurrences of every unique element or slice.
+
+Example:
+    >>> o3d.core.unique(o3d.core.Tensor([3, 1, 3, 2, 1, 3]))
+    ([1 2 3], [2 0 2 1 0 2], [2 1 3]))",
+            "tensor"_a, "dim"_a = py::none());
+
+    py::enum_<SegmentReduceOp>(m, "SegmentReduceOp",
+                               "Reduction operations for segment_reduce.")
+            .value("Sum", SegmentReduceOp::Sum)
+            .value("Mean", SegmentReduceOp::Mean)
+            .value("Min", SegmentReduceOp::Min)
+            .value("Max", SegmentReduceOp::Max)
+            .export_values();
+
+    m.def("segment_reduce", &core::SegmentReduce,
+          R"(Reduces the rows of values that belong to the same segment.
+Row i belongs to segment segment_ids[i]. The segment ids do not need to be
+sorted. Returns a tensor with num_segments rows; empty segments are zero.
+
+Example:
+    >>> values = o3d.core.Tensor([1.0, 2.0, 3.0, 4.0])
+    >>> ids = o3d.core.Tensor([1, 0, 1, 0])
+    >>> o3d.core.segment_reduce(values, ids, 2, o3d.core.SegmentReduceOp.Sum)
+    [6.0 4.0])",
+          "values"_a, "segment_ids"_a, "num_segments"_a, "op"_a);
 }
 
 }  // namespace core
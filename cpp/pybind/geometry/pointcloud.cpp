@@ -104,8 +104,12 @@ void pybind_pointcloud(py::module &m) {
                  "Function to downsample input pointcloud into output "
                  "pointcloud with a set of points has farthest distance. The "
                  "sample is performed by selecting the farthest point from "
-                 "previous selected points iteratively.",
-                 "num_samples"_a)
+                 "previous selected points iteratively. If bucket_size is "
+                 "positive, points are partitioned into buckets of at most "
+                 "that many points, and buckets that cannot contain a point "
+                 "closer to a new sample are skipped, which gives the same "
+                 "result faster for large point clouds.",
+                 "num_samples"_a, "start_index"_a = 0, "bucket_size"_a = 0)
             .def("crop",
                  (std::shared_ptr<PointCloud>(PointCloud::*)(
                          const AxisAlignedBoundingBox &) const) &
@@ -210,6 +214,13 @@ Returns:
                  "algorithm.",
                  "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
                  "probability"_a = 0.99999999, "seed"_a = py::none())
+            .def("segment_planes", &PointCloud::SegmentPlanes,
+                 "Segments up to max_num_planes planes in the point cloud one "
+                 "after another using the RANSAC algorithm. Returns a list of "
+                 "plane models and inlier indices.",
+                 "distance_threshold"_a, "ransac_n"_a, "num_iterations"_a,
+                 "max_num_planes"_a, "min_num_inliers"_a = 0,
+                 "probability"_a = 0.99999999, "seed"_a = py::none())
             .def_static(
                     "create_from_depth_image",
                     &PointCloud::CreateFromDepthImage,
@@ -365,6 +376,23 @@ camera. Given depth value d at (u, v) image coordinate, the corresponding 3d poi
              {"seed",
               "Seed value used in the random generator, set to None to use a "
               "random seed value with each function call."}});
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_planes",
+            {{"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Number of iterations per plane."},
+             {"max_num_planes", "Maximum number of planes to segment."},
+             {"min_num_inliers",
+              "Segmentation stops at the first plane with fewer inliers."},
+             {"probability",
+              "Expected probability of finding the optimal plane."},
+             {"seed",
+              "Seed value used in the random generator, set to None to use a "
+              "random seed value with each function call."}});
     docstring::ClassMethodDocInject(
             m, "PointCloud", "create_from_depth_image",
             {{"depth",
@@ -28,6 +28,7 @@
 
 #include "open3d/geometry/Image.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMeshDeformation.h"
 #include "pybind/docstring.h"
 #include "pybind/geometry/geometry.h"
 #include "pybind/geometry/geometry_trampoline.h"
@@ -792,6 +793,47 @@ void pybind_trianglemesh(py::module &m) {
              {"flatness", "Controls the flatness/height of the Mobius strip."},
              {"width", "Width of the Mobius strip."},
              {"scale", "Scale the complete Mobius strip."}});
+
+    py::class_<DeformAsRigidAsPossibleSolver,
+               std::shared_ptr<DeformAsRigidAsPossibleSolver>>
+            arap_solver(m, "DeformAsRigidAsPossibleSolver",
+                        "Reusable solver for the deformation by Sorkine and "
+                        "Alexa, 'As-Rigid-As-Possible Surface Modeling', "
+                        "2007. The factorization of the system is computed "
+                        "once, and every call of deform starts from the "
+                        "previous solution.");
+    arap_solver
+            .def(py::init<const TriangleMesh &, const std::vector<int> &,
+                          MeshBase::DeformAsRigidAsPossibleEnergy, double>(),
+                 "mesh"_a, "constraint_vertex_indices"_a,
+                 "energy"_a = MeshBase::DeformAsRigidAsPossibleEnergy::Spokes,
+                 "smoothed_alpha"_a = 0.01)
+            .def("deform", &DeformAsRigidAsPossibleSolver::Deform,
+                 "Deforms the mesh so that the constrained vertices are at "
+                 "constraint_vertex_positions.",
+                 "constraint_vertex_positions"_a, "max_iter"_a)
+            .def("reset", &DeformAsRigidAsPossibleSolver::Reset,
+                 "Makes the next deform start from the rest shape.")
+            .def_property_readonly(
+                    "constraint_vertex_indices",
+                    &DeformAsRigidAsPossibleSolver::GetConstraintVertexIndices,
+                    "Indices of the constrained vertices.");
+    docstring::ClassMethodDocInject(
+            m, "DeformAsRigidAsPossibleSolver", "__init__",
+            {{"mesh", "The rest shape."},
+             {"constraint_vertex_indices",
+              "Indices of the vertices whose positions are given to deform."},
+             {"energy",
+              "Energy model that is minimized in the deformation process"},
+             {"smoothed_alpha",
+              "trade-off parameter for the smoothed energy functional for the "
+              "regularization term."}});
+    docstring::ClassMethodDocInject(
+            m, "DeformAsRigidAsPossibleSolver", "deform",
+            {{"constraint_vertex_positions",
+              "One position per constraint vertex index."},
+             {"max_iter",
+              "Maximum number of iterations to minimize energy functional."}});
 }
 
 void pybind_trianglemesh_methods(py::module &m) {}
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
@@ -62,6 +63,32 @@ The default connection class which uses a ZeroMQ socket.
                  "address"_a = "tcp://127.0.0.1:51454",
                  "connect_timeout"_a = 5000, "timeout"_a = 10000);
 
+    py::class_<rpc::AsyncConnection, std::shared_ptr<rpc::AsyncConnection>,
+               rpc::ConnectionBase>(m, "AsyncConnection", R"doc(
+A connection for streaming data which does not wait for the reply of each
+message. Up to max_in_flight messages are sent before blocking. Call flush()
+to wait for all outstanding replies.
+)doc")
+            .def(py::init([](std::string address, int connect_timeout,
+                             int timeout, int max_in_flight,
+                             bool use_compression) {
+                     return std::shared_ptr<rpc::AsyncConnection>(
+                             new rpc::AsyncConnection(
+                                     address, connect_timeout, timeout,
+                                     max_in_flight, use_compression));
+                 }),
+                 "Creates an asynchronous connection object",
+                 "address"_a = "tcp://127.0.0.1:51454",
+                 "connect_timeout"_a = 5000, "timeout"_a = 10000,
+                 "max_in_flight"_a = 8, "use_compression"_a = false)
+            .def("flush", &rpc::AsyncConnection::Flush,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Waits for the replies of all messages in flight. Returns "
+                 "False if any reply since the last flush was not OK.")
+            .def_property_readonly("num_in_flight",
+                                   &rpc::AsyncConnection::GetNumInFlight,
+                                   "Number of messages waiting for a reply.");
+
     py::class_<rpc::BufferConnection, std::shared_ptr<rpc::BufferConnection>,
                rpc::ConnectionBase>(m, "BufferConnection", R"doc(
 A connection writing to a memory buffer.
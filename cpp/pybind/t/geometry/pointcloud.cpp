@@ -194,6 +194,12 @@ The attributes of the point cloud have different levels::
             },
             "Downsamples a point cloud with a specified voxel size.",
             "voxel_size"_a);
+    pointcloud.def("farthest_point_down_sample",
+                   &PointCloud::FarthestPointDownSample,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Downsamples a point cloud by iteratively selecting the "
+                   "point farthest from all points selected so far.",
+                   "num_samples"_a, "start_index"_a = 0, "bucket_size"_a = 0);
     pointcloud.def("remove_radius_outliers", &PointCloud::RemoveRadiusOutliers,
                    "nb_points"_a, "search_radius"_a,
                    "Remove points that have less than nb_points neighbors in a "
@@ -207,6 +213,12 @@ The attributes of the point cloud have different levels::
                    "with respect to the same. It uses KNN search if only "
                    "max_nn parameter is provided, and HybridSearch if radius "
                    "parameter is also provided.");
+    pointcloud.def("orient_normals_consistent_tangent_plane",
+                   &PointCloud::OrientNormalsConsistentTangentPlane,
+                   py::call_guard<py::gil_scoped_release>(), "k"_a,
+                   "Function to orient the normals with respect to consistent "
+                   "tangent planes. Each connected component of the k nearest "
+                   "neighbor graph is oriented separately.");
     pointcloud.def("estimate_color_gradients",
                    &PointCloud::EstimateColorGradients,
                    py::call_guard<py::gil_scoped_release>(),
@@ -273,6 +285,28 @@ The attributes of the point cloud have different levels::
              {"min_points", "Minimum number of points to form a cluster."},
              {"print_progress",
               "If true the progress is visualized in the console."}});
+    pointcloud.def("segment_plane", &PointCloud::SegmentPlane,
+                   py::call_guard<py::gil_scoped_release>(),
+                   "Segments a plane in the point cloud using the RANSAC "
+                   "algorithm. Returns the plane model and the indices of "
+                   "the inliers.",
+                   "distance_threshold"_a = 0.01, "ransac_n"_a = 3,
+                   "num_iterations"_a = 100, "probability"_a = 0.99999999,
+                   "seed"_a = py::none());
+    docstring::ClassMethodDocInject(
+            m, "PointCloud", "segment_plane",
+            {{"distance_threshold",
+              "Max distance a point can be from the plane model, and still be "
+              "considered an inlier."},
+             {"ransac_n",
+              "Number of initial points to be considered inliers in each "
+              "iteration."},
+             {"num_iterations", "Maximum number of iterations."},
+             {"probability",
+              "Expected probability of finding the optimal plane."},
+             {"seed",
+              "Seed value used in the random generator, set to None to use a "
+              "random seed value with each function call."}});
     pointcloud.def(
             "compute_convex_hull", &PointCloud::ComputeConvexHull,
             "joggle_inputs"_a = false,
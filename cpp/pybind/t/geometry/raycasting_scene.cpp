@@ -26,6 +26,7 @@
 
 #include "open3d/t/geometry/RaycastingScene.h"
 #include "pybind/core/tensor_type_caster.h"
+#include "pybind11/functional.h"
 #include "pybind/t/geometry/geometry.h"
 
 namespace open3d {
@@ -105,6 +106,42 @@ Returns:
     The geometry ID of the added mesh.
 )doc");
 
+    raycasting_scene.def("commit", &RaycastingScene::Commit, R"doc(
+Builds the acceleration structure of the scene.
+
+The acceleration structure is built lazily by the first query after geometry
+has been added. Calling this function builds it eagerly, e.g., before forking
+worker processes that share the scene read-only.
+)doc");
+
+    raycasting_scene.def("save", &RaycastingScene::Save, "file_name"_a, R"doc(
+Saves the geometry of the scene to a binary file.
+
+The file starts with a versioned header followed by the geometry IDs, vertex
+positions and triangle indices of all meshes in the scene.
+
+Args:
+    file_name (str): The path of the file to write.
+)doc");
+
+    raycasting_scene.def_static("load", &RaycastingScene::Load, "file_name"_a,
+                                "use_mmap"_a = false, R"doc(
+Loads a scene previously written with save().
+
+The loaded scene assigns the same geometry IDs to its meshes as the saved scene.
+The acceleration structure is built by the first query or by calling commit().
+
+Args:
+    file_name (str): The path of the file to read.
+
+    use_mmap (bool): If True, the file is memory mapped and the vertex and
+        index buffers are used in place without copying. The read-only pages
+        are shared between all processes that map the same file.
+
+Returns:
+    The restored RaycastingScene.
+)doc");
+
     raycasting_scene.def("cast_rays", &RaycastingScene::CastRays, "rays"_a,
                          "nthreads"_a = 0,
                          R"doc(
@@ -293,6 +330,140 @@ Returns:
     or 1. A point is occupied or inside if the value is 1.
 )doc");
 
+    raycasting_scene.def(
+            "compute_signed_distance_grid",
+            py::overload_cast<const core::Tensor&, const core::Tensor&,
+                              const core::SizeVector&, const int>(
+                    &RaycastingScene::ComputeSignedDistanceGrid),
+            "min_bound"_a, "max_bound"_a, "resolution"_a, "nthreads"_a = 0,
+            R"doc(
+Computes the signed distance on a regular grid.
+
+This function computes the same values as compute_signed_distance() for the
+cell centers of a regular grid but exploits the coherence of the query points.
+The cells are processed in tiles, a single closest point query per tile bounds
+the search radius for all cells in the tile and the sign is computed once for
+tiles that do not intersect the surface.
+
+Args:
+    min_bound (open3d.core.Tensor): The minimum bound of the grid with shape
+        {3}.
+
+    max_bound (open3d.core.Tensor): The maximum bound of the grid with shape
+        {3}.
+
+    resolution (open3d.core.SizeVector): The number of cells along each axis
+        [nx, ny, nz]. The query point of the cell with index (i,j,k) is
+        min_bound + ((i,j,k) + 0.5) * (max_bound - min_bound) / resolution.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    A tensor with the signed distances with shape {nx, ny, nz}.
+)doc");
+
+    raycasting_scene.def(
+            "compute_signed_distance_grid",
+            py::overload_cast<
+                    const core::Tensor&, const core::Tensor&,
+                    const core::SizeVector&,
+                    const std::function<void(int64_t, const core::Tensor&)>&,
+                    const int64_t, const int>(
+                    &RaycastingScene::ComputeSignedDistanceGrid),
+            "min_bound"_a, "max_bound"_a, "resolution"_a, "callback"_a,
+            "chunk_size"_a = 64, "nthreads"_a = 0,
+            R"doc(
+Computes the signed distance on a regular grid in chunks.
+
+Same as above but the result is passed chunk by chunk to the callback such that
+only a single chunk is kept in memory.
+
+Args:
+    min_bound (open3d.core.Tensor): The minimum bound of the grid with shape
+        {3}.
+
+    max_bound (open3d.core.Tensor): The maximum bound of the grid with shape
+        {3}.
+
+    resolution (open3d.core.SizeVector): The number of cells along each axis
+        [nx, ny, nz].
+
+    callback (Callable[[int, open3d.core.Tensor], None]): The function called
+        for each chunk with the index of the first slice along the x axis and
+        the signed distances of the chunk with shape {chunk_size, ny, nz}. The
+        last chunk may be smaller.
+
+    chunk_size (int): The number of slices along the x axis per chunk.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+)doc");
+
+    raycasting_scene.def(
+            "compute_occupancy_grid",
+            py::overload_cast<const core::Tensor&, const core::Tensor&,
+                              const core::SizeVector&, const int>(
+                    &RaycastingScene::ComputeOccupancyGrid),
+            "min_bound"_a, "max_bound"_a, "resolution"_a, "nthreads"_a = 0,
+            R"doc(
+Computes the occupancy on a regular grid.
+
+This function computes the same values as compute_occupancy() for the cell
+centers of a regular grid. Tiles of cells that do not intersect the surface are
+classified with a single query.
+
+Args:
+    min_bound (open3d.core.Tensor): The minimum bound of the grid with shape
+        {3}.
+
+    max_bound (open3d.core.Tensor): The maximum bound of the grid with shape
+        {3}.
+
+    resolution (open3d.core.SizeVector): The number of cells along each axis
+        [nx, ny, nz]. The query point of the cell with index (i,j,k) is
+        min_bound + ((i,j,k) + 0.5) * (max_bound - min_bound) / resolution.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+
+Returns:
+    A tensor with the occupancy values with shape {nx, ny, nz}.
+)doc");
+
+    raycasting_scene.def(
+            "compute_occupancy_grid",
+            py::overload_cast<
+                    const core::Tensor&, const core::Tensor&,
+                    const core::SizeVector&,
+                    const std::function<void(int64_t, const core::Tensor&)>&,
+                    const int64_t, const int>(
+                    &RaycastingScene::ComputeOccupancyGrid),
+            "min_bound"_a, "max_bound"_a, "resolution"_a, "callback"_a,
+            "chunk_size"_a = 64, "nthreads"_a = 0,
+            R"doc(
+Computes the occupancy on a regular grid in chunks.
+
+Same as above but the result is passed chunk by chunk to the callback such that
+only a single chunk is kept in memory.
+
+Args:
+    min_bound (open3d.core.Tensor): The minimum bound of the grid with shape
+        {3}.
+
+    max_bound (open3d.core.Tensor): The maximum bound of the grid with shape
+        {3}.
+
+    resolution (open3d.core.SizeVector): The number of cells along each axis
+        [nx, ny, nz].
+
+    callback (Callable[[int, open3d.core.Tensor], None]): The function called
+        for each chunk with the index of the first slice along the x axis and
+        the occupancy values of the chunk with shape {chunk_size, ny, nz}. The
+        last chunk may be smaller.
+
+    chunk_size (int): The number of slices along the x axis per chunk.
+
+    nthreads (int): The number of threads to use. Set to 0 for automatic.
+)doc");
+
     raycasting_scene.def_static(
             "create_rays_pinhole",
             py::overload_cast<const core::Tensor&, const core::Tensor&, int,
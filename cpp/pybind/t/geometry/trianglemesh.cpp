@@ -30,6 +30,7 @@
 #include <unordered_map>
 
 #include "open3d/core/CUDAUtils.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "pybind/t/geometry/geometry.h"
 
 namespace open3d {
@@ -189,6 +190,48 @@ Example:
             "vertex_dtype"_a = core::Float32, "triangle_dtype"_a = core::Int64,
             "device"_a = core::Device("CPU:0"),
             "Create a TriangleMesh from a legacy Open3D TriangleMesh.");
+    triangle_mesh.def_static(
+            "create_from_point_cloud_poisson",
+            &TriangleMesh::CreateFromPointCloudPoisson, "pcd"_a, "depth"_a = 8,
+            "width"_a = 0, "scale"_a = 1.1, "linear_fit"_a = false,
+            "n_threads"_a = -1, "max_memory_mb"_a = 0.0,
+            R"(Computes a triangle mesh from an oriented point cloud with the
+Screened Poisson Reconstruction of Kazhdan and Hoppe, "Screened Poisson Surface
+Reconstruction", 2013. This runs on the CPU. Contiguous float32 or float64 CPU
+positions, normals and colors are read in place without copying.
+
+Args:
+    pcd (open3d.t.geometry.PointCloud): Point cloud with normals and
+        optionally colors.
+    depth (int): Maximum depth of the tree that will be used for surface
+        reconstruction.
+    width (float): Target width of the finest level octree cells. Ignored if
+        depth is specified.
+    scale (float): Ratio between the diameter of the cube used for
+        reconstruction and the diameter of the samples' bounding cube.
+    linear_fit (bool): Use linear interpolation to estimate the positions of
+        iso-vertices.
+    n_threads (int): Number of threads, -1 to use all hardware threads.
+    max_memory_mb (float): Abort once the process memory sampled after a
+        solver stage exceeds this many MB. No limit if <= 0.
+
+Returns:
+    Tuple of the mesh, on the device of pcd, with the vertex attribute
+    "densities", and a list of (stage, seconds) tuples with the wall time of
+    every solver stage in execution order, ending with the "total" run.
+
+Example:
+
+    This code reconstructs a mesh and masks out the low density vertices::
+
+        import numpy as np
+        pcd = o3d.t.io.read_point_cloud(o3d.data.EaglePointCloud().path)
+        mesh, timings = o3d.t.geometry.TriangleMesh.create_from_point_cloud_poisson(
+            pcd, depth=9)
+        densities = mesh.vertex["densities"].numpy()
+        mask = densities > np.quantile(densities, 0.05)
+)");
+
     // conversion
     triangle_mesh.def("to_legacy", &TriangleMesh::ToLegacy,
                       "Convert to a legacy Open3D TriangleMesh.");
@@ -221,6 +264,40 @@ This example shows how to create a hemisphere from a sphere::
 
     o3d.visualization.draw(hemisphere)
 )");
+
+    triangle_mesh.def(
+            "filter_sharpen", &TriangleMesh::FilterSharpen,
+            "number_of_iterations"_a = 1, "strength"_a = 1.0,
+            "Sharpens the vertex positions, and the vertex normals and colors "
+            "with the dtype of the positions. Returns a new mesh.");
+    triangle_mesh.def(
+            "filter_smooth_simple", &TriangleMesh::FilterSmoothSimple,
+            "number_of_iterations"_a = 1,
+            "Smooths the mesh with the average of every vertex and its "
+            "neighbours. Returns a new mesh.");
+    triangle_mesh.def(
+            "filter_smooth_laplacian", &TriangleMesh::FilterSmoothLaplacian,
+            "number_of_iterations"_a = 1, "lambda_filter"_a = 0.5,
+            "Smooths the mesh with the inverse distance weighted Laplacian. "
+            "Returns a new mesh.");
+    triangle_mesh.def("filter_smooth_taubin", &TriangleMesh::FilterSmoothTaubin,
+                      "number_of_iterations"_a = 1, "lambda_filter"_a = 0.5,
+                      "mu"_a = -0.53,
+                      "Smooths the mesh with the method of Taubin, which "
+                      "avoids shrinkage. Returns a new mesh.");
+    triangle_mesh.def("subdivide_loop", &TriangleMesh::SubdivideLoop,
+                      "number_of_iterations"_a = 1,
+                      "Subdivides the mesh with Loop's algorithm. Every "
+                      "iteration splits each triangle into four. Returns a "
+                      "new mesh.");
+    triangle_mesh.def(
+            "sample_points_poisson_disk",
+            &TriangleMesh::SamplePointsPoissonDisk, "number_of_points"_a,
+            "init_factor"_a = 5, "use_triangle_normal"_a = false,
+            "seed"_a = -1,
+            "Samples points from the mesh with Poisson disk sampling by "
+            "eliminating samples from a uniformly sampled point cloud. Runs "
+            "on the CPU and returns a point cloud on the device of the mesh.");
 }
 
 }  // namespace geometry
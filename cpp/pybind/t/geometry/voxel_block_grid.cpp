@@ -142,6 +142,18 @@ void pybind_voxel_block_grid(py::module& m) {
             "Obtain active block coordinates from a point cloud.", "pcd"_a,
             "trunc_voxel_multiplier"_a = 8.0);
 
+    vbg.def("compute_unique_block_coordinates",
+            py::overload_cast<const std::vector<Image>&, const core::Tensor&,
+                              const std::vector<core::Tensor>&, float, float,
+                              float>(
+                    &VoxelBlockGrid::GetUniqueBlockCoordinates),
+            "Obtain the union of active block coordinates touched by a list "
+            "of depth images, each with its own extrinsic. Duplicates across "
+            "frames are removed.",
+            "depths"_a, "intrinsic"_a, "extrinsics"_a,
+            "depth_scale"_a = 1000.0f, "depth_max"_a = 3.0f,
+            "trunc_voxel_multiplier"_a = 8.0);
+
     vbg.def("integrate",
             py::overload_cast<const core::Tensor&, const Image&, const Image&,
                               const core::Tensor&, const core::Tensor&,
@@ -179,6 +191,24 @@ void pybind_voxel_block_grid(py::module& m) {
             "depth_max"_a.noconvert() = 3.0f,
             "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
 
+    vbg.def("integrate",
+            py::overload_cast<const core::Tensor&, const std::vector<Image>&,
+                              const std::vector<Image>&, const core::Tensor&,
+                              const core::Tensor&,
+                              const std::vector<core::Tensor>&, float, float,
+                              float>(&VoxelBlockGrid::Integrate),
+            "Specific operation for TSDF volumes."
+            "Integrate a batch of RGB-D frames in the selected block "
+            "coordinates. Blocks are activated once for the batch and each "
+            "voxel fuses the frames in order, matching frame-by-frame "
+            "integration. Pass an empty color list for depth-only "
+            "integration.",
+            "block_coords"_a, "depths"_a, "colors"_a, "depth_intrinsic"_a,
+            "color_intrinsic"_a, "extrinsics"_a,
+            "depth_scale"_a.noconvert() = 1000.0f,
+            "depth_max"_a.noconvert() = 3.0f,
+            "trunc_voxel_multiplier"_a.noconvert() = 8.0f);
+
     vbg.def("ray_cast", &VoxelBlockGrid::RayCast,
             "Specific operation for TSDF volumes."
             "Perform volumetric ray casting in the selected block coordinates."
@@ -193,16 +223,60 @@ void pybind_voxel_block_grid(py::module& m) {
             "depth_max"_a = 3.0f, "weight_threshold"_a = 3.0f,
             "trunc_voxel_multiplier"_a = 8.0f, "range_map_down_factor"_a = 8);
 
-    vbg.def("extract_point_cloud", &VoxelBlockGrid::ExtractPointCloud,
+    vbg.def("extract_point_cloud",
+            py::overload_cast<float, int>(&VoxelBlockGrid::ExtractPointCloud),
             "Specific operation for TSDF volumes."
             "Extract point cloud at isosurface points.",
             "weight_threshold"_a = 3.0f, "estimated_point_number"_a = -1);
 
-    vbg.def("extract_triangle_mesh", &VoxelBlockGrid::ExtractTriangleMesh,
+    vbg.def("extract_point_cloud",
+            py::overload_cast<const core::Tensor&, float, int>(
+                    &VoxelBlockGrid::ExtractPointCloud),
+            "Specific operation for TSDF volumes."
+            "Extract point cloud at isosurface points in the given blocks.",
+            "block_coords"_a, "weight_threshold"_a = 3.0f,
+            "estimated_point_number"_a = -1);
+
+    vbg.def("extract_triangle_mesh",
+            py::overload_cast<float, int>(&VoxelBlockGrid::ExtractTriangleMesh),
             "Specific operation for TSDF volumes."
             "Extract triangle mesh at isosurface points.",
             "weight_threshold"_a = 3.0f, "estimated_vertex_number"_a = -1);
 
+    vbg.def("extract_triangle_mesh",
+            py::overload_cast<const core::Tensor&, float, int>(
+                    &VoxelBlockGrid::ExtractTriangleMesh),
+            "Specific operation for TSDF volumes."
+            "Extract triangle mesh at isosurface points in the given blocks. "
+            "The triangle attribute 'block_coords' stores the block owning "
+            "each triangle.",
+            "block_coords"_a, "weight_threshold"_a = 3.0f,
+            "estimated_vertex_number"_a = -1);
+
+    vbg.def("extract_triangle_mesh_update",
+            &VoxelBlockGrid::ExtractTriangleMeshUpdate,
+            "Specific operation for TSDF volumes."
+            "Re-mesh the blocks whose surface may have changed since the last "
+            "call, i.e. the dirty blocks and their neighbors, then clear the "
+            "dirty blocks. Returns the mesh patch and the (M, 3) coordinates "
+            "of the re-meshed blocks, whose chunks the patch replaces.",
+            "weight_threshold"_a = 3.0f, "estimated_vertex_number"_a = -1);
+
+    vbg.def("mark_blocks_dirty", &VoxelBlockGrid::MarkBlocksDirty,
+            "Mark blocks as modified. Integration marks its blocks "
+            "automatically.",
+            "block_coords"_a);
+
+    vbg.def("get_dirty_block_coordinates",
+            &VoxelBlockGrid::GetDirtyBlockCoordinates,
+            "Get the coordinates of the blocks modified since the last "
+            "clear_dirty_blocks or extract_triangle_mesh_update, optionally "
+            "with their active neighbors.",
+            "include_neighbors"_a = false);
+
+    vbg.def("clear_dirty_blocks", &VoxelBlockGrid::ClearDirtyBlocks,
+            "Reset dirty block tracking.");
+
     vbg.def("save", &VoxelBlockGrid::Save,
             "Save the voxel block grid to a npz file."
             "file_name"_a);
@@ -27,6 +27,7 @@
 #include <memory>
 
 #include "open3d/geometry/RGBDImage.h"
+#include "open3d/t/io/sensor/RGBDImageSequenceReader.h"
 #include "open3d/t/io/sensor/RGBDSensor.h"
 #include "open3d/t/io/sensor/RGBDVideoReader.h"
 #ifdef BUILD_LIBREALSENSE
@@ -56,7 +57,10 @@ void pybind_sensor(py::module &m) {
                      "(default video length) Save frames till this time (us)"},
                     {"buffer_size",
                      "Size of internal frame buffer, increase this if you "
-                     "experience frame drops."}};
+                     "experience frame drops."},
+                    {"num_workers",
+                     "Number of threads decoding frames ahead of the "
+                     "consumer."}};
 
     py::enum_<SensorType>(m, "SensorType", "Sensor type")
             .value("AZURE_KINECT", SensorType::AZURE_KINECT)
@@ -97,6 +101,38 @@ void pybind_sensor(py::module &m) {
                            "Number of color channels.")
             .def("__repr__", &RGBDVideoMetadata::ToString);
 
+    // Class RGBD video reader statistics
+    py::class_<RGBDVideoReaderStatistics> rgbd_video_reader_statistics(
+            m, "RGBDVideoReaderStatistics",
+            "Decode and playback statistics of an RGBD video reader.");
+    rgbd_video_reader_statistics.def(py::init<>())
+            .def_readwrite("num_frames_decoded",
+                           &RGBDVideoReaderStatistics::num_frames_decoded_,
+                           "Number of frames decoded, including frames "
+                           "discarded by a seek.")
+            .def_readwrite("decode_time",
+                           &RGBDVideoReaderStatistics::decode_time_,
+                           "Time (s) spent decoding frames, summed over all "
+                           "decode workers.")
+            .def_readwrite("num_frames_read",
+                           &RGBDVideoReaderStatistics::num_frames_read_,
+                           "Number of frames returned to the consumer.")
+            .def_readwrite("num_stalls",
+                           &RGBDVideoReaderStatistics::num_stalls_,
+                           "Number of frames the consumer had to wait for.")
+            .def_readwrite("stall_time",
+                           &RGBDVideoReaderStatistics::stall_time_,
+                           "Time (s) the consumer spent waiting for frames to "
+                           "be decoded.")
+            .def_readwrite("elapsed_time",
+                           &RGBDVideoReaderStatistics::elapsed_time_,
+                           "Wall time (s) since the video was opened.")
+            .def_property_readonly(
+                    "decode_throughput",
+                    &RGBDVideoReaderStatistics::GetDecodeThroughput,
+                    "Frames decoded per second of wall time.")
+            .def("__repr__", &RGBDVideoReaderStatistics::ToString);
+
     // RGBD video reader trampoline
     class PyRGBDVideoReader : public RGBDVideoReader {
     public:
@@ -155,12 +191,78 @@ void pybind_sensor(py::module &m) {
                  "start_time_us"_a = 0, "end_time_us"_a = UINT64_MAX,
                  "Save synchronized and aligned individual frames to "
                  "subfolders.")
+            .def("get_statistics", &RGBDVideoReader::GetStatistics,
+                 "Get decode throughput and consumer stall statistics.")
             .def("__repr__", &RGBDVideoReader::ToString);
     docstring::ClassMethodDocInject(m, "RGBDVideoReader", "create",
                                     map_shared_argument_docstrings);
     docstring::ClassMethodDocInject(m, "RGBDVideoReader", "save_frames",
                                     map_shared_argument_docstrings);
 
+    // Class RGBD image sequence reader
+    py::class_<RGBDImageSequenceReader,
+               std::unique_ptr<RGBDImageSequenceReader>, RGBDVideoReader>
+            rgbd_image_sequence_reader(
+                    m, "RGBDImageSequenceReader",
+                    "Reader for RGBD datasets stored as a directory of "
+                    "images.\n"
+                    "The directory must contain a 'depth' subfolder with 16 "
+                    "bit PNG depth images and a 'color', 'image' or 'rgb' "
+                    "subfolder with JPG or PNG color images, paired in sorted "
+                    "filename order. Metadata is read from 'intrinsic.json' if "
+                    "present. Frames are decoded ahead of the consumer on a "
+                    "pool of worker threads.");
+    rgbd_image_sequence_reader
+            .def(py::init<size_t, size_t, double>(),
+                 "buffer_size"_a = RGBDImageSequenceReader::DEFAULT_BUFFER_SIZE,
+                 "num_workers"_a = 0, "fps"_a = 30.0)
+            .def("is_opened", &RGBDImageSequenceReader::IsOpened,
+                 "Check if the image sequence is opened.")
+            .def("open", &RGBDImageSequenceReader::Open,
+                 py::call_guard<py::gil_scoped_release>(), "filename"_a,
+                 "Open an image sequence directory.")
+            .def("close", &RGBDImageSequenceReader::Close,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Close the opened image sequence.")
+            .def("is_eof", &RGBDImageSequenceReader::IsEOF,
+                 "Check if the image sequence is all read.")
+            .def_property(
+                    "metadata",
+                    py::overload_cast<>(&RGBDImageSequenceReader::GetMetadata,
+                                        py::const_),
+                    py::overload_cast<>(&RGBDImageSequenceReader::GetMetadata),
+                    "Get metadata of the image sequence.")
+            .def("seek_timestamp", &RGBDImageSequenceReader::SeekTimestamp,
+                 py::call_guard<py::gil_scoped_release>(), "timestamp"_a,
+                 "Seek to the timestamp (in us).")
+            .def("get_timestamp", &RGBDImageSequenceReader::GetTimestamp,
+                 "Get current timestamp (in us).")
+            .def("next_frame", &RGBDImageSequenceReader::NextFrame,
+                 py::call_guard<py::gil_scoped_release>(),
+                 "Get next frame from the image sequence and returns the RGBD "
+                 "object.")
+            .def("get_num_frames", &RGBDImageSequenceReader::GetNumFrames,
+                 "Number of frames in the image sequence.")
+            .def("get_statistics", &RGBDImageSequenceReader::GetStatistics,
+                 "Get decode throughput and consumer stall statistics since "
+                 "open().")
+            .def("__repr__", &RGBDImageSequenceReader::ToString);
+    docstring::ClassMethodDocInject(
+            m, "RGBDImageSequenceReader", "__init__",
+            {{"buffer_size", "Max number of decoded frames to buffer."},
+             {"num_workers",
+              "Number of decode worker threads. 0 uses one worker per "
+              "hardware thread."},
+             {"fps",
+              "Frame rate of the sequence, used for timestamps if the "
+              "directory has no 'intrinsic.json'."}});
+    docstring::ClassMethodDocInject(m, "RGBDImageSequenceReader", "open",
+                                    {{"filename", "Path to the dataset "
+                                                  "directory."}});
+    docstring::ClassMethodDocInject(m, "RGBDImageSequenceReader",
+                                    "seek_timestamp",
+                                    map_shared_argument_docstrings);
+
     // Class RGBD sensor
     py::class_<RGBDSensor> rgbd_sensor(
             m, "RGBDSensor", "Interface class for control of RGBD cameras.");
@@ -191,8 +293,9 @@ void pybind_sensor(py::module &m) {
                     "takes a long time (>10 frame intervals) to process a "
                     "frame.");
     rs_bag_reader.def(py::init<>())
-            .def(py::init<size_t>(),
-                 "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE)
+            .def(py::init<size_t, size_t>(),
+                 "buffer_size"_a = RSBagReader::DEFAULT_BUFFER_SIZE,
+                 "num_workers"_a = 1)
             .def("is_opened", &RSBagReader::IsOpened,
                  "Check if the RS bag file  is opened.")
             .def("open", &RSBagReader::Open,
@@ -212,6 +315,9 @@ void pybind_sensor(py::module &m) {
                  "Seek to the timestamp (in us).")
             .def("get_timestamp", &RSBagReader::GetTimestamp,
                  "Get current timestamp (in us).")
+            .def("get_statistics", &RSBagReader::GetStatistics,
+                 "Get decode throughput and consumer stall statistics since "
+                 "open().")
             .def("next_frame", &RSBagReader::NextFrame,
                  py::call_guard<py::gil_scoped_release>(),
                  "Get next frame from the RS bag playback and returns the RGBD "
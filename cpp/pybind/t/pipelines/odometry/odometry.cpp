@@ -126,6 +126,37 @@ void pybind_odometry_classes(py::module &m) {
                         olp.depth_outlier_trunc_, olp.depth_huber_delta_,
                         olp.intensity_huber_delta_);
             });
+
+    // open3d.t.pipelines.odometry.RGBDOdometryFrame
+    py::class_<RGBDOdometryFrame> rgbd_odometry_frame(
+            m, "RGBDOdometryFrame",
+            "RGBD image with the image pyramid and derived maps used by RGBD "
+            "odometry, computed on first use and cached. Pass the target "
+            "frame of one odometry call as the source frame of the next call "
+            "to avoid computing its pyramid twice. Level 0 has the input "
+            "resolution, each further level halves the resolution.");
+    rgbd_odometry_frame
+            .def(py::init<const t::geometry::RGBDImage &, const core::Tensor &,
+                          float, float, float>(),
+                 "rgbd"_a, "intrinsics"_a, "depth_scale"_a = 1000.0f,
+                 "depth_max"_a = 3.0f, "depth_outlier_trunc"_a = 0.07f)
+            .def_property_readonly("device", &RGBDOdometryFrame::GetDevice)
+            .def_property_readonly("depth_outlier_trunc",
+                                   &RGBDOdometryFrame::GetDepthOutlierTrunc)
+            .def("get_intrinsics", &RGBDOdometryFrame::GetIntrinsics,
+                 "level"_a)
+            .def("get_depth", &RGBDOdometryFrame::GetDepth, "level"_a)
+            .def("get_intensity", &RGBDOdometryFrame::GetIntensity, "level"_a)
+            .def("get_vertex_map", &RGBDOdometryFrame::GetVertexMap, "level"_a)
+            .def("get_normal_map", &RGBDOdometryFrame::GetNormalMap, "level"_a)
+            .def("get_num_cached_levels",
+                 &RGBDOdometryFrame::GetNumCachedLevels)
+            .def("__repr__", [](const RGBDOdometryFrame &frame) {
+                return fmt::format(
+                        "RGBDOdometryFrame[device={}, cached_levels={}].",
+                        frame.GetDevice().ToString(),
+                        frame.GetNumCachedLevels());
+            });
 }
 
 // Odometry functions have similar arguments, sharing arg docstrings.
@@ -191,7 +222,14 @@ static const std::unordered_map<std::string, std::string>
                  "by CreateVertexMap before calling this function."}};
 
 void pybind_odometry_methods(py::module &m) {
-    m.def("rgbd_odometry_multi_scale", &RGBDOdometryMultiScale,
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<const t::geometry::RGBDImage &,
+                            const t::geometry::RGBDImage &,
+                            const core::Tensor &, const core::Tensor &,
+                            const float, const float,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
           py::call_guard<py::gil_scoped_release>(),
           "Function for Multi Scale RGBD odometry.", "source"_a, "target"_a,
           "intrinsics"_a,
@@ -201,6 +239,21 @@ void pybind_odometry_methods(py::module &m) {
           "criteria_list"_a =
                   std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
           "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
+    m.def("rgbd_odometry_multi_scale",
+          py::overload_cast<RGBDOdometryFrame &, RGBDOdometryFrame &,
+                            const core::Tensor &,
+                            const std::vector<OdometryConvergenceCriteria> &,
+                            const Method, const OdometryLossParams &>(
+                  &RGBDOdometryMultiScale),
+          py::call_guard<py::gil_scoped_release>(),
+          "Function for Multi Scale RGBD odometry on odometry frames, which "
+          "cache their image pyramids across calls.",
+          "source"_a, "target"_a,
+          "init_source_to_target"_a =
+                  core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
+          "criteria_list"_a =
+                  std::vector<OdometryConvergenceCriteria>({10, 5, 3}),
+          "method"_a = Method::Hybrid, "params"_a = OdometryLossParams());
     docstring::FunctionDocInject(m, "rgbd_odometry_multi_scale",
                                  map_shared_argument_docstrings);
 
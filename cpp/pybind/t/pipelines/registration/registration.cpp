@@ -296,7 +296,14 @@ static const std::unordered_map<std::string, std::string>
                  "Optional lambda function, saves string to tensor map of "
                  "attributes such as iteration_index, scale_index, "
                  "scale_iteration_index, inlier_rmse, fitness, transformation, "
-                 "on CPU device, updated after each iteration."}};
+                 "on CPU device, updated after each iteration."},
+                {"correspondence_cache_tolerance",
+                 "If non-negative, correspondences are cached between "
+                 "iterations, and only the source points that moved farther "
+                 "than their search bound plus this distance are searched "
+                 "again. 0 gives the same correspondences as a full search, "
+                 "larger values trade accuracy for speed. A negative value "
+                 "disables the cache."}};
 
 void pybind_registration_methods(py::module &m) {
     m.def("evaluate_registration", &EvaluateRegistration,
@@ -314,7 +321,8 @@ void pybind_registration_methods(py::module &m) {
                   core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
           "estimation_method"_a = TransformationEstimationPointToPoint(),
           "criteria"_a = ICPConvergenceCriteria(), "voxel_size"_a = -1.0,
-          "callback_after_iteration"_a = py::none());
+          "callback_after_iteration"_a = py::none(),
+          "correspondence_cache_tolerance"_a = -1.0);
     docstring::FunctionDocInject(m, "icp", map_shared_argument_docstrings);
 
     m.def("multi_scale_icp", &MultiScaleICP,
@@ -324,7 +332,8 @@ void pybind_registration_methods(py::module &m) {
           "init_source_to_target"_a =
                   core::Tensor::Eye(4, core::Float64, core::Device("CPU:0")),
           "estimation_method"_a = TransformationEstimationPointToPoint(),
-          "callback_after_iteration"_a = py::none());
+          "callback_after_iteration"_a = py::none(),
+          "correspondence_cache_tolerance"_a = -1.0);
     docstring::FunctionDocInject(m, "multi_scale_icp",
                                  map_shared_argument_docstrings);
 
@@ -26,6 +26,10 @@
 
 #include "open3d/core/Blob.h"
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+
 #include "open3d/core/Device.h"
 #include "open3d/core/MemoryManager.h"
 #include "tests/Tests.h"
@@ -64,5 +68,76 @@ TEST_P(BlobPermuteDevices, BlobConstructorWithExternalMemory) {
     EXPECT_TRUE(deleter_called);
 }
 
+TEST_P(BlobPermuteDevices, ShareCopyOnWrite) {
+    core::Device device = GetParam();
+
+    auto blob = std::make_shared<core::Blob>(4, device);
+    EXPECT_EQ(blob->GetByteSize(), 4);
+    if (device.GetType() != core::Device::DeviceType::CPU) {
+        EXPECT_EQ(blob->ShareCopyOnWrite(), nullptr);
+        return;
+    }
+    std::memset(blob->GetDataPtr(), 1, 4);
+
+    std::shared_ptr<core::Blob> shared_blob = blob->ShareCopyOnWrite();
+    ASSERT_NE(shared_blob, nullptr);
+    const core::Blob& blob_const = *blob;
+    const core::Blob& shared_blob_const = *shared_blob;
+    EXPECT_EQ(blob_const.GetDataPtr(), shared_blob_const.GetDataPtr());
+
+    // The writer gets its own copy of the memory.
+    std::memset(shared_blob->GetDataPtr(), 2, 4);
+    EXPECT_NE(blob_const.GetDataPtr(), shared_blob_const.GetDataPtr());
+    EXPECT_EQ(static_cast<const char*>(blob_const.GetDataPtr())[3], 1);
+    EXPECT_EQ(static_cast<const char*>(shared_blob_const.GetDataPtr())[3], 2);
+
+    // The last owner keeps the memory without copying.
+    const void* data_ptr = blob_const.GetDataPtr();
+    EXPECT_TRUE(blob->IsShared());
+    EXPECT_EQ(blob->GetDataPtr(), data_ptr);
+    EXPECT_FALSE(blob->IsShared());
+
+    // Externally managed memory and disabled blobs are never shared.
+    int value = 0;
+    core::Blob external_blob(device, &value, [](void*) {});
+    EXPECT_EQ(external_blob.GetByteSize(), -1);
+    EXPECT_EQ(external_blob.ShareCopyOnWrite(), nullptr);
+    blob->DisableCopyOnWrite();
+    EXPECT_EQ(blob->ShareCopyOnWrite(), nullptr);
+}
+
+TEST(Blob, DetachWhileReading) {
+    const core::Device device("CPU:0");
+    const int64_t byte_size = 1 << 16;
+    auto blob = std::make_shared<core::Blob>(byte_size, device);
+    std::memset(blob->GetDataPtr(), 1, byte_size);
+
+    for (int i = 0; i < 100; ++i) {
+        std::shared_ptr<core::Blob> shared_blob = blob->ShareCopyOnWrite();
+        ASSERT_NE(shared_blob, nullptr);
+        // A second view of the shared Blob, e.g. another Tensor referencing
+        // it, is read while the shared Blob is detached by a writer.
+        const std::shared_ptr<core::Blob> view = shared_blob;
+        const void* shared_ptr =
+                static_cast<const core::Blob&>(*blob).GetDataPtr();
+        std::atomic<bool> detached(false);
+        std::thread reader([&]() {
+            bool correct = true;
+            do {
+                const char* data = static_cast<const char*>(
+                        static_cast<const core::Blob&>(*view).GetDataPtr());
+                correct = correct && data[0] == 1 && data[byte_size - 1] == 1;
+            } while (!detached.load());
+            EXPECT_TRUE(correct);
+        });
+        void* detached_ptr = shared_blob->GetDataPtr();
+        detached.store(true);
+        reader.join();
+        EXPECT_NE(detached_ptr, shared_ptr);
+        EXPECT_EQ(static_cast<const core::Blob&>(*view).GetDataPtr(),
+                  detached_ptr);
+    }
+}
+
 }  // namespace tests
 }  // namespace open3d
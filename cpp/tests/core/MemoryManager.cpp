@@ -29,6 +29,7 @@
 #include <map>
 
 #include "open3d/core/Device.h"
+#include "open3d/core/MemoryManagerStatistic.h"
 #include "tests/Tests.h"
 #include "tests/core/CoreTest.h"
 
@@ -138,6 +139,44 @@ TEST_P(MemoryManagerPermuteDevices, MallocFree) {
     core::MemoryManager::Free(ptr, device);
 }
 
+TEST_P(MemoryManagerPermuteDevices, OwnerStatistics) {
+    core::Device device = GetParam();
+    core::MemoryManagerStatistic& statistic =
+            core::MemoryManagerStatistic::GetInstance();
+
+    void* untagged_ptr = core::MemoryManager::Malloc(10, device);
+    void* ptr_a;
+    void* ptr_b;
+    void* ptr_c;
+    {
+        core::MemoryManagerStatistic::ScopedOwner owner_a("a");
+        ptr_a = core::MemoryManager::Malloc(10, device);
+        {
+            core::MemoryManagerStatistic::ScopedOwner owner_b("b");
+            ptr_b = core::MemoryManager::Malloc(20, device);
+        }
+        ptr_c = core::MemoryManager::Malloc(30, device);
+    }
+
+    auto owners = statistic.GetOwnerStatistics(device);
+    ASSERT_EQ(owners.size(), 2);
+    EXPECT_EQ(owners.at("a").count_active_, 2);
+    EXPECT_EQ(owners.at("a").byte_size_, 40);
+    EXPECT_EQ(owners.at("b").count_active_, 1);
+    EXPECT_EQ(owners.at("b").byte_size_, 20);
+
+    core::MemoryManager::Free(ptr_a, device);
+    core::MemoryManager::Free(ptr_b, device);
+    owners = statistic.GetOwnerStatistics(device);
+    ASSERT_EQ(owners.size(), 1);
+    EXPECT_EQ(owners.at("a").count_active_, 1);
+    EXPECT_EQ(owners.at("a").byte_size_, 30);
+
+    core::MemoryManager::Free(ptr_c, device);
+    core::MemoryManager::Free(untagged_ptr, device);
+    EXPECT_TRUE(statistic.GetOwnerStatistics(device).empty());
+}
+
 TEST_P(MemoryManagerPermuteDevicePairs, Memcpy) {
     core::Device dst_device;
     core::Device src_device;
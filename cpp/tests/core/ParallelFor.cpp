@@ -56,6 +56,18 @@ TEST(ParallelFor, LambdaCPU) {
     }
 }
 
+TEST(ParallelFor, LambdaSerialOrParallelCPU) {
+    const int64_t min_parallel = core::OPEN3D_PARFOR_MIN_PARALLEL_WORKLOADS;
+    for (const int64_t n : {int64_t(0), int64_t(1), min_parallel - 1,
+                            min_parallel * 4}) {
+        std::vector<int64_t> v(n, -1);
+        core::ParallelForCPU(n, [&](int64_t idx) { v[idx] = idx; });
+        for (int64_t i = 0; i < n; ++i) {
+            ASSERT_EQ(v[i], i);
+        }
+    }
+}
+
 TEST(ParallelFor, VectorizedLambda1) {
     const size_t N = 10000000;
     std::vector<int64_t> v(N);
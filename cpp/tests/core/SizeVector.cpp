@@ -26,6 +26,8 @@
 
 #include "open3d/core/SizeVector.h"
 
+#include <vector>
+
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -44,5 +46,51 @@ TEST(DynamicSizeVector, IsCompatible) {
     EXPECT_FALSE(core::SizeVector({10, 3}).IsCompatible({utility::nullopt, 5}));
 }
 
+TEST(SizeVector, InlineStorage) {
+    core::SizeVector sv;
+    for (int64_t i = 0; i < core::MAX_DIMS; ++i) {
+        sv.push_back(i);
+    }
+    EXPECT_TRUE(sv.IsInline());
+
+    // Growing past MAX_DIMS moves the elements to the heap.
+    sv.push_back(core::MAX_DIMS);
+    EXPECT_FALSE(sv.IsInline());
+    EXPECT_EQ(sv.size(), core::MAX_DIMS + 1);
+    for (int64_t i = 0; i <= core::MAX_DIMS; ++i) {
+        EXPECT_EQ(sv[i], i);
+    }
+
+    // Copies and moves keep the values independent of the storage.
+    core::SizeVector sv_copy = sv;
+    EXPECT_EQ(sv_copy, sv);
+    core::SizeVector sv_moved = std::move(sv_copy);
+    EXPECT_EQ(sv_moved, sv);
+    sv_moved.resize(2);
+    sv_moved.shrink_to_fit();
+    EXPECT_TRUE(sv_moved.IsInline());
+    EXPECT_EQ(sv_moved, core::SizeVector({0, 1}));
+}
+
+TEST(SizeVector, InsertErase) {
+    core::SizeVector sv{1, 2, 3};
+    sv.insert(sv.begin(), 0);
+    sv.insert(sv.end(), {4, 5});
+    EXPECT_EQ(sv, core::SizeVector({0, 1, 2, 3, 4, 5}));
+
+    // Inserting a range of the vector itself.
+    sv.insert(sv.begin() + 1, sv.begin(), sv.end());
+    EXPECT_EQ(sv, core::SizeVector({0, 0, 1, 2, 3, 4, 5, 1, 2, 3, 4, 5}));
+
+    sv.erase(sv.begin() + 1, sv.begin() + 7);
+    EXPECT_EQ(sv, core::SizeVector({0, 1, 2, 3, 4, 5}));
+    sv.erase(sv.begin());
+    EXPECT_EQ(sv, core::SizeVector({1, 2, 3, 4, 5}));
+
+    std::vector<int64_t> v = sv;
+    EXPECT_EQ(v, std::vector<int64_t>({1, 2, 3, 4, 5}));
+    EXPECT_EQ(core::SizeVector(v), sv);
+}
+
 }  // namespace tests
 }  // namespace open3d
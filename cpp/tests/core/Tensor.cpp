@@ -2257,6 +2257,64 @@ TEST_P(TensorPermuteDevices, ReduceArgMax) {
               std::vector<int64_t>({1, 2, 2, 1, 3, 2}));
 }
 
+TEST_P(TensorPermuteDevices, Sort) {
+    core::Device device = GetParam();
+    core::Tensor src =
+            core::Tensor::Init<float>({{3, 1, 2, 1}, {-1, 5, 0, -7}}, device);
+
+    core::Tensor dst = src.Sort();
+    EXPECT_EQ(dst.GetShape(), core::SizeVector({2, 4}));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({1, 1, 2, 3, -7, -1, 0, 5}));
+
+    dst = src.Sort(0);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({-1, 1, 0, -7, 3, 5, 2, 1}));
+
+    dst = src.Sort(1, true);
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({3, 2, 1, 1, 5, 0, -1, -7}));
+
+    // NaNs are sorted last.
+    src = core::Tensor::Init<double>({2, NAN, -1}, device);
+    dst = src.Sort();
+    EXPECT_EQ(dst[0].Item<double>(), -1);
+    EXPECT_EQ(dst[1].Item<double>(), 2);
+    EXPECT_TRUE(std::isnan(dst[2].Item<double>()));
+
+    // Long rows use the parallel radix sort.
+    const int64_t n = 100000;
+    core::Tensor keys = core::Tensor::Arange(n, 0, -1, core::Int64, device);
+    keys = keys - n / 2;
+    core::Tensor expected = core::Tensor::Arange(1 - n / 2, n / 2 + 1, 1,
+                                                 core::Int64, device);
+    EXPECT_TRUE(keys.Sort().AllEqual(expected));
+}
+
+TEST_P(TensorPermuteDevices, ArgSort) {
+    core::Device device = GetParam();
+    core::Tensor src = core::Tensor::Init<int32_t>(
+            {{3, 1, 2, 1}, {0, 0, 9, -2}}, device);
+
+    // The sort is stable.
+    core::Tensor dst = src.ArgSort();
+    EXPECT_EQ(dst.GetDtype(), core::Int64);
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 3, 2, 0, 3, 0, 1, 2}));
+
+    dst = src.ArgSort(-1, true);
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({0, 2, 1, 3, 2, 0, 1, 3}));
+
+    dst = src.ArgSort(0);
+    EXPECT_EQ(dst.ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 1, 0, 1, 0, 0, 1, 0}));
+
+    src = core::Tensor::Init<bool>({true, false, true}, device);
+    EXPECT_EQ(src.ArgSort().ToFlatVector<int64_t>(),
+              std::vector<int64_t>({1, 0, 2}));
+}
+
 TEST_P(TensorPermuteDevices, Sqrt) {
     core::Device device = GetParam();
     core::Tensor src =
@@ -3092,6 +3150,52 @@ TEST_P(TensorPermuteDevices, IsSame) {
     EXPECT_TRUE(vec[0].IsSame(vec[1]));
 }
 
+TEST_P(TensorPermuteDevices, ToCopyOnWrite) {
+    const core::Device &device = GetParam();
+    const bool is_cpu = device.GetType() == core::Device::DeviceType::CPU;
+
+    core::Tensor src =
+            core::Tensor::Init<float>({{0, 1, 2}, {3, 4, 5}}, device);
+    const core::Tensor src_ref = src.Clone();
+    core::Tensor dst = src.To(device, /*copy=*/true);
+    core::Tensor dst_view = dst[1];
+
+    // CPU copies share the memory until written.
+    EXPECT_EQ(src.GetBlob()->IsShared(), is_cpu);
+    EXPECT_EQ(dst.GetBlob()->IsShared(), is_cpu);
+    const core::Tensor &src_const = src;
+    const core::Tensor &dst_const = dst;
+    EXPECT_EQ(src_const.GetDataPtr() == dst_const.GetDataPtr(), is_cpu);
+
+    // Writing to a view of the copy detaches all views of the copy.
+    dst_view.AsRvalue() = core::Tensor::Init<float>({6, 7, 8}, device);
+    EXPECT_FALSE(dst.GetBlob()->IsShared());
+    EXPECT_NE(src_const.GetDataPtr(), dst_const.GetDataPtr());
+    EXPECT_TRUE(src.AllEqual(src_ref));
+    EXPECT_EQ(dst.ToFlatVector<float>(),
+              std::vector<float>({0, 1, 2, 6, 7, 8}));
+
+    // Writing to the source does not change the copy.
+    core::Tensor dst2 = src.To(device, /*copy=*/true);
+    src.Fill(9);
+    EXPECT_TRUE(dst2.AllEqual(src_ref));
+    EXPECT_EQ(src.ToFlatVector<float>(), std::vector<float>(6, 9));
+
+    // Views that do not cover the whole memory are copied immediately.
+    core::Tensor src_slice = src_ref[0];
+    core::Tensor dst_slice = src_slice.To(device, /*copy=*/true);
+    EXPECT_FALSE(dst_slice.GetBlob()->IsShared());
+    EXPECT_TRUE(dst_slice.AllEqual(src_slice));
+
+    // Clone() always copies immediately.
+    core::Tensor dst3 = src.Clone();
+    EXPECT_FALSE(src.GetBlob()->IsShared());
+    EXPECT_FALSE(dst3.GetBlob()->IsShared());
+    EXPECT_NE(src_const.GetDataPtr(),
+              static_cast<const core::Tensor &>(dst3).GetDataPtr());
+    EXPECT_TRUE(dst3.AllEqual(src));
+}
+
 TEST_P(TensorPermuteDevices, RValueScalar) {
     const core::Device &device = GetParam();
     core::Tensor t, t_ref;
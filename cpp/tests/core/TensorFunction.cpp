@@ -234,5 +234,74 @@ TEST_P(TensorFunctionPermuteDevices, Append) {
     EXPECT_TRUE(core::Append(self, other).AllClose(self.Append(other)));
 }
 
+TEST_P(TensorFunctionPermuteDevices, Unique) {
+    core::Device device = GetParam();
+    core::Tensor unique, inverse, counts;
+
+    core::Tensor a =
+            core::Tensor::Init<int64_t>({{3, 1, 3}, {2, 1, 3}}, device);
+    std::tie(unique, inverse, counts) = core::Unique(a);
+    EXPECT_TRUE(
+            unique.AllEqual(core::Tensor::Init<int64_t>({1, 2, 3}, device)));
+    EXPECT_TRUE(inverse.AllEqual(
+            core::Tensor::Init<int64_t>({{2, 0, 2}, {1, 0, 2}}, device)));
+    EXPECT_TRUE(
+            counts.AllEqual(core::Tensor::Init<int64_t>({2, 1, 3}, device)));
+
+    // Unique rows.
+    core::Tensor b = core::Tensor::Init<float>(
+            {{1, 2}, {0, 5}, {1, 2}, {1, -1}}, device);
+    std::tie(unique, inverse, counts) = core::Unique(b, 0);
+    EXPECT_TRUE(unique.AllEqual(
+            core::Tensor::Init<float>({{0, 5}, {1, -1}, {1, 2}}, device)));
+    EXPECT_TRUE(inverse.AllEqual(
+            core::Tensor::Init<int64_t>({2, 0, 2, 1}, device)));
+    EXPECT_TRUE(
+            counts.AllEqual(core::Tensor::Init<int64_t>({1, 1, 2}, device)));
+
+    // Unique columns.
+    core::Tensor c =
+            core::Tensor::Init<int32_t>({{1, 0, 1}, {2, 7, 2}}, device);
+    std::tie(unique, inverse, counts) = core::Unique(c, 1);
+    EXPECT_TRUE(unique.AllEqual(
+            core::Tensor::Init<int32_t>({{0, 1}, {7, 2}}, device)));
+    EXPECT_TRUE(
+            inverse.AllEqual(core::Tensor::Init<int64_t>({1, 0, 1}, device)));
+
+    // Empty tensors.
+    std::tie(unique, inverse, counts) =
+            core::Unique(core::Tensor({0, 3}, core::Float32, device), 0);
+    EXPECT_EQ(unique.GetShape(), core::SizeVector({0, 3}));
+    EXPECT_EQ(inverse.GetShape(), core::SizeVector({0}));
+}
+
+TEST_P(TensorFunctionPermuteDevices, SegmentReduce) {
+    core::Device device = GetParam();
+    core::Tensor values = core::Tensor::Init<float>(
+            {{1, 10}, {2, 20}, {3, 30}, {4, 40}}, device);
+    core::Tensor ids = core::Tensor::Init<int64_t>({2, 0, 2, 0}, device);
+
+    EXPECT_TRUE(core::SegmentReduce(values, ids, 4, core::SegmentReduceOp::Sum)
+                        .AllEqual(core::Tensor::Init<float>(
+                                {{6, 60}, {0, 0}, {4, 40}, {0, 0}}, device)));
+    EXPECT_TRUE(core::SegmentReduce(values, ids, 3, core::SegmentReduceOp::Mean)
+                        .AllEqual(core::Tensor::Init<float>(
+                                {{3, 30}, {0, 0}, {2, 20}}, device)));
+    EXPECT_TRUE(core::SegmentReduce(values, ids, 3, core::SegmentReduceOp::Min)
+                        .AllEqual(core::Tensor::Init<float>(
+                                {{2, 20}, {0, 0}, {1, 10}}, device)));
+    EXPECT_TRUE(core::SegmentReduce(values, ids.To(core::Int32), 3,
+                                    core::SegmentReduceOp::Max)
+                        .AllEqual(core::Tensor::Init<float>(
+                                {{4, 40}, {0, 0}, {3, 30}}, device)));
+
+    // Ids out of range.
+    EXPECT_ANY_THROW(
+            core::SegmentReduce(values, ids, 2, core::SegmentReduceOp::Sum));
+    // Wrong number of ids.
+    EXPECT_ANY_THROW(core::SegmentReduce(values, ids.Slice(0, 0, 3), 3,
+                                         core::SegmentReduceOp::Sum));
+}
+
 }  // namespace tests
 }  // namespace open3d
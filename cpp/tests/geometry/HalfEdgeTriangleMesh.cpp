@@ -293,6 +293,39 @@ TEST(HalfEdgeTriangleMesh, Constructor_Sphere) {
     EXPECT_FALSE(het_mesh->IsEmpty());
 }
 
+TEST(HalfEdgeTriangleMesh, Constructor_NonManifold) {
+    EXPECT_THROW(geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(
+                         get_mesh_two_triangles_flipped()),
+                 std::runtime_error);
+    EXPECT_THROW(geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(
+                         get_mesh_two_triangles_invalid_vertex()),
+                 std::runtime_error);
+}
+
+TEST(HalfEdgeTriangleMesh, HalfEdges_Hexagon) {
+    auto het_mesh = geometry::HalfEdgeTriangleMesh::CreateFromTriangleMesh(
+            get_mesh_hexagon());
+    ASSERT_EQ(het_mesh->half_edges_.size(), 18u);
+    for (int he_index = 0; he_index < 18; ++he_index) {
+        const auto& he = het_mesh->half_edges_[he_index];
+        EXPECT_EQ(he.triangle_index_, he_index / 3);
+        EXPECT_EQ(het_mesh->half_edges_[he.next_].vertex_indices_(0),
+                  he.vertex_indices_(1));
+        if (!he.IsBoundary()) {
+            const auto& twin = het_mesh->half_edges_[he.twin_];
+            EXPECT_EQ(twin.twin_, he_index);
+            EXPECT_EQ(twin.vertex_indices_(0), he.vertex_indices_(1));
+            EXPECT_EQ(twin.vertex_indices_(1), he.vertex_indices_(0));
+        }
+    }
+    // 6 inner edges with two half-edges and 6 boundary edges.
+    EXPECT_EQ(std::count_if(het_mesh->half_edges_.begin(),
+                            het_mesh->half_edges_.end(),
+                            [](const geometry::HalfEdgeTriangleMesh::HalfEdge&
+                                       he) { return he.IsBoundary(); }),
+              6);
+}
+
 TEST(HalfEdgeTriangleMesh, OrderedHalfEdgesFromVertex_TwoTriangles) {
     auto mesh = get_mesh_two_triangles();
     auto het_mesh =
@@ -27,6 +27,8 @@
 #include "open3d/geometry/PointCloud.h"
 
 #include <algorithm>
+#include <numeric>
+#include <random>
 
 #include "open3d/camera/PinholeCameraIntrinsic.h"
 #include "open3d/data/Dataset.h"
@@ -737,6 +739,32 @@ TEST(PointCloud, VoxelDownSample) {
              covariances_down);
 }
 
+TEST(PointCloud, VoxelDownSampleAndTrace) {
+    geometry::PointCloud pcd({{1.2, 0.2, 0.2},
+                              {0.7, 0.2, 0.9},
+                              {1.8, 0.6, 0.1},
+                              {0.1, 0.1, 0.1}});
+
+    std::shared_ptr<geometry::PointCloud> pc_down;
+    Eigen::MatrixXi cubic_id;
+    std::vector<std::vector<int>> original_indices;
+    std::tie(pc_down, cubic_id, original_indices) =
+            pcd.VoxelDownSampleAndTrace(1.0, Eigen::Vector3d(0, 0, 0),
+                                        Eigen::Vector3d(3, 3, 3));
+
+    // Voxels are ordered by index, points within a voxel by point index.
+    ExpectEQ(pc_down->points_, std::vector<Eigen::Vector3d>(
+                                       {{0.4, 0.15, 0.5}, {1.5, 0.4, 0.15}}));
+    EXPECT_EQ(original_indices,
+              std::vector<std::vector<int>>({{1, 3}, {0, 2}}));
+    Eigen::MatrixXi cubic_id_ref = Eigen::MatrixXi::Constant(2, 8, -1);
+    cubic_id_ref(0, 0) = 3;
+    cubic_id_ref(0, 5) = 1;
+    cubic_id_ref(1, 0) = 0;
+    cubic_id_ref(1, 3) = 2;
+    EXPECT_EQ(cubic_id, cubic_id_ref);
+}
+
 TEST(PointCloud, UniformDownSample) {
     std::vector<Eigen::Vector3d> points({
             {0, 0, 0},
@@ -825,6 +853,32 @@ TEST(PointCloud, FarthestPointDownSample) {
                                                               {0, 1.0, 1.0}}));
 }  // namespace tests
 
+TEST(PointCloud, FarthestPointDownSampleStartIndexAndBuckets) {
+    geometry::PointCloud pcd({{0, 2.0, 0},
+                              {1.0, 1.5, 0},
+                              {0, 1.0, 0},
+                              {1.0, 1.0, 0},
+                              {0, 0, 1.0},
+                              {1.0, 0, 1.0},
+                              {0, 1.0, 1.0},
+                              {1.0, 1.0, 1.5}});
+    std::shared_ptr<geometry::PointCloud> pcd_down =
+            pcd.FarthestPointDownSample(3, 4);
+    ExpectEQ(pcd_down->points_,
+             std::vector<Eigen::Vector3d>(
+                     {{0, 2.0, 0}, {0, 0, 1.0}, {1.0, 1.0, 1.5}}));
+
+    // Skipping buckets does not change the samples.
+    data::PLYPointCloud pointcloud_ply;
+    io::ReadPointCloud(pointcloud_ply.GetPath(), pcd);
+    std::shared_ptr<geometry::PointCloud> pcd_dense =
+            pcd.FarthestPointDownSample(500, 7);
+    std::shared_ptr<geometry::PointCloud> pcd_bucketed =
+            pcd.FarthestPointDownSample(500, 7, 64);
+    ExpectEQ(pcd_dense->points_, pcd_bucketed->points_);
+    ExpectEQ(pcd_dense->colors_, pcd_bucketed->colors_);
+}
+
 TEST(PointCloud, Crop_AxisAlignedBoundingBox) {
     geometry::AxisAlignedBoundingBox aabb({0, 0, 0}, {2, 2, 2});
     geometry::PointCloud pcd({{0, 0, 0},
@@ -1292,6 +1346,53 @@ TEST(PointCloud, SegmentPlaneSpecialCase) {
     EXPECT_ANY_THROW(pcd.SegmentPlane(0.01, 3, 10, 1.5));
 }
 
+TEST(PointCloud, SegmentPlanes) {
+    // Three disjoint planar patches of decreasing size and a noise cluster.
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    geometry::PointCloud pcd;
+    for (int i = 0; i < 3000; ++i) {
+        pcd.points_.emplace_back(uniform(rng), uniform(rng), 0);
+    }
+    for (int i = 0; i < 2000; ++i) {
+        pcd.points_.emplace_back(2, 0.5 + uniform(rng), 0.5 + uniform(rng));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        pcd.points_.emplace_back(3 + uniform(rng), -1, 3 + uniform(rng));
+    }
+    for (int i = 0; i < 100; ++i) {
+        pcd.points_.emplace_back(5 + uniform(rng), 5 + uniform(rng),
+                                 5 + uniform(rng));
+    }
+    const std::vector<Eigen::Vector3d> normals = {
+            {0, 0, 1}, {1, 0, 0}, {0, 1, 0}};
+    const std::vector<size_t> offsets = {0, 3000, 5000, 6000};
+
+    const auto planes = pcd.SegmentPlanes(0.001, 3, 1000, 5, 500, 0.99999999,
+                                          /*seed=*/0);
+    ASSERT_EQ(planes.size(), 3);
+    for (size_t k = 0; k < planes.size(); ++k) {
+        Eigen::Vector4d plane_model;
+        std::vector<size_t> inliers;
+        std::tie(plane_model, inliers) = planes[k];
+        EXPECT_NEAR(std::abs(plane_model.head<3>().dot(normals[k])), 1, 1e-6);
+        std::vector<size_t> expected(offsets[k + 1] - offsets[k]);
+        std::iota(expected.begin(), expected.end(), offsets[k]);
+        EXPECT_EQ(inliers, expected);
+    }
+
+    // The same seed gives the same planes.
+    EXPECT_EQ(pcd.SegmentPlanes(0.001, 3, 1000, 5, 500, 0.99999999, 0),
+              planes);
+    EXPECT_EQ(pcd.SegmentPlane(0.001, 3, 1000, 0.99999999, 0),
+              planes[0]);
+
+    // At most max_num_planes planes are returned.
+    EXPECT_EQ(pcd.SegmentPlanes(0.001, 3, 1000, 2, 500, 0.99999999, 0).size(),
+              2);
+    EXPECT_ANY_THROW(pcd.SegmentPlanes(0.001, 2, 1000, 2));
+}
+
 TEST(PointCloud, CreateFromDepthImage) {
     data::SampleRedwoodRGBDImages redwood_data;
     const std::string trajectory_path = redwood_data.GetTrajectoryLogPath();
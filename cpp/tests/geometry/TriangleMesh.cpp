@@ -27,7 +27,10 @@
 #include "open3d/geometry/TriangleMesh.h"
 
 #include "open3d/geometry/BoundingVolume.h"
+#include "open3d/geometry/KDTreeFlann.h"
 #include "open3d/geometry/PointCloud.h"
+#include "open3d/geometry/TriangleMeshDeformation.h"
+#include "open3d/geometry/TriangleMeshTopology.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -762,6 +765,72 @@ TEST(TriangleMesh, SamplePointsUniformly) {
     }
 }
 
+TEST(TriangleMesh, SamplePointsPoissonDisk) {
+    auto mesh_empty = geometry::TriangleMesh();
+    EXPECT_THROW(mesh_empty.SamplePointsPoissonDisk(100), std::runtime_error);
+
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh->ComputeVertexNormals();
+    mesh->PaintUniformColor({1, 0, 0});
+    size_t n_points = 1000;
+    auto pcd = mesh->SamplePointsPoissonDisk(n_points, 5, nullptr, false, 0);
+    EXPECT_EQ(pcd->points_.size(), n_points);
+    EXPECT_EQ(pcd->normals_.size(), n_points);
+    EXPECT_EQ(pcd->colors_.size(), n_points);
+
+    // Unlike uniform samples, the samples keep a minimum distance.
+    double r_max = 2 * std::sqrt((mesh->GetSurfaceArea() / n_points) /
+                                 (2 * std::sqrt(3.)));
+    geometry::KDTreeFlann kdtree(*pcd);
+    for (const Eigen::Vector3d &point : pcd->points_) {
+        std::vector<int> indices;
+        std::vector<double> dists2;
+        kdtree.SearchKNN(point, 2, indices, dists2);
+        EXPECT_GT(std::sqrt(dists2[1]), 0.5 * r_max);
+    }
+
+    // The parallel elimination gives the result of the serial elimination,
+    // which repeatedly removes the sample with the largest weight.
+    n_points = 100;
+    auto pcd_init = mesh->SamplePointsUniformly(5 * n_points, false, 0);
+    const std::vector<Eigen::Vector3d> &points = pcd_init->points_;
+    r_max = 2 * std::sqrt((mesh->GetSurfaceArea() / n_points) /
+                          (2 * std::sqrt(3.)));
+    const double r_min = r_max * 0.5 * (1 - std::pow(0.2, 1.5));
+    Eigen::MatrixXd pair_weights(points.size(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        for (size_t j = 0; j < points.size(); ++j) {
+            const double d = std::max((points[i] - points[j]).norm(), r_min);
+            pair_weights(i, j) =
+                    i != j && d <= r_max ? std::pow(1 - d / r_max, 8) : 0;
+        }
+    }
+    std::vector<bool> deleted(points.size(), false);
+    for (size_t count = points.size(); count > n_points; --count) {
+        int pidx_max = -1;
+        double weight_max = -1;
+        for (size_t i = 0; i < points.size(); ++i) {
+            double weight = 0;
+            for (size_t j = 0; j < points.size(); ++j) {
+                weight += deleted[j] ? 0 : pair_weights(i, j);
+            }
+            if (!deleted[i] && weight > weight_max) {
+                pidx_max = int(i);
+                weight_max = weight;
+            }
+        }
+        deleted[pidx_max] = true;
+    }
+    std::vector<Eigen::Vector3d> ref_points;
+    for (size_t i = 0; i < points.size(); ++i) {
+        if (!deleted[i]) {
+            ref_points.push_back(points[i]);
+        }
+    }
+    pcd = mesh->SamplePointsPoissonDisk(n_points, 5, pcd_init);
+    ExpectEQ(pcd->points_, ref_points);
+}
+
 TEST(TriangleMesh, FilterSharpen) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
@@ -844,6 +913,25 @@ TEST(TriangleMesh, FilterSmoothTaubin) {
     ExpectEQ(mesh->vertices_, ref2, 1e-4);
 }
 
+TEST(TriangleMesh, SubdivideLoop) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    mesh.triangles_ = {{0, 1, 2}};
+
+    auto subdivided = mesh.SubdivideLoop(1);
+    std::vector<Eigen::Vector3d> ref_vertices = {
+            {0.125, 0.125, 0}, {0.75, 0.125, 0}, {0.125, 0.75, 0},
+            {0.5, 0, 0},       {0.5, 0.5, 0},    {0, 0.5, 0}};
+    std::vector<Eigen::Vector3i> ref_triangles = {
+            {0, 3, 5}, {3, 1, 4}, {4, 2, 5}, {3, 4, 5}};
+    ExpectEQ(subdivided->vertices_, ref_vertices);
+    ExpectEQ(subdivided->triangles_, ref_triangles);
+
+    subdivided = mesh.SubdivideLoop(2);
+    EXPECT_EQ(subdivided->vertices_.size(), 15u);
+    EXPECT_EQ(subdivided->triangles_.size(), 16u);
+}
+
 TEST(TriangleMesh, HasVertices) {
     int size = 100;
 
@@ -1048,6 +1136,53 @@ TEST(TriangleMesh, IsVertexManifold) {
     EXPECT_FALSE(mesh1.IsVertexManifold());
 }
 
+TEST(TriangleMesh, GetTopology) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 0, 2}, {1, 0.5, 1}};
+    mesh.triangles_ = {{0, 1, 2}, {1, 2, 3}, {1, 2, 4}};
+
+    auto topology = mesh.GetTopology();
+    EXPECT_EQ(topology->NumEdges(), 7u);
+    EXPECT_EQ(topology->FindEdge(2, 1), 2);
+    EXPECT_EQ(topology->EdgeDegree(2), 3);
+    EXPECT_EQ(topology->FindEdge(0, 3), -1);
+    const std::vector<Eigen::Vector2i> non_manifold_edges = {{1, 2}};
+    ExpectEQ(mesh.GetNonManifoldEdges(true), non_manifold_edges);
+    const std::vector<Eigen::Vector2i> all_edges = {
+            {0, 1}, {0, 2}, {1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}};
+    ExpectEQ(mesh.GetNonManifoldEdges(false), all_edges);
+    EXPECT_EQ(mesh.GetTopology(), topology);
+
+    // Changing the triangles invalidates the cached topology.
+    mesh.triangles_.pop_back();
+    EXPECT_NE(mesh.GetTopology(), topology);
+    EXPECT_EQ(mesh.GetTopology()->NumEdges(), 5u);
+    EXPECT_TRUE(mesh.IsEdgeManifold(true));
+
+    // Triangles modified in place are detected without an invalidation.
+    const std::vector<Eigen::Vector3i> manifold_triangles = {
+            {0, 1, 2}, {1, 2, 3}, {0, 3, 4}};
+    mesh.triangles_ = manifold_triangles;
+    EXPECT_TRUE(mesh.IsEdgeManifold(true));
+    mesh.triangles_[2] = {1, 2, 4};
+    EXPECT_FALSE(mesh.IsEdgeManifold(true));
+    EXPECT_EQ(mesh.GetTopology()->EdgeDegree(
+                      mesh.GetTopology()->FindEdge(1, 2)),
+              3);
+
+    // So is a copy assignment of the same size, which reuses the storage.
+    mesh.triangles_ = manifold_triangles;
+    EXPECT_TRUE(mesh.IsEdgeManifold(true));
+
+    // Member functions that modify the triangles invalidate it.
+    topology = mesh.GetTopology();
+    mesh.OrientTriangles();
+    EXPECT_NE(mesh.GetTopology(), topology);
+
+    mesh.Clear();
+    EXPECT_EQ(mesh.GetTopology()->NumEdges(), 0u);
+}
+
 TEST(TriangleMesh, IsSelfIntersecting) {
     EXPECT_FALSE(geometry::TriangleMesh::CreateBox()->IsSelfIntersecting());
     EXPECT_FALSE(geometry::TriangleMesh::CreateSphere()->IsSelfIntersecting());
@@ -1451,6 +1586,50 @@ TEST(TriangleMesh, DeformAsRigidAsPossible) {
     ExpectMeshEQ(*mesh_deform, mesh_gt, 1e-5);
 }
 
+TEST(TriangleMesh, DeformAsRigidAsPossibleSolver) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    std::vector<int> constraint_ids;
+    std::vector<Eigen::Vector3d> constraint_pos;
+    for (int idx = 0; idx < int(mesh->vertices_.size()); ++idx) {
+        const Eigen::Vector3d &v = mesh->vertices_[idx];
+        if (v(2) < -0.8) {
+            constraint_ids.push_back(idx);
+            constraint_pos.push_back(v);
+        } else if (v(2) > 0.8) {
+            constraint_ids.push_back(idx);
+            constraint_pos.push_back(v + Eigen::Vector3d(0.3, 0, 0.2));
+        }
+    }
+
+    for (auto energy : {geometry::MeshBase::DeformAsRigidAsPossibleEnergy::
+                                Spokes,
+                        geometry::MeshBase::DeformAsRigidAsPossibleEnergy::
+                                Smoothed}) {
+        auto mesh_gt = mesh->DeformAsRigidAsPossible(
+                constraint_ids, constraint_pos, 20, energy);
+        geometry::DeformAsRigidAsPossibleSolver solver(*mesh, constraint_ids,
+                                                       energy);
+        ExpectMeshEQ(*solver.Deform(constraint_pos, 20), *mesh_gt);
+
+        // Reset starts from the rest shape again.
+        solver.Reset();
+        ExpectMeshEQ(*solver.Deform(constraint_pos, 20), *mesh_gt);
+    }
+
+    // The spokes energy only depends on the positions, so the iterations can
+    // be split across calls.
+    geometry::DeformAsRigidAsPossibleSolver solver(*mesh, constraint_ids);
+    solver.Deform(constraint_pos, 10);
+    ExpectMeshEQ(*solver.Deform(constraint_pos, 10),
+                 *mesh->DeformAsRigidAsPossible(constraint_ids,
+                                                constraint_pos, 20));
+
+    constraint_pos.pop_back();
+    EXPECT_ANY_THROW(solver.Deform(constraint_pos, 1));
+    EXPECT_ANY_THROW(geometry::DeformAsRigidAsPossibleSolver(
+            *mesh, {int(mesh->vertices_.size())}));
+}
+
 TEST(TriangleMesh, SelectByIndex) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {360.784314, 717.647059, 800.000000},
@@ -1939,6 +2118,43 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectMeshEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // Fibonacci sphere with more points than fit into one partition, so that
+    // the partitions are stitched.
+    const int num_points = 20000;
+    const double golden_angle = M_PI * (3 - std::sqrt(5.0));
+    geometry::PointCloud pcd;
+    for (int i = 0; i < num_points; ++i) {
+        const double z = 1 - 2 * (i + 0.5) / num_points;
+        const double r = std::sqrt(1 - z * z);
+        pcd.points_.emplace_back(r * std::cos(golden_angle * i),
+                                 r * std::sin(golden_angle * i), z);
+    }
+    pcd.normals_ = pcd.points_;
+
+    const double radius = 2 * std::sqrt(4 * M_PI / num_points);
+    auto mesh = geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {radius});
+    EXPECT_EQ(mesh->vertices_, pcd.points_);
+    EXPECT_EQ(mesh->triangles_.size(), 2 * num_points - 4);
+    EXPECT_EQ(mesh->triangle_normals_.size(), mesh->triangles_.size());
+    EXPECT_TRUE(mesh->IsEdgeManifold(/*allow_boundary_edges=*/false));
+    EXPECT_TRUE(mesh->IsVertexManifold());
+    EXPECT_TRUE(mesh->IsOrientable());
+    // Triangles are oriented along the point normals.
+    for (const Eigen::Vector3i& triangle : mesh->triangles_) {
+        const Eigen::Vector3d& p0 = mesh->vertices_[triangle(0)];
+        const Eigen::Vector3d normal =
+                (mesh->vertices_[triangle(1)] - p0)
+                        .cross(mesh->vertices_[triangle(2)] - p0);
+        EXPECT_GT(normal.dot(mesh->vertex_normals_[triangle(0)]), 0);
+    }
+
+    pcd.normals_.clear();
+    EXPECT_ANY_THROW(geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+            pcd, {radius}));
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     std::vector<Eigen::Vector3d> ref_vertices = {
             {0.000000, 0.000000, 1.000000},
@@ -24,6 +24,11 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstring>
+#include <fstream>
+
+#include "open3d/io/TriangleMeshIO.h"
+#include "open3d/utility/FileSystem.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -47,6 +52,108 @@ TEST(FilePLY, DISABLED_ReadTriangleMeshFromPLY) { NotImplemented(); }
 
 TEST(FilePLY, DISABLED_WriteTriangleMeshToPLY) { NotImplemented(); }
 
+// Big endian payload with an unused list property on the vertices and a quad
+// that has to be split into triangles.
+TEST(FilePLY, ReadBinaryBigEndianTriangleMesh) {
+    const std::string filename =
+            utility::filesystem::GetTempDirectoryPath() + "/test_be.ply";
+    std::ofstream out(filename, std::ios::binary);
+    out << "ply\n"
+           "format binary_big_endian 1.0\n"
+           "element vertex 4\n"
+           "property float x\n"
+           "property list uchar short junk\n"
+           "property double y\n"
+           "property float z\n"
+           "property uchar red\n"
+           "property uchar green\n"
+           "property uchar blue\n"
+           "element face 2\n"
+           "property list uchar int vertex_indices\n"
+           "end_header\n";
+    auto write = [&out](auto value) {
+        char bytes[sizeof(value)];
+        std::memcpy(bytes, &value, sizeof(value));
+        for (int k = int(sizeof(value)) - 1; k >= 0; --k) {
+            out.put(bytes[k]);
+        }
+    };
+    const std::vector<Eigen::Vector3d> vertices = {
+            {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    for (size_t i = 0; i < vertices.size(); ++i) {
+        write(float(vertices[i](0)));
+        write(uint8_t(i));
+        for (size_t k = 0; k < i; ++k) {
+            write(int16_t(-1));
+        }
+        write(double(vertices[i](1)));
+        write(float(vertices[i](2)));
+        write(uint8_t(255));
+        write(uint8_t(0));
+        write(uint8_t(51 * i));
+    }
+    write(uint8_t(3));
+    for (int idx : {0, 1, 2}) write(int32_t(idx));
+    write(uint8_t(4));
+    for (int idx : {0, 1, 2, 3}) write(int32_t(idx));
+    out.close();
+
+    geometry::TriangleMesh mesh;
+    EXPECT_TRUE(io::ReadTriangleMesh(filename, mesh));
+    ExpectEQ(mesh.vertices_, vertices);
+    ExpectEQ(mesh.vertex_colors_[3], Eigen::Vector3d(1, 0, 0.6));
+    EXPECT_EQ(mesh.triangles_.size(), 3u);
+    ExpectEQ(mesh.triangles_[0], Eigen::Vector3i(0, 1, 2));
+}
+
+// Faces whose lengths differ from the first face only after a few rows, and
+// elements whose row counts exceed the file and would overflow the end offset.
+TEST(FilePLY, ReadBinaryFaceListLengths) {
+    const std::string filename =
+            utility::filesystem::GetTempDirectoryPath() + "/test_faces.ply";
+    auto write_file = [&filename](const std::string &extra_element,
+                                  const std::vector<int> &face_sizes,
+                                  int64_t num_faces) {
+        std::ofstream out(filename, std::ios::binary);
+        out << "ply\n"
+               "format binary_little_endian 1.0\n"
+               "element vertex 5\n"
+               "property float x\n"
+               "property float y\n"
+               "property float z\n"
+            << extra_element << "element face " << num_faces
+            << "\n"
+               "property list uchar int vertex_indices\n"
+               "end_header\n";
+        auto write = [&out](auto value) {
+            out.write(reinterpret_cast<const char *>(&value), sizeof(value));
+        };
+        for (int i = 0; i < 5; ++i) {
+            write(float(i));
+            write(float(i * i));
+            write(0.0f);
+        }
+        for (int size : face_sizes) {
+            write(uint8_t(size));
+            for (int k = 0; k < size; ++k) write(int32_t(k));
+        }
+    };
+
+    geometry::TriangleMesh mesh;
+    write_file("", {3, 3, 3, 4, 3}, 5);
+    EXPECT_TRUE(io::ReadTriangleMesh(filename, mesh));
+    EXPECT_EQ(mesh.vertices_.size(), 5u);
+    EXPECT_EQ(mesh.triangles_.size(), 6u);
+    ExpectEQ(mesh.triangles_[5], Eigen::Vector3i(0, 1, 2));
+
+    write_file("", {3, 3}, int64_t(1) << 61);
+    EXPECT_FALSE(io::ReadTriangleMesh(filename, mesh));
+
+    write_file("element junk 2305843009213693952\nproperty double v\n",
+               {3, 3}, 2);
+    EXPECT_FALSE(io::ReadTriangleMesh(filename, mesh));
+}
+
 TEST(FilePLY, DISABLED_ResetConsoleProgress) { NotImplemented(); }
 
 }  // namespace tests
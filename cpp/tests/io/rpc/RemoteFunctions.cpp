@@ -30,10 +30,12 @@
 
 #include "open3d/geometry/PointCloud.h"
 #include "open3d/geometry/TriangleMesh.h"
+#include "open3d/io/rpc/AsyncConnection.h"
 #include "open3d/io/rpc/BufferConnection.h"
 #include "open3d/io/rpc/Connection.h"
 #include "open3d/io/rpc/DummyReceiver.h"
 #include "open3d/io/rpc/MessageUtils.h"
+#include "open3d/io/rpc/Messages.h"
 #include "open3d/io/rpc/ZMQContext.h"
 #include "tests/Tests.h"
 
@@ -243,5 +245,90 @@ TEST_F(RemoteFunctions, SendGarbage) {
     receiver.Stop();
 }
 
+TEST_F(RemoteFunctions, AsyncConnection) {
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+
+    const int max_in_flight = 4;
+    for (bool use_compression : {false, true}) {
+        auto connection = std::make_shared<AsyncConnection>(
+                connection_address, 500, 500, max_in_flight, use_compression);
+        for (int i = 0; i < 10; ++i) {
+            core::Tensor vertices =
+                    core::Tensor::Full({100000, 3}, i, core::Float32);
+            ASSERT_TRUE(SetMeshData("", i, "", vertices, {},
+                                    core::Tensor({0}, core::Int32), {},
+                                    core::Tensor({0}, core::Int32), {}, "",
+                                    {}, {}, {}, "", connection));
+            ASSERT_LE(connection->GetNumInFlight(), max_in_flight);
+        }
+        ASSERT_TRUE(connection->Flush());
+        ASSERT_EQ(connection->GetNumInFlight(), 0);
+    }
+
+    receiver.Stop();
+}
+
+TEST_F(RemoteFunctions, AsyncConnectionReconnect) {
+    // Without a receiver no reply arrives, so Flush() times out and the
+    // socket is reconnected.
+    auto connection = std::make_shared<AsyncConnection>(connection_address,
+                                                        100, 100);
+    SetTime(0, connection);
+    ASSERT_FALSE(connection->Flush());
+    ASSERT_EQ(connection->GetNumInFlight(), 0);
+
+    // The new socket is usable once a receiver is listening.
+    DummyReceiver receiver(connection_address, 500);
+    receiver.Start();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(SetTime(i, connection));
+    }
+    ASSERT_TRUE(connection->Flush());
+    ASSERT_EQ(connection->GetNumInFlight(), 0);
+    receiver.Stop();
+}
+
+TEST_F(RemoteFunctions, CompressArrays) {
+    t::geometry::PointCloud pcd(core::Tensor::Full({100000, 3}, 1.f,
+                                                   core::Float32));
+    pcd.SetPointColors(core::Tensor::Zeros({100000, 3}, core::Float32));
+    // Too small to be compressed.
+    pcd.SetPointAttr("labels", core::Tensor::Ones({10}, core::Int32));
+
+    messages::MeshData mesh_data = GeometryToMeshData(pcd);
+    CompressArrays(mesh_data);
+    ASSERT_EQ(mesh_data.vertices.compression, "lzf");
+    ASSERT_LT(mesh_data.vertices.data.size, 100000 * 3 * sizeof(float));
+    ASSERT_EQ(mesh_data.vertex_attributes.at("labels").compression, "");
+
+    std::string errstr;
+    ASSERT_TRUE(DecompressArrays(mesh_data, errstr));
+    ASSERT_EQ(mesh_data.vertices.compression, "");
+    auto result = std::dynamic_pointer_cast<t::geometry::PointCloud>(
+            MeshDataToGeometry(mesh_data));
+    ASSERT_TRUE(result);
+    ASSERT_TRUE(result->GetPointPositions().AllEqual(pcd.GetPointPositions()));
+    ASSERT_TRUE(result->GetPointColors().AllEqual(pcd.GetPointColors()));
+    ASSERT_TRUE(result->GetPointAttr("labels").AllEqual(
+            pcd.GetPointAttr("labels")));
+
+    // Corrupted data must be detected.
+    CompressArrays(mesh_data);
+    mesh_data.vertices.data.size /= 2;
+    ASSERT_FALSE(DecompressArrays(mesh_data, errstr));
+
+    // Unknown types and sizes beyond what lzf can decompress are rejected.
+    mesh_data = GeometryToMeshData(pcd);
+    CompressArrays(mesh_data);
+    mesh_data.vertices.type = "<f99999999999999999999";
+    ASSERT_FALSE(DecompressArrays(mesh_data, errstr));
+    mesh_data.vertices.type = "<f4";
+    mesh_data.vertices.shape = {int64_t(1) << 31, 3};
+    ASSERT_FALSE(DecompressArrays(mesh_data, errstr));
+    mesh_data.vertices.shape = {int64_t(1) << 62, int64_t(1) << 62};
+    ASSERT_FALSE(DecompressArrays(mesh_data, errstr));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -32,6 +32,7 @@
 #include "open3d/data/Dataset.h"
 #include "open3d/io/ImageIO.h"
 #include "open3d/io/PinholeCameraTrajectoryIO.h"
+#include "open3d/t/geometry/kernel/Image.h"
 #include "open3d/t/io/ImageIO.h"
 #include "open3d/utility/Preprocessor.h"
 #include "open3d/visualization/utility/DrawGeometry.h"
@@ -283,20 +284,20 @@ TEST_P(ImagePermuteDevices, FilterBilateral) {
                 core::Tensor(input_data, {5, 5, 1}, core::Float32, device);
 
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterBilateral(3, 10, 10), std::runtime_error);
+        im = im.FilterBilateral(3, 10, 10);
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::Float32, device)));
         } else {
-            im = im.FilterBilateral(3, 10, 10);
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::Float32, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::Float32, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::Float32, device)));
         }
+
+        // The native kernel follows IPP on all devices.
+        core::Tensor native = core::Tensor::EmptyLike(data);
+        t::geometry::kernel::image::FilterBilateral(data, native, 3, 10, 10);
+        EXPECT_TRUE(native.AllClose(core::Tensor(output_ref_ipp, {5, 5, 1},
+                                                 core::Float32, device)));
     }
 
     {  // UInt8
@@ -325,20 +326,21 @@ TEST_P(ImagePermuteDevices, FilterBilateral) {
                 core::Tensor(input_data, {5, 5, 1}, core::UInt8, device);
 
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterBilateral(3, 5, 5), std::runtime_error);
+        im = im.FilterBilateral(3, 5, 5);
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
         } else {
-            im = im.FilterBilateral(3, 5, 5);
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::UInt8, device)));
         }
+
+        core::Tensor native = core::Tensor::EmptyLike(data);
+        t::geometry::kernel::image::FilterBilateral(data, native, 3, 5, 5);
+        EXPECT_TRUE(native.AllClose(core::Tensor(output_ref_ipp, {5, 5, 1},
+                                                 core::UInt8, device)));
+        EXPECT_ANY_THROW(t::geometry::kernel::image::FilterBilateral(
+                data, native, 3, 0, 5));
     }
 }
 
@@ -366,15 +368,15 @@ TEST_P(ImagePermuteDevices, FilterGaussian) {
         core::Tensor data =
                 core::Tensor(input_data, {5, 5, 1}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterGaussian(3), std::runtime_error);
-        } else {
-            im = im.FilterGaussian(3);
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {5, 5, 1}, core::Float32, device)));
-        }
+        im = im.FilterGaussian(3);
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {5, 5, 1}, core::Float32, device)));
+
+        // The native kernel follows IPP on all devices.
+        core::Tensor native = core::Tensor::EmptyLike(data);
+        t::geometry::kernel::image::FilterGaussian(data, native, 3, 1.0f);
+        EXPECT_TRUE(native.AllClose(
+                core::Tensor(output_ref, {5, 5, 1}, core::Float32, device)));
     }
 
     {  // UInt8
@@ -402,20 +404,26 @@ TEST_P(ImagePermuteDevices, FilterGaussian) {
         core::Tensor data =
                 core::Tensor(input_data, {5, 5, 1}, core::UInt8, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterGaussian(3), std::runtime_error);
+        im = im.FilterGaussian(3);
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
         } else {
-            im = im.FilterGaussian(3);
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::UInt8, device)));
         }
+
+        core::Tensor native = core::Tensor::EmptyLike(data);
+        t::geometry::kernel::image::FilterGaussian(data, native, 3, 1.0f);
+        EXPECT_TRUE(native.AllClose(core::Tensor(output_ref_ipp, {5, 5, 1},
+                                                 core::UInt8, device)));
+
+        // A non-positive sigma has no valid Gaussian weights.
+        EXPECT_ANY_THROW(
+                t::geometry::kernel::image::FilterGaussian(data, native, 3, 0));
+        EXPECT_ANY_THROW(t::geometry::kernel::image::FilterGaussian(
+                data, native, 3, -1.0f));
+        EXPECT_ANY_THROW(im.FilterGaussian(3, 0));
     }
 }
 
@@ -444,15 +452,13 @@ TEST_P(ImagePermuteDevices, Filter) {
         core::Tensor kernel =
                 core::Tensor(kernel_data, {5, 5}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.Filter(kernel), std::runtime_error);
-        } else {
-            t::geometry::Image im_new = im.Filter(kernel);
-            EXPECT_TRUE(
-                    im_new.AsTensor().Reverse().View({5, 5}).AllClose(kernel));
-        }
+        t::geometry::Image im_new = im.Filter(kernel);
+        EXPECT_TRUE(im_new.AsTensor().Reverse().View({5, 5}).AllClose(kernel));
+
+        // The native kernel follows IPP on all devices.
+        core::Tensor native = core::Tensor::EmptyLike(data);
+        t::geometry::kernel::image::Filter(data, native, kernel);
+        EXPECT_TRUE(native.Reverse().View({5, 5}).AllClose(kernel));
     }
 
     {  // UInt8
@@ -492,20 +498,19 @@ TEST_P(ImagePermuteDevices, Filter) {
         core::Tensor kernel =
                 core::Tensor(kernel_data, {5, 5}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.Filter(kernel), std::runtime_error);
+        im = im.Filter(kernel);
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
         } else {
-            im = im.Filter(kernel);
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {5, 5, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {5, 5, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {5, 5, 1}, core::UInt8, device)));
         }
+
+        core::Tensor native = core::Tensor::EmptyLike(data);
+        t::geometry::kernel::image::Filter(data, native, kernel);
+        EXPECT_TRUE(native.AllClose(core::Tensor(output_ref_ipp, {5, 5, 1},
+                                                 core::UInt8, device)));
     }
 }
 
@@ -538,18 +543,21 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
                 core::Tensor(input_data, {5, 5, 1}, core::Float32, device);
         t::geometry::Image im(data);
         t::geometry::Image dx, dy;
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterSobel(3), std::runtime_error);
-        } else {
-            std::tie(dx, dy) = im.FilterSobel(3);
-
-            EXPECT_TRUE(dx.AsTensor().AllClose(core::Tensor(
-                    output_dx_ref, {5, 5, 1}, core::Float32, device)));
-            EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor(
-                    output_dy_ref, {5, 5, 1}, core::Float32, device)));
-        }
+        std::tie(dx, dy) = im.FilterSobel(3);
+
+        EXPECT_TRUE(dx.AsTensor().AllClose(core::Tensor(
+                output_dx_ref, {5, 5, 1}, core::Float32, device)));
+        EXPECT_TRUE(dy.AsTensor().AllClose(core::Tensor(
+                output_dy_ref, {5, 5, 1}, core::Float32, device)));
+
+        // The native kernel follows IPP on all devices.
+        core::Tensor native_dx = core::Tensor::EmptyLike(data);
+        core::Tensor native_dy = core::Tensor::EmptyLike(data);
+        t::geometry::kernel::image::FilterSobel(data, native_dx, native_dy, 3);
+        EXPECT_TRUE(native_dx.AllClose(core::Tensor(
+                output_dx_ref, {5, 5, 1}, core::Float32, device)));
+        EXPECT_TRUE(native_dy.AllClose(core::Tensor(
+                output_dy_ref, {5, 5, 1}, core::Float32, device)));
     }
 
     {  // UInt8 -> Int16
@@ -558,22 +566,26 @@ TEST_P(ImagePermuteDevices, FilterSobel) {
                         .To(core::UInt8);
         t::geometry::Image im(data);
         t::geometry::Image dx, dy;
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.FilterSobel(3), std::runtime_error);
-        } else {
-            std::tie(dx, dy) = im.FilterSobel(3);
-
-            EXPECT_TRUE(dx.AsTensor().AllClose(
-                    core::Tensor(output_dx_ref, {5, 5, 1}, core::Float32,
-                                 device)
-                            .To(core::Int16)));
-            EXPECT_TRUE(dy.AsTensor().AllClose(
-                    core::Tensor(output_dy_ref, {5, 5, 1}, core::Float32,
-                                 device)
-                            .To(core::Int16)));
-        }
+        std::tie(dx, dy) = im.FilterSobel(3);
+
+        EXPECT_TRUE(dx.AsTensor().AllClose(
+                core::Tensor(output_dx_ref, {5, 5, 1}, core::Float32, device)
+                        .To(core::Int16)));
+        EXPECT_TRUE(dy.AsTensor().AllClose(
+                core::Tensor(output_dy_ref, {5, 5, 1}, core::Float32, device)
+                        .To(core::Int16)));
+
+        core::Tensor native_dx =
+                core::Tensor::Empty({5, 5, 1}, core::Int16, device);
+        core::Tensor native_dy =
+                core::Tensor::Empty({5, 5, 1}, core::Int16, device);
+        t::geometry::kernel::image::FilterSobel(data, native_dx, native_dy, 3);
+        EXPECT_TRUE(native_dx.AllClose(
+                core::Tensor(output_dx_ref, {5, 5, 1}, core::Float32, device)
+                        .To(core::Int16)));
+        EXPECT_TRUE(native_dy.AllClose(
+                core::Tensor(output_dy_ref, {5, 5, 1}, core::Float32, device)
+                        .To(core::Int16)));
     }
 }
 
@@ -598,17 +610,17 @@ TEST_P(ImagePermuteDevices, Resize) {
         core::Tensor data =
                 core::Tensor(input_data, {6, 6, 1}, core::Float32, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(
-                    im.Resize(0.5, t::geometry::Image::InterpType::Nearest),
-                    std::runtime_error);
-        } else {
-            im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {3, 3, 1}, core::Float32, device)));
-        }
+        im = im.Resize(0.5, t::geometry::Image::InterpType::Nearest);
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Float32, device)));
+
+        // The native kernel follows IPP on all devices.
+        core::Tensor native =
+                core::Tensor::Empty({3, 3, 1}, core::Float32, device);
+        t::geometry::kernel::image::Resize(
+                data, native, t::geometry::Image::InterpType::Nearest);
+        EXPECT_TRUE(native.AllClose(
+                core::Tensor(output_ref, {3, 3, 1}, core::Float32, device)));
     }
     {  // UInt8
         // clang-format off
@@ -632,39 +644,36 @@ TEST_P(ImagePermuteDevices, Resize) {
         core::Tensor data =
                 core::Tensor(input_data, {6, 6, 1}, core::UInt8, device);
         t::geometry::Image im(data);
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.Resize(0.5, t::geometry::Image::InterpType::Super),
-                         std::runtime_error);
+        t::geometry::Image im_low =
+                im.Resize(0.5, t::geometry::Image::InterpType::Super);
+
+        core::Tensor native =
+                core::Tensor::Empty({3, 3, 1}, core::UInt8, device);
+        t::geometry::kernel::image::Resize(
+                data, native, t::geometry::Image::InterpType::Super);
+        EXPECT_TRUE(native.AllClose(core::Tensor(output_ref_ipp, {3, 3, 1},
+                                                 core::UInt8, device)));
+
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im_low.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
         } else {
-            t::geometry::Image im_low =
-                    im.Resize(0.5, t::geometry::Image::InterpType::Super);
-            utility::LogInfo("Super: {}",
+            EXPECT_TRUE(im_low.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {3, 3, 1}, core::UInt8, device)));
+
+            // Check output in the CI to see if other inteprolations works
+            // with other platforms
+            im_low = im.Resize(0.5, t::geometry::Image::InterpType::Linear);
+            utility::LogInfo("Linear(impl. dependent): {}",
                              im_low.AsTensor().View({3, 3}).ToString());
 
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im_low.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im_low.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {3, 3, 1}, core::UInt8, device)));
-
-                // Check output in the CI to see if other inteprolations works
-                // with other platforms
-                im_low = im.Resize(0.5, t::geometry::Image::InterpType::Linear);
-                utility::LogInfo("Linear(impl. dependent): {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-
-                im_low = im.Resize(0.5, t::geometry::Image::InterpType::Cubic);
-                utility::LogInfo("Cubic(impl. dependent): {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-
-                im_low =
-                        im.Resize(0.5, t::geometry::Image::InterpType::Lanczos);
-                utility::LogInfo("Lanczos(impl. dependent): {}",
-                                 im_low.AsTensor().View({3, 3}).ToString());
-            }
+            im_low = im.Resize(0.5, t::geometry::Image::InterpType::Cubic);
+            utility::LogInfo("Cubic(impl. dependent): {}",
+                             im_low.AsTensor().View({3, 3}).ToString());
+
+            im_low = im.Resize(0.5, t::geometry::Image::InterpType::Lanczos);
+            utility::LogInfo("Lanczos(impl. dependent): {}",
+                             im_low.AsTensor().View({3, 3}).ToString());
         }
     }
 }
@@ -691,15 +700,9 @@ TEST_P(ImagePermuteDevices, PyrDown) {
                 core::Tensor(input_data, {6, 6, 1}, core::Float32, device);
         t::geometry::Image im(data);
 
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.PyrDown(), std::runtime_error);
-        } else {
-            im = im.PyrDown();
-            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                    output_ref, {3, 3, 1}, core::Float32, device)));
-        }
+        im = im.PyrDown();
+        EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                output_ref, {3, 3, 1}, core::Float32, device)));
     }
 
     {  // UInt8
@@ -725,19 +728,13 @@ TEST_P(ImagePermuteDevices, PyrDown) {
                 core::Tensor(input_data, {6, 6, 1}, core::UInt8, device);
         t::geometry::Image im(data);
 
-        if (!t::geometry::Image::HAVE_IPPICV &&
-            device.GetType() ==
-                    core::Device::DeviceType::CPU) {  // Not Implemented
-            ASSERT_THROW(im.PyrDown(), std::runtime_error);
+        im = im.PyrDown();
+        if (device.GetType() == core::Device::DeviceType::CPU) {
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
         } else {
-            im = im.PyrDown();
-            if (device.GetType() == core::Device::DeviceType::CPU) {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_ipp, {3, 3, 1}, core::UInt8, device)));
-            } else {
-                EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
-                        output_ref_npp, {3, 3, 1}, core::UInt8, device)));
-            }
+            EXPECT_TRUE(im.AsTensor().AllClose(core::Tensor(
+                    output_ref_npp, {3, 3, 1}, core::UInt8, device)));
         }
     }
 }
@@ -775,46 +772,39 @@ TEST_P(ImagePermuteDevices, Dilate) {
     core::Tensor t_input_uint8_t =
             t_input.To(core::UInt8);  // normal static_cast is OK
     t::geometry::Image input_uint8_t(t_input_uint8_t);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() == core::Device::DeviceType::CPU) {  // Not Implemented
-        ASSERT_THROW(input_uint8_t.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input_uint8_t.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<uint8_t>(),
-                    ElementsAreArray(output_ref));
-    }
+    output = input_uint8_t.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<uint8_t>(),
+                ElementsAreArray(output_ref));
 
     // UInt16
     core::Tensor t_input_uint16_t =
             t_input.To(core::UInt16);  // normal static_cast is OK
     t::geometry::Image input_uint16_t(t_input_uint16_t);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() == core::Device::DeviceType::CPU) {  // Not Implemented
-        ASSERT_THROW(input_uint16_t.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input_uint16_t.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<uint16_t>(),
-                    ElementsAreArray(output_ref));
-    }
+    output = input_uint16_t.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<uint16_t>(),
+                ElementsAreArray(output_ref));
 
     // Float32
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() == core::Device::DeviceType::CPU) {  // Not Implemented
-        ASSERT_THROW(input.Dilate(kernel_size), std::runtime_error);
-    } else {
-        output = input.Dilate(kernel_size);
-        EXPECT_EQ(output.GetRows(), input.GetRows());
-        EXPECT_EQ(output.GetCols(), input.GetCols());
-        EXPECT_EQ(output.GetChannels(), input.GetChannels());
-        EXPECT_THAT(output.AsTensor().ToFlatVector<float>(),
-                    ElementsAreArray(output_ref));
-    }
+    output = input.Dilate(kernel_size);
+    EXPECT_EQ(output.GetRows(), input.GetRows());
+    EXPECT_EQ(output.GetCols(), input.GetCols());
+    EXPECT_EQ(output.GetChannels(), input.GetChannels());
+    EXPECT_THAT(output.AsTensor().ToFlatVector<float>(),
+                ElementsAreArray(output_ref));
+
+    // The native kernel follows IPP on all devices.
+    core::Tensor native = core::Tensor::EmptyLike(t_input_uint8_t);
+    t::geometry::kernel::image::Dilate(t_input_uint8_t, native, kernel_size);
+    EXPECT_THAT(native.ToFlatVector<uint8_t>(), ElementsAreArray(output_ref));
+    native = core::Tensor::EmptyLike(t_input);
+    t::geometry::kernel::image::Dilate(t_input, native, kernel_size);
+    EXPECT_THAT(native.ToFlatVector<float>(), ElementsAreArray(output_ref));
 }
 
 // tImage: (r, c, ch) | legacy Image: (u, v, ch) = (c, r, ch)
@@ -929,22 +919,16 @@ TEST_P(ImagePermuteDevices, DISABLED_CreateNormalMap_Visual) {
     // We have to apply a bilateral filter, otherwise normals would be too
     // noisy.
     auto depth_clipped = depth.ClipTransform(1000.0, 0.0, 3.0, invalid_fill);
-    if (!t::geometry::Image::HAVE_IPPICV &&
-        device.GetType() == core::Device::DeviceType::CPU) {  // Not Implemented
-        ASSERT_THROW(depth_clipped.FilterBilateral(5, 5.0, 10.0),
-                     std::runtime_error);
-    } else {
-        auto depth_bilateral = depth_clipped.FilterBilateral(5, 5.0, 10.0);
-        auto vertex_map_for_normal =
-                depth_bilateral.CreateVertexMap(intrinsic_t, invalid_fill);
-        auto normal_map = vertex_map_for_normal.CreateNormalMap(invalid_fill);
-
-        // Use abs for better visualization
-        normal_map.AsTensor() = normal_map.AsTensor().Abs();
-        visualization::DrawGeometries(
-                {std::make_shared<open3d::geometry::Image>(
-                        normal_map.ToLegacy())});
-    }
+    auto depth_bilateral = depth_clipped.FilterBilateral(5, 5.0, 10.0);
+    auto vertex_map_for_normal =
+            depth_bilateral.CreateVertexMap(intrinsic_t, invalid_fill);
+    auto normal_map = vertex_map_for_normal.CreateNormalMap(invalid_fill);
+
+    // Use abs for better visualization
+    normal_map.AsTensor() = normal_map.AsTensor().Abs();
+    visualization::DrawGeometries(
+            {std::make_shared<open3d::geometry::Image>(
+                    normal_map.ToLegacy())});
 }
 
 TEST_P(ImagePermuteDevices, DISABLED_ColorizeDepth) {
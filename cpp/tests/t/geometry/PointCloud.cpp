@@ -28,6 +28,8 @@
 
 #include <gmock/gmock.h>
 
+#include <random>
+
 #include "core/CoreTest.h"
 #include "open3d/core/Tensor.h"
 #include "open3d/data/Dataset.h"
@@ -295,6 +297,68 @@ TEST_P(PointCloudPermuteDevices, EstimateNormals) {
     EXPECT_TRUE(pcd.GetPointNormals().AllClose(normals, 1e-4, 1e-4));
 }
 
+TEST_P(PointCloudPermuteDevices, OrientNormalsConsistentTangentPlane) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd(
+            core::Tensor::Init<double>({{0, 0, 0},
+                                        {0, 0, 1},
+                                        {0, 1, 0},
+                                        {0, 1, 1},
+                                        {1, 0, 0},
+                                        {1, 0, 1},
+                                        {1, 1, 0},
+                                        {1, 1, 1},
+                                        {0.5, 0.5, -0.25},
+                                        {0.5, 0.5, 1.25},
+                                        {0.5, -0.25, 0.5},
+                                        {0.5, 1.25, 0.5},
+                                        {-0.25, 0.5, 0.5},
+                                        {1.25, 0.5, 0.5}},
+                                       device));
+    const double a = 0.57735;
+    const double b = 0.0927618;
+    const double c = 0.991358;
+    pcd.SetPointNormals(core::Tensor::Init<double>({{a, a, a},
+                                                    {-a, -a, a},
+                                                    {a, -a, a},
+                                                    {-a, a, a},
+                                                    {-a, a, a},
+                                                    {a, -a, a},
+                                                    {-a, -a, a},
+                                                    {a, a, a},
+                                                    {-b, -b, -c},
+                                                    {b, b, -c},
+                                                    {b, c, b},
+                                                    {-b, c, -b},
+                                                    {c, b, b},
+                                                    {c, -b, -b}},
+                                                   device));
+
+    pcd.OrientNormalsConsistentTangentPlane(/*k=*/4);
+    EXPECT_EQ(pcd.GetPointNormals().GetDevice(), device);
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(
+            core::Tensor::Init<double>({{-a, -a, -a},
+                                        {-a, -a, a},
+                                        {-a, a, -a},
+                                        {-a, a, a},
+                                        {a, -a, -a},
+                                        {a, -a, a},
+                                        {a, a, -a},
+                                        {a, a, a},
+                                        {-b, -b, -c},
+                                        {-b, -b, c},
+                                        {-b, -c, -b},
+                                        {-b, c, -b},
+                                        {-c, -b, -b},
+                                        {c, -b, -b}},
+                                       device)));
+
+    // Without normals, there is nothing to orient.
+    pcd.RemovePointAttr("normals");
+    EXPECT_ANY_THROW(pcd.OrientNormalsConsistentTangentPlane(4));
+}
+
 TEST_P(PointCloudPermuteDevices, FromLegacy) {
     core::Device device = GetParam();
     geometry::PointCloud legacy_pcd;
@@ -710,6 +774,54 @@ TEST_P(PointCloudPermuteDevices, VoxelDownSample) {
             core::Tensor::Init<float>({{0, 0, 0}}, device)));
 }
 
+TEST_P(PointCloudPermuteDevices, FarthestPointDownSample) {
+    core::Device device = GetParam();
+
+    t::geometry::PointCloud pcd_small(
+            core::Tensor::Init<float>({{0, 2.0, 0},
+                                       {1.0, 1.5, 0},
+                                       {0, 1.0, 0},
+                                       {1.0, 1.0, 0},
+                                       {0, 0, 1.0},
+                                       {1.0, 0, 1.0},
+                                       {0, 1.0, 1.0},
+                                       {1.0, 1.0, 1.5}},
+                                      device));
+    pcd_small.SetPointColors(
+            core::Tensor::Arange(0, 8, 1, core::Float32, device)
+                    .Reshape({8, 1})
+                    .Expand({8, 3})
+                    .Contiguous());
+    // Samples are returned in the order they are selected.
+    auto pcd_small_down = pcd_small.FarthestPointDownSample(4);
+    EXPECT_TRUE(pcd_small_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>({{0, 2.0, 0},
+                                       {1.0, 0, 1.0},
+                                       {1.0, 1.0, 0},
+                                       {0, 1.0, 1.0}},
+                                      device)));
+    EXPECT_TRUE(pcd_small_down.GetPointColors().AllClose(
+            core::Tensor::Init<float>(
+                    {{0, 0, 0}, {5, 5, 5}, {3, 3, 3}, {6, 6, 6}}, device)));
+
+    pcd_small_down = pcd_small.FarthestPointDownSample(3, 4);
+    EXPECT_TRUE(pcd_small_down.GetPointPositions().AllClose(
+            core::Tensor::Init<float>(
+                    {{0, 0, 1.0}, {0, 2.0, 0}, {1.0, 1.0, 1.5}}, device)));
+
+    // Skipping buckets does not change the samples.
+    t::geometry::PointCloud pcd;
+    data::PLYPointCloud pointcloud_ply;
+    t::io::ReadPointCloud(pointcloud_ply.GetPath(), pcd);
+    pcd = pcd.To(device);
+    const t::geometry::PointCloud pcd_dense =
+            pcd.FarthestPointDownSample(200, 3);
+    const t::geometry::PointCloud pcd_bucketed =
+            pcd.FarthestPointDownSample(200, 3, 64);
+    EXPECT_TRUE(pcd_dense.GetPointPositions().AllClose(
+            pcd_bucketed.GetPointPositions()));
+}
+
 TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
     core::Device device = GetParam();
 
@@ -735,6 +847,60 @@ TEST_P(PointCloudPermuteDevices, RemoveRadiusOutliers) {
                                       device)));
 }
 
+TEST_P(PointCloudPermuteDevices, SegmentPlane) {
+    core::Device device = GetParam();
+
+    // Points sampled from the plane x + y + z + 1 = 0 and one outlier.
+    t::geometry::PointCloud pcd(core::Tensor::Init<float>({{2.0, 1.0, -4.0},
+                                                           {1.0, 3.0, -5.0},
+                                                           {0.0, 0.0, 0.0},
+                                                           {-2.0, -1.0, 2.0},
+                                                           {-2.0, -2.0, 3.0},
+                                                           {10.0, 10.0, -21.0}},
+                                                          device));
+    for (int ransac_n : {3, 4}) {
+        core::Tensor plane_model, inliers;
+        std::tie(plane_model, inliers) =
+                pcd.SegmentPlane(0.01, ransac_n, 10, 0.99999999, /*seed=*/0);
+        EXPECT_EQ(plane_model.GetDtype(), core::Float64);
+        EXPECT_EQ(plane_model.GetDevice(), device);
+        EXPECT_TRUE(inliers.AllEqual(
+                core::Tensor::Init<int64_t>({0, 1, 3, 4, 5}, device)));
+        const double sign = plane_model[0].Item<double>() > 0 ? 1 : -1;
+        EXPECT_TRUE((plane_model * sign)
+                            .AllClose(core::Tensor::Full(
+                                    {4}, 1 / std::sqrt(3), core::Float64,
+                                    device)));
+    }
+
+    // Same inliers as the legacy point cloud.
+    geometry::PointCloud pcd_legacy;
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<double> uniform(0, 1);
+    for (int i = 0; i < 2000; ++i) {
+        pcd_legacy.points_.emplace_back(uniform(rng), uniform(rng), 0);
+    }
+    for (int i = 0; i < 1000; ++i) {
+        pcd_legacy.points_.emplace_back(uniform(rng), uniform(rng),
+                                        uniform(rng));
+    }
+    std::vector<size_t> inliers_legacy;
+    std::tie(std::ignore, inliers_legacy) =
+            pcd_legacy.SegmentPlane(0.001, 3, 1000, 0.99999999, 0);
+    core::Tensor inliers;
+    std::tie(std::ignore, inliers) =
+            t::geometry::PointCloud::FromLegacy(pcd_legacy, core::Float64,
+                                                device)
+                    .SegmentPlane(0.001, 3, 1000, 0.99999999, 0);
+    EXPECT_EQ(inliers.ToFlatVector<int64_t>(),
+              std::vector<int64_t>(inliers_legacy.begin(),
+                                   inliers_legacy.end()));
+
+    EXPECT_ANY_THROW(pcd.SegmentPlane(0.01, 2));
+    EXPECT_ANY_THROW(pcd.SegmentPlane(0.01, 3, 10, 0));
+    EXPECT_ANY_THROW(pcd.SegmentPlane(0.01, 7));
+}
+
 TEST_P(PointCloudPermuteDevices, ClusterDBSCAN) {
     core::Device device = GetParam();
     if (device.GetType() != core::Device::DeviceType::CPU) GTEST_SKIP();
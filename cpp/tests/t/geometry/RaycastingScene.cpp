@@ -0,0 +1,118 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "open3d/t/geometry/RaycastingScene.h"
+
+#include "open3d/core/Tensor.h"
+#include "open3d/geometry/TriangleMesh.h"
+#include "open3d/t/geometry/TriangleMesh.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+// Returns the cell centers of the grid in the order used by the grid queries.
+static core::Tensor GridCellCenters(const std::vector<float>& min_bound,
+                                    const std::vector<float>& max_bound,
+                                    const core::SizeVector& resolution) {
+    std::vector<float> points;
+    points.reserve(resolution.NumElements() * 3);
+    for (int64_t i = 0; i < resolution[0]; ++i) {
+        for (int64_t j = 0; j < resolution[1]; ++j) {
+            for (int64_t k = 0; k < resolution[2]; ++k) {
+                const int64_t cell[3] = {i, j, k};
+                for (int d = 0; d < 3; ++d) {
+                    const float cell_size = (max_bound[d] - min_bound[d]) /
+                                            float(resolution[d]);
+                    points.push_back(min_bound[d] + 0.5f * cell_size +
+                                     float(cell[d]) * cell_size);
+                }
+            }
+        }
+    }
+    return core::Tensor(
+            points, {resolution[0], resolution[1], resolution[2], 3},
+            core::Float32);
+}
+
+TEST(RaycastingScene, ComputeGridMatchesPerPointQueries) {
+    auto sphere = geometry::TriangleMesh::CreateSphere(0.8, 20);
+    t::geometry::RaycastingScene scene;
+    scene.AddTriangles(t::geometry::TriangleMesh::FromLegacy(*sphere));
+
+    // The resolution is not a multiple of the tile size so that partial
+    // tiles are tested as well.
+    const std::vector<float> min_bound = {-1.1f, -1.2f, -0.9f};
+    const std::vector<float> max_bound = {1.f, 1.3f, 1.05f};
+    const core::SizeVector resolution = {21, 27, 13};
+    const core::Tensor min_bound_t(min_bound, {3}, core::Float32);
+    const core::Tensor max_bound_t(max_bound, {3}, core::Float32);
+    const core::Tensor points =
+            GridCellCenters(min_bound, max_bound, resolution);
+
+    const core::Tensor sdf_grid =
+            scene.ComputeSignedDistanceGrid(min_bound_t, max_bound_t,
+                                            resolution);
+    const core::Tensor sdf = scene.ComputeSignedDistance(points);
+    ASSERT_EQ(sdf_grid.GetShape(), resolution);
+    EXPECT_TRUE(sdf_grid.AllClose(sdf, 1e-5, 1e-5));
+
+    const core::Tensor occupancy_grid =
+            scene.ComputeOccupancyGrid(min_bound_t, max_bound_t, resolution);
+    const core::Tensor occupancy = scene.ComputeOccupancy(points);
+    ASSERT_EQ(occupancy_grid.GetShape(), resolution);
+    EXPECT_TRUE(occupancy_grid.AllEqual(occupancy));
+    // The grid must cover the inside and the outside of the sphere.
+    const float num_occupied = occupancy.Sum({0, 1, 2}).Item<float>();
+    EXPECT_GT(num_occupied, 0.f);
+    EXPECT_LT(num_occupied, float(resolution.NumElements()));
+
+    // The chunked queries must produce the same values.
+    const int64_t chunk_size = 4;
+    core::Tensor sdf_chunks = core::Tensor::Zeros(resolution, core::Float32);
+    scene.ComputeSignedDistanceGrid(
+            min_bound_t, max_bound_t, resolution,
+            [&](int64_t x_begin, const core::Tensor& chunk) {
+                sdf_chunks.Slice(0, x_begin, x_begin + chunk.GetShape(0))
+                        .CopyFrom(chunk);
+            },
+            chunk_size);
+    EXPECT_TRUE(sdf_chunks.AllClose(sdf, 1e-5, 1e-5));
+
+    core::Tensor occupancy_chunks =
+            core::Tensor::Zeros(resolution, core::Float32);
+    scene.ComputeOccupancyGrid(
+            min_bound_t, max_bound_t, resolution,
+            [&](int64_t x_begin, const core::Tensor& chunk) {
+                occupancy_chunks.Slice(0, x_begin, x_begin + chunk.GetShape(0))
+                        .CopyFrom(chunk);
+            },
+            chunk_size);
+    EXPECT_TRUE(occupancy_chunks.AllEqual(occupancy));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -29,7 +29,9 @@
 #include <gmock/gmock.h>
 
 #include "core/CoreTest.h"
+#include "open3d/core/EigenConverter.h"
 #include "open3d/core/TensorCheck.h"
+#include "open3d/t/geometry/PointCloud.h"
 #include "tests/Tests.h"
 
 namespace open3d {
@@ -453,5 +455,161 @@ TEST_P(TriangleMeshPermuteDevices, ToLegacy) {
                                   Pointwise(FloatEq(), {1.0, 1.1})}));
 }
 
+TEST_P(TriangleMeshPermuteDevices, CreateFromPointCloudPoisson) {
+    core::Device device = GetParam();
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    sphere->ComputeVertexNormals();
+    geometry::PointCloud pcd_legacy(sphere->vertices_);
+    pcd_legacy.normals_ = sphere->vertex_normals_;
+
+    std::shared_ptr<geometry::TriangleMesh> mesh_legacy;
+    std::vector<double> densities_legacy;
+    std::tie(mesh_legacy, densities_legacy) =
+            geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                    pcd_legacy, 4, 0, 1.1f, false, /*n_threads=*/1);
+
+    // Float64 input takes the same solver path as the legacy point cloud.
+    t::geometry::PointCloud pcd = t::geometry::PointCloud::FromLegacy(
+            pcd_legacy, core::Float64, device);
+    t::geometry::TriangleMesh mesh;
+    std::vector<std::pair<std::string, double>> timings;
+    std::tie(mesh, timings) =
+            t::geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                    pcd, 4, 0, 1.1f, false, /*n_threads=*/1);
+
+    EXPECT_EQ(mesh.GetDevice(), device);
+    EXPECT_FALSE(mesh.HasVertexColors());
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    mesh_legacy->vertices_, core::Float64, device)));
+    EXPECT_TRUE(mesh.GetTriangleIndices().AllClose(
+            core::eigen_converter::EigenVector3iVectorToTensor(
+                    mesh_legacy->triangles_, core::Int64, device)));
+    const int64_t num_vertices = densities_legacy.size();
+    EXPECT_TRUE(mesh.GetVertexAttr("densities")
+                        .AllClose(core::Tensor(densities_legacy,
+                                               {num_vertices}, core::Float64,
+                                               device)));
+    ASSERT_GT(timings.size(), 1u);
+    EXPECT_EQ(timings.back().first, "total");
+    double stage_sum = 0;
+    for (const auto &stage : timings) {
+        EXPECT_GE(stage.second, 0);
+        if (stage.first != "total") stage_sum += stage.second;
+    }
+    // Stages are timed back to back, so they cannot outlast the whole run.
+    EXPECT_LE(stage_sum, timings.back().second * (1 + 1e-6) + 1e-6);
+
+    // Float32 positions are streamed in place and the output keeps the dtype.
+    pcd = t::geometry::PointCloud::FromLegacy(pcd_legacy, core::Float32,
+                                              device);
+    std::tie(mesh, timings) =
+            t::geometry::TriangleMesh::CreateFromPointCloudPoisson(
+                    pcd, 4, 0, 1.1f, false, /*n_threads=*/1);
+    EXPECT_EQ(mesh.GetVertexPositions().GetDtype(), core::Float32);
+    EXPECT_EQ(mesh.GetVertexAttr("densities").GetDtype(), core::Float32);
+    EXPECT_EQ(mesh.GetTriangleIndices().GetLength(),
+              (int64_t)mesh_legacy->triangles_.size());
+}
+
+TEST_P(TriangleMeshPermuteDevices, FilterSmooth) {
+    core::Device device = GetParam();
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    sphere->ComputeVertexNormals();
+    sphere->PaintUniformColor({0.5, 0.2, 0.1});
+    sphere->vertex_colors_[0] = {1, 0, 0};
+    sphere->vertices_[0] *= 1.5;
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *sphere, core::Float64, core::Int64, device);
+
+    auto ExpectMatchesLegacy = [&](const t::geometry::TriangleMesh &filtered,
+                                   const geometry::TriangleMesh &legacy) {
+        EXPECT_EQ(filtered.GetDevice(), device);
+        EXPECT_TRUE(filtered.GetVertexPositions().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        legacy.vertices_, core::Float64, device)));
+        EXPECT_TRUE(filtered.GetVertexNormals().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        legacy.vertex_normals_, core::Float64, device)));
+        EXPECT_TRUE(filtered.GetVertexColors().AllClose(
+                core::eigen_converter::EigenVector3dVectorToTensor(
+                        legacy.vertex_colors_, core::Float64, device)));
+        EXPECT_TRUE(filtered.GetTriangleIndices().AllEqual(
+                mesh.GetTriangleIndices()));
+    };
+    ExpectMatchesLegacy(mesh.FilterSharpen(2, 0.1),
+                        *sphere->FilterSharpen(2, 0.1));
+    ExpectMatchesLegacy(mesh.FilterSmoothSimple(3),
+                        *sphere->FilterSmoothSimple(3));
+    ExpectMatchesLegacy(mesh.FilterSmoothLaplacian(3, 0.5),
+                        *sphere->FilterSmoothLaplacian(3, 0.5));
+    ExpectMatchesLegacy(mesh.FilterSmoothTaubin(3, 0.5, -0.53),
+                        *sphere->FilterSmoothTaubin(3, 0.5, -0.53));
+
+    // The input mesh is not modified.
+    EXPECT_TRUE(mesh.GetVertexPositions().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    sphere->vertices_, core::Float64, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SubdivideLoop) {
+    core::Device device = GetParam();
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 5);
+    sphere->ComputeVertexNormals();
+    sphere->PaintUniformColor({0.5, 0.2, 0.1});
+    // Remove two triangles to have a boundary.
+    sphere->triangles_.resize(sphere->triangles_.size() - 2);
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *sphere, core::Float32, core::Int32, device);
+
+    auto legacy = sphere->SubdivideLoop(2);
+    t::geometry::TriangleMesh subdivided = mesh.SubdivideLoop(2);
+    EXPECT_EQ(subdivided.GetDevice(), device);
+    EXPECT_EQ(subdivided.GetVertexPositions().GetDtype(), core::Float32);
+    EXPECT_TRUE(subdivided.GetVertexPositions().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy->vertices_, core::Float32, device)));
+    EXPECT_TRUE(subdivided.GetVertexNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy->vertex_normals_, core::Float32, device)));
+    EXPECT_TRUE(subdivided.GetVertexColors().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy->vertex_colors_, core::Float32, device)));
+    EXPECT_TRUE(subdivided.GetTriangleIndices().AllEqual(
+            core::eigen_converter::EigenVector3iVectorToTensor(
+                    legacy->triangles_, core::Int32, device)));
+}
+
+TEST_P(TriangleMeshPermuteDevices, SamplePointsPoissonDisk) {
+    core::Device device = GetParam();
+
+    auto sphere = geometry::TriangleMesh::CreateSphere(1.0, 10);
+    sphere->ComputeVertexNormals();
+    sphere->PaintUniformColor({0.5, 0.2, 0.1});
+    t::geometry::TriangleMesh mesh = t::geometry::TriangleMesh::FromLegacy(
+            *sphere, core::Float64, core::Int64, device);
+
+    auto legacy = sphere->SamplePointsPoissonDisk(200, 5, nullptr, false, 0);
+    t::geometry::PointCloud pcd =
+            mesh.SamplePointsPoissonDisk(200, 5, false, 0);
+    EXPECT_EQ(pcd.GetDevice(), device);
+    EXPECT_EQ(pcd.GetPointPositions().GetDtype(), core::Float64);
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy->points_, core::Float64, device)));
+    EXPECT_TRUE(pcd.GetPointNormals().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy->normals_, core::Float64, device)));
+    EXPECT_TRUE(pcd.GetPointColors().AllClose(
+            core::eigen_converter::EigenVector3dVectorToTensor(
+                    legacy->colors_, core::Float64, device)));
+
+    EXPECT_ANY_THROW(t::geometry::TriangleMesh(device).SamplePointsPoissonDisk(
+            200));
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -282,6 +282,168 @@ TEST_P(VoxelBlockGridPermuteDevices, Integrate) {
     }
 }
 
+TEST_P(VoxelBlockGridPermuteDevices, IntegrateFrames) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float trunc_voxel_multiplier = 4.0;
+
+    const size_t num_frames = 3;
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::vector<Image> depths, colors;
+    for (size_t i = 0; i < num_frames; ++i) {
+        depths.push_back(
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                        ->To(device));
+        colors.push_back(
+                t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                        ->To(device));
+    }
+    extrinsics.resize(num_frames);
+
+    for (auto backend : backends) {
+        for (auto &dtype :
+             std::vector<core::Dtype>{core::Float32, core::UInt16}) {
+            auto vbg_seq = VoxelBlockGrid(
+                    {"tsdf", "weight", "color"}, {core::Float32, dtype, dtype},
+                    {{1}, {1}, {3}}, 3.0 / 512, 8, 10000, device, backend);
+            auto vbg_batch = VoxelBlockGrid(
+                    {"tsdf", "weight", "color"}, {core::Float32, dtype, dtype},
+                    {{1}, {1}, {3}}, 3.0 / 512, 8, 10000, device, backend);
+
+            // The union covers every per-frame block exactly once.
+            core::Tensor block_coords = vbg_batch.GetUniqueBlockCoordinates(
+                    depths, intrinsic, extrinsics, depth_scale, depth_max,
+                    trunc_voxel_multiplier);
+            core::Tensor block_coords_0 = vbg_batch.GetUniqueBlockCoordinates(
+                    depths[0], intrinsic, extrinsics[0], depth_scale,
+                    depth_max, trunc_voxel_multiplier);
+            EXPECT_GE(block_coords.GetLength(), block_coords_0.GetLength());
+
+            for (size_t i = 0; i < num_frames; ++i) {
+                vbg_seq.Integrate(block_coords, depths[i], colors[i],
+                                  intrinsic, extrinsics[i], depth_scale,
+                                  depth_max, trunc_voxel_multiplier);
+            }
+            vbg_batch.Integrate(block_coords, depths, colors, intrinsic,
+                                intrinsic, extrinsics, depth_scale, depth_max,
+                                trunc_voxel_multiplier);
+
+            // Batched integration must match frame-by-frame integration.
+            core::HashMap hashmap_seq = vbg_seq.GetHashMap();
+            core::HashMap hashmap_batch = vbg_batch.GetHashMap();
+            EXPECT_EQ(hashmap_seq.Size(), hashmap_batch.Size());
+
+            core::Tensor indices_seq =
+                    hashmap_seq.GetActiveIndices().To(core::Int64);
+            core::Tensor keys = hashmap_seq.GetKeyTensor().IndexGet(
+                    {indices_seq});
+            core::Tensor indices_batch, masks;
+            hashmap_batch.Find(keys, indices_batch, masks);
+            EXPECT_TRUE(masks.All());
+            indices_batch = indices_batch.To(core::Int64);
+
+            for (const std::string attr : {"tsdf", "weight", "color"}) {
+                core::Tensor value_seq =
+                        vbg_seq.GetAttribute(attr).IndexGet({indices_seq});
+                core::Tensor value_batch =
+                        vbg_batch.GetAttribute(attr).IndexGet({indices_batch});
+                EXPECT_TRUE(value_seq.AllClose(value_batch));
+            }
+        }
+    }
+}
+
+TEST_P(VoxelBlockGridPermuteDevices, ExtractTriangleMeshUpdate) {
+    core::Device device = GetParam();
+    std::vector<core::HashBackendType> backends = EnumerateBackends(device);
+
+    core::Tensor intrinsic = GetIntrinsicTensor();
+    std::vector<core::Tensor> extrinsics = GetExtrinsicTensors();
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float trunc_voxel_multiplier = 4.0;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    for (auto backend : backends) {
+        auto vbg = VoxelBlockGrid({"tsdf", "weight", "color"},
+                                  {core::Float32, core::UInt16, core::UInt16},
+                                  {{1}, {1}, {3}}, 3.0 / 512, 8, 10000, device,
+                                  backend);
+        auto integrate = [&](size_t i) {
+            Image depth =
+                    t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                            ->To(device);
+            Image color =
+                    t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                            ->To(device);
+            core::Tensor block_coords = vbg.GetUniqueBlockCoordinates(
+                    depth, intrinsic, extrinsics[i], depth_scale, depth_max,
+                    trunc_voxel_multiplier);
+            vbg.Integrate(block_coords, depth, color, intrinsic, extrinsics[i],
+                          depth_scale, depth_max, trunc_voxel_multiplier);
+            return block_coords;
+        };
+
+        for (size_t i = 0; i < 3; ++i) {
+            integrate(i);
+        }
+
+        // Extracting from all the blocks matches the full extraction.
+        core::HashMap hashmap = vbg.GetHashMap();
+        core::Tensor all_coords = hashmap.GetKeyTensor().IndexGet(
+                {hashmap.GetActiveIndices().To(core::Int64)});
+        TriangleMesh mesh = vbg.ExtractTriangleMesh(0.0f);
+        TriangleMesh mesh_all = vbg.ExtractTriangleMesh(all_coords, 0.0f);
+        EXPECT_EQ(mesh.GetVertexPositions().GetLength(),
+                  mesh_all.GetVertexPositions().GetLength());
+        EXPECT_EQ(mesh.GetTriangleIndices().GetLength(),
+                  mesh_all.GetTriangleIndices().GetLength());
+        EXPECT_EQ(mesh_all.GetTriangleAttr("block_coords").GetLength(),
+                  mesh_all.GetTriangleIndices().GetLength());
+
+        // All the integrated blocks are dirty.
+        EXPECT_EQ(vbg.GetDirtyBlockCoordinates().GetLength(),
+                  all_coords.GetLength());
+        vbg.ClearDirtyBlocks();
+        EXPECT_EQ(vbg.GetDirtyBlockCoordinates().GetLength(), 0);
+        auto empty_update = vbg.ExtractTriangleMeshUpdate(0.0f);
+        EXPECT_EQ(empty_update.first.GetTriangleIndices().GetLength(), 0);
+        EXPECT_EQ(empty_update.second.GetLength(), 0);
+
+        // Only blocks around the new frame are re-meshed.
+        core::Tensor frame_coords = integrate(3);
+        core::Tensor dirty_coords = vbg.GetDirtyBlockCoordinates();
+        EXPECT_EQ(dirty_coords.GetLength(), frame_coords.GetLength());
+        core::Tensor update_coords = vbg.GetDirtyBlockCoordinates(true);
+        EXPECT_GE(update_coords.GetLength(), dirty_coords.GetLength());
+
+        TriangleMesh patch;
+        core::Tensor remeshed_coords;
+        std::tie(patch, remeshed_coords) = vbg.ExtractTriangleMeshUpdate(0.0f);
+        EXPECT_TRUE(remeshed_coords.AllEqual(update_coords));
+        EXPECT_EQ(vbg.GetDirtyBlockCoordinates().GetLength(), 0);
+
+        // The patch holds exactly the triangles of the re-meshed blocks.
+        hashmap = vbg.GetHashMap();
+        all_coords = hashmap.GetKeyTensor().IndexGet(
+                {hashmap.GetActiveIndices().To(core::Int64)});
+        mesh_all = vbg.ExtractTriangleMesh(all_coords, 0.0f);
+        core::HashSet remeshed_set(remeshed_coords.GetLength(), core::Int32,
+                                   {3}, device);
+        remeshed_set.Insert(remeshed_coords);
+        core::Tensor buf_indices, masks;
+        remeshed_set.Find(mesh_all.GetTriangleAttr("block_coords"),
+                          buf_indices, masks);
+        EXPECT_EQ(patch.GetTriangleIndices().GetLength(),
+                  masks.To(core::Int64).Sum({0}).Item<int64_t>());
+    }
+}
+
 TEST_P(VoxelBlockGridPermuteDevices, IO) {
     core::Device device = GetParam();
     std::vector<core::HashBackendType> backends = EnumerateBackends(device);
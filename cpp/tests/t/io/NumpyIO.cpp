@@ -27,7 +27,10 @@
 #include "open3d/t/io/NumpyIO.h"
 
 #include <cmath>
+#include <cstring>
+#include <fstream>
 #include <limits>
+#include <sstream>
 
 #include "open3d/t/io/NumpyIO.h"
 #include "open3d/utility/FileSystem.h"
@@ -176,5 +179,138 @@ TEST_P(NumpyIOPermuteDevices, NpzWriteRead) {
     utility::filesystem::RemoveFile(file_name);
 }
 
+TEST_P(NumpyIOPermuteDevices, NpyMemoryMap) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensor_mmap.npy";
+
+    core::Tensor t = core::Tensor::Init<float>({{1, 2}, {3, 4}}, device);
+    t.Save(file_name);
+
+    core::Tensor t_load = core::Tensor::Load(file_name, /*memory_map=*/true);
+    EXPECT_EQ(t_load.GetDevice(), core::Device("CPU:0"));
+    EXPECT_TRUE(t.AllClose(t_load.To(device)));
+
+    // Writes go to private pages and never reach the file.
+    t_load.Fill(0);
+    EXPECT_EQ(t_load.ToFlatVector<float>(), std::vector<float>({0, 0, 0, 0}));
+    core::Tensor t_reload = t::io::ReadNpy(file_name, /*memory_map=*/true);
+    EXPECT_TRUE(t.AllClose(t_reload.To(device)));
+
+    // The mapping stays valid as long as a tensor refers to it.
+    core::Tensor t_slice = t_reload.Slice(0, 1, 2);
+    t_reload = core::Tensor();
+    EXPECT_EQ(t_slice.ToFlatVector<float>(), std::vector<float>({3, 4}));
+
+    // Clean up.
+    t_load = core::Tensor();
+    t_slice = core::Tensor();
+    utility::filesystem::RemoveFile(file_name);
+}
+
+TEST_P(NumpyIOPermuteDevices, NpzMemoryMap) {
+    const core::Device device = GetParam();
+    const std::string file_name = "tensors_mmap.npz";
+
+    // Empty map.
+    t::io::WriteNpz(file_name, {});
+    EXPECT_EQ(t::io::ReadNpz(file_name, /*memory_map=*/true).size(), 0);
+
+    core::Tensor t0 = core::Tensor::Init<int32_t>({{1, 2}, {3, 4}}, device);
+    core::Tensor t1 = core::Tensor::Init<double>({5, 6, 7}, device);
+    core::Tensor t2 = core::Tensor::Init<uint8_t>({8}, device);
+    core::Tensor t3 = core::Tensor::Ones({0, 1, 0}, core::Float32, device);
+    t::io::WriteNpz(file_name,
+                    {{"t0", t0}, {"t1", t1}, {"t2", t2}, {"t3", t3}});
+
+    // Files written by WriteNpz() can be mapped without any copy, as the
+    // data of every array is aligned.
+    std::unordered_map<std::string, core::Tensor> tensor_map =
+            t::io::ReadNpz(file_name, /*memory_map=*/true);
+    EXPECT_EQ(tensor_map.size(), 4);
+    for (const auto& it : tensor_map) {
+        EXPECT_EQ(it.second.GetDevice(), core::Device("CPU:0"));
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(it.second.GetDataPtr()) % 64, 0);
+    }
+    EXPECT_TRUE(t0.AllClose(tensor_map.at("t0").To(device)));
+    EXPECT_TRUE(t1.AllClose(tensor_map.at("t1").To(device)));
+    EXPECT_TRUE(t2.AllClose(tensor_map.at("t2").To(device)));
+    EXPECT_TRUE(t3.AllClose(tensor_map.at("t3").To(device)));
+    EXPECT_EQ(tensor_map.at("t1").GetDtype(), core::Float64);
+
+    // The padded file can still be read without memory mapping.
+    std::unordered_map<std::string, core::Tensor> tensor_map_read =
+            t::io::ReadNpz(file_name);
+    EXPECT_EQ(tensor_map_read.size(), 4);
+    EXPECT_TRUE(t1.AllClose(tensor_map_read.at("t1").To(device)));
+
+    // Clean up.
+    tensor_map.clear();
+    utility::filesystem::RemoveFile(file_name);
+}
+
+// Zip64 extra fields only hold the sizes that are 0xFFFFFFFF in the local
+// header, the uncompressed size first.
+TEST(NumpyIO, NpzMemoryMapZip64) {
+    const std::string npy_name = "tensor_zip64.npy";
+    const std::string npz_name = "tensors_zip64.npz";
+    core::Tensor t = core::Tensor::Init<float>({{1, 2}, {3, 4}});
+    t.Save(npy_name);
+    std::ifstream npy_file(npy_name, std::ios::binary);
+    std::stringstream npy_stream;
+    npy_stream << npy_file.rdbuf();
+    npy_file.close();
+    const std::string npy = npy_stream.str();
+    const uint64_t npy_size = npy.size();
+
+    auto write_npz = [&](bool zip64_uncompressed, bool zip64_compressed) {
+        std::string header(30, '\0');
+        const uint32_t signature = 0x04034b50;
+        const uint32_t uncompressed_size =
+                zip64_uncompressed ? 0xFFFFFFFF : uint32_t(npy_size);
+        const uint32_t compressed_size =
+                zip64_compressed ? 0xFFFFFFFF : uint32_t(npy_size);
+        const uint16_t name_len = 5;
+        const uint16_t extra_len =
+                4 + 8 * (int(zip64_uncompressed) + int(zip64_compressed));
+        memcpy(&header[0], &signature, 4);
+        memcpy(&header[18], &compressed_size, 4);
+        memcpy(&header[22], &uncompressed_size, 4);
+        memcpy(&header[26], &name_len, 2);
+        memcpy(&header[28], &extra_len, 2);
+
+        std::string extra(extra_len, '\0');
+        const uint16_t field_id = 0x0001;
+        const uint16_t field_len = extra_len - 4;
+        memcpy(&extra[0], &field_id, 2);
+        memcpy(&extra[2], &field_len, 2);
+        for (size_t k = 4; k < extra.size(); k += 8) {
+            memcpy(&extra[k], &npy_size, 8);
+        }
+
+        // The reader stops at the central directory, which is left empty.
+        std::string central_directory(46 + 22, '\0');
+        const uint32_t central_signature = 0x02014b50;
+        memcpy(&central_directory[0], &central_signature, 4);
+
+        std::ofstream out(npz_name, std::ios::binary);
+        out << header << "a.npy" << extra << npy << central_directory;
+    };
+
+    for (bool zip64_uncompressed : {false, true}) {
+        for (bool zip64_compressed : {false, true}) {
+            if (!zip64_uncompressed && !zip64_compressed) continue;
+            write_npz(zip64_uncompressed, zip64_compressed);
+            std::unordered_map<std::string, core::Tensor> tensor_map =
+                    t::io::ReadNpz(npz_name, /*memory_map=*/true);
+            ASSERT_EQ(tensor_map.size(), 1);
+            EXPECT_TRUE(t.AllClose(tensor_map.at("a")));
+        }
+    }
+
+    // Clean up.
+    utility::filesystem::RemoveFile(npy_name);
+    utility::filesystem::RemoveFile(npz_name);
+}
+
 }  // namespace tests
 }  // namespace open3d
@@ -219,6 +219,45 @@ TEST(TPointCloudIO, ReadPointCloudFromPLY3) {
     EXPECT_FALSE(pcd.HasPointAttr("intensity"));
 }
 
+// Binary payload with mixed datatypes: "y" is converted to the dtype of the
+// positions, the int16 property is skipped.
+TEST(TPointCloudIO, ReadPointCloudFromBinaryPLY) {
+    std::string filename_out = utility::filesystem::GetTempDirectoryPath() +
+                               "/test_sample_binary.ply";
+    std::ofstream outfile(filename_out, std::ios::binary);
+    outfile << "ply\n"
+               "format binary_little_endian 1.0\n"
+               "element vertex 2\n"
+               "property float x\n"
+               "property double y\n"
+               "property float z\n"
+               "property short intensity\n"
+               "property ushort label\n"
+               "end_header\n";
+    for (int i = 0; i < 2; ++i) {
+        const float x = 1.5f * i, z = -1.f;
+        const double y = 2.0 + i;
+        const int16_t intensity = 7;
+        const uint16_t label = 40000 + i;
+        outfile.write(reinterpret_cast<const char *>(&x), sizeof(x));
+        outfile.write(reinterpret_cast<const char *>(&y), sizeof(y));
+        outfile.write(reinterpret_cast<const char *>(&z), sizeof(z));
+        outfile.write(reinterpret_cast<const char *>(&intensity),
+                      sizeof(intensity));
+        outfile.write(reinterpret_cast<const char *>(&label), sizeof(label));
+    }
+    outfile.close();
+
+    t::geometry::PointCloud pcd;
+    EXPECT_TRUE(t::io::ReadPointCloud(filename_out, pcd,
+                                      {"auto", false, false, true}));
+    EXPECT_TRUE(pcd.GetPointPositions().AllClose(core::Tensor::Init<float>(
+            {{0.f, 2.f, -1.f}, {1.5f, 3.f, -1.f}})));
+    EXPECT_FALSE(pcd.HasPointAttr("intensity"));
+    EXPECT_TRUE(pcd.GetPointAttr("label").AllEqual(
+            core::Tensor::Init<uint16_t>({{40000}, {40001}})));
+}
+
 // Read write empty point cloud.
 TEST(TPointCloudIO, ReadWriteEmptyPTS) {
     t::geometry::PointCloud pcd, pcd_read;
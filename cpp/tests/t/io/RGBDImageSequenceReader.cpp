@@ -0,0 +1,124 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018-2021 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "open3d/t/io/sensor/RGBDImageSequenceReader.h"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "open3d/core/Tensor.h"
+#include "open3d/t/io/ImageIO.h"
+#include "open3d/utility/FileSystem.h"
+#include "tests/Tests.h"
+
+namespace open3d {
+namespace tests {
+
+namespace {
+
+constexpr int64_t kNumFrames = 20;
+
+// Writes a sequence whose color and depth pixels hold the frame index.
+std::string WriteTestSequence() {
+    const std::string path = utility::filesystem::GetTempDirectoryPath() +
+                             "/test_rgbd_image_sequence";
+    utility::filesystem::MakeDirectoryHierarchy(path + "/color");
+    utility::filesystem::MakeDirectoryHierarchy(path + "/depth");
+    for (int64_t i = 0; i < kNumFrames; ++i) {
+        core::Tensor color = core::Tensor::Full({6, 8, 3}, i, core::UInt8);
+        core::Tensor depth =
+                core::Tensor::Full({6, 8, 1}, 10 * i, core::UInt16);
+        t::io::WriteImage(fmt::format("{}/color/{:05d}.png", path, i),
+                          t::geometry::Image(color));
+        t::io::WriteImage(fmt::format("{}/depth/{:05d}.png", path, i),
+                          t::geometry::Image(depth));
+    }
+    return path;
+}
+
+int64_t GetFrameIndex(const t::geometry::RGBDImage &frame) {
+    const int64_t color_index =
+            frame.color_.AsTensor()[0][0][0].Item<uint8_t>();
+    EXPECT_EQ(frame.depth_.AsTensor()[0][0][0].Item<uint16_t>(),
+              10 * color_index);
+    return color_index;
+}
+
+}  // namespace
+
+TEST(RGBDImageSequenceReader, NextFrame) {
+    const std::string path = WriteTestSequence();
+    t::io::RGBDImageSequenceReader reader(/*buffer_size=*/4,
+                                          /*num_workers=*/3);
+    ASSERT_TRUE(reader.Open(path));
+    EXPECT_EQ(reader.GetNumFrames(), kNumFrames);
+    EXPECT_EQ(reader.GetMetadata().width_, 8);
+    EXPECT_EQ(reader.GetMetadata().height_, 6);
+    EXPECT_EQ(reader.GetMetadata().color_channels_, 3);
+
+    for (int64_t i = 0; i < kNumFrames; ++i) {
+        EXPECT_FALSE(reader.IsEOF());
+        t::geometry::RGBDImage frame = reader.NextFrame();
+        EXPECT_EQ(GetFrameIndex(frame), i);
+        EXPECT_EQ(reader.GetTimestamp(),
+                  static_cast<uint64_t>(std::round(i * 1e6 / 30)));
+    }
+    EXPECT_TRUE(reader.NextFrame().IsEmpty());
+    EXPECT_TRUE(reader.IsEOF());
+
+    t::io::RGBDVideoReaderStatistics statistics = reader.GetStatistics();
+    EXPECT_EQ(statistics.num_frames_read_, kNumFrames);
+    EXPECT_GE(statistics.num_frames_decoded_, kNumFrames);
+    reader.Close();
+}
+
+TEST(RGBDImageSequenceReader, SeekTimestamp) {
+    const std::string path = WriteTestSequence();
+    std::unique_ptr<t::io::RGBDVideoReader> reader =
+            t::io::RGBDVideoReader::Create(path);
+    ASSERT_TRUE(reader->IsOpened());
+
+    EXPECT_EQ(GetFrameIndex(reader->NextFrame()), 0);
+    EXPECT_TRUE(reader->SeekTimestamp(
+            static_cast<uint64_t>(std::round(15 * 1e6 / 30))));
+    EXPECT_EQ(GetFrameIndex(reader->NextFrame()), 15);
+    EXPECT_EQ(GetFrameIndex(reader->NextFrame()), 16);
+
+    // Seeking back after the end restarts decoding.
+    while (!reader->IsEOF()) {
+        reader->NextFrame();
+    }
+    EXPECT_TRUE(reader->SeekTimestamp(0));
+    EXPECT_FALSE(reader->IsEOF());
+    EXPECT_EQ(GetFrameIndex(reader->NextFrame()), 0);
+    EXPECT_FALSE(reader->SeekTimestamp(
+            reader->GetMetadata().stream_length_usec_));
+}
+
+}  // namespace tests
+}  // namespace open3d
@@ -327,5 +327,70 @@ TEST_P(OdometryPermuteDevices, RGBDOdometryMultiScaleHybrid) {
     core::Tensor Ttrans = Tdiff.Slice(0, 0, 3).Slice(1, 3, 4);
     EXPECT_LE(Ttrans.T().Matmul(Ttrans).Item<double>(), 5e-5);
 }
+
+TEST_P(OdometryPermuteDevices, RGBDOdometryFrame) {
+    core::Device device = GetParam();
+    if (!t::geometry::Image::HAVE_IPPICV &&
+        device.GetType() == core::Device::DeviceType::CPU) {
+        return;
+    }
+
+    const float depth_scale = 1000.0;
+    const float depth_max = 3.0;
+    const float depth_diff = 0.07;
+
+    data::SampleRedwoodRGBDImages redwood_data;
+    std::vector<t::geometry::RGBDImage> rgbds(3);
+    for (size_t i = 0; i < rgbds.size(); ++i) {
+        rgbds[i].depth_ =
+                t::io::CreateImageFromFile(redwood_data.GetDepthPaths()[i])
+                        ->To(device);
+        rgbds[i].color_ =
+                t::io::CreateImageFromFile(redwood_data.GetColorPaths()[i])
+                        ->To(device);
+    }
+
+    core::Tensor intrinsic_t = CreateIntrisicTensor();
+    core::Tensor trans =
+            core::Tensor::Eye(4, core::Float64, core::Device("CPU:0"));
+    std::vector<t::pipelines::odometry::OdometryConvergenceCriteria> criteria{
+            10, 5, 3};
+    t::pipelines::odometry::OdometryLossParams params(depth_diff);
+
+    // Frame to frame tracking, the target of the first call is the source of
+    // the second call.
+    std::vector<t::pipelines::odometry::RGBDOdometryFrame> frames;
+    for (const auto& rgbd : rgbds) {
+        frames.emplace_back(rgbd, intrinsic_t, depth_scale, depth_max,
+                            depth_diff);
+    }
+    EXPECT_EQ(frames[1].GetNumCachedLevels(), 0);
+    for (size_t i = 0; i + 1 < frames.size(); ++i) {
+        auto result_frame = t::pipelines::odometry::RGBDOdometryMultiScale(
+                frames[i], frames[i + 1], trans, criteria,
+                t::pipelines::odometry::Method::Hybrid, params);
+        auto result_image = t::pipelines::odometry::RGBDOdometryMultiScale(
+                rgbds[i], rgbds[i + 1], intrinsic_t, trans, depth_scale,
+                depth_max, criteria, t::pipelines::odometry::Method::Hybrid,
+                params);
+        EXPECT_TRUE(result_frame.transformation_.AllClose(
+                result_image.transformation_));
+        EXPECT_DOUBLE_EQ(result_frame.fitness_, result_image.fitness_);
+    }
+
+    // Maps are computed once per level and then reused.
+    EXPECT_EQ(frames[1].GetNumCachedLevels(), 3);
+    EXPECT_TRUE(frames[1].GetVertexMap(2).IsSame(frames[1].GetVertexMap(2)));
+    EXPECT_TRUE(frames[1].GetIntensityDx(0).IsSame(
+            frames[1].GetIntensityDx(0)));
+    EXPECT_EQ(frames[1].GetDepth(1).GetShape(0) * 2,
+              frames[1].GetDepth(0).GetShape(0));
+
+    // The frames must be built with the threshold of the loss parameters.
+    t::pipelines::odometry::OdometryLossParams other_params(2 * depth_diff);
+    EXPECT_ANY_THROW(t::pipelines::odometry::RGBDOdometryMultiScale(
+            frames[0], frames[1], trans, criteria,
+            t::pipelines::odometry::Method::Hybrid, other_params));
+}
 }  // namespace tests
 }  // namespace open3d
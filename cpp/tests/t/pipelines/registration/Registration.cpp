@@ -311,6 +311,42 @@ TEST_P(RegistrationPermuteDevices, ICPPointToPlane) {
     }
 }
 
+TEST_P(RegistrationPermuteDevices, ICPCorrespondenceCache) {
+    core::Device device = GetParam();
+
+    for (auto dtype : {core::Float32, core::Float64}) {
+        t::geometry::PointCloud source_tpcd(device), target_tpcd(device);
+        std::tie(source_tpcd, target_tpcd) = GetTestPointClouds(dtype, device);
+
+        core::Tensor initial_transform_t =
+                core::Tensor::Init<double>({{0.862, 0.011, -0.507, 0.5},
+                                            {-0.139, 0.967, -0.215, 0.7},
+                                            {0.487, 0.255, 0.835, -1.4},
+                                            {0.0, 0.0, 0.0, 1.0}},
+                                           core::Device("CPU:0"));
+
+        double max_correspondence_dist = 1.5;
+        t_reg::ICPConvergenceCriteria criteria(1e-6, 1e-6, 10);
+
+        t_reg::RegistrationResult reg_full = t_reg::ICP(
+                source_tpcd, target_tpcd, max_correspondence_dist,
+                initial_transform_t,
+                t_reg::TransformationEstimationPointToPlane(), criteria, -1.0);
+
+        // With zero tolerance, only the points whose nearest neighbor may
+        // have changed are searched again, so the result does not change.
+        t_reg::RegistrationResult reg_cached = t_reg::ICP(
+                source_tpcd, target_tpcd, max_correspondence_dist,
+                initial_transform_t,
+                t_reg::TransformationEstimationPointToPlane(), criteria, -1.0,
+                nullptr, 0.0);
+        EXPECT_NEAR(reg_cached.fitness_, reg_full.fitness_, 1e-6);
+        EXPECT_NEAR(reg_cached.inlier_rmse_, reg_full.inlier_rmse_, 1e-4);
+        EXPECT_TRUE(reg_cached.transformation_.AllClose(
+                reg_full.transformation_, 1e-4, 1e-4));
+    }
+}
+
 TEST_P(RegistrationPermuteDevices, ICPColored) {
     core::Device device = GetParam();
 
@@ -560,5 +560,35 @@ TEST(FileSystem, GetPathComponents) {
     EXPECT_EQ(result, expected);
 }
 
+// ----------------------------------------------------------------------------
+// Map a file read-only into memory.
+// ----------------------------------------------------------------------------
+TEST(FileSystem, MappedFile) {
+    std::string file_name =
+            utility::filesystem::GetTempDirectoryPath() + "/mapped_file.bin";
+    const std::string content = "Open3D mapped file";
+
+    FILE *file = utility::filesystem::FOpen(file_name, "wb");
+    fwrite(content.data(), 1, content.size(), file);
+    fclose(file);
+
+    utility::filesystem::MappedFile mapped_file;
+    EXPECT_FALSE(mapped_file.IsOpen());
+    EXPECT_TRUE(mapped_file.Open(file_name));
+    EXPECT_TRUE(mapped_file.IsOpen());
+    EXPECT_EQ(mapped_file.GetSize(), content.size());
+    EXPECT_EQ(std::string(static_cast<const char *>(mapped_file.GetData()),
+                          mapped_file.GetSize()),
+              content);
+
+    mapped_file.Close();
+    EXPECT_FALSE(mapped_file.IsOpen());
+    EXPECT_EQ(mapped_file.GetData(), nullptr);
+    EXPECT_EQ(mapped_file.GetSize(), 0);
+
+    EXPECT_TRUE(utility::filesystem::RemoveFile(file_name));
+    EXPECT_FALSE(mapped_file.Open(file_name));
+}
+
 }  // namespace tests
 }  // namespace open3d
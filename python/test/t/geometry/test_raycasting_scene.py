@@ -233,6 +233,120 @@ def test_compute_occupancy():
     np.testing.assert_allclose(ans.numpy(), [1.0, 0.0])
 
 
+def test_compute_grid():
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(cube)
+
+    min_bound = o3d.core.Tensor([-0.5, -0.4, -0.3], dtype=o3d.core.float32)
+    max_bound = o3d.core.Tensor([1.5, 1.4, 1.3], dtype=o3d.core.float32)
+    resolution = [21, 18, 16]
+
+    # query points at the cell centers with 'ij' indexing
+    cell_size = (max_bound - min_bound).numpy() / resolution
+    axes = [
+        min_bound[i].item() + (np.arange(resolution[i]) + 0.5) * cell_size[i]
+        for i in range(3)
+    ]
+    query_points = o3d.core.Tensor(np.stack(np.meshgrid(*axes, indexing='ij'),
+                                            axis=-1).astype(np.float32))
+
+    sdf = scene.compute_signed_distance_grid(min_bound, max_bound, resolution)
+    assert list(sdf.shape) == resolution
+    np.testing.assert_allclose(
+        sdf.numpy(),
+        scene.compute_signed_distance(query_points).numpy(),
+        rtol=1e-5,
+        atol=1e-6)
+
+    occupancy = scene.compute_occupancy_grid(min_bound, max_bound, resolution)
+    np.testing.assert_equal(occupancy.numpy(),
+                            scene.compute_occupancy(query_points).numpy())
+
+    # streaming the result in chunks gives the same values
+    chunks = []
+    scene.compute_signed_distance_grid(
+        min_bound,
+        max_bound,
+        resolution,
+        lambda begin, chunk: chunks.append((begin, chunk.numpy())),
+        chunk_size=8)
+    assert [begin for begin, _ in chunks] == [0, 8, 16]
+    np.testing.assert_equal(np.concatenate([c for _, c in chunks]),
+                            sdf.numpy())
+
+
+@pytest.mark.parametrize("use_mmap", (False, True))
+def test_save_load(tmp_path, use_mmap):
+    cube = o3d.t.geometry.TriangleMesh.from_legacy(
+        o3d.geometry.TriangleMesh.create_box())
+    vertices = o3d.core.Tensor([[0, 0, 2], [1, 0, 2], [1, 1, 2]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+
+    scene = o3d.t.geometry.RaycastingScene()
+    cube_id = scene.add_triangles(cube)
+    triangle_id = scene.add_triangles(vertices, triangles)
+
+    file_name = str(tmp_path / "scene.bin")
+    scene.save(file_name)
+    restored = o3d.t.geometry.RaycastingScene.load(file_name, use_mmap)
+    restored.commit()
+
+    rays = o3d.core.Tensor([[0.5, 0.5, -1, 0, 0, 1], [0.8, 0.1, 3, 0, 0, -1]],
+                           dtype=o3d.core.float32)
+    ans = scene.cast_rays(rays)
+    restored_ans = restored.cast_rays(rays)
+    assert restored_ans['geometry_ids'][0] == cube_id
+    assert restored_ans['geometry_ids'][1] == triangle_id
+    for k in ans:
+        np.testing.assert_equal(restored_ans[k].numpy(), ans[k].numpy())
+
+    query_points = o3d.core.Tensor([[0.5, 0.5, 0.5], [-0.5, -0.5, -0.5]],
+                                   dtype=o3d.core.float32)
+    np.testing.assert_allclose(
+        restored.compute_signed_distance(query_points).numpy(),
+        scene.compute_signed_distance(query_points).numpy())
+
+
+@pytest.mark.parametrize("use_mmap", (False, True))
+def test_load_corrupted(tmp_path, use_mmap):
+    vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],
+                               dtype=o3d.core.float32)
+    triangles = o3d.core.Tensor([[0, 1, 2]], dtype=o3d.core.uint32)
+    scene = o3d.t.geometry.RaycastingScene()
+    scene.add_triangles(vertices, triangles)
+    scene.add_triangles(vertices, triangles)
+    file_name = tmp_path / "scene.bin"
+    scene.save(str(file_name))
+    data = file_name.read_bytes()
+
+    # The header has 24 bytes and every geometry record 40 bytes, starting
+    # with the 32 bit geometry id and type and the 64 bit number of vertices.
+    duplicate_id = bytearray(data)
+    duplicate_id[64:68] = (0).to_bytes(4, "little")
+    file_name.write_bytes(bytes(duplicate_id))
+    with pytest.raises(RuntimeError):
+        o3d.t.geometry.RaycastingScene.load(str(file_name), use_mmap)
+
+    # A huge number of vertices must not overflow the bounds checks.
+    huge_size = bytearray(data)
+    huge_size[32:40] = (2**62).to_bytes(8, "little")
+    file_name.write_bytes(bytes(huge_size))
+    with pytest.raises(RuntimeError):
+        o3d.t.geometry.RaycastingScene.load(str(file_name), use_mmap)
+
+    # Triangle indices must refer to existing vertices.
+    bad_index = bytearray(data)
+    index_offset = int.from_bytes(data[56:64], "little")
+    bad_index[index_offset:index_offset + 4] = (3).to_bytes(4, "little")
+    file_name.write_bytes(bytes(bad_index))
+    with pytest.raises(RuntimeError):
+        o3d.t.geometry.RaycastingScene.load(str(file_name), use_mmap)
+
+
 @pytest.mark.parametrize("shape", ([11], [1, 2, 3], [32, 14]))
 def test_output_shapes(shape):
     vertices = o3d.core.Tensor([[0, 0, 0], [1, 0, 0], [1, 1, 0]],